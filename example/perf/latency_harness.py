@@ -0,0 +1,173 @@
+# -*- coding: utf-8 -*-
+# End-to-end latency harness for the Fove Python bindings.
+#
+# Drives the backend (the real runtime, or the loopback stub via
+# LD_PRELOAD=.../libfove_stub.so or -DFOVE_PYTHON_USE_STUB=ON) through
+# representative loops and reports per-stage latency percentiles and
+# throughput from the bindings' own instrumentation surfaces, so every site
+# measures latency the same way instead of reinventing the script:
+#
+#   gaze      the classic wait / fetch / getters loop
+#   image     gaze plus the eyes-image fetch and zero-copy array return
+#   snapshot  the FramePump full-snapshot capture with batch drains
+#
+# Per-call stage timings come from `capi.perf_stats()` (log2-bucket histogram
+# percentiles, measured natively around each fove_* call), and the end-to-end
+# data age from `capi.gaze_age_stats()` (host fetch time minus frame timestamp
+# through the clock-sync estimate) -- Python-side timing never perturbs the
+# measurement. Exit status is 0 only if every requested scenario captured
+# frames, so the harness can gate site-acceptance runs:
+#
+#   PYTHONPATH=<build dir> python3 latency_harness.py --frames 1200 --json report.json
+
+from __future__ import absolute_import, division, print_function
+
+import argparse
+import json
+import sys
+import time
+
+from fove import capi
+
+
+def run_gaze(headset, frames):
+    """The classic per-frame loop: wait, fetch, read every gaze channel."""
+    ts = capi.FrameTimestamp()
+    vec = capi.Vec3()
+    ray = capi.Ray()
+    f = capi.Float()
+    state = capi.EyeStateObj()
+    b = capi.Bool()
+    captured = 0
+    for _ in range(frames):
+        if capi.Headset_waitForProcessedEyeFrame(headset) != capi.ErrorCode.None_:
+            time.sleep(0.01)
+            continue
+        capi.Headset_fetchEyeTrackingData(headset, ts)
+        for eye in (capi.Eye.Left, capi.Eye.Right):
+            capi.Headset_getGazeVector(headset, eye, vec)
+            capi.Headset_getPupilRadius(headset, eye, f)
+            capi.Headset_getEyeState(headset, eye, state)
+            capi.Headset_isEyeBlinking(headset, eye, b)
+        capi.Headset_getCombinedGazeRay(headset, ray)
+        capi.Headset_getCombinedGazeDepth(headset, f)
+        captured += 1
+    return captured
+
+
+def run_image(headset, frames):
+    """Gaze loop plus the eyes-image fetch and zero-copy array return."""
+    ts = capi.FrameTimestamp()
+    ray = capi.Ray()
+    captured = 0
+    for _ in range(frames):
+        if capi.Headset_waitForProcessedEyeFrame(headset) != capi.ErrorCode.None_:
+            time.sleep(0.01)
+            continue
+        capi.Headset_fetchEyeTrackingData(headset, ts)
+        capi.Headset_getCombinedGazeRay(headset, ray)
+        capi.Headset_fetchEyesImage(headset, ts)
+        err, _timestamp, array = capi.Headset_getEyesImageArray(headset)
+        if err == capi.ErrorCode.None_ and array is not None:
+            _ = array[0]  # touch the aliased buffer before the next fetch
+        captured += 1
+    return captured
+
+
+def run_snapshot(headset_obj, frames):
+    """FramePump full-snapshot capture, drained in batches at ~20 Hz."""
+    pump = capi.FramePump(4096)
+    err = pump.start(headset_obj)
+    if err != capi.ErrorCode.None_:
+        print("latency_harness: FramePump.start failed: {}".format(err), file=sys.stderr)
+        return 0
+    captured = 0
+    try:
+        while captured < frames:
+            time.sleep(0.05)
+            captured += len(pump.drain())
+            if not pump.running:
+                break
+    finally:
+        pump.stop()
+    return captured
+
+
+SCENARIOS = [
+    ("gaze", run_gaze),
+    ("image", run_image),
+    ("snapshot", run_snapshot),
+]
+
+
+def run_scenario(name, loop, headset, frames):
+    capi.perf_reset()
+    capi.gaze_age_reset()
+    start = time.monotonic()
+    captured = loop(headset, frames)
+    elapsed = time.monotonic() - start
+    return {
+        "frames": captured,
+        "seconds": round(elapsed, 3),
+        "frames_per_second": round(captured / elapsed, 1) if elapsed > 0 else 0.0,
+        "stages_ns": capi.perf_stats(),
+        "gaze_age_us": capi.gaze_age_stats(),
+    }
+
+
+def print_report(name, report):
+    print("== {}: {} frames in {} s ({} fps)".format(
+        name, report["frames"], report["seconds"], report["frames_per_second"]))
+    age = report["gaze_age_us"]
+    if age.get("count"):
+        print("  gaze age us: p50={} p95={} p99={} max={}".format(
+            age["p50_us"], age["p95_us"], age["p99_us"], age["max_us"]))
+    for stage, entry in sorted(report["stages_ns"].items()):
+        print("  {:44s} n={:<7d} p50={:<8d} p95={:<8d} p99={:<8d} ns".format(
+            stage, entry["count"], entry["p50_ns"], entry["p95_ns"], entry["p99_ns"]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--frames", type=int, default=600,
+                        help="frames to capture per scenario (default: 600, ~5 s at 120 Hz)")
+    parser.add_argument("--scenario", choices=[name for name, _ in SCENARIOS] + ["all"],
+                        default="all", help="which loop to drive (default: all)")
+    parser.add_argument("--json", metavar="PATH",
+                        help="also write the full report as JSON, for site-acceptance records")
+    args = parser.parse_args()
+
+    headset = capi.Fove_Headset()
+    err = capi.createHeadset(
+        capi.ClientCapabilities.EyeTracking + capi.ClientCapabilities.EyesImage, headset)
+    if err != capi.ErrorCode.None_:
+        print("latency_harness: createHeadset failed: {}".format(err), file=sys.stderr)
+        return 1
+
+    capi.perf_enable(True)
+    reports = {}
+    try:
+        for name, loop in SCENARIOS:
+            if args.scenario not in ("all", name):
+                continue
+            reports[name] = run_scenario(name, loop, headset, args.frames)
+            print_report(name, reports[name])
+    finally:
+        capi.perf_enable(False)
+        capi.Headset_destroy(headset)
+
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump(reports, f, indent=2, sort_keys=True)
+        print("report written to {}".format(args.json))
+
+    failed = [name for name, report in reports.items() if report["frames"] == 0]
+    if failed:
+        print("latency_harness: no frames captured in: {}".format(", ".join(failed)),
+              file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
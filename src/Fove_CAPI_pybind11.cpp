@@ -2,6 +2,8 @@
 #include <FoveAPI.h>
 #include <pybind11/pybind11.h>
 
+#include <mutex>
+
 #include "bindings.h"
 
 #pragma warning(disable : 4996)
@@ -10,18 +12,73 @@ namespace FovePython
 {
 namespace py = pybind11;
 
+namespace
+{
+
+// The Headset_*/Compositor_* function table (~150 functions with multi-kilobyte
+// docstrings) dominates import time, yet most tools touch only a handful of
+// them. We register it lazily on the first missing-attribute lookup (PEP 562
+// module __getattr__), which also defers interning all those docstrings; the
+// struct and enum types stay eager since the function signatures refer to them.
+std::once_flag lazyBindFlag;
+
+void bindFunctionTable(py::module_ m)
+{
+	std::call_once(lazyBindFlag, [&m] {
+		bind_CAPIs(m);
+		bind_BatchMath(m);
+		bind_BitmapDecode(m);
+		bind_Perf(m);
+		bind_ErrorPolicy(m);
+		bind_Log(m);
+		bind_ClockSync(m);
+		bind_GazeEvents(m);
+		bind_GazeFilter(m);
+		bind_PupilStats(m);
+		bind_ColumnExport(m);
+	});
+}
+
+} // namespace
+
 // This module is to be called `fove.capi` (i.e. `fove/capi.so`) within the `fove` SDK package.
-PYBIND11_MODULE(capi, m)
+//
+// The module is declared safe for free-threaded CPython (no GIL): the binding layer
+// keeps no mutable global state — the Obj<T> wrappers and the default-value helpers
+// are all per-instance or return fresh values, and the pump/recorder subsystems use
+// their own locks and atomics. Concurrent calls on the *same* wrapper object are the
+// caller's responsibility, as with any Python object.
+PYBIND11_MODULE(capi, m, py::mod_gil_not_used())
 {
+	// Subinterpreter embedding: the vendored pybind11 (2.x) initializes modules
+	// single-phase and keeps its type registry in process-wide state, so a
+	// second interpreter importing this module would die deep inside pybind11
+	// on a duplicate type registration (or crash later sharing unsynchronized
+	// per-process statics under per-interpreter GILs). Refuse the import up
+	// front with an actionable error instead. Hosts that want one module per
+	// plugin interpreter need the multi-phase init of pybind11 3.x
+	// (py::multiple_interpreters::per_interpreter_gil()); until that upgrade,
+	// embed fove.capi in the main interpreter (it is free-threading safe, see
+	// below) or give plugins separate processes.
+	if (PyInterpreterState_Get() != PyInterpreterState_Main())
+		throw py::import_error(
+			"fove.capi cannot be imported into a Python subinterpreter: the module uses "
+			"single-phase initialization with process-wide binding state. Import it from "
+			"the main interpreter (safe under free-threaded CPython) or from a separate process.");
+
 	m.doc() = "Python binding to the Fove SDK API";
 
 	defstruct_Headsets(m);
+#if FOVE_HAS_FEATURE(FOVE_FEATURE_COMPOSITOR)
 	defstruct_Compositor(m);
+#endif
 
 	// structures
 	defenum_ClientCapabilities(m);
 	defenum_ErrorCode(m);
+#if FOVE_HAS_FEATURE(FOVE_FEATURE_COMPOSITOR)
 	defenum_CompositorLayerType(m);
+#endif
 	defenum_ObjectGroup(m);
 
 	defstruct_Versions(m);
@@ -42,6 +99,7 @@ PYBIND11_MODULE(capi, m)
 
 	defstruct_ProjectionParams(m);
 
+#if FOVE_HAS_FEATURE(FOVE_FEATURE_GAZABLE_OBJECTS)
 	defstruct_BoundingBox(m);
 	defstruct_ObjectPose(m);
 	defenum_ColliderType(m);
@@ -51,7 +109,9 @@ PYBIND11_MODULE(capi, m)
 	defstruct_ObjectCollider(m);
 	defstruct_GazableObject(m);
 	defstruct_CameraObject(m);
+#endif
 
+#if FOVE_HAS_FEATURE(FOVE_FEATURE_COMPOSITOR)
 	defenum_GraphicsAPI(m);
 	defenum_AlphaMode(m);
 	defstruct_CompositorLayerCreateInfo(m);
@@ -66,6 +126,7 @@ PYBIND11_MODULE(capi, m)
 	defstruct_CompositorLayerEyeSubmitInfo(m);
 	defstruct_CompositorLayerSubmitInfo(m);
 	defstruct_AdapterId(m);
+#endif
 
 	defstruct_Buffer(m);
 
@@ -73,18 +134,70 @@ PYBIND11_MODULE(capi, m)
 	defstruct_PupilShape(m);
 	defstruct_BitmapImage(m);
 
-	defstruct_CalibrationTarget(m);
+	// CalibrationState stays in every build: the state query (and the reusable
+	// wrapper in Scratch) is part of the eye-data surface, unlike the rendering
 	defenum_CalibrationState(m);
+#if FOVE_HAS_FEATURE(FOVE_FEATURE_CALIBRATION_GUI)
+	defstruct_CalibrationTarget(m);
 	defenum_CalibrationMethod(m);
 	defenum_EyeByEyeCalibration(m);
 	defenum_EyeTorsionCalibration(m);
 	defstruct_CalibrationData(m);
 	defstruct_CalibrationOptions(m);
 	defstruct_HmdAdjustmentData(m);
+#endif
+
+	defstruct_Dtypes(m); // structured dtypes must precede the batch types below
+	defstruct_EyeTrackingSnapshot(m);
+	defstruct_StartupInfo(m);
+	defstruct_FramePump(m);
+	defstruct_FrameAligner(m);
+	defstruct_HeadsetGroup(m);
+	defstruct_Recorder(m);
+	defstruct_ReplayHeadset(m);
+	defstruct_FrameWaiter(m);
+#if FOVE_HAS_FEATURE(FOVE_FEATURE_COMPOSITOR)
+	defstruct_CompositorWaiter(m);
+#endif
+	defstruct_PoseBuffer(m);
+	defstruct_PosePump(m);
+	defstruct_ConnectionSupervisor(m);
+#if FOVE_HAS_FEATURE(FOVE_FEATURE_GAZABLE_OBJECTS)
+	defstruct_GazeCastScene(m);
+#endif
+	defstruct_Heatmap(m);
+	defstruct_Scanpath(m);
+	defstruct_ArrowBatch(m);
+	defstruct_Relay(m);
+	defstruct_ImageStream(m);
+	defstruct_SnapshotBus(m);
+#if FOVE_HAS_FEATURE(FOVE_FEATURE_COMPOSITOR)
+	defstruct_SubmitContext(m);
+#endif
 
 	defstruct_Wrappers(m);
-
-	bind_CAPIs(m);
+	defstruct_Scratch(m);
+
+	// Which optional groups this build bound (see the FOVE_FEATURE_* bits in
+	// bindings.h), so client code can feature-test a slim module up front
+	// instead of probing the lazy function table attribute by attribute
+	m.attr("FEATURE_COMPOSITOR") = FOVE_FEATURE_COMPOSITOR;
+	m.attr("FEATURE_CALIBRATION_GUI") = FOVE_FEATURE_CALIBRATION_GUI;
+	m.attr("FEATURE_GAZABLE_OBJECTS") = FOVE_FEATURE_GAZABLE_OBJECTS;
+	m.attr("bound_features") = int(FOVE_BINDINGS_FEATURES);
+
+	// The function table is bound on first use; see bindFunctionTable above
+	m.attr("__getattr__") = py::cpp_function([m](const std::string& name) -> py::object {
+		bindFunctionTable(m);
+		const py::dict dict = m.attr("__dict__");
+		if (dict.contains(name))
+			return dict[py::str(name)];
+		throw py::attribute_error("module 'fove.capi' has no attribute '" + name + "'");
+	});
+	m.attr("__dir__") = py::cpp_function([m]() -> py::object {
+		bindFunctionTable(m);
+		return py::list(m.attr("__dict__"));
+	});
 }
 
 } // namespace FovePython
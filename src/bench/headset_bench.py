@@ -0,0 +1,154 @@
+# Python-level regression benchmark for the fove.headset wrapper layer.
+#
+# The C++ microbenchmarks (bindings_bench.cpp) cover the binding lambdas;
+# this suite measures what a Python client actually pays per call: wrapper
+# dispatch in headset.py, the Obj<T> out-parameter round-trip, Result
+# construction, and the pump drain / columnar numpy conversion. It runs the
+# hot Headset surface against the loopback stub backend and records ops/sec
+# per method, compared against a JSON baseline so wrapper regressions are
+# caught per release. Run against a stub build:
+#
+#     cmake -B build-bench -DFOVE_PYTHON_USE_STUB=ON
+#     cmake --build build-bench
+#     PYTHONPATH=build-bench python3 src/bench/headset_bench.py --update-baseline
+#     ... after a change ...
+#     PYTHONPATH=build-bench python3 src/bench/headset_bench.py
+#
+# Exits nonzero when any benchmark regresses by more than --threshold
+# (default 25%) against the baseline. Ops/sec are machine-dependent; keep
+# baselines per machine and out of version control.
+
+import argparse
+import json
+import os
+import sys
+import time
+
+from fove import capi
+from fove.headset import Headset, Result
+
+
+DEFAULT_BASELINE = os.path.join(os.path.dirname(os.path.abspath(__file__)), "headset_bench_baseline.json")
+
+
+def time_ops_per_sec(fn, min_time: float = 0.2, repeats: int = 3) -> float:
+    # Calibrate the iteration count so one repeat takes roughly min_time,
+    # then report the best repeat (least scheduling noise)
+    n = 1
+    while True:
+        begin = time.perf_counter()
+        for _ in range(n):
+            fn()
+        elapsed = time.perf_counter() - begin
+        if elapsed >= min_time / 4 or n >= 1 << 22:
+            break
+        n *= 4
+    best = float("inf")
+    for _ in range(repeats):
+        begin = time.perf_counter()
+        for _ in range(n):
+            fn()
+        best = min(best, time.perf_counter() - begin)
+    return n / best
+
+
+def collect_pump_batch(headset_obj):
+    # Captures ~half a second of stub frames so the conversion benchmarks
+    # below run over a realistically sized batch
+    pump = capi.FramePump(256)
+    pump.start(headset_obj)
+    time.sleep(0.5)
+    batch = pump.drain()
+    pump.stop()
+    return batch
+
+
+def build_benchmarks(h: Headset):
+    left = capi.Eye.Left
+    benches = [
+        ("fetchEyeTrackingData", h.fetchEyeTrackingData),
+        ("getGazeVector", lambda: h.getGazeVector(left)),
+        ("getGazeScreenPosition", lambda: h.getGazeScreenPosition(left)),
+        ("getCombinedGazeRay", h.getCombinedGazeRay),
+        ("getCombinedGazeDepth", h.getCombinedGazeDepth),
+        ("getPupilRadius", lambda: h.getPupilRadius(left)),
+        ("getEyeState", lambda: h.getEyeState(left)),
+        ("isUserPresent", h.isUserPresent),
+        ("isEyeTrackingEnabled", h.isEyeTrackingEnabled),
+        # Result construction and validity checking in isolation, so a
+        # regression here is attributable to the wrapper rather than a binding
+        ("result_handling", lambda: Result(1.0).isValid()),
+    ]
+
+    batch = collect_pump_batch(h._headset)
+    if len(batch):
+        benches.append(("export_columns", lambda: capi.export_columns(batch)))
+    else:
+        print("headset_bench: pump captured no frames; skipping export_columns", file=sys.stderr)
+    return benches
+
+
+def run(baseline_path: str, update_baseline: bool, threshold: float) -> int:
+    results = {}
+    with Headset(Headset.ET_CAPS) as h:
+        # Let the stub produce a first frame so the getters return real data
+        h.waitForProcessedEyeFrame()
+        h.fetchEyeTrackingData()
+        for name, fn in build_benchmarks(h):
+            results[name] = time_ops_per_sec(fn)
+
+    baseline = {}
+    if os.path.exists(baseline_path):
+        with open(baseline_path) as f:
+            baseline = json.load(f)
+
+    regressions = []
+    for name in sorted(results):
+        ops = results[name]
+        line = "{:24s} {:>14,.0f} ops/s".format(name, ops)
+        if name in baseline and baseline[name] > 0:
+            change = ops / baseline[name] - 1.0
+            line += "  {:+6.1f}% vs baseline".format(change * 100)
+            if change < -threshold:
+                regressions.append(name)
+                line += "  REGRESSION"
+        print(line)
+
+    if update_baseline:
+        with open(baseline_path, "w") as f:
+            json.dump(results, f, indent=2, sort_keys=True)
+            f.write("\n")
+        print("headset_bench: baseline written to {}".format(baseline_path))
+        return 0
+
+    if not baseline:
+        print("headset_bench: no baseline at {}; run with --update-baseline to record one".format(baseline_path))
+        return 0
+
+    if regressions:
+        print("headset_bench: {} benchmark(s) regressed more than {:.0f}%: {}".format(
+            len(regressions), threshold * 100, ", ".join(regressions)))
+        return 1
+    return 0
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="fove.headset wrapper-layer benchmark (stub backend)")
+    parser.add_argument("--baseline", default=DEFAULT_BASELINE, help="baseline JSON path")
+    parser.add_argument("--update-baseline", action="store_true", help="record the current results as the baseline")
+    parser.add_argument("--threshold", type=float, default=0.25,
+                        help="relative ops/sec drop that counts as a regression (default 0.25)")
+    args = parser.parse_args()
+
+    probe = capi.Fove_Headset()
+    err = capi.createHeadset(capi.ClientCapabilities.None_, probe)
+    if err != capi.ErrorCode.None_:
+        print("headset_bench: createHeadset failed: {} (build with -DFOVE_PYTHON_USE_STUB=ON)".format(err))
+        return 1
+    capi.Headset_destroy(probe)
+
+    return run(args.baseline, args.update_baseline, args.threshold)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,87 @@
+# PGO training workload for the Python bindings.
+#
+# Drives the dispatch-heavy paths of fove.capi (per-frame fetch + getters,
+# the frame pump, batch math, struct construction) against the loopback stub
+# backend, so a profile-guided build lays out the hot binding lambdas from a
+# realistic 120 Hz loop. Run against a module built with:
+#
+#     cmake -B build-pgo -DFOVE_PYTHON_USE_STUB=ON -DFOVE_PYTHON_PGO=generate
+#     cmake --build build-pgo
+#     PYTHONPATH=build-pgo python3 src/bench/pgo_train.py
+#
+# then rebuild with -DFOVE_PYTHON_PGO=use (see CMakeLists.txt). The workload
+# is deterministic apart from thread scheduling; ~10 s wall time.
+
+import sys
+
+from fove import capi
+
+
+FRAMES = 1200  # ~10 s of the stub's 120 Hz clock
+
+
+def train_getters(headset) -> None:
+    ts = capi.FrameTimestamp()
+    vec = capi.Vec3()
+    vec2 = capi.Vec2()
+    ray = capi.Ray()
+    b = capi.Bool()
+    f = capi.Float()
+    state = capi.EyeStateObj()
+    for _ in range(FRAMES):
+        capi.Headset_waitForProcessedEyeFrame(headset)
+        capi.Headset_fetchEyeTrackingData(headset, ts)
+        for eye in (capi.Eye.Left, capi.Eye.Right):
+            capi.Headset_getGazeVector(headset, eye, vec)
+            capi.Headset_getGazeVectorRaw(headset, eye, vec)
+            capi.Headset_getGazeScreenPosition(headset, eye, vec2)
+            capi.Headset_getPupilRadius(headset, eye, f)
+            capi.Headset_getEyeState(headset, eye, state)
+            capi.Headset_isEyeBlinking(headset, eye, b)
+        capi.Headset_getCombinedGazeRay(headset, ray)
+        capi.Headset_getCombinedGazeDepth(headset, f)
+        capi.Headset_isUserPresent(headset, b)
+
+
+def train_pump(headset_obj) -> None:
+    import time
+
+    pump = capi.FramePump(256)
+    pump.start(headset_obj)
+    deadline = time.monotonic() + 2.0
+    while time.monotonic() < deadline:
+        time.sleep(0.05)
+        batch = pump.drain()
+        if len(batch):
+            capi.export_columns(batch)
+    pump.stop()
+
+
+def train_batch_math() -> None:
+    import numpy as np
+
+    directions = np.tile(np.array([0.0, 0.0, 1.0], dtype=np.float32), (1024, 1))
+    quats = np.tile(np.array([0.0, 0.0, 0.0, 1.0], dtype=np.float32), (1024, 1))
+    for _ in range(100):
+        capi.quat_rotate_vec3(quats, directions)
+        capi.vec3_normalize(directions)
+
+
+def main() -> int:
+    headset = capi.Fove_Headset()
+    err = capi.createHeadset(capi.ClientCapabilities.EyeTracking, headset)
+    if err != capi.ErrorCode.None_:
+        print("pgo_train: createHeadset failed: {} (build with -DFOVE_PYTHON_USE_STUB=ON)".format(err))
+        return 1
+    try:
+        train_getters(headset)
+        train_pump(headset)
+        train_batch_math()
+    finally:
+        capi.Headset_destroy(headset)
+    print("pgo_train: done ({} frames)".format(FRAMES))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
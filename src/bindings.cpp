@@ -1,64 +1,41 @@
-// Note:
-// - The C API provides a canonical API to which other language bindings are made
-// - The C++ API is a bit special in that (currently) it is not really a binding to the C API
-//   but defined by sharing codes with the C API
-// - Here, we bind to the C API compiled as C++ codes; this in particular means:
-//   - C++ APIs are not defined
-//   - `FoveAPI.h` is pulled in with `FOVE_DEFINE_CXX_API` set to false (0)
-//   - Structs exclusively uses containment than inheritance;
-//     but they are compiled as C++, so that we can use member pointers
-//   - Enums are C++ enum class (for symmetry and better type safety);
-//     but this comes at a cost of we having have to duplicate some functions
-//     that operates on some enums (`operator|` for ClientCapabilities etc.)
-//   - Maybe systematically expose a fraction of CXX_API to python bindings using
-//     FOVE_PYTHON_BINDINGS cpp flag?
-//
-// Note2: On initialization of objects
-// - As a matter of principle, we prefer to have objects initialized properly
-//   as soon as they get constructed.  This is certainly so when objects in concern
-//   have sensible defaults; even if not (e.g. `Fove_Versions`) we prefer them
-//   (as a matter of taste) to be initialized to arbitrary but predictable values,
-//   with possible exceptions that doing so may incur significant performance penalties.
-// - So, it would nice if we could initialize structs in `FoveAPI.h`
-//   with their non-static data member initializers (NSDMI) as in the C++ API.
-// - In C++11, however, we cannot aggregate initialize (Struct x = {...}) objects
-//   with NSDMIs. (In C++14, we can.)
-// - We do not want to force our clients to use C++14. (We do force C++11, or later)
-// - So when we use NSDMI, `pybind11` ctors like
-//   ```
-//   py::class_<C>(..)
-//     .def(py::init<Arg>(py::arg("arg0") = ..))
-//   ```
-//   chokes (should choke) when we compile in a strict C++11 mode.
-// - There is `py::class_<C>(..).def(py::init([](Arg arg0, ..) { .. }))`, but it does not appear
-//   to provide a handle for controlling keyword argument names as of yet.
-// - There are two choices at this point:
-//   (1) give up NSDMI on the C++ layer and (repeat and) inject default values from this file to `FoveAPI.h`
-//   (2) use NSDMI and provide `py::init<>()` and `py::init([](Args..) {..})`
-//   And both have pros and cons.
-// - Bottom line: Choose (1) for now.
-//   (Would be more python user friendly, in case we ever ended up opening up `fove.capi` to users)
-// - [Remark: for those that do not have sensible defaults (e.g. `Fove_Versions`, `Fove_Matrix44`)
-//    we do not really care and just provide a default constructor.]
-#define FOVE_DEFINE_CXX_API 0
-#define FOVE_CXX_NAMESPACE SHOULD_CAUSE_SYNTAX_ERROR_WHEN_USED !
-#define FOVE_EXTERN_C extern "C"
-#define FOVE_ENUM(enumName) enum class Fove_##enumName
-#define FOVE_ENUM_VAL(enumName, valueName) valueName
-#define FOVE_ENUM_END(enumName) ;
-#define FOVE_STRUCT(structName) struct Fove_##structName
-// We do not set default values upon constructions although we are in a C++ mode;
-// see the comments above for a rationale.
-// #define FOVE_STRUCT_VAL(memberName, defaultVal) memberName = defaultVal
-#define FOVE_STRUCT_VAL(memberName, defaultVal) memberName;
-#define FOVE_STRUCT_END(structName) ;
-#define FOVE_STRUCT_END_NO_CXX_ALIAS(structName) ;
-#include <FoveAPI.h>
-
+// The headset-facing bindings and the stateful subsystems (gaze history and
+// events, frame pump/aligner, recorder and relay, streams, compositor fast
+// path). The FoveAPI.h inclusion mode, the Obj<T> wrapper and the perf
+// instrumentation shared by all binding TUs live in bindings_common.h; the
+// plain struct/enum registrations in bindings_structs.cpp, the diagnostics in
+// bindings_diag.cpp and the compute kernels in bindings_math.cpp.
+#include "bindings_common.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cctype>
 #include <cmath>
+#include <limits>
 #include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <map>
 #include <memory>
+#include <unordered_map>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
 #include <sstream>
+#include <string_view>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -68,12 +45,6 @@
 
 using namespace std;
 
-// FoveAPI.h uses these names to define opaque types.
-// We do not really need define these, but pybind11 requires them to be defined.
-// clang-format off
-struct Fove_Headset_{};
-struct Fove_Compositor_{};
-// clang-format on
 
 namespace Fove
 {
@@ -85,1893 +56,9322 @@ bool logWriteToStdoutDefault = false;
 
 namespace FovePython
 {
-namespace py = pybind11;
-
-namespace
-{
-
-// pybind11 does not support like C arrays and C double pointers, so we wrap
-// structs that contains those in an Obj.
-// Also, primitive types such as bool, int, .. are immutable, so we wrap them
-// as well.
-template <typename T>
-struct Obj
-{
-	T val;
-	operator T&() { return val; }
-	operator T*() { return &val; }
-};
-
-// clang-format off
-template <typename T>
-bool operator==(const Obj<T>& a, const Obj<T>& b) { return a.val == b.val; }
-template <typename T>
-bool operator!=(const Obj<T>& a, const Obj<T>& b) { return !(a.val == b.val); }
-// clang-format on
-
-} // namespace
 
 ////////////////////////////////////////////////////////////////
-// structures
-
-// copied from FoveAPI.h
-inline constexpr Fove_ClientCapabilities operator|(Fove_ClientCapabilities a, Fove_ClientCapabilities b) { return static_cast<Fove_ClientCapabilities>(static_cast<int>(a) | static_cast<int>(b)); }
-inline constexpr Fove_ClientCapabilities operator&(Fove_ClientCapabilities a, Fove_ClientCapabilities b) { return static_cast<Fove_ClientCapabilities>(static_cast<int>(a) & static_cast<int>(b)); }
-inline constexpr Fove_ClientCapabilities operator~(Fove_ClientCapabilities a) { return static_cast<Fove_ClientCapabilities>(~static_cast<int>(a)); }
-inline constexpr Fove_ObjectGroup operator|(Fove_ObjectGroup a, Fove_ObjectGroup b) { return static_cast<Fove_ObjectGroup>(static_cast<int>(a) | static_cast<int>(b)); }
-inline constexpr Fove_ObjectGroup operator&(Fove_ObjectGroup a, Fove_ObjectGroup b) { return static_cast<Fove_ObjectGroup>(static_cast<int>(a) & static_cast<int>(b)); }
-inline constexpr Fove_ObjectGroup operator~(Fove_ObjectGroup a) { return static_cast<Fove_ObjectGroup>(~static_cast<int>(a)); }
+// Capability cache
 
 namespace
 {
 
-std::ostream& operator<<(std::ostream& out, const Fove_Versions& v)
-{
-	out << "<Versions:"
-		<< " client: " << v.clientMajor << '.' << v.clientMinor << '.' << v.clientBuild
-		<< ", runtime: " << v.runtimeMajor << '.' << v.runtimeMinor << '.' << v.runtimeBuild
-		<< ", protocol: " << v.clientProtocol
-		<< ", min_firmware: " << v.minFirmware
-		<< ", max_firmware: " << v.maxFirmware
-		<< ", too_old_headset: " << v.tooOldHeadsetConnected
-		<< ">";
-	return out;
-};
-std::ostream& operator<<(std::ostream& out, const Fove_Quaternion& self)
-{
-	out << "<Quaternion: " << self.x << ", " << self.y << ", " << self.z << ", " << self.w << ">";
-	return out;
-}
-std::ostream& operator<<(std::ostream& out, const Fove_Vec3& self)
-{
-	out << "<Vec3: " << self.x << ", " << self.y << ", " << self.z << ">";
-	return out;
-}
-std::ostream& operator<<(std::ostream& out, const Fove_Vec2& self)
-{
-	out << "<Vec2: " << self.x << ", " << self.y << ">";
-	return out;
-}
-std::ostream& operator<<(std::ostream& out, const Fove_Vec2i& self)
-{
-	out << "<Vec2i: " << self.x << ", " << self.y << ">";
-	return out;
-}
-std::ostream& operator<<(std::ostream& out, const Fove_Ray& self)
-{
-	out << "<Ray: " << self.origin << ", " << self.direction << ">";
-	return out;
-}
-std::ostream& operator<<(std::ostream& out, const Fove_FrameTimestamp& self)
-{
-	out << "<FrameTimestamp: "
-		<< "id: " << self.id
-		<< ", timestamp: " << self.timestamp
-		<< ">";
-	return out;
-}
-std::ostream& operator<<(std::ostream& out, const Fove_Pose& self)
-{
-	out << "<Pose: "
-		<< "id: " << self.id
-		<< ", timestamp: " << self.timestamp
-		<< ", orientation: " << self.orientation
-		<< ", angularVelocity: " << self.angularVelocity
-		<< ", angularAcceleration: " << self.angularAcceleration
-		<< ", position: " << self.position
-		<< ", standingPosition: " << self.standingPosition
-		<< ", velocity: " << self.velocity
-		<< ", acceleration: " << self.acceleration
-		<< ">";
-	return out;
-}
-std::ostream& operator<<(std::ostream& out, const Fove_ProjectionParams& self)
-{
-	out << "<ProjectionParams: "
-		<< "left: " << self.left
-		<< ", right: " << self.right
-		<< ", top: " << self.top
-		<< ", bottom: " << self.bottom
-		<< ">";
-	return out;
-}
-std::ostream& operator<<(std::ostream& out, const Fove_BoundingBox& self)
-{
-	out << "<BoundingBox: "
-		<< "center: " << self.center
-		<< ", extend: " << self.extend
-		<< ">";
-	return out;
-}
-std::ostream& operator<<(std::ostream& out, const Fove_ObjectPose& self)
+// Tracks the active capabilities this client is known to have registered, per
+// headset, so that redundant register/unregister calls from independent plugin
+// components are answered locally instead of with an IPC round-trip. Every
+// binding that registers capabilities (createHeadset, Headset_register/
+// unregisterCapabilities, and the pump/recorder start paths) updates the cache
+// on success, so it is exact as long as the headset is driven through this
+// module; pass force=True to bypass it.
+std::mutex capabilityCacheMutex;
+std::unordered_map<Fove_Headset*, Fove_ClientCapabilities> capabilityCache;
+
+void noteCapabilitiesRegistered(Fove_Headset* const headset, const Fove_ClientCapabilities caps)
 {
-	out << "<ObjectPose: "
-		<< "scale: " << self.scale
-		<< ", rotation: " << self.rotation
-		<< ", position: " << self.position
-		<< ", velocity: " << self.velocity
-		<< ">";
-	return out;
+	std::lock_guard<std::mutex> lock(capabilityCacheMutex);
+	Fove_ClientCapabilities& mask = capabilityCache[headset];
+	mask = mask | caps;
 }
-std::ostream& operator<<(std::ostream& out, const Fove_ColliderCube& self)
+
+void noteCapabilitiesUnregistered(Fove_Headset* const headset, const Fove_ClientCapabilities caps)
 {
-	out << "<ColliderCube: " << self.size << ">";
-	return out;
+	std::lock_guard<std::mutex> lock(capabilityCacheMutex);
+	const auto it = capabilityCache.find(headset);
+	if (it != capabilityCache.end())
+		it->second = it->second & ~caps;
 }
-std::ostream& operator<<(std::ostream& out, const Fove_ColliderSphere& self)
+
+// Returns whether all of caps are already known registered on the headset
+bool capabilitiesAlreadyRegistered(Fove_Headset* const headset, const Fove_ClientCapabilities caps)
 {
-	out << "<ColliderSphere: " << self.radius << ">";
-	return out;
+	std::lock_guard<std::mutex> lock(capabilityCacheMutex);
+	const auto it = capabilityCache.find(headset);
+	return it != capabilityCache.end() && (caps & ~it->second) == Fove_ClientCapabilities::None;
 }
-std::ostream& operator<<(std::ostream& out, const Fove_ColliderMesh& self)
+
+// Returns whether none of caps are known registered on the headset
+bool capabilitiesAlreadyUnregistered(Fove_Headset* const headset, const Fove_ClientCapabilities caps)
 {
-	out << "<ColliderMesh: "
-		<< "VextexCount: " << self.vertexCount
-		<< ", TriangleCount: " << self.triangleCount
-		<< ", BoundingBox: " << self.boundingBox
-		<< ">";
-	return out;
+	std::lock_guard<std::mutex> lock(capabilityCacheMutex);
+	const auto it = capabilityCache.find(headset);
+	return it != capabilityCache.end() && (caps & it->second) == Fove_ClientCapabilities::None;
 }
-std::ostream& operator<<(std::ostream& out, const Fove_GazableObject& self)
+
+// Returns the capabilities known registered on the headset, None if unknown
+Fove_ClientCapabilities registeredCapabilities(Fove_Headset* const headset)
 {
-	out << "<GazableObject: "
-		<< "Id: " << self.id
-		<< ", Pose: " << self.pose
-		<< ", Group: " << std::hex << static_cast<unsigned>(self.group)
-		<< ", ColliderCount: " << self.colliderCount
-		<< ">";
-	return out;
+	std::lock_guard<std::mutex> lock(capabilityCacheMutex);
+	const auto it = capabilityCache.find(headset);
+	return it != capabilityCache.end() ? it->second : Fove_ClientCapabilities::None;
 }
-std::ostream& operator<<(std::ostream& out, const Fove_CameraObject& self)
+
+void forgetCapabilities(Fove_Headset* const headset)
 {
-	out << "<GazableObject: "
-		<< "Id: " << self.id
-		<< ", Pose: " << self.pose
-		<< ", GroupMask: " << std::hex << static_cast<unsigned>(self.groupMask)
-		<< ">";
-	return out;
+	std::lock_guard<std::mutex> lock(capabilityCacheMutex);
+	capabilityCache.erase(headset);
 }
-std::ostream& operator<<(std::ostream& out, const Fove_ObjectCollider& self)
+
+////////////////////////////////////////////////////////////////
+// Shared service connection
+
+// Defined in the startup-info section below; joins the warm-start
+// revalidation thread of the headset (if any) so the native handle cannot be
+// destroyed out from under an in-flight query
+void forgetWarmRevalidation(Fove_Headset* headset);
+
+// One process-wide service connection shared by cooperating clients. A full
+// fove_createHeadset handshake costs hundreds of milliseconds, which test
+// suites and plugin hosts creating short-lived Headset wrappers pay over and
+// over; acquire() hands every holder the same Fove_Headset* and only
+// registers whichever requested capabilities no current holder covers yet.
+// release() unregisters the capabilities no remaining holder needs and
+// destroys the connection with the last holder.
+class SharedHeadsetPool
 {
-	out << "<ObjectCollider: "
-		<< "Center: " << self.center;
-		// << ", ShapeType: " << Fove::stringForEnum(self.shapeType);
-	switch (self.shapeType)
+public:
+	Fove_ErrorCode acquire(const Fove_ClientCapabilities caps, Fove_Headset*& outHeadset)
 	{
-		case Fove_ColliderType::Cube:
-			out << ", size: " << self.shapeDefinition.cube.size;
-			break;
-		case Fove_ColliderType::Sphere:
-			out << ", radius: " << self.shapeDefinition.sphere.radius;
-			break;
-		case Fove_ColliderType::Mesh:
-			out << ", VertexCount: " << self.shapeDefinition.mesh.vertexCount;
-			out << ", TriangleCount: " << self.shapeDefinition.mesh.triangleCount;
-			out << ", BoundingBox: " << self.shapeDefinition.mesh.boundingBox;
-			break;
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (!headset_)
+		{
+			Fove_Headset* headset = nullptr;
+			const Fove_ErrorCode err = fove_createHeadset(caps, &headset);
+			if (err != Fove_ErrorCode::None)
+				return err;
+			noteCapabilitiesRegistered(headset, caps);
+			headset_ = headset;
+		}
+		else if ((caps & ~unionCaps()) != Fove_ClientCapabilities::None)
+		{
+			const Fove_ErrorCode err = fove_Headset_registerCapabilities(headset_, caps);
+			if (err != Fove_ErrorCode::None)
+				return err;
+			noteCapabilitiesRegistered(headset_, caps);
+		}
+		holders_.push_back(caps);
+		outHeadset = headset_;
+		return Fove_ErrorCode::None;
 	}
-	out << ">";
 
-	return out;
-}
+	// Balances one acquire; outDestroyed tells the caller the last holder is
+	// gone so it can drop the per-headset caches keyed by the pointer
+	Fove_ErrorCode release(Fove_Headset* const headset, const Fove_ClientCapabilities caps, bool& outDestroyed)
+	{
+		outDestroyed = false;
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (headset_ == nullptr || headset != headset_)
+			return Fove_ErrorCode::API_InvalidArgument;
+		const auto it = std::find(holders_.begin(), holders_.end(), caps);
+		if (it == holders_.end())
+			return Fove_ErrorCode::API_InvalidArgument;
+		holders_.erase(it);
+		if (holders_.empty())
+		{
+			forgetWarmRevalidation(headset_); // drained before the handle dies
+			forgetCapabilities(headset_);
+			const Fove_ErrorCode err = fove_Headset_destroy(headset_);
+			headset_ = nullptr;
+			outDestroyed = true;
+			return err;
+		}
+		// Capability union management: drop the bits no remaining holder needs
+		const Fove_ClientCapabilities unneeded = caps & ~unionCaps();
+		if (unneeded != Fove_ClientCapabilities::None
+			&& fove_Headset_unregisterCapabilities(headset_, unneeded) == Fove_ErrorCode::None)
+			noteCapabilitiesUnregistered(headset_, unneeded);
+		return Fove_ErrorCode::None;
+	}
 
-template <typename T>
-std::string repr(const T& self)
-{
-	std::ostringstream ss;
-	ss << self;
-	return ss.str();
-}
+	size_t holderCount()
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return holders_.size();
+	}
 
-// pybind11 uses __repr__ for generating type signature, and this is done at the declaration time.
-// So to make things work, one has to forward declare classes as in
-// ```
-// auto pyFoo = py::class_<Foo>(m, "Foo");
-// auto pyBar = py::class_<Bar>(m, "Bar");
-//
-// pyFoo.def(py::init<const Bar&>());
-// pyBar.def(py::init<const Foo&>());
-//
-// ```
-// and define __repr__ to generate a string that python understands.
-// Alternatively, we could use `py::arg_v(..)` construct (for now we go this route).
-// refs:
-// - https://pybind11.readthedocs.io/en/latest/advanced/misc.html#avoiding-cpp-types-in-docstrings
-// - https://pybind11.readthedocs.io/en/latest/advanced/functions.html#default-arguments-revisited
-//
-// template <>
-// std::string repr<Fove_Vec3>(const Fove_Vec3& self)
-// {
-// 	std::ostringstream ss;
-// 	ss << "fove.capi.Vec3(0,0,0)";
-// 	return ss.str();
-// }
+private:
+	Fove_ClientCapabilities unionCaps() const
+	{
+		Fove_ClientCapabilities caps = Fove_ClientCapabilities::None;
+		for (const Fove_ClientCapabilities held : holders_)
+			caps = caps | held;
+		return caps;
+	}
 
-} // namespace
+	std::mutex mutex_;
+	Fove_Headset* headset_ = nullptr;
+	std::vector<Fove_ClientCapabilities> holders_; // one entry per live acquisition
+};
 
-// XXX docstring annotation on `py::enum_` `.values` will be supported by pybind11 v2.3.0 on,
-// (which is not released as of now).
-void defenum_ClientCapabilities(py::module& m)
-{
-	py::enum_<Fove_ClientCapabilities>(m, "ClientCapabilities",
-									   R"(List of capabilities usable by clients
-
-Most features require registering for the relevant capability.
-If a client queries data related to a capability it has not registered API_NotRegistered will be returned.
-After a new capability registration the Data_NoUpdate error may be returned for a few frames while
-the service is bootstrapping the new capability.
-
-This enum is designed to be used as a flag set, so items may be binary logic operators like |.
-
-The FOVE runtime will keep any given set of hardware/software running so long as one client is registering a capability.
-
-The registration of a capability does not necessarily mean that the capability is running.
-For example, if no position tracking camera is attached, no position tracking will occur regardless of how many clients registered for it.
-
-- `None_`:  No capabilities requested
-- `OrientationTracking`:  Enables headset orientation tracking
-- `PositionTracking`:  Enables headset position tracking
-- `PositionImage`:  Enables Position camera image transfer from the runtime service to the client
-- `EyeTracking`:  Enables headset eye tracking
-- `GazeDepth`:  Enables gaze depth computation
-- `UserPresence`:  Enables user presence detection
-- `UserAttentionShift`:  Enables user attention shift computation
-- `UserIOD`:  Enables the calculation of the user IOD
-- `UserIPD`:  Enables the calculation of the user IPD
-- `EyeTorsion`:  Enables the calculation of the user eye torsion
-- `EyeShape`:  Enables the detection of the eyes shape
-- `EyesImage`:  Enables Eye camera image transfer from the runtime service to the client
-- `EyeballRadius`:  Enables the calculation of the user eyeball radius
-- `IrisRadius`:  Enables the calculation of the user iris radius
-- `PupilRadius`:  Enables the calculation of the user pupil radius
-- `GazedObjectDetection`:  Enables gazed object detection based on registered gazable objects
-- `DirectScreenAccess`:  Give you direct access to the HMD screen and disable the Fove compositor
-- `PupilShape`:  Enables the detection of the pupil shape
-- `EyeBlink`:  Enables eye blink detection and counting
-)")
-		// XXX symbol None is reserved in python
-		.value("None_", Fove_ClientCapabilities::None)
-		.value("OrientationTracking", Fove_ClientCapabilities::OrientationTracking)
-		.value("PositionTracking", Fove_ClientCapabilities::PositionTracking)
-		.value("PositionImage", Fove_ClientCapabilities::PositionImage)
-		.value("EyeTracking", Fove_ClientCapabilities::EyeTracking)
-		.value("GazeDepth", Fove_ClientCapabilities::GazeDepth)
-		.value("UserPresence", Fove_ClientCapabilities::UserPresence)
-		.value("UserAttentionShift", Fove_ClientCapabilities::UserAttentionShift)
-		.value("UserIOD", Fove_ClientCapabilities::UserIOD)
-		.value("UserIPD", Fove_ClientCapabilities::UserIPD)
-		.value("EyeTorsion", Fove_ClientCapabilities::EyeTorsion)
-		.value("EyeShape", Fove_ClientCapabilities::EyeShape)
-		.value("EyesImage", Fove_ClientCapabilities::EyesImage)
-		.value("EyeballRadius", Fove_ClientCapabilities::EyeballRadius)
-		.value("IrisRadius", Fove_ClientCapabilities::IrisRadius)
-		.value("PupilRadius", Fove_ClientCapabilities::PupilRadius)
-		.value("GazedObjectDetection", Fove_ClientCapabilities::GazedObjectDetection)
-		.value("DirectScreenAccess", Fove_ClientCapabilities::DirectScreenAccess)
-		.value("PupilShape", Fove_ClientCapabilities::PupilShape)
-		.value("EyeBlink", Fove_ClientCapabilities::EyeBlink)
-		.def("__eq__", [](const Fove_ClientCapabilities cap1, const Fove_ClientCapabilities cap2) -> bool {
-			return cap1 == cap2;
-		},
-			 py::is_operator(), "Returns True if two capabilities `cap1` and `cap2` are the same.")
-		.def("__bool__", [](const Fove_ClientCapabilities cap) -> bool {
-			return cap != Fove_ClientCapabilities::None;
-		},
-			 py::is_operator(), "Returns True if a capability `cap`is not Empty")
-		.def("__and__", [](const Fove_ClientCapabilities cap1, const Fove_ClientCapabilities cap2) {
-			return cap1 & cap2;
-		},
-			 py::is_operator(), "Returns the intersection of two capabilities `cap1` and `cap2`.")
-		.def("__or__", [](const Fove_ClientCapabilities cap1, const Fove_ClientCapabilities cap2) {
-			return cap1 | cap2;
-		},
-			 py::is_operator(), "Returns the union of two capabilities `cap1` and `cap2`.")
-		.def("__add__", [](const Fove_ClientCapabilities cap1, const Fove_ClientCapabilities cap2) {
-			return cap1 | cap2;
-		},
-			 py::is_operator(), "Returns the union of two capabilities `cap1` and `cap2`.")
-		.def("__sub__", [](const Fove_ClientCapabilities cap1, const Fove_ClientCapabilities cap2) {
-			return cap1 & ~cap2;
-		},
-			 py::is_operator(), "Returns the capability `cap2` but with `cap1` removed.")
-		.def("__contains__", [](const Fove_ClientCapabilities cap1, const Fove_ClientCapabilities cap2) -> bool {
-			return (cap1 & cap2) == cap2; // cap1 contains cap2, note the order
-		},
-			 py::is_operator(), "Returns `True` if `cap2 in cap1`.");
-}
-
-void defenum_ErrorCode(py::module& m)
-{
-	py::enum_<Fove_ErrorCode>(m, "ErrorCode", R"(The error codes that the Fove system may return
-- `None`:  Indicates that no error occurred
-
-// Connection Errors
-- `Connect_NotConnected`:  The client lost the connection with the Fove service
-- `Connect_RuntimeVersionTooOld`:  The FOVE runtime version is too old for this client
-- `Connect_ClientVersionTooOld`:  The client version is too old for the installed runtime
-
-// API usage errors
-- `API_InvalidArgument`:  An argument passed to an API function was invalid for a reason other than one of the below reasons
-- `API_NotRegistered`:  Data was queried without first registering for that data
-- `API_NullInPointer`:  An input argument passed to an API function was invalid for a reason other than the below reasons
-- `API_InvalidEnumValue`:  An enum argument passed to an API function was invalid
-- `API_NullOutPointersOnly`:  All output arguments were null on a function that requires at least one output (all getters that have no side effects)
-- `API_OverlappingOutPointers`:  Two (or more) output parameters passed to an API function overlap in memory. Each output parameter should be a unique, separate object
-- `API_MissingArgument`:  The service was expecting extra arguments that the client didn't provide
-- `API_Timeout`:  A call to an API could not be completed within a timeout
-
-// Data Errors
-- `Data_Unreadable`:  The data couldn't be read properly from the shared memory and may be corrupted
-- `Data_NoUpdate`:  The data has not been updated by the system yet and is invalid
-- `Data_Uncalibrated`:  The data is invalid because the feature in question is not calibrated
-- `Data_Unreliable`:  The data is unreliable because the eye tracking has been lost
-- `Data_LowAccuracy`:  The accuracy of the data is low
-
-// Hardware Errors
-- `Hardware_Disconnected`:  The hardware has been physically disconnected
-- `Hardware_WrongFirmwareVersion`:  A wrong version of hardware firmware has been detected
-
-// Code and placeholders
-- `Code_NotImplementedYet`:  The function hasn't been implemented yet
-- `Code_FunctionDeprecated`:  The function has been deprecated
-
-// Position Tracking
-- `Position_ObjectNotTracked`:  The object is inactive or currently not tracked
-
-// Compositor
-- `Compositor_NotSwapped`:  This comes from submitting without calling WaitForRenderPose after a complete submit
-- `Compositor_UnableToCreateDeviceAndContext`:  Compositor was unable to initialize its backend component
-- `Compositor_UnableToUseTexture`:  Compositor was unable to use the given texture (likely due to mismatched client and data types or an incompatible format)
-- `Compositor_DeviceMismatch`:  Compositor was unable to match its device to the texture's, either because of multiple GPUs or a failure to get the device from the texture
-- `Compositor_DisconnectedFromRuntime`:  Compositor was running and is no longer responding
-- `Compositor_ErrorCreatingTexturesOnDevice`:  Failed to create shared textures for compositor
-- `Compositor_NoEyeSpecifiedForSubmit`:  The supplied Fove_Eye for submit is invalid (i.e. is Both or Neither)
-
-// Generic
-- `UnknownError`:  Errors that are unknown or couldn't be classified. If possible, info will be logged about the nature of the issue
-
-// Objects
-- `Object_AlreadyRegistered`:  The scene object that you attempted to register was already present in the object registry
-
-// Render
-- `Render_OtherRendererPrioritized`:  Another renderer registered to render the process have a higher priority than current client
-
-// License
-- `License_FeatureAccessDenied`:  You don't have the license rights to use the corresponding feature
-
-// Profiles
-- `Profile_DoesntExist`:  The profile doesn't exist
-- `Profile_NotAvailable`:  The profile already exists when it shouldn't, or is otherwise taken or not available
-- `Profile_InvalidName`:  The profile name is not a valid name
-
-// Config
-- `Config_DoesntExist`:  The provided key doesn't exist in the config
-- `Config_TypeMismatch`:  The value type of the key doesn't match
-
-// System Errors, errors that originate from the OS level API (files, sockets, etc)
-- `System_UnknownError`: Any system error not otherwise specified
-- `System_PathNotFound`: Unix: ENOENT, Windows: ERROR_PATH_NOT_FOUND or ERROR_FILE_NOT_FOUND
-- `System_AccessDenied`: Unix: EACCES, Windows: ERROR_ACCESS_DENIED
-)")
-		.value("None_", Fove_ErrorCode::None) // = 0
-		// Connection errors
-		.value("Connect_NotConnected", Fove_ErrorCode::Connect_NotConnected)
-		.value("Connect_RuntimeVersionTooOld", Fove_ErrorCode::Connect_RuntimeVersionTooOld)
-		.value("Connect_ClientVersionTooOld", Fove_ErrorCode::Connect_ClientVersionTooOld)
-
-		// API usage errors
-		.value("API_InvalidArgument", Fove_ErrorCode::API_InvalidArgument)
-		.value("API_NotRegistered", Fove_ErrorCode::API_NotRegistered)
-		.value("API_NullInPointer", Fove_ErrorCode::API_NullInPointer)
-		.value("API_InvalidEnumValue", Fove_ErrorCode::API_InvalidEnumValue)
-		.value("API_NullOutPointersOnly", Fove_ErrorCode::API_NullOutPointersOnly)
-		.value("API_OverlappingOutPointers", Fove_ErrorCode::API_OverlappingOutPointers)
-		.value("API_MissingArgument", Fove_ErrorCode::API_MissingArgument)
-		.value("API_Timeout", Fove_ErrorCode::API_Timeout)
-		.value("API_AlreadyInTheDesiredState", Fove_ErrorCode::API_AlreadyInTheDesiredState)
-
-		// Data errors
-		.value("Data_Unreadable", Fove_ErrorCode::Data_Unreadable)
-		.value("Data_NoUpdate", Fove_ErrorCode::Data_NoUpdate)
-		.value("Data_Uncalibrated", Fove_ErrorCode::Data_Uncalibrated)
-		.value("Data_Unreliable", Fove_ErrorCode::Data_Unreliable)
-		.value("Data_LowAccuracy", Fove_ErrorCode::Data_LowAccuracy)
-
-		// Hardware Errors
-		.value("Hardware_Disconnected", Fove_ErrorCode::Hardware_Disconnected)
-		.value("Hardware_WrongFirmwareVersion", Fove_ErrorCode::Hardware_WrongFirmwareVersion)
-
-		// Code and placeholders
-		.value("Code_NotImplementedYet", Fove_ErrorCode::Code_NotImplementedYet)
-		.value("Code_FunctionDeprecated", Fove_ErrorCode::Code_FunctionDeprecated)
-
-		// Position Tracking
-		.value("Position_ObjectNotTracked", Fove_ErrorCode::Position_ObjectNotTracked)
-
-		// Compositor
-		.value("Compositor_NotSwapped", Fove_ErrorCode::Compositor_NotSwapped)
-		.value("Compositor_UnableToCreateDeviceAndContext", Fove_ErrorCode::Compositor_UnableToCreateDeviceAndContext)
-		.value("Compositor_UnableToUseTexture", Fove_ErrorCode::Compositor_UnableToUseTexture)
-		.value("Compositor_DeviceMismatch", Fove_ErrorCode::Compositor_DeviceMismatch)
-		.value("Compositor_DisconnectedFromRuntime", Fove_ErrorCode::Compositor_DisconnectedFromRuntime)
-		.value("Compositor_ErrorCreatingTexturesOnDevice", Fove_ErrorCode::Compositor_ErrorCreatingTexturesOnDevice)
-		.value("Compositor_NoEyeSpecifiedForSubmit", Fove_ErrorCode::Compositor_NoEyeSpecifiedForSubmit)
-
-		// Generic
-		.value("UnknownError", Fove_ErrorCode::UnknownError) // = 9000
-
-		// Objects
-		.value("Object_AlreadyRegistered", Fove_ErrorCode::Object_AlreadyRegistered)
-
-		// Render
-		.value("Render_OtherRendererPrioritized", Fove_ErrorCode::Render_OtherRendererPrioritized)
-
-		// License
-		.value("License_FeatureAccessDenied", Fove_ErrorCode::License_FeatureAccessDenied)
-
-		// Profiles
-		.value("Profile_DoesntExist", Fove_ErrorCode::Profile_DoesntExist)
-		.value("Profile_NotAvailable", Fove_ErrorCode::Profile_NotAvailable)
-		.value("Profile_InvalidName", Fove_ErrorCode::Profile_InvalidName)
-
-		// Config
-		.value("Config_DoesntExist", Fove_ErrorCode::Config_DoesntExist)
-		.value("Config_TypeMismatch", Fove_ErrorCode::Config_TypeMismatch)
-
-		// System Errors, errors that originate from the OS level API (files, sockets, etc)
-		.value("System_UnknownError", Fove_ErrorCode::System_UnknownError)
-		.value("System_PathNotFound", Fove_ErrorCode::System_PathNotFound)
-		.value("System_AccessDenied", Fove_ErrorCode::System_AccessDenied);
-}
-
-void defenum_CompositorLayerType(py::module& m)
-{
-	py::enum_<Fove_CompositorLayerType>(m, "CompositorLayerType", R"(Compositor layer type, which defines the order that clients are composited
-
-- Base: The first and main application layer
-- Overlay: Layer over the base
-- Diagnostic: Layer over Overlay)")
-		.value("Base", Fove_CompositorLayerType::Base)
-		.value("Overlay", Fove_CompositorLayerType::Overlay)
-		.value("Diagnostic", Fove_CompositorLayerType::Diagnostic);
-}
-
-void defenum_ObjectGroup(py::module& m)
-{
-	py::enum_<Fove_ObjectGroup>(m, "ObjectGroup", R"(The groups of objects of the scene)")
-		.value("Group0", Fove_ObjectGroup::Group0)
-		.value("Group1", Fove_ObjectGroup::Group1)
-		.value("Group2", Fove_ObjectGroup::Group2)
-		.value("Group3", Fove_ObjectGroup::Group3)
-		.value("Group4", Fove_ObjectGroup::Group4)
-		.value("Group5", Fove_ObjectGroup::Group5)
-		.value("Group6", Fove_ObjectGroup::Group6)
-		.value("Group7", Fove_ObjectGroup::Group7)
-		.value("Group8", Fove_ObjectGroup::Group8)
-		.value("Group9", Fove_ObjectGroup::Group9)
-		.value("Group10", Fove_ObjectGroup::Group10)
-		.value("Group11", Fove_ObjectGroup::Group11)
-		.value("Group12", Fove_ObjectGroup::Group12)
-		.value("Group13", Fove_ObjectGroup::Group13)
-		.value("Group14", Fove_ObjectGroup::Group14)
-		.value("Group15", Fove_ObjectGroup::Group15)
-		.value("Group16", Fove_ObjectGroup::Group16)
-		.value("Group17", Fove_ObjectGroup::Group17)
-		.value("Group18", Fove_ObjectGroup::Group18)
-		.value("Group19", Fove_ObjectGroup::Group19)
-		.value("Group20", Fove_ObjectGroup::Group20)
-		.value("Group21", Fove_ObjectGroup::Group21)
-		.value("Group22", Fove_ObjectGroup::Group22)
-		.value("Group23", Fove_ObjectGroup::Group23)
-		.value("Group24", Fove_ObjectGroup::Group24)
-		.value("Group25", Fove_ObjectGroup::Group25)
-		.value("Group26", Fove_ObjectGroup::Group26)
-		.value("Group27", Fove_ObjectGroup::Group27)
-		.value("Group28", Fove_ObjectGroup::Group28)
-		.value("Group29", Fove_ObjectGroup::Group29)
-		.value("Group30", Fove_ObjectGroup::Group30)
-		.value("Group31", Fove_ObjectGroup::Group31)
-		.def(
-			"__add__", [](const Fove_ObjectGroup grp1, const Fove_ObjectGroup grp2) {
-				return grp1 | grp2;
-			},
-			py::is_operator(), "Returns the union of two groups `grp1` and `grp2`.")
-		.def("__sub__", [](const Fove_ObjectGroup grp1, const Fove_ObjectGroup grp2) {
-			return grp1 & ~grp2;
-		},
-			 py::is_operator(), "Returns the group `grp2` but with `grp1` removed.")
-		.def("__contains__", [](const Fove_ObjectGroup grp1, const Fove_ObjectGroup grp2) -> bool {
-			return (grp1 & grp2) == grp2;
-		},
-			 py::is_operator(), "Returns `True` if `grp2 in grp1`.");
+SharedHeadsetPool& sharedHeadsetPool()
+{
+	static SharedHeadsetPool& pool = *new SharedHeadsetPool; // leaked: usable during interpreter teardown
+	return pool;
 }
 
-// pybind11 does not support C arrays, so we translate Fove_Versions
-// to Python_Versions in Headset_queryHardwareInfo().
-namespace
-{
-struct Python_Versions
-{
-	int clientMajor = -1;
-	int clientMinor = -1;
-	int clientBuild = -1;
-	int clientProtocol = -1;
-	string clientHash;
-	int runtimeMajor = -1;
-	int runtimeMinor = -1;
-	int runtimeBuild = -1;
-	string runtimeHash;
-	int firmware = -1;
-	int maxFirmware = -1;
-	int minFirmware = -1;
-	bool tooOldHeadsetConnected = false;
-};
 } // namespace
-void defstruct_Versions(py::module& m)
-{
-	py::class_<Python_Versions>(m, "Versions",
-								R"(Struct to list various version info about the FOVE software
-
-Contains the version for the software (both runtime and client versions).
-A negative value in any int field represents unknown.)")
-		.def(py::init<int, int, int, int, string, int, int, int, string, int, int, int, bool>(),
-			 py::arg("clientMajor") = -1,
-			 py::arg("clientMinor") = -1,
-			 py::arg("clientBuild") = -1,
-			 py::arg("clientProtocol") = -1,
-			 py::arg("clientHash") = "",
-			 py::arg("runtimeMajor") = -1,
-			 py::arg("runtimeMinor") = -1,
-			 py::arg("runtimeBuild") = -1,
-			 py::arg("runtimeHash") = "",
-			 py::arg("firmware") = -1,
-			 py::arg("maxFirmware") = -1,
-			 py::arg("minFirmware") = -1,
-			 py::arg("tooOldHeadsetConnected") = false)
-		.def_readwrite("clientMajor", &Python_Versions::clientMajor) // initialized to -1 in c++
-		.def_readwrite("clientMinor", &Python_Versions::clientMinor)
-		.def_readwrite("clientBuild", &Python_Versions::clientBuild)
-		.def_readwrite("clientProtocol", &Python_Versions::clientProtocol)
-		.def_readwrite("clientHash", &Python_Versions::clientHash)
-		.def_readwrite("runtimeMajor", &Python_Versions::runtimeMajor)
-		.def_readwrite("runtimeMinor", &Python_Versions::runtimeMinor)
-		.def_readwrite("runtimeBuild", &Python_Versions::runtimeBuild)
-		.def_readwrite("runtimeHash", &Python_Versions::runtimeHash)
-		.def_readwrite("firmware", &Python_Versions::firmware)
-		.def_readwrite("maxFirmware", &Python_Versions::maxFirmware)
-		.def_readwrite("minFirmware", &Python_Versions::minFirmware)
-		.def_readwrite("tooOldHeadsetConnected", &Python_Versions::tooOldHeadsetConnected) // initialized to false in c++
-		.def("__repr__", repr<Fove_Versions>, "Returns a string representation of versions");
-}
-
-// pybind11 does not support C arrays, so we translate Fove_LicenseInfo to Python_LicenseInfo
+
 namespace
 {
-struct Python_LicenseInfo
+// One flat record holding all the per-frame eye tracking data, so that a client
+// loop can grab everything through a single binding call instead of going through
+// a dozen separate getters (each paying its own dispatch and wrapper cost).
+// Each channel keeps its own error code, as channels can fail independently
+// (e.g. one eye closed, or a capability not registered).
+struct Python_EyeTrackingSnapshot
 {
-	std::string uuid;
-	int expirationYear = 0;
-	int expirationMonth = 0;
-	int expirationDay = 0;
-	std::string licenseType;
-	std::string licensee;
+	Fove_FrameTimestamp timestamp = {};
+	Fove_Vec3 gazeVectorLeft = {};
+	Fove_Vec3 gazeVectorRight = {};
+	Fove_Vec3 gazeVectorRawLeft = {};
+	Fove_Vec3 gazeVectorRawRight = {};
+	float pupilRadiusLeft = 0;
+	float pupilRadiusRight = 0;
+	float irisRadiusLeft = 0;
+	float irisRadiusRight = 0;
+	Fove_EyeState eyeStateLeft = Fove_EyeState::NotDetected;
+	Fove_EyeState eyeStateRight = Fove_EyeState::NotDetected;
+	bool eyeBlinkingLeft = false;
+	bool eyeBlinkingRight = false;
+	Fove_Ray combinedRay = {};
+	float combinedDepth = 0;
+	float gazeVelocityLeft = 0;       // deg/s, NaN until the differentiator has history
+	float gazeVelocityRight = 0;      // deg/s
+	float gazeAccelerationLeft = 0;   // deg/s^2, NaN until two velocity samples exist
+	float gazeAccelerationRight = 0;  // deg/s^2
+	Fove_ErrorCode errGazeVectorLeft = Fove_ErrorCode::Data_NoUpdate;
+	Fove_ErrorCode errGazeVectorRight = Fove_ErrorCode::Data_NoUpdate;
+	Fove_ErrorCode errGazeVectorRawLeft = Fove_ErrorCode::Data_NoUpdate;
+	Fove_ErrorCode errGazeVectorRawRight = Fove_ErrorCode::Data_NoUpdate;
+	Fove_ErrorCode errPupilRadiusLeft = Fove_ErrorCode::Data_NoUpdate;
+	Fove_ErrorCode errPupilRadiusRight = Fove_ErrorCode::Data_NoUpdate;
+	Fove_ErrorCode errIrisRadiusLeft = Fove_ErrorCode::Data_NoUpdate;
+	Fove_ErrorCode errIrisRadiusRight = Fove_ErrorCode::Data_NoUpdate;
+	Fove_ErrorCode errEyeStateLeft = Fove_ErrorCode::Data_NoUpdate;
+	Fove_ErrorCode errEyeStateRight = Fove_ErrorCode::Data_NoUpdate;
+	Fove_ErrorCode errEyeBlinkingLeft = Fove_ErrorCode::Data_NoUpdate;
+	Fove_ErrorCode errEyeBlinkingRight = Fove_ErrorCode::Data_NoUpdate;
+	Fove_ErrorCode errCombinedRay = Fove_ErrorCode::Data_NoUpdate;
+	Fove_ErrorCode errCombinedDepth = Fove_ErrorCode::Data_NoUpdate;
 };
 } // namespace
-void defstruct_LicenseInfo(py::module& m)
+
+void defstruct_EyeTrackingSnapshot(py::module& m)
 {
-	py::class_<Python_LicenseInfo>(m, "LicenseInfo",
-								   R"(Struct with details about a FOVE license)")
+	py::class_<Python_EyeTrackingSnapshot>(m, "EyeTrackingSnapshot",
+										   R"(A flat record of all the per-frame eye tracking data
+
+Filled in one go by `Headset_getEyeTrackingSnapshot`.
+Every channel carries its own error code (the `err*` fields), since channels can fail
+independently of each other depending on the registered capabilities and the tracking state.)")
 		.def(py::init<>())
-		.def_readwrite("uuid", &Python_LicenseInfo::uuid, "128-bit uuid of this license, in binary form")
-		.def_readwrite("expirationYear", &Python_LicenseInfo::expirationYear, "Expiration, year (eg. 2028), 0 if there is no expiration")
-		.def_readwrite("expirationMonth", &Python_LicenseInfo::expirationMonth, "Expiration month (1 - 12), 0 if there is no expiration")
-		.def_readwrite("expirationDay", &Python_LicenseInfo::expirationDay, "Expiration day (1 - 31), 0 if there is no expiration")
-		.def_readwrite("licenseType", &Python_LicenseInfo::licenseType, "Null-termianted type of license, such as \"Professional\"")
-		.def_readwrite("licensee", &Python_LicenseInfo::licensee, "Null-terminated name of the person or organization that this license is for, truncated as needed");
+		.def_readonly("timestamp", &Python_EyeTrackingSnapshot::timestamp)
+		.def_readonly("gazeVectorLeft", &Python_EyeTrackingSnapshot::gazeVectorLeft)
+		.def_readonly("gazeVectorRight", &Python_EyeTrackingSnapshot::gazeVectorRight)
+		.def_readonly("gazeVectorRawLeft", &Python_EyeTrackingSnapshot::gazeVectorRawLeft)
+		.def_readonly("gazeVectorRawRight", &Python_EyeTrackingSnapshot::gazeVectorRawRight)
+		.def_readonly("pupilRadiusLeft", &Python_EyeTrackingSnapshot::pupilRadiusLeft)
+		.def_readonly("pupilRadiusRight", &Python_EyeTrackingSnapshot::pupilRadiusRight)
+		.def_readonly("irisRadiusLeft", &Python_EyeTrackingSnapshot::irisRadiusLeft)
+		.def_readonly("irisRadiusRight", &Python_EyeTrackingSnapshot::irisRadiusRight)
+		.def_readonly("eyeStateLeft", &Python_EyeTrackingSnapshot::eyeStateLeft)
+		.def_readonly("eyeStateRight", &Python_EyeTrackingSnapshot::eyeStateRight)
+		.def_readonly("eyeBlinkingLeft", &Python_EyeTrackingSnapshot::eyeBlinkingLeft)
+		.def_readonly("eyeBlinkingRight", &Python_EyeTrackingSnapshot::eyeBlinkingRight)
+		.def_readonly("combinedRay", &Python_EyeTrackingSnapshot::combinedRay)
+		.def_readonly("combinedDepth", &Python_EyeTrackingSnapshot::combinedDepth)
+		.def_readonly("gazeVelocityLeft", &Python_EyeTrackingSnapshot::gazeVelocityLeft)
+		.def_readonly("gazeVelocityRight", &Python_EyeTrackingSnapshot::gazeVelocityRight)
+		.def_readonly("gazeAccelerationLeft", &Python_EyeTrackingSnapshot::gazeAccelerationLeft)
+		.def_readonly("gazeAccelerationRight", &Python_EyeTrackingSnapshot::gazeAccelerationRight)
+		.def_readonly("errGazeVectorLeft", &Python_EyeTrackingSnapshot::errGazeVectorLeft)
+		.def_readonly("errGazeVectorRight", &Python_EyeTrackingSnapshot::errGazeVectorRight)
+		.def_readonly("errGazeVectorRawLeft", &Python_EyeTrackingSnapshot::errGazeVectorRawLeft)
+		.def_readonly("errGazeVectorRawRight", &Python_EyeTrackingSnapshot::errGazeVectorRawRight)
+		.def_readonly("errPupilRadiusLeft", &Python_EyeTrackingSnapshot::errPupilRadiusLeft)
+		.def_readonly("errPupilRadiusRight", &Python_EyeTrackingSnapshot::errPupilRadiusRight)
+		.def_readonly("errIrisRadiusLeft", &Python_EyeTrackingSnapshot::errIrisRadiusLeft)
+		.def_readonly("errIrisRadiusRight", &Python_EyeTrackingSnapshot::errIrisRadiusRight)
+		.def_readonly("errEyeStateLeft", &Python_EyeTrackingSnapshot::errEyeStateLeft)
+		.def_readonly("errEyeStateRight", &Python_EyeTrackingSnapshot::errEyeStateRight)
+		.def_readonly("errEyeBlinkingLeft", &Python_EyeTrackingSnapshot::errEyeBlinkingLeft)
+		.def_readonly("errEyeBlinkingRight", &Python_EyeTrackingSnapshot::errEyeBlinkingRight)
+		.def_readonly("errCombinedRay", &Python_EyeTrackingSnapshot::errCombinedRay)
+		.def_readonly("errCombinedDepth", &Python_EyeTrackingSnapshot::errCombinedDepth);
 }
 
-// pybind11 does not support C arrays, so we translate Fove_HeadsetHardwareInfo
-// to Python_HeadsetHardwareInfo in Headset_queryHardwareInfo().
+
+////////////////////////////////////////////////////////////////
+// Startup info cache
+
 namespace
 {
-struct Python_HeadsetHardwareInfo
+
+// One-crossing snapshot of the session-start queries (software versions,
+// hardware info, licenses), cached per headset so a supervisor polling it
+// for health checks pays the three IPC round-trips only once. A snapshot is
+// cached only when all three queries succeed, so a disconnected session
+// keeps retrying until the runtime answers; Headset_destroy drops the entry
+// and force=True re-queries (the runtime exposes no reconnect notification
+// to invalidate on).
+struct StartupInfo
 {
-	std::string serialNumber;
-	std::string manufacturer;
-	std::string modelName;
+	Fove_ErrorCode versionsError = Fove_ErrorCode::None;
+	Fove_ErrorCode hardwareError = Fove_ErrorCode::None;
+	Fove_ErrorCode licensesError = Fove_ErrorCode::None;
+	Python_Versions versions;
+	Python_HeadsetHardwareInfo hardwareInfo;
+	std::vector<Python_LicenseInfo> licenses;
 };
-} // namespace
-void defstruct_HeadsetHardwareInfo(py::module& m)
-{
-	py::class_<Python_HeadsetHardwareInfo>(m, "HeadsetHardwareInfo",
-										   R"(Struct Contains hardware information for the headset
-
-Contains the serial number, manufacturer and model name for the headset.
-Values of the member fields originates from their UTF-8 string representations
-defined by headset manufacturers, and passed to us (FoveClient) by FoveService
-server through an IPC message.
-The server may be sending very long strings, but the FoveClient library will
-be truncating them in an unspecified manner to 0-terminated strings of length
-at most 256.)")
-		.def(py::init<>())
-		.def_readwrite("serialNumber", &Python_HeadsetHardwareInfo::serialNumber, "Serial number, as a null-terminated UTF8 string")
-		.def_readwrite("manufacturer", &Python_HeadsetHardwareInfo::manufacturer, "Manufacturer info, as a null-terminated UTF8 string")
-		.def_readwrite("modelName", &Python_HeadsetHardwareInfo::modelName, "Model name, as a null-terminated UTF8 string");
-}
 
-// XXX maybe move to upstream
-template <typename Struct, typename ElemType, std::size_t Size>
-constexpr void assert_layout()
-{
-	static_assert(std::is_standard_layout<Struct>::value,
-				  "Struct not in a standard layout where one was expected.");
-	static_assert(sizeof(Struct) == Size * sizeof(ElemType),
-				  "Struct not an array of single elem type where one was expected.");
-}
+std::mutex startupInfoMutex;
+std::unordered_map<Fove_Headset*, StartupInfo> startupInfoCache;
 
-// define buffer_protocol for a C array type with element type Elem
-template <typename Elem, std::size_t Size,
-		  typename = typename std::enable_if<std::is_arithmetic<Elem>::value, Elem>::type>
-auto define_1D_buffer_protocol(Elem (&data)[Size])
+StartupInfo queryStartupInfo(Fove_Headset* const headset)
 {
-	return py::buffer_info{
-		reinterpret_cast<void*>(&data[0]),
-		sizeof(Elem),
-		py::format_descriptor<Elem>::format(),
-		1,             // ndims
-		{Size},        // dims
-		{sizeof(Elem)} // strides
-	};
-}
+	StartupInfo info;
 
-namespace
-{
-bool operator==(const Fove_Quaternion& self, const Fove_Quaternion& other)
-{
-	return self.x == other.x && self.y == other.y && self.z == other.z && self.w == other.w;
-}
-bool operator==(const Fove_Vec3& self, const Fove_Vec3& other)
-{
-	return self.x == other.x && self.y == other.y && self.z == other.z;
-}
-bool operator==(const Fove_Vec2& self, const Fove_Vec2& other)
-{
-	return self.x == other.x && self.y == other.y;
-}
-bool operator==(const Fove_Vec2i& self, const Fove_Vec2i& other)
-{
-	return self.x == other.x && self.y == other.y;
-}
-bool operator==(const Fove_Ray& self, const Fove_Ray& other)
-{
-	return self.origin == other.origin && self.direction == other.direction;
+	Fove_Versions versions;
+	info.versionsError = FOVE_PERF(fove_Headset_querySoftwareVersions(headset, &versions));
+	if (info.versionsError == Fove_ErrorCode::None)
+	{
+		info.versions.clientMajor = versions.clientMajor;
+		info.versions.clientMinor = versions.clientMinor;
+		info.versions.clientBuild = versions.clientBuild;
+		info.versions.clientProtocol = versions.clientProtocol;
+		info.versions.clientHash = std::string(versions.clientHash);
+		info.versions.runtimeMajor = versions.runtimeMajor;
+		info.versions.runtimeMinor = versions.runtimeMinor;
+		info.versions.runtimeBuild = versions.runtimeBuild;
+		info.versions.runtimeHash = std::string(versions.runtimeHash);
+		info.versions.firmware = versions.firmware;
+		info.versions.maxFirmware = versions.maxFirmware;
+		info.versions.minFirmware = versions.minFirmware;
+		info.versions.tooOldHeadsetConnected = versions.tooOldHeadsetConnected;
+	}
+
+	Fove_HeadsetHardwareInfo hardware;
+	info.hardwareError = FOVE_PERF(fove_Headset_queryHardwareInfo(headset, &hardware));
+	if (info.hardwareError == Fove_ErrorCode::None)
+	{
+		// Note: it is a bug of Headset_queryHardwareInfo() if the C arrays are not null terminated.
+		info.hardwareInfo.serialNumber = std::string(hardware.serialNumber);
+		info.hardwareInfo.manufacturer = std::string(hardware.manufacturer);
+		info.hardwareInfo.modelName = std::string(hardware.modelName);
+	}
+
+	size_t numLicenses = 0;
+	info.licensesError = FOVE_PERF(fove_Headset_queryLicenses(headset, nullptr, &numLicenses));
+	if (info.licensesError == Fove_ErrorCode::None && numLicenses > 0)
+	{
+		const std::unique_ptr<Fove_LicenseInfo[]> licenses = std::make_unique<Fove_LicenseInfo[]>(numLicenses);
+		info.licensesError = FOVE_PERF(fove_Headset_queryLicenses(headset, licenses.get(), &numLicenses));
+		if (info.licensesError == Fove_ErrorCode::None)
+		{
+			info.licenses.resize(numLicenses);
+			for (size_t i = 0; i < numLicenses; ++i)
+			{
+				info.licenses[i].expirationYear = licenses[i].expirationYear;
+				info.licenses[i].expirationMonth = licenses[i].expirationMonth;
+				info.licenses[i].expirationDay = licenses[i].expirationDay;
+				info.licenses[i].licenseType = std::string(licenses[i].licenseType); // Null terminated
+				info.licenses[i].licensee = std::string(licenses[i].licensee);       // Null terminated
+			}
+		}
+	}
+
+	return info;
 }
-bool operator==(const Fove_FrameTimestamp& self, const Fove_FrameTimestamp& other)
+
+void forgetStartupInfo(Fove_Headset* const headset)
 {
-	return self.id == other.id && self.timestamp == other.timestamp;
+	std::lock_guard<std::mutex> lock(startupInfoMutex);
+	startupInfoCache.erase(headset);
 }
-bool operator==(const Fove_TextureBounds& self, const Fove_TextureBounds& other)
+
+// The warm-start revalidation threads, one slot per headset (see
+// Headset_getStartupInfoWarm). An entry stays registered until the headset is
+// destroyed or a later warm call replaces it, so the destroy paths can join
+// the thread before freeing the native handle it queries.
+std::mutex warmRevalidateMutex;
+std::map<Fove_Headset*, std::thread>& warmRevalidations()
 {
-	return self.left == other.left && self.top == other.top && self.right == other.right && self.bottom == other.bottom;
+	// Leaked so process exit never runs ~thread on a still-joinable slot
+	static std::map<Fove_Headset*, std::thread>& threads = *new std::map<Fove_Headset*, std::thread>;
+	return threads;
 }
-bool operator==(const Fove_BoundingBox& self, const Fove_BoundingBox& other)
+
+void forgetWarmRevalidation(Fove_Headset* const headset)
 {
-	return self.center == other.center && self.extend == other.extend;
+	std::thread thread;
+	{
+		std::lock_guard<std::mutex> lock(warmRevalidateMutex);
+		const auto it = warmRevalidations().find(headset);
+		if (it == warmRevalidations().end())
+			return;
+		thread = std::move(it->second);
+		warmRevalidations().erase(it);
+	}
+	// The queries are bounded IPC round-trips, so the join is short; the
+	// thread touches no Python state and thus never waits on the GIL we may
+	// be holding here
+	if (thread.joinable())
+		thread.join();
 }
-bool operator==(const Fove_ObjectPose& self, const Fove_ObjectPose& other)
+
+// ---- Warm-start disk cache ----
+// Persists the handshake snapshots across runs so a warm start does not wait
+// on the three service round-trips before the first frame: the most recently
+// validated device's record is served straight from disk and revalidated on a
+// background thread (see Headset_getStartupInfoWarm). The file is a small
+// tab-separated text format, one block per serial with the most recently
+// validated block last; anything unreadable or from a future writer is treated
+// as an empty cache, never an error.
+
+std::mutex warmStartFileMutex; // serializes the read-modify-write of the cache file
+
+std::vector<std::string> warmStartFields(const char* line)
 {
-	return self.scale == other.scale && self.rotation == other.rotation && self.position == other.position && self.velocity == other.velocity;
+	std::string trimmed(line);
+	while (!trimmed.empty() && (trimmed.back() == '\n' || trimmed.back() == '\r'))
+		trimmed.pop_back();
+	std::vector<std::string> fields;
+	size_t begin = 0;
+	for (;;)
+	{
+		const size_t tab = trimmed.find('\t', begin);
+		fields.push_back(trimmed.substr(begin, tab == std::string::npos ? tab : tab - begin));
+		if (tab == std::string::npos)
+			return fields;
+		begin = tab + 1;
+	}
 }
-bool operator==(const Fove_CalibrationTarget& self, const Fove_CalibrationTarget& other)
+
+// Parses the cache file into one StartupInfo per serial block. Tolerant by
+// design: unknown or short lines are skipped so older builds keep reading
+// files written by newer ones, and a corrupt file just yields fewer entries.
+std::vector<StartupInfo> warmStartRead(const std::string& path)
 {
-	return self.position == other.position && self.recommendedSize == other.recommendedSize;
+	std::vector<StartupInfo> entries;
+	std::FILE* const file = std::fopen(path.c_str(), "r");
+	if (!file)
+		return entries;
+	char line[1024];
+	if (!std::fgets(line, sizeof line, file) || warmStartFields(line)[0] != "FOVEWARM")
+	{
+		std::fclose(file);
+		return entries;
+	}
+	while (std::fgets(line, sizeof line, file))
+	{
+		const std::vector<std::string> f = warmStartFields(line);
+		if (f[0] == "serial" && f.size() >= 2)
+		{
+			entries.emplace_back();
+			entries.back().hardwareInfo.serialNumber = f[1];
+			continue;
+		}
+		if (entries.empty())
+			continue; // garbage before the first serial line
+		StartupInfo& info = entries.back();
+		if (f[0] == "manufacturer" && f.size() >= 2)
+			info.hardwareInfo.manufacturer = f[1];
+		else if (f[0] == "model" && f.size() >= 2)
+			info.hardwareInfo.modelName = f[1];
+		else if (f[0] == "client" && f.size() >= 6)
+		{
+			info.versions.clientMajor = std::atoi(f[1].c_str());
+			info.versions.clientMinor = std::atoi(f[2].c_str());
+			info.versions.clientBuild = std::atoi(f[3].c_str());
+			info.versions.clientProtocol = std::atoi(f[4].c_str());
+			info.versions.clientHash = f[5];
+		}
+		else if (f[0] == "runtime" && f.size() >= 5)
+		{
+			info.versions.runtimeMajor = std::atoi(f[1].c_str());
+			info.versions.runtimeMinor = std::atoi(f[2].c_str());
+			info.versions.runtimeBuild = std::atoi(f[3].c_str());
+			info.versions.runtimeHash = f[4];
+		}
+		else if (f[0] == "firmware" && f.size() >= 5)
+		{
+			info.versions.firmware = std::atoi(f[1].c_str());
+			info.versions.maxFirmware = std::atoi(f[2].c_str());
+			info.versions.minFirmware = std::atoi(f[3].c_str());
+			info.versions.tooOldHeadsetConnected = f[4] == "1";
+		}
+		else if (f[0] == "license" && f.size() >= 6)
+		{
+			Python_LicenseInfo license;
+			license.expirationYear = std::atoi(f[1].c_str());
+			license.expirationMonth = std::atoi(f[2].c_str());
+			license.expirationDay = std::atoi(f[3].c_str());
+			license.licenseType = f[4];
+			license.licensee = f[5];
+			info.licenses.push_back(license);
+		}
+	}
+	std::fclose(file);
+	return entries;
 }
 
-// This is a very annoying consequence of our choice of not initializing things
-// on the C++ level: Chains of initializations of contained structures
-// have to be done manually as containments are on the C++ level than on
-// the python level. To ameliorate clutter to some extent, we provide these
-// helper functions for structs that may be contained in others..
-Fove_Quaternion default_Quaternion()
+void warmStartWrite(const std::string& path, const std::vector<StartupInfo>& entries)
 {
-	return Fove_Quaternion{0.0f, 0.0f, 0.0f, 1.0f};
+	// Written to a sibling temp file and renamed into place so a crash
+	// mid-write never destroys the existing cache. Best effort throughout:
+	// the cache is an optimization and must never surface an error.
+	const std::string tmpPath = path + ".tmp";
+	std::FILE* const file = std::fopen(tmpPath.c_str(), "w");
+	if (!file)
+		return;
+	bool ok = std::fprintf(file, "FOVEWARM\t1\n") > 0;
+	for (const StartupInfo& info : entries)
+	{
+		ok = ok && std::fprintf(file, "serial\t%s\n", info.hardwareInfo.serialNumber.c_str()) > 0;
+		ok = ok && std::fprintf(file, "manufacturer\t%s\n", info.hardwareInfo.manufacturer.c_str()) > 0;
+		ok = ok && std::fprintf(file, "model\t%s\n", info.hardwareInfo.modelName.c_str()) > 0;
+		ok = ok && std::fprintf(file, "client\t%d\t%d\t%d\t%d\t%s\n",
+								info.versions.clientMajor, info.versions.clientMinor, info.versions.clientBuild,
+								info.versions.clientProtocol, info.versions.clientHash.c_str()) > 0;
+		ok = ok && std::fprintf(file, "runtime\t%d\t%d\t%d\t%s\n",
+								info.versions.runtimeMajor, info.versions.runtimeMinor, info.versions.runtimeBuild,
+								info.versions.runtimeHash.c_str()) > 0;
+		ok = ok && std::fprintf(file, "firmware\t%d\t%d\t%d\t%d\n",
+								info.versions.firmware, info.versions.maxFirmware, info.versions.minFirmware,
+								info.versions.tooOldHeadsetConnected ? 1 : 0) > 0;
+		for (const Python_LicenseInfo& license : info.licenses)
+			ok = ok && std::fprintf(file, "license\t%d\t%d\t%d\t%s\t%s\n",
+									license.expirationYear, license.expirationMonth, license.expirationDay,
+									license.licenseType.c_str(), license.licensee.c_str()) > 0;
+	}
+	ok = std::fclose(file) == 0 && ok;
+	if (!ok)
+	{
+		std::remove(tmpPath.c_str());
+		return;
+	}
+	std::remove(path.c_str()); // rename does not replace on all platforms
+	std::rename(tmpPath.c_str(), path.c_str());
 }
-Fove_Vec3 default_Vec3()
+
+// Replaces (or appends) the entry with the snapshot's serial and moves it to
+// the back, keeping the most recently validated device last
+void warmStartStore(const std::string& path, const StartupInfo& info)
 {
-	return Fove_Vec3{0.0f, 0.0f, 0.0f};
+	std::lock_guard<std::mutex> lock(warmStartFileMutex);
+	std::vector<StartupInfo> entries = warmStartRead(path);
+	entries.erase(std::remove_if(entries.begin(), entries.end(),
+								 [&](const StartupInfo& entry) { return entry.hardwareInfo.serialNumber == info.hardwareInfo.serialNumber; }),
+				  entries.end());
+	entries.push_back(info);
+	warmStartWrite(path, entries);
 }
-Fove_Vec2 default_Vec2()
+
+} // namespace
+
+void defstruct_StartupInfo(py::module& m)
 {
-	return Fove_Vec2{0.0f, 0.0f};
+	py::class_<StartupInfo>(m, "StartupInfo",
+							R"(The session-start queries bundled into one record
+
+Returned by `Headset_getStartupInfo`; each of the three underlying queries
+keeps its own error code, as they can fail independently.)")
+		.def(py::init<>())
+		.def_readonly("versionsError", &StartupInfo::versionsError, "The error returned by the software versions query")
+		.def_readonly("hardwareError", &StartupInfo::hardwareError, "The error returned by the hardware info query")
+		.def_readonly("licensesError", &StartupInfo::licensesError, "The error returned by the licenses query")
+		.def_readonly("versions", &StartupInfo::versions, "The client and runtime software versions")
+		.def_readonly("hardwareInfo", &StartupInfo::hardwareInfo, "The headset serial number, manufacturer and model name")
+		.def_readonly("licenses", &StartupInfo::licenses, "The currently activated licenses");
 }
-Fove_Vec2i default_Vec2i()
+
+////////////////////////////////////////////////////////////////
+// Gaze history
+
+namespace
 {
-	return Fove_Vec2i{0, 0};
-}
-Fove_Pose default_Pose()
+
+// A short per-headset ring of gaze samples, filled on every successful
+// Headset_fetchEyeTrackingData, so event-locked analysis can ask for the gaze
+// at an arbitrary timestamp (Headset_getGazeAt) and get a natively
+// interpolated sample instead of buffering and interpolating frames in Python.
+struct GazeSample
 {
-	return Fove_Pose{0, 0, default_Quaternion(), default_Vec3(), default_Vec3(), default_Vec3(),
-					 default_Vec3(), default_Vec3(), default_Vec3()};
-}
-Fove_TextureBounds default_TextureBounds()
+	uint64_t timestampUs;
+	Fove_Vec3 gazeLeft;
+	Fove_Vec3 gazeRight;
+	Fove_Ray combinedRay;
+	float combinedDepth;
+	float pupilLeft;
+	float pupilRight;
+};
+
+constexpr size_t gazeHistoryCapacity = 64; // about half a second at 120 Hz
+
+struct GazeHistory
 {
-	return Fove_TextureBounds{0.0f, 0.0f, 0.0f, 0.0f};
-}
-Fove_CompositorLayerEyeSubmitInfo default_CompositorLayerEyeSubmitInfo()
+	GazeSample samples[gazeHistoryCapacity];
+	size_t count = 0;
+	size_t next = 0;
+};
+
+std::mutex gazeHistoryMutex;
+std::unordered_map<Fove_Headset*, GazeHistory> gazeHistories;
+
+// Captures the interpolation channels of the just-fetched frame and appends
+// them to the headset's history; channels whose capability is not registered
+// simply stay zero, matching what the per-channel getters would report
+void pushGazeSample(Fove_Headset* const headset, const uint64_t timestampUs)
 {
-	return Fove_CompositorLayerEyeSubmitInfo{nullptr, default_TextureBounds()};
+	GazeSample sample = {};
+	sample.timestampUs = timestampUs;
+	fove_Headset_getGazeVector(headset, Fove_Eye::Left, &sample.gazeLeft);
+	fove_Headset_getGazeVector(headset, Fove_Eye::Right, &sample.gazeRight);
+	fove_Headset_getCombinedGazeRay(headset, &sample.combinedRay);
+	fove_Headset_getCombinedGazeDepth(headset, &sample.combinedDepth);
+	fove_Headset_getPupilRadius(headset, Fove_Eye::Left, &sample.pupilLeft);
+	fove_Headset_getPupilRadius(headset, Fove_Eye::Right, &sample.pupilRight);
+
+	std::lock_guard<std::mutex> lock(gazeHistoryMutex);
+	GazeHistory& history = gazeHistories[headset];
+	if (history.count > 0)
+	{
+		// Re-fetching before a new frame arrives must not flatten the history
+		const GazeSample& last = history.samples[(history.next + gazeHistoryCapacity - 1) % gazeHistoryCapacity];
+		if (last.timestampUs == timestampUs)
+			return;
+	}
+	history.samples[history.next] = sample;
+	history.next = (history.next + 1) % gazeHistoryCapacity;
+	history.count = std::min(history.count + 1, gazeHistoryCapacity);
 }
-Fove_Buffer default_Buffer()
+
+void forgetGazeHistory(Fove_Headset* const headset)
 {
-	return Fove_Buffer{nullptr, 0};
+	std::lock_guard<std::mutex> lock(gazeHistoryMutex);
+	gazeHistories.erase(headset);
 }
 
-Fove_ObjectPose default_ObjectPose()
+// Spherical interpolation of unit direction vectors; falls back to a
+// normalized lerp when the directions are nearly parallel
+Fove_Vec3 slerpDirection(const Fove_Vec3& a, const Fove_Vec3& b, const float u)
 {
-	return Fove_ObjectPose{
-		Fove_Vec3{1, 1, 1},
-		default_Quaternion(),
-		default_Vec3(),
-		default_Vec3()};
+	const float dot = std::max(-1.0f, std::min(1.0f, a.x * b.x + a.y * b.y + a.z * b.z));
+	float wa, wb;
+	if (dot > 0.9995f)
+	{
+		wa = 1.0f - u;
+		wb = u;
+	}
+	else
+	{
+		const float theta = std::acos(dot);
+		const float s = std::sin(theta);
+		wa = std::sin((1.0f - u) * theta) / s;
+		wb = std::sin(u * theta) / s;
+	}
+	Fove_Vec3 result{wa * a.x + wb * b.x, wa * a.y + wb * b.y, wa * a.z + wb * b.z};
+	const float norm2 = result.x * result.x + result.y * result.y + result.z * result.z;
+	if (norm2 > 0)
+	{
+		const float inv = 1.0f / std::sqrt(norm2);
+		result.x *= inv;
+		result.y *= inv;
+		result.z *= inv;
+	}
+	return result;
 }
 
-Fove_CalibrationTarget default_CalibrationTarget()
+GazeSample interpolateGazeSamples(const GazeSample& s0, const GazeSample& s1, const uint64_t timestampUs)
 {
-	return Fove_CalibrationTarget{{0, 0, 0}, 0};
+	const float u = s1.timestampUs == s0.timestampUs
+		? 0.0f
+		: static_cast<float>(timestampUs - s0.timestampUs) / static_cast<float>(s1.timestampUs - s0.timestampUs);
+	GazeSample out = {};
+	out.timestampUs = timestampUs;
+	out.gazeLeft = slerpDirection(s0.gazeLeft, s1.gazeLeft, u);
+	out.gazeRight = slerpDirection(s0.gazeRight, s1.gazeRight, u);
+	out.combinedRay.origin = Fove_Vec3{(1 - u) * s0.combinedRay.origin.x + u * s1.combinedRay.origin.x,
+									   (1 - u) * s0.combinedRay.origin.y + u * s1.combinedRay.origin.y,
+									   (1 - u) * s0.combinedRay.origin.z + u * s1.combinedRay.origin.z};
+	out.combinedRay.direction = slerpDirection(s0.combinedRay.direction, s1.combinedRay.direction, u);
+	out.combinedDepth = (1 - u) * s0.combinedDepth + u * s1.combinedDepth;
+	out.pupilLeft = (1 - u) * s0.pupilLeft + u * s1.pupilLeft;
+	out.pupilRight = (1 - u) * s0.pupilRight + u * s1.pupilRight;
+	return out;
 }
 
-} // namespace
-
-void defstruct_Quaternion(py::module& m)
-{
-	assert_layout<Fove_Quaternion, float, 4>();
-
-	py::class_<Fove_Quaternion>(m, "Quaternion", py::buffer_protocol(),
-								R"(Struct representation on a quaternion
-
-A quaternion represents an orientation in 3D space)")
-		.def(py::init<float, float, float, float>(),
-			 py::arg("x") = 0.0f,
-			 py::arg("y") = 0.0f,
-			 py::arg("z") = 0.0f,
-			 py::arg("w") = 1.0f)
-		.def_readwrite("x", &Fove_Quaternion::x) // 0.0
-		.def_readwrite("y", &Fove_Quaternion::y) // 0.0
-		.def_readwrite("z", &Fove_Quaternion::z) // 0.0
-		.def_readwrite("w", &Fove_Quaternion::w) // 1.0
-		.def_buffer([](Fove_Quaternion& obj) {
-			using Arr4 = float(&)[4];
-			return define_1D_buffer_protocol(reinterpret_cast<Arr4>(obj));
-		})
-		.def(
-			"__eq__", [](const Fove_Quaternion& self, const Fove_Quaternion& other) {
-				return self == other;
-			},
-			py::is_operator(), "Returns `True` if two quaternions are the same. Quaternions that differ by an overall factor are considered different.")
-		.def("__ne__", [](const Fove_Quaternion& self, const Fove_Quaternion& other) {
-			return !(self == other);
-		},
-			 py::is_operator(), "Returns `True` if two quaternions are not the same. See `__eq__()`.")
-		// XXX these operations are duplicating functionalities in FoveMath.h
-		.def("__mul__", [](const Fove_Quaternion& self, const Fove_Quaternion& other) {
-			const auto& q1 = self;
-			const auto& q2 = other;
-			return Fove_Quaternion{q1.w * q2.x + q1.x * q2.w + q1.y * q2.z - q1.z * q2.y,
-								   q1.w * q2.y + q1.y * q2.w + q1.z * q2.x - q1.x * q2.z,
-								   q1.w * q2.z + q1.z * q2.w + q1.x * q2.y - q1.y * q2.x,
-								   q1.w * q2.w - q1.x * q2.x - q1.y * q2.y - q1.z * q2.z};
-		},
-			 py::is_operator(), "Returns the product of two quaternions.")
-		.def("__mul__", [](const Fove_Quaternion& self, const float other) {
-			const auto& q = self;
-			const auto a = other;
-			return Fove_Quaternion{a * q.x, a * q.y, a * q.z, a * q.w};
-		},
-			 py::is_operator(), "Returns the quaternion rescaled by a scalar.")
-		.def("__rmul__", [](const Fove_Quaternion& self, const float other) {
-			const auto& q = self;
-			const auto a = other;
-			return Fove_Quaternion{a * q.x, a * q.y, a * q.z, a * q.w};
-		},
-			 py::is_operator(), "Returns the quaternion rescaled by a scalar.")
-		.def("__neg__", [](const Fove_Quaternion& self) {
-			const auto& q = self;
-			return Fove_Quaternion{-q.x, -q.y, -q.z, -q.w};
-		},
-			 py::is_operator(), "Returns the quaternion whose components are all negated.")
-		.def("normalise", [](const Fove_Quaternion& self) {
-			const auto& q = self;
-			const auto norm2 = self.x * self.x + self.y * self.y + self.z * self.z + self.w * self.w;
-			const auto a = 1.0f / std::sqrt(norm2);
-			return Fove_Quaternion{a * q.x, a * q.y, a * q.z, a * q.w};
-		},
-			 "Returns the quaternion of a unit norm by appropriately rescaling the given quaternion.")
-		.def("conjugate", [](const Fove_Quaternion& self) {
-			const auto& q = self;
-			return Fove_Quaternion{-q.x, -q.y, -q.z, q.w};
-		},
-			 "Returns the conjugated quaternion.")
-		// XXX this diverges from FoveMath.h that we normalize the inverse of original norm; probably we should not support non-normalized quaternions altogether
-		.def("invert", [](const Fove_Quaternion& self) {
-			const auto& q = self;
-			const auto norm2 = self.x * self.x + self.y * self.y + self.z * self.z + self.w * self.w;
-			const auto a = 1.0f / norm2;
-			return Fove_Quaternion{-a * q.x, -a * q.y, -a * q.z, a * q.w};
-		},
-			 "Returns the inverse of the given quaternion.")
-		.def("__repr__", repr<Fove_Quaternion>, "Returns a string representation of the quaternion.");
-}
-
-void defstruct_Vec3(py::module& m)
-{
-	assert_layout<Fove_Vec3, float, 3>();
-
-	py::class_<Fove_Vec3>(m, "Vec3", py::buffer_protocol(),
-						  R"(Struct to represent a 3D-vector
-
-A vector that represents an position in 3D space.)")
-		.def(py::init<float, float, float>(),
-			 py::arg("x") = 0.0f,
-			 py::arg("y") = 0.0f,
-			 py::arg("z") = 0.0f)
-		.def_readwrite("x", &Fove_Vec3::x) // 0.0
-		.def_readwrite("y", &Fove_Vec3::y) // 0.0
-		.def_readwrite("z", &Fove_Vec3::z) // 0.0
-		.def_buffer([](Fove_Vec3& obj) {
-			using Arr3 = float(&)[3];
-			return define_1D_buffer_protocol(reinterpret_cast<Arr3>(obj));
-		})
-		.def(
-			"__eq__", [](const Fove_Vec3& self, const Fove_Vec3& other) {
-				return self == other;
-			},
-			py::is_operator(), "Returns `True` if the two vectors are the same.")
-		.def("__ne__", [](Fove_Vec3& self, Fove_Vec3& other) {
-			return !(self == other);
-		},
-			 py::is_operator(), "Returns `True` if the two vectors are not the same.")
-		.def("__add__", [](Fove_Vec3& self, Fove_Vec3& other) {
-			return Fove_Vec3{self.x + other.x, self.y + other.y, self.z + other.z};
-		},
-			 py::is_operator(), "Returns the sum of two vectors.")
-		.def("__sub__", [](Fove_Vec3& self, Fove_Vec3& other) {
-			return Fove_Vec3{self.x - other.x, self.y - other.y, self.z - other.z};
-		},
-			 py::is_operator(), "Returns the difference of two vectors.")
-		.def("__mul__", [](Fove_Vec3& self, const float a) {
-			return Fove_Vec3{a * self.x, a * self.y, a * self.z};
-		},
-			 py::is_operator(), "Returns the vector rescaled by a scalar factor.")
-		.def("__rmul__", [](const float& a, Fove_Vec3& self) {
-			return Fove_Vec3{a * self.x, a * self.y, a * self.z};
-		},
-			 py::is_operator(), "Returns the vector rescaled by a scalar factor.")
-		.def("__repr__", repr<Fove_Vec3>, "Returns a string representation of the vector.");
-}
+#if FOVE_HAS_FEATURE(FOVE_FEATURE_COMPOSITOR)
+// Caches the most recent render pose per compositor so a late-latching
+// renderer can re-predict right before encode (Compositor_getPredictedPoseAt)
+// by pure extrapolation from the pose's velocity/acceleration fields, without
+// another trip through the compositor IPC path.
+std::mutex renderPoseMutex;
+std::unordered_map<Fove_Compositor*, Fove_Pose> lastRenderPoses;
 
-void defstruct_Vec2(py::module& m)
+void noteRenderPose(Fove_Compositor* const compositor, const Fove_Pose& pose)
 {
-	assert_layout<Fove_Vec2, float, 2>();
-
-	py::class_<Fove_Vec2>(m, "Vec2", py::buffer_protocol(),
-						  R"(Struct to represent a 2D-vector
-
-A vector that represents a position or orientation in 2D space, such as screen or image coordinates.)")
-		.def(py::init<float, float>(),
-			 py::arg("x") = 0.0,
-			 py::arg("y") = 0.0)
-		.def_readwrite("x", &Fove_Vec2::x) // 0.0
-		.def_readwrite("y", &Fove_Vec2::y) // 0.0
-		.def_buffer([](Fove_Vec2& obj) {
-			using Arr2 = float(&)[2];
-			return define_1D_buffer_protocol(reinterpret_cast<Arr2>(obj));
-		})
-		.def(
-			"__eq__", [](const Fove_Vec2& self, const Fove_Vec2& other) {
-				return self == other;
-			},
-			py::is_operator(), "Returns `True` if the two vectors are the same.")
-		.def("__ne__", [](Fove_Vec2& self, Fove_Vec2& other) {
-			return !(self == other);
-		},
-			 py::is_operator(), "Returns `True` if the two vectors are not the same.")
-		.def("__add__", [](Fove_Vec2& self, Fove_Vec2& other) {
-			return Fove_Vec2{self.x + other.x, self.y + other.y};
-		},
-			 py::is_operator(), "Returns the sum of two vectors.")
-		.def("__sub__", [](Fove_Vec2& self, Fove_Vec2& other) {
-			return Fove_Vec2{self.x - other.x, self.y - other.y};
-		},
-			 py::is_operator(), "Returns the difference of two vectors.")
-		.def("__mul__", [](Fove_Vec2& self, const float a) {
-			return Fove_Vec2{a * self.x, a * self.y};
-		},
-			 py::is_operator(), "Returns the vector rescaled by a scalar factor.")
-		.def("__rmul__", [](const float& a, Fove_Vec2& self) {
-			return Fove_Vec2{a * self.x, a * self.y};
-		},
-			 py::is_operator(), "Returns the vector rescaled by a scalar factor.")
-		.def("__repr__", repr<Fove_Vec2>, "Returns the string representation of the vector");
+	std::lock_guard<std::mutex> lock(renderPoseMutex);
+	lastRenderPoses[compositor] = pose;
 }
 
-void defstruct_Vec2i(py::module& m)
+void forgetRenderPose(Fove_Compositor* const compositor)
 {
-	assert_layout<Fove_Vec2i, int, 2>();
-
-	py::class_<Fove_Vec2i>(m, "Vec2i", py::buffer_protocol(),
-						   R"(Struct to represent a 2D integral vector)")
-		.def(py::init<int, int>(),
-			 py::arg("x") = 0,
-			 py::arg("y") = 0)
-		.def_readwrite("x", &Fove_Vec2i::x)
-		.def_readwrite("y", &Fove_Vec2i::y)
-		.def_buffer([](Fove_Vec2i& obj) {
-			using Arr2i = int(&)[2];
-			return define_1D_buffer_protocol(reinterpret_cast<Arr2i>(obj));
-		})
-		.def(
-			"__eq__", [](const Fove_Vec2i& self, const Fove_Vec2i& other) {
-				return self == other;
-			},
-			py::is_operator(), "Returns `True` if the two vectors are the same.")
-		.def("__ne__", [](Fove_Vec2i& self, Fove_Vec2i& other) {
-			return !(self == other);
-		},
-			 py::is_operator(), "Returns `True` if the two vectors are the same.")
-		.def("__add__", [](Fove_Vec2i& self, Fove_Vec2i& other) {
-			return Fove_Vec2i{self.x + other.x, self.y + other.y};
-		},
-			 py::is_operator(), "Returns the sum of two vectors.")
-		.def("__sub__", [](Fove_Vec2i& self, Fove_Vec2i& other) {
-			return Fove_Vec2i{self.x - other.x, self.y - other.y};
-		},
-			 py::is_operator(), "Returns the difference of two vectors.")
-		// XXX deliberately not supporting rescaling for integral vectors
-		// .def("__mul__", [](Fove_Vec2i& self, const int a) {
-		// 	return Fove_Vec2i{a * self.x, a * self.y};
-		// },
-		// 	 py::is_operator())
-		// .def("__rmul__", [](const int& a, Fove_Vec2i& self) {
-		// 	return Fove_Vec2i{a * self.x, a * self.y};
-		// },
-		// 	 py::is_operator())
-		//
-		.def("__repr__", repr<Fove_Vec2i>, "Returns a string representation of the vector.");
-}
-
-// TODO this should be mapped to a python type whose fields are numpy. how to do that automatically?
-void defstruct_Ray(py::module& m)
-{
-	py::class_<Fove_Ray>(m, "Ray",
-						 R"(Struct to represent a Ray
-
-Stores the start point and direction of a Ray)")
-		.def(py::init<Fove_Vec3, Fove_Vec3>(),
-			 py::arg_v("origin", Fove_Vec3{0, 0, 0}, "Vec3(0, 0, 0)"),
-			 py::arg_v("direction", Fove_Vec3{0, 0, 1}, "Vec3(0, 0, 1)"))
-		.def_readwrite("origin", &Fove_Ray::origin, "The start point of the Ray")     // Fove_Vec3 {0,0,0}
-		.def_readwrite("direction", &Fove_Ray::direction, "The direction of the Ray") // Fove_Vec3 {0,0,1}
-		.def(
-			"__eq__", [](const Fove_Ray& self, const Fove_Ray& other) {
-				return self == other;
-			},
-			py::is_operator(), "Returns `True` if the two rays are the same.")
-		.def("__ne__", [](Fove_Ray& self, Fove_Ray& other) {
-			return !(self == other);
-		},
-			 py::is_operator(), "Returns `True` if the two rays are not the same.")
-		.def("__repr__", repr<Fove_Ray>, "Returns a string representation of the ray.");
+	std::lock_guard<std::mutex> lock(renderPoseMutex);
+	lastRenderPoses.erase(compositor);
 }
 
-void defstruct_FrameTimestamp(py::module& m)
+// Frame pacing telemetry over the submit path. Compositor_submit gives no
+// timing feedback, so the bindings measure what they can see natively: the
+// wait-return-to-submit gap (the frame budget the renderer actually used),
+// the submit call duration, and composes inferred missed from gaps in the
+// render-pose ids handed out by consecutive waits — a skipped id means the
+// compositor composed a frame this client never submitted against, i.e. a
+// reprojected stutter frame.
+struct CompositorPacing
 {
-	py::class_<Fove_FrameTimestamp>(m, "FrameTimestamp",
-									R"(A frame timestamp information.
+	PerfRecord waitToSubmit;
+	PerfRecord submitDuration;
+	std::atomic<uint64_t> waits{0};
+	std::atomic<uint64_t> submits{0};
+	std::atomic<uint64_t> missedComposes{0};
+	std::mutex mutex; // guards the previous-frame state below
+	uint64_t lastPoseId = 0;
+	bool hasLastPose = false;
+	std::chrono::steady_clock::time_point waitReturn{};
+	bool hasWaitReturn = false;
+};
 
-It is returned by every update function so that you can know which frame the new data correspond to)")
-		.def(py::init<uint64_t, uint64_t>(),
-			 py::arg("id") = 0,
-			 py::arg("timestamp") = 0)
-		.def_readwrite("id", &Fove_FrameTimestamp::id, "Incremental frame counter")
-		.def_readwrite("timestamp", &Fove_FrameTimestamp::timestamp, "The time at which the data was captured, in microseconds since an unspecified epoch")
-		.def(
-			"__eq__", [](const Fove_FrameTimestamp& self, const Fove_FrameTimestamp& other) {
-				return self == other;
-			},
-			py::is_operator(), "Returns `True` if the two frame timestamps are the same.")
-		.def("__ne__", [](Fove_FrameTimestamp& self, Fove_FrameTimestamp& other) {
-			return !(self == other);
-		},
-			 py::is_operator(), "Returns `True` if the two frame timestamps are not the same.")
-		.def("__repr__", repr<Fove_FrameTimestamp>, "Returns a string representation of the frame timestamps.");
-}
-
-// XXX we do not define __eq__ just yet, as the desired semantics is not so clear: should id and timestamp participate in equalities?
-void defstruct_Pose(py::module& m)
-{
-	py::class_<Fove_Pose>(m, "Pose",
-						  R"(Struct to represent a combination of position and orientation of Fove Headset
-
-This structure is a combination of the Fove headset position and orientation in 3D space, collectively known as the "pose".
-In the future this may also contain acceleration information for the headset, and may also be used for controllers.)")
-		.def(py::init<uint64_t, uint64_t, Fove_Quaternion,
-					  Fove_Vec3, Fove_Vec3, Fove_Vec3, Fove_Vec3, Fove_Vec3, Fove_Vec3>(),
-			 py::arg("id") = 0,
-			 py::arg("timestamp") = 0,
-			 py::arg_v("orientation", default_Quaternion(), "Quaternion()"),
-			 py::arg_v("angularVelocity", default_Vec3(), "Vec3()"),
-			 py::arg_v("angularAcceleration", default_Vec3(), "Vec3()"),
-			 py::arg_v("position", default_Vec3(), "Vec3()"),
-			 py::arg_v("standingPosition", default_Vec3(), "Vec3()"),
-			 py::arg_v("velocity", default_Vec3(), "Vec3()"),
-			 py::arg_v("acceleration", default_Vec3(), "Vec3()"))
-		.def_readwrite("id", &Fove_Pose::id,
-					   "Incremental counter which tells if the coord captured is a fresh value at a given frame") // uint64_t 0
-		.def_readwrite("timestamp", &Fove_Pose::timestamp,
-					   "The time at which the pose was captured, in microseconds since an unspecified epoch") // uint64_t 0
-		.def_readwrite("orientation", &Fove_Pose::orientation,
-					   "The Quaternion which represents the orientation of the head") // Fove_Quaternion {}
-		.def_readwrite("angularVelocity", &Fove_Pose::angularVelocity,
-					   "The angular velocity of the head") // Fove_Vec3 {}
-		.def_readwrite("angularAcceleration", &Fove_Pose::angularAcceleration,
-					   "The angular acceleration of the head") // Fove_Vec3 {}
-		.def_readwrite("position", &Fove_Pose::position,
-					   "The position of headset in 3D space. Tares to (0, 0, 0). Use for sitting applications") // Fove_Vec3 {}
-		.def_readwrite("standingPosition", &Fove_Pose::standingPosition,
-					   "The position of headset including offset for camera location. Will not tare to zero. Use for standing applications") // Fove_Vec3 {}
-		.def_readwrite("velocity", &Fove_Pose::velocity,
-					   "The velocity of headset in 3D space") // Fove_Vec3 {}
-		.def_readwrite("acceleration", &Fove_Pose::acceleration,
-					   "The acceleration of headset in 3D space") // Fove_Vec3 {}
-		.def("__repr__", repr<Fove_Pose>, "Returns a string representation of the pose.");
-}
-
-void defenum_LogLevel(py::module& m)
-{
-	py::enum_<Fove_LogLevel>(m, "LogLevel", "Severity level of log messages")
-		.value("Debug", Fove_LogLevel::Debug)     // = 0,
-		.value("Warning", Fove_LogLevel::Warning) // = 1,
-		.value("Error", Fove_LogLevel::Error)     // = 2,
-		;
-}
-
-void defenum_Eye(py::module& m)
-{
-	py::enum_<Fove_Eye>(m, "Eye", R"(Enum specifying the left or right eye
-- Left: Left eye
-- Right: Right eye
-)")
-		.value("Left", Fove_Eye::Left)
-		.value("Right", Fove_Eye::Right);
+CompositorPacing& compositorPacing()
+{
+	// Leaked deliberately, like the other always-on accounting singletons
+	static CompositorPacing& pacing = *new CompositorPacing;
+	return pacing;
 }
 
-void defenum_EyeState(py::module& m)
+void pacingNoteWaitReturn(const Fove_Pose& pose)
 {
-	py::enum_<Fove_EyeState>(m, "EyeState", R"(Enum specifying the state of an eye
-
-- `NotDetected`: The eye is missing or the tracking was lost
-- `Opened`: The eye is present and opened
-- `Closed`: The eye is present and closed
-)")
-		.value("NotDetected", Fove_EyeState::NotDetected)
-		.value("Opened", Fove_EyeState::Opened)
-		.value("Closed", Fove_EyeState::Closed);
-}
-
-// define buffer_protocol for a C double array type with element type Elem
-template <typename Elem, std::size_t Rows, std::size_t Cols,
-		  typename = typename std::enable_if<std::is_arithmetic<Elem>::value, Elem>::type>
-auto define_2D_buffer_protocol(Elem (&data)[Rows][Cols])
-{
-	return py::buffer_info{
-		reinterpret_cast<void*>(&data[0][0]),
-		sizeof(Elem),
-		py::format_descriptor<Elem>::format(),
-		2,                                  // ndims
-		{Rows, Cols},                       // dims
-		{sizeof(Elem) * Cols, sizeof(Elem)} // strides
-	};
+	CompositorPacing& pacing = compositorPacing();
+	pacing.waits.fetch_add(1, std::memory_order_relaxed);
+	std::lock_guard<std::mutex> lock(pacing.mutex);
+	if (pacing.hasLastPose && pose.id > pacing.lastPoseId + 1)
+		pacing.missedComposes.fetch_add(pose.id - pacing.lastPoseId - 1, std::memory_order_relaxed);
+	pacing.lastPoseId = pose.id;
+	pacing.hasLastPose = true;
+	pacing.waitReturn = std::chrono::steady_clock::now();
+	pacing.hasWaitReturn = true;
 }
 
-using Python_Matrix44 = Obj<Fove_Matrix44>;
-void defstruct_Matrix44(py::module& m)
+// Wraps one submit call with the pacing clocks; `submit` does the actual call
+template <typename Submit>
+Fove_ErrorCode pacingTimedSubmit(const Submit& submit)
 {
-	py::class_<Python_Matrix44>(m, "Matrix44", py::buffer_protocol(),
-								R"(Struct to hold a rectangular array
-
-This struct implements buffer_protocol, and thus can be converted
-to a numpy array:
-m = fove.capi.Matrix44()
-a = numpy.array(m, copy=False)
-)")
-		.def(py::init<>())
-		.def_buffer([](Python_Matrix44& obj) {
-			return define_2D_buffer_protocol(obj.val.mat);
-		});
-}
-
-void defstruct_ProjectionParams(py::module& m)
-{
-	py::class_<Fove_ProjectionParams>(m, "ProjectionParams",
-									  R"(Struct holding information about projection frustum planes
-
-Values are given for a depth of 1 so that it's easy to multiply them by your near clipping plan, for example, to get the correct values for your use.)")
-		.def(py::init<float, float, float, float>(),
-			 py::arg("left") = -1.0f,
-			 py::arg("right") = 1.0f,
-			 py::arg("top") = 1.0f,
-			 py::arg("bottom") = -1.0f)
-		.def_readwrite("left", &Fove_ProjectionParams::left, "Left side (low-X)")     // float -1
-		.def_readwrite("right", &Fove_ProjectionParams::right, "Right side (high-X)") // float +1
-		.def_readwrite("top", &Fove_ProjectionParams::top, "Top (high-Y)")            // float +1
-		.def_readwrite("bottom", &Fove_ProjectionParams::bottom, "Bottom (low-Y)")    // float -1
-		.def("__repr__", repr<Fove_ProjectionParams>, "Returns a string representation of the projection params.");
-}
-
-void defstruct_BoundingBox(py::module& m)
-{
-	py::class_<Fove_BoundingBox>(m, "BoundingBox",
-								 R"(A bounding box)")
-		.def(py::init<Fove_Vec3, Fove_Vec3>(),
-			 py::arg_v("center", default_Vec3(), "Vec3()"),
-			 py::arg_v("extend", default_Vec3(), "Vec3()"))
-		.def_readwrite("center", &Fove_BoundingBox::center, "The position of the center of the bounding box")
-		.def_readwrite("extend", &Fove_BoundingBox::extend, "The extend of the bounding box (e.g. half of its size)")
-		.def("__repr__", repr<Fove_BoundingBox>, "Returns a string representation of the bounding box.")
-		.def(
-			"__eq__", [](const Fove_BoundingBox& self, const Fove_BoundingBox& other) {
-				return self == other;
-			},
-			py::is_operator(), "Returns `True` if the two bounding box are the same.")
-		.def("__ne__", [](Fove_BoundingBox& self, Fove_BoundingBox& other) {
-			return !(self == other);
-		},
-			 py::is_operator(), "Returns `True` if the two bounding box are not the same.");
+	CompositorPacing& pacing = compositorPacing();
+	const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	{
+		std::lock_guard<std::mutex> lock(pacing.mutex);
+		if (pacing.hasWaitReturn)
+		{
+			pacing.waitToSubmit.add(static_cast<uint64_t>(
+				std::chrono::duration_cast<std::chrono::nanoseconds>(begin - pacing.waitReturn).count()));
+			pacing.hasWaitReturn = false; // one gap per wait, even if the frame submits twice
+		}
+	}
+	const Fove_ErrorCode err = submit();
+	pacing.submitDuration.add(static_cast<uint64_t>(
+		std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count()));
+	pacing.submits.fetch_add(1, std::memory_order_relaxed);
+	return err;
 }
 
-void defstruct_ObjectPose(py::module& m)
+Fove_Quaternion quatMultiply(const Fove_Quaternion& a, const Fove_Quaternion& b)
 {
-	py::class_<Fove_ObjectPose>(m, "ObjectPose",
-								R"(Represents the pose of an object of the scene
-
-Pose transformations are applied in the following order on the object: scale, rotation, translation)")
-		.def(py::init<Fove_Vec3, Fove_Quaternion, Fove_Vec3, Fove_Vec3>(),
-			 py::arg_v("scale", Fove_Vec3{1, 1, 1}, "Vec3(1,1,1)"),
-			 py::arg_v("rotation", default_Quaternion(), "Quaternion()"),
-			 py::arg_v("position", default_Vec3(), "Vec3()"),
-			 py::arg_v("velocity", default_Vec3(), "Vec3()"))
-		.def_readwrite("scale", &Fove_ObjectPose::scale, "The scale of the object in world space")
-		.def_readwrite("rotation", &Fove_ObjectPose::rotation, "The rotation of the object in world space")
-		.def_readwrite("position", &Fove_ObjectPose::position, "The position of the object in world space")
-		.def_readwrite("velocity", &Fove_ObjectPose::velocity, "Velocity of the object in world space")
-		.def("__repr__", repr<Fove_ObjectPose>, "Returns a string representation of the object pose.")
-		.def(
-			"__eq__", [](const Fove_ObjectPose& self, const Fove_ObjectPose& other) {
-				return self == other;
-			},
-			py::is_operator(), "Returns `True` if the two poses are the same.")
-		.def("__ne__", [](Fove_ObjectPose& self, Fove_ObjectPose& other) {
-			return !(self == other);
-		},
-			 py::is_operator(), "Returns `True` if the two poses are not the same.");
-	;
+	return Fove_Quaternion{
+		a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+		a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+		a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+		a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z};
 }
 
-void defenum_ColliderType(py::module& m)
+// Quaternion for a rotation by the given axis-angle vector (angle = |v|, radians)
+Fove_Quaternion quatFromRotationVector(const float x, const float y, const float z)
 {
-	py::enum_<Fove_ColliderType>(m, "ColliderType", R"(Specify the different collider shape types
-
-- `Cube`: A cube shape
-- `Sphere`: A sphere shape
-- `Mesh`: A shape defined by a mesh
-)")
-		.value("Cube", Fove_ColliderType::Cube)
-		.value("Sphere", Fove_ColliderType::Sphere)
-		.value("Mesh", Fove_ColliderType::Mesh);
+	const float angle = std::sqrt(x * x + y * y + z * z);
+	if (angle < 1e-9f)
+		return Fove_Quaternion{0, 0, 0, 1};
+	const float s = std::sin(angle / 2) / angle;
+	return Fove_Quaternion{x * s, y * s, z * s, std::cos(angle / 2)};
 }
 
-void defstruct_ColliderCube(py::module& m)
+// Extrapolates a cached pose to the given display time using its own first-
+// and second-order motion fields; dt is clamped to +-50 ms so a stale cache
+// cannot produce a wild prediction
+Fove_Pose predictPoseAt(const Fove_Pose& pose, const uint64_t displayTimeUs)
 {
-	py::class_<Fove_ColliderCube>(m, "ColliderCube",
-								  R"(Define a cube collider shape)")
-		.def(py::init<Fove_Vec3>(),
-			 py::arg_v("size", Fove_Vec3{1, 1, 1}, "Vec3(1,1,1)"))
-		.def_readwrite("size", &Fove_ColliderCube::size, "The size of the cube")
-		.def("__repr__", repr<Fove_ColliderCube>, "Returns a string representation of the cube collider.");
+	float dt = static_cast<float>(static_cast<int64_t>(displayTimeUs) - static_cast<int64_t>(pose.timestamp)) * 1e-6f;
+	dt = std::max(-0.05f, std::min(0.05f, dt));
+
+	Fove_Pose out = pose;
+	out.timestamp = displayTimeUs;
+	const float halfDt2 = 0.5f * dt * dt;
+	out.position.x += pose.velocity.x * dt + pose.acceleration.x * halfDt2;
+	out.position.y += pose.velocity.y * dt + pose.acceleration.y * halfDt2;
+	out.position.z += pose.velocity.z * dt + pose.acceleration.z * halfDt2;
+	out.standingPosition.x += pose.velocity.x * dt + pose.acceleration.x * halfDt2;
+	out.standingPosition.y += pose.velocity.y * dt + pose.acceleration.y * halfDt2;
+	out.standingPosition.z += pose.velocity.z * dt + pose.acceleration.z * halfDt2;
+	out.velocity.x += pose.acceleration.x * dt;
+	out.velocity.y += pose.acceleration.y * dt;
+	out.velocity.z += pose.acceleration.z * dt;
+
+	const Fove_Quaternion rotation = quatFromRotationVector(
+		pose.angularVelocity.x * dt + pose.angularAcceleration.x * halfDt2,
+		pose.angularVelocity.y * dt + pose.angularAcceleration.y * halfDt2,
+		pose.angularVelocity.z * dt + pose.angularAcceleration.z * halfDt2);
+	out.orientation = quatMultiply(rotation, pose.orientation);
+	out.angularVelocity.x += pose.angularAcceleration.x * dt;
+	out.angularVelocity.y += pose.angularAcceleration.y * dt;
+	out.angularVelocity.z += pose.angularAcceleration.z * dt;
+	return out;
 }
+#endif // FOVE_FEATURE_COMPOSITOR
+
+} // namespace
+
+////////////////////////////////////////////////////////////////
+// Gaze event detection
 
-void defstruct_ColliderSphere(py::module& m)
+namespace
 {
-	py::class_<Fove_ColliderSphere>(m, "ColliderSphere",
-									R"(Define a sphere collider shape)")
-		.def(py::init<float>(),
-			 py::arg("radius") = 0.5f)
-		.def_readwrite("radius", &Fove_ColliderSphere::radius, "The radius of the sphere")
-		.def("__repr__", repr<Fove_ColliderSphere>, "Returns a string representation of the sphere collider.");
-}
 
-struct VertexBuffer
+// Angle between two unit directions in degrees, shared by the event engine and
+// the kinematics differentiator below
+float angleDeg(const Fove_Vec3& a, const Fove_Vec3& b)
 {
-	float* vertices;
-	unsigned int vertexCount;
-};
+	const float dot = std::max(-1.0f, std::min(1.0f, a.x * b.x + a.y * b.y + a.z * b.z));
+	return std::acos(dot) * 57.29577951308232f;
+}
 
-void defstruct_VertexBuffer(py::module& m)
+// A streaming I-VT fixation/saccade classifier fed from the fetch hook, so
+// event detection costs a few flops per frame in C++ instead of a Python pass
+// over the raw samples. Angular velocity is computed incrementally between
+// consecutive raw gaze directions; samples above the velocity threshold are
+// saccade, below it fixation, and a dispersion check splits fixations whose
+// direction drifts from the running centroid. Transition events are queued
+// and drained in batches by poll_gaze_events().
+class GazeEventEngine
 {
-	py::class_<VertexBuffer>(m, "VertexBuffer", py::buffer_protocol(),
-							 R"(Contains the vertices defining a mesh)")
-		.def(py::init([](py::buffer b) {
-			/* Request a buffer descriptor from Python */
-			py::buffer_info info = b.request();
+public:
+	void configure(const float velocityThresholdDegS, const float dispersionThresholdDeg, const float minFixationMs)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		velocityThresholdDegS_ = velocityThresholdDegS;
+		dispersionThresholdDeg_ = dispersionThresholdDeg;
+		minFixationUs_ = static_cast<uint64_t>(minFixationMs * 1000);
+		state_ = State::Unknown;
+		hasPrev_ = false;
+	}
 
-			/* Some sanity checks ... */
-			if (info.format != py::format_descriptor<float>::format())
-				throw std::runtime_error("Incompatible format: expected a float array! received:" + info.format);
+	// Feeds one frame; called from the fetch hook with a deduplicated timestamp
+	void feed(Fove_Headset* const headset, const uint64_t timestampUs)
+	{
+		Fove_Vec3 left = {}, right = {};
+		const bool okLeft = fove_Headset_getGazeVectorRaw(headset, Fove_Eye::Left, &left) == Fove_ErrorCode::None;
+		const bool okRight = fove_Headset_getGazeVectorRaw(headset, Fove_Eye::Right, &right) == Fove_ErrorCode::None;
+		if (!okLeft && !okRight)
+			return;
+		Fove_Vec3 dir{left.x + right.x, left.y + right.y, left.z + right.z};
+		if (!okLeft)
+			dir = right;
+		else if (!okRight)
+			dir = left;
+		const float norm2 = dir.x * dir.x + dir.y * dir.y + dir.z * dir.z;
+		if (norm2 <= 0)
+			return;
+		const float inv = 1.0f / std::sqrt(norm2);
+		dir = Fove_Vec3{dir.x * inv, dir.y * inv, dir.z * inv};
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (hasPrev_ && timestampUs > prevTimestampUs_)
+		{
+			const float dtS = static_cast<float>(timestampUs - prevTimestampUs_) * 1e-6f;
+			const float velocityDegS = angleDeg(prevDir_, dir) / dtS;
+			step(timestampUs, dir, velocityDegS);
+		}
+		prevDir_ = dir;
+		prevTimestampUs_ = timestampUs;
+		hasPrev_ = true;
+	}
 
-			if (info.ndim != 2)
-				throw std::runtime_error("Incompatible buffer dimension!");
+	// Drains the queued events; each entry is a dict with at least `type` and `timestamp`
+	py::list poll()
+	{
+		std::deque<Event> drained;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			drained.swap(events_);
+		}
+		py::list result;
+		for (const Event& event : drained)
+		{
+			py::dict entry;
+			switch (event.type)
+			{
+			case EventType::FixationStart:
+				entry["type"] = "fixation_start";
+				break;
+			case EventType::FixationEnd:
+				entry["type"] = "fixation_end";
+				entry["duration_us"] = event.durationUs;
+				entry["direction"] = event.direction;
+				break;
+			case EventType::Saccade:
+				entry["type"] = "saccade";
+				entry["duration_us"] = event.durationUs;
+				entry["peak_velocity_deg_s"] = event.peakVelocityDegS;
+				entry["amplitude_deg"] = event.amplitudeDeg;
+				break;
+			}
+			entry["timestamp"] = event.timestampUs;
+			result.append(std::move(entry));
+		}
+		return result;
+	}
 
-			if (info.shape[1] != 3)
-				throw std::runtime_error("Vertex should be composed of 3 components (x,y,z)!");
+private:
+	enum class State
+	{
+		Unknown,
+		Fixation,
+		Saccade,
+	};
 
-			if (info.strides[0] != 3 * sizeof(float))
-				throw std::runtime_error("Row stride should be 3 floats");
+	enum class EventType
+	{
+		FixationStart,
+		FixationEnd,
+		Saccade,
+	};
 
-			if (info.strides[1] != sizeof(float))
-				throw std::runtime_error("Col stride should be 1 float");
+	struct Event
+	{
+		EventType type;
+		uint64_t timestampUs;
+		uint64_t durationUs;
+		float peakVelocityDegS;
+		float amplitudeDeg;
+		Fove_Vec3 direction;
+	};
 
-			return VertexBuffer{static_cast<float*>(info.ptr), static_cast<unsigned int>(info.shape[0] * 3)};
-		}));
-}
+	void push(Event event)
+	{
+		if (events_.size() >= 1024)
+			events_.pop_front(); // poll is not keeping up; drop the oldest
+		events_.push_back(event);
+	}
 
-struct IndexBuffer
-{
-	unsigned int* indices;
-	unsigned int triangleCount;
-};
+	// One classified sample; called with mutex_ held
+	void step(const uint64_t timestampUs, const Fove_Vec3& dir, const float velocityDegS)
+	{
+		const bool isSaccade = velocityDegS > velocityThresholdDegS_;
+		switch (state_)
+		{
+		case State::Unknown:
+			enter(isSaccade ? State::Saccade : State::Fixation, timestampUs, dir);
+			break;
 
-void defstruct_IndexBuffer(py::module& m)
-{
-	py::class_<IndexBuffer>(m, "IndexBuffer", py::buffer_protocol(),
-							R"(Contains the triangle indices defining a mesh)")
-		.def(py::init([](py::buffer b) {
-			/* Request a buffer descriptor from Python */
-			py::buffer_info info = b.request();
+		case State::Fixation:
+			if (isSaccade)
+			{
+				endFixation(timestampUs);
+				enter(State::Saccade, timestampUs, dir);
+			}
+			else
+			{
+				// Running (renormalized) centroid of the fixation directions
+				centroid_ = Fove_Vec3{centroid_.x + dir.x, centroid_.y + dir.y, centroid_.z + dir.z};
+				const float norm = std::sqrt(centroid_.x * centroid_.x + centroid_.y * centroid_.y + centroid_.z * centroid_.z);
+				centroid_ = Fove_Vec3{centroid_.x / norm, centroid_.y / norm, centroid_.z / norm};
+				if (angleDeg(centroid_, dir) > dispersionThresholdDeg_)
+				{
+					// Slow drift carried the gaze out of the dispersion window:
+					// split into a new fixation without an intervening saccade
+					endFixation(timestampUs);
+					enter(State::Fixation, timestampUs, dir);
+				}
+				else if (!fixationEmitted_ && timestampUs - stateStartUs_ >= minFixationUs_)
+				{
+					push(Event{EventType::FixationStart, stateStartUs_, 0, 0, 0, centroid_});
+					fixationEmitted_ = true;
+				}
+			}
+			break;
 
-			if (info.ndim != 1)
-				throw std::runtime_error("Incompatible buffer dimension!");
+		case State::Saccade:
+			if (isSaccade)
+				peakVelocityDegS_ = std::max(peakVelocityDegS_, velocityDegS);
+			else
+			{
+				push(Event{EventType::Saccade, stateStartUs_, timestampUs - stateStartUs_,
+						   peakVelocityDegS_, angleDeg(stateStartDir_, dir), {}});
+				enter(State::Fixation, timestampUs, dir);
+			}
+			break;
+		}
+	}
+
+	void enter(const State state, const uint64_t timestampUs, const Fove_Vec3& dir)
+	{
+		state_ = state;
+		stateStartUs_ = timestampUs;
+		stateStartDir_ = dir;
+		centroid_ = dir;
+		peakVelocityDegS_ = 0;
+		fixationEmitted_ = false;
+	}
+
+	// Emits fixation_end if the fixation lasted long enough to have been started
+	void endFixation(const uint64_t timestampUs)
+	{
+		if (fixationEmitted_)
+			push(Event{EventType::FixationEnd, timestampUs, timestampUs - stateStartUs_, 0, 0, centroid_});
+	}
+
+	std::mutex mutex_;
+	float velocityThresholdDegS_ = 30.0f;
+	float dispersionThresholdDeg_ = 2.0f;
+	uint64_t minFixationUs_ = 60000;
+	State state_ = State::Unknown;
+	uint64_t stateStartUs_ = 0;
+	Fove_Vec3 stateStartDir_ = {};
+	Fove_Vec3 centroid_ = {};
+	float peakVelocityDegS_ = 0;
+	bool fixationEmitted_ = false;
+	bool hasPrev_ = false;
+	Fove_Vec3 prevDir_ = {};
+	uint64_t prevTimestampUs_ = 0;
+	std::deque<Event> events_;
+};
+
+GazeEventEngine& gazeEventEngine()
+{
+	static GazeEventEngine engine;
+	return engine;
+}
+
+// Streaming per-eye differentiator over the raw gaze directions: angular
+// velocity from consecutive samples (optionally box-smoothed over a small
+// window), angular acceleration from consecutive smoothed velocities. Runs
+// where the samples are produced (the pump thread and the snapshot getter), so
+// saccade metrics read finished channels instead of finite-differencing in
+// Python per frame. Invalid samples and blinks break the chain: no derivative
+// ever spans a blink gap or a dropout.
+class GazeKinematics
+{
+public:
+	struct Sample
+	{
+		float velocityDegS = std::numeric_limits<float>::quiet_NaN();
+		float accelerationDegS2 = std::numeric_limits<float>::quiet_NaN();
+	};
+
+	static constexpr size_t windowCapacity = 64;
+
+	void configure(const size_t window, const uint64_t gapUs)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		window_ = std::max<size_t>(1, std::min(window, windowCapacity));
+		gapUs_ = gapUs;
+		eyes_[0] = EyeState{};
+		eyes_[1] = EyeState{};
+	}
+
+	// Feeds one per-eye sample; refeeding the current timestamp (the pump and
+	// the snapshot getter can observe the same frame) returns the values
+	// already computed for it without perturbing the state
+	Sample feed(const Fove_Eye eye, const bool valid, const bool blinking, const Fove_Vec3& dir, const uint64_t timestampUs)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		EyeState& state = eyes_[eye == Fove_Eye::Right ? 1 : 0];
+		if (!valid || blinking)
+		{
+			state = EyeState{}; // break the chain; the next valid sample re-anchors
+			return Sample{};
+		}
+		if (state.hasPrev && timestampUs <= state.prevTimestampUs)
+			return state.last;
+		if (state.hasPrev && timestampUs - state.prevTimestampUs > gapUs_)
+			state = EyeState{}; // dropped frames; do not derive across the hole
+
+		Sample sample;
+		if (state.hasPrev)
+		{
+			const float dtS = static_cast<float>(timestampUs - state.prevTimestampUs) * 1e-6f;
+			state.window[state.windowNext++ % windowCapacity] = angleDeg(state.prevDir, dir) / dtS;
+			if (state.windowFill < window_)
+				++state.windowFill;
+			float sum = 0;
+			for (size_t i = 0; i < state.windowFill; ++i)
+				sum += state.window[(state.windowNext - 1 - i) % windowCapacity];
+			sample.velocityDegS = sum / static_cast<float>(state.windowFill);
+			if (state.hasVelocity)
+				sample.accelerationDegS2 = (sample.velocityDegS - state.lastVelocityDegS) / dtS;
+			state.lastVelocityDegS = sample.velocityDegS;
+			state.hasVelocity = true;
+		}
+		state.prevDir = dir;
+		state.prevTimestampUs = timestampUs;
+		state.hasPrev = true;
+		state.last = sample;
+		return sample;
+	}
+
+private:
+	struct EyeState
+	{
+		bool hasPrev = false;
+		Fove_Vec3 prevDir = {};
+		uint64_t prevTimestampUs = 0;
+		float window[windowCapacity] = {};
+		uint64_t windowNext = 0; // total raw velocities pushed; index modulo capacity
+		size_t windowFill = 0;
+		bool hasVelocity = false;
+		float lastVelocityDegS = 0;
+		Sample last;
+	};
+
+	std::mutex mutex_;
+	size_t window_ = 1;          // 1 = pure finite difference
+	uint64_t gapUs_ = 100000;    // samples further apart than this re-anchor instead of differentiating
+	EyeState eyes_[2];
+};
+
+GazeKinematics& gazeKinematics()
+{
+	static GazeKinematics kinematics;
+	return kinematics;
+}
+
+// Feeds both eyes of a just-captured frame and writes the four kinematics
+// channels; a sample is valid when its raw gaze vector read succeeded and the
+// eye is not known to be mid-blink
+template <typename Record>
+void fillGazeKinematics(Record& rec, const bool validLeft, const bool validRight,
+						const bool blinkingLeft, const bool blinkingRight, const uint64_t timestampUs)
+{
+	const GazeKinematics::Sample left = gazeKinematics().feed(
+		Fove_Eye::Left, validLeft, blinkingLeft, rec.gazeVectorRawLeft, timestampUs);
+	const GazeKinematics::Sample right = gazeKinematics().feed(
+		Fove_Eye::Right, validRight, blinkingRight, rec.gazeVectorRawRight, timestampUs);
+	rec.gazeVelocityLeft = left.velocityDegS;
+	rec.gazeVelocityRight = right.velocityDegS;
+	rec.gazeAccelerationLeft = left.accelerationDegS2;
+	rec.gazeAccelerationRight = right.accelerationDegS2;
+}
+
+// Accumulates per-object gaze dwell times from the frame pump, replacing the
+// Python pattern of calling Headset_getGazedObjectId every frame and keeping
+// the bookkeeping in a dict. A contiguous run of frames on the same object is
+// one entry; its duration is committed when the gaze moves on (or at report
+// time for the still-open run). fove_ObjectIdInvalid (nothing gazed) closes
+// the current run without opening one.
+class DwellTracker
+{
+public:
+	struct Entry
+	{
+		int64_t objectId;
+		uint64_t totalUs;
+		uint32_t entryCount;
+	};
+
+	// Feeds one sample; called from the pump thread
+	void feed(const int objectId, const uint64_t timestampUs)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (objectId != currentId_)
+		{
+			commit(timestampUs);
+			currentId_ = objectId;
+			segmentStartUs_ = timestampUs;
+			if (objectId != fove_ObjectIdInvalid)
+				++totals_[objectId].entryCount;
+		}
+		lastTimestampUs_ = timestampUs;
+	}
+
+	// Snapshots the accumulated totals, including the still-open run
+	std::vector<Entry> report()
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		std::vector<Entry> entries;
+		entries.reserve(totals_.size());
+		for (const auto& pair : totals_)
+		{
+			Entry entry = {pair.first, pair.second.totalUs, pair.second.entryCount};
+			if (pair.first == currentId_)
+				entry.totalUs += lastTimestampUs_ - segmentStartUs_;
+			entries.push_back(entry);
+		}
+		std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.objectId < b.objectId; });
+		return entries;
+	}
+
+	void reset()
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		totals_.clear();
+		currentId_ = fove_ObjectIdInvalid;
+	}
+
+private:
+	struct Totals
+	{
+		uint64_t totalUs = 0;
+		uint32_t entryCount = 0;
+	};
+
+	// Folds the open run into its object's total; called with mutex_ held
+	void commit(const uint64_t timestampUs)
+	{
+		if (currentId_ != fove_ObjectIdInvalid && timestampUs > segmentStartUs_)
+			totals_[currentId_].totalUs += timestampUs - segmentStartUs_;
+	}
+
+	std::mutex mutex_;
+	std::unordered_map<int, Totals> totals_;
+	int currentId_ = fove_ObjectIdInvalid;
+	uint64_t segmentStartUs_ = 0;
+	uint64_t lastTimestampUs_ = 0;
+};
+
+DwellTracker& dwellTracker()
+{
+	static DwellTracker tracker;
+	return tracker;
+}
+
+// Rolling pupil-radius statistics for pupillometry, fed by the frame pump.
+// Samples carry cumulative sums, so window aggregates come from two prefix
+// differences after a binary search — no per-frame numpy pass over a growing
+// array. Samples taken during blinks (or whose pupil channel errored) are
+// excluded, so a blink gap does not drag the rolling mean down.
+class PupilStats
+{
+public:
+	// Appends one valid sample for an eye; called from the pump thread
+	void feed(const Fove_Eye eye, const uint64_t timestampUs, const float radius)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		std::deque<Sample>& samples = eye == Fove_Eye::Right ? right_ : left_;
+		Sample sample;
+		sample.timestampUs = timestampUs;
+		sample.radius = radius;
+		sample.cumSum = radius;
+		sample.cumSumSq = double(radius) * radius;
+		if (!samples.empty())
+		{
+			sample.cumSum += samples.back().cumSum;
+			sample.cumSumSq += samples.back().cumSumSq;
+		}
+		if (samples.size() >= maxSamples)
+			samples.pop_front(); // cumulative sums stay valid: queries only ever difference them
+		samples.push_back(sample);
+	}
+
+	// Aggregates over the trailing window; count 0 means no valid sample in range
+	struct Aggregates
+	{
+		uint64_t count = 0;
+		double mean = 0;
+		double stddev = 0;
+		float latest = 0;
+	};
+
+	Aggregates query(const Fove_Eye eye, const uint64_t windowUs)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		const std::deque<Sample>& samples = eye == Fove_Eye::Right ? right_ : left_;
+		Aggregates result;
+		if (samples.empty())
+			return result;
+		const uint64_t newest = samples.back().timestampUs;
+		const uint64_t cutoff = newest >= windowUs ? newest - windowUs : 0;
+		const auto first = std::lower_bound(samples.begin(), samples.end(), cutoff,
+											[](const Sample& s, const uint64_t t) { return s.timestampUs < t; });
+		if (first == samples.end())
+			return result;
+		const double sumBefore = first == samples.begin() ? 0 : std::prev(first)->cumSum;
+		const double sumSqBefore = first == samples.begin() ? 0 : std::prev(first)->cumSumSq;
+		result.count = static_cast<uint64_t>(samples.end() - first);
+		const double sum = samples.back().cumSum - sumBefore;
+		const double sumSq = samples.back().cumSumSq - sumSqBefore;
+		result.mean = sum / result.count;
+		const double variance = sumSq / result.count - result.mean * result.mean;
+		result.stddev = variance > 0 ? std::sqrt(variance) : 0;
+		result.latest = samples.back().radius;
+		return result;
+	}
+
+	// Freezes the current window mean as the baseline for percent-change reporting
+	void setBaseline(const Fove_Eye eye, const double mean)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		(eye == Fove_Eye::Right ? baselineRight_ : baselineLeft_) = mean;
+	}
+
+	double baseline(const Fove_Eye eye)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return eye == Fove_Eye::Right ? baselineRight_ : baselineLeft_;
+	}
+
+	void reset()
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		left_.clear();
+		right_.clear();
+		baselineLeft_ = baselineRight_ = 0;
+	}
+
+private:
+	struct Sample
+	{
+		uint64_t timestampUs;
+		float radius;
+		double cumSum;   // cumulative over the whole stream, not just the retained ring
+		double cumSumSq;
+	};
+
+	// ~9 minutes at 120 Hz; old samples roll off the front
+	static constexpr size_t maxSamples = 1 << 16;
+
+	std::mutex mutex_;
+	std::deque<Sample> left_;
+	std::deque<Sample> right_;
+	double baselineLeft_ = 0;
+	double baselineRight_ = 0;
+};
+
+PupilStats& pupilStats()
+{
+	static PupilStats stats;
+	return stats;
+}
+
+// Attention heatmap accumulated natively from the combined gaze screen
+// position during the pump, replacing the per-sample Python histogram update.
+// Screen coordinates in [-1, 1] map onto a width x height float32 grid; each
+// sample either increments one bin or splats a precomputed Gaussian kernel.
+// The grid is exposed zero-copy through the buffer protocol, so the dashboard
+// reads it as a numpy array without a copy per refresh.
+class Heatmap
+{
+public:
+	Heatmap(const size_t width, const size_t height, const float sigma)
+	    : width_(width), height_(height), grid_(width * height, 0.0f)
+	{
+		if (width == 0 || height == 0)
+			throw std::runtime_error("Heatmap: width and height must be positive");
+		if (sigma > 0)
+		{
+			// Kernel covers ±3 sigma; beyond that the weights are negligible
+			kernelRadius_ = static_cast<int>(std::ceil(3 * sigma));
+			const int size = 2 * kernelRadius_ + 1;
+			kernel_.resize(static_cast<size_t>(size) * size);
+			for (int ky = -kernelRadius_; ky <= kernelRadius_; ++ky)
+				for (int kx = -kernelRadius_; kx <= kernelRadius_; ++kx)
+					kernel_[static_cast<size_t>(ky + kernelRadius_) * size + (kx + kernelRadius_)] =
+						std::exp(-(kx * kx + ky * ky) / (2.0f * sigma * sigma));
+		}
+	}
+
+	// Splats one combined-gaze screen position; called from the pump thread
+	void feed(const Fove_Vec2& pos)
+	{
+		// Screen coordinates are [-1, 1] with y up; flip y so row 0 is the top
+		const int cx = static_cast<int>((pos.x + 1) * 0.5f * width_);
+		const int cy = static_cast<int>((1 - pos.y) * 0.5f * height_);
+		std::lock_guard<std::mutex> lock(mutex_);
+		++samples_;
+		if (kernel_.empty())
+		{
+			if (cx >= 0 && cx < static_cast<int>(width_) && cy >= 0 && cy < static_cast<int>(height_))
+				grid_[static_cast<size_t>(cy) * width_ + cx] += 1.0f;
+			return;
+		}
+		const int size = 2 * kernelRadius_ + 1;
+		for (int ky = -kernelRadius_; ky <= kernelRadius_; ++ky)
+		{
+			const int y = cy + ky;
+			if (y < 0 || y >= static_cast<int>(height_))
+				continue;
+			for (int kx = -kernelRadius_; kx <= kernelRadius_; ++kx)
+			{
+				const int x = cx + kx;
+				if (x < 0 || x >= static_cast<int>(width_))
+					continue;
+				grid_[static_cast<size_t>(y) * width_ + x] +=
+					kernel_[static_cast<size_t>(ky + kernelRadius_) * size + (kx + kernelRadius_)];
+			}
+		}
+	}
+
+	void clear()
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		std::fill(grid_.begin(), grid_.end(), 0.0f);
+		samples_ = 0;
+	}
+
+	size_t width() const { return width_; }
+	size_t height() const { return height_; }
+	uint64_t samples() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return samples_;
+	}
+
+	py::buffer_info buffer()
+	{
+		return py::buffer_info{
+			grid_.data(),
+			sizeof(float),
+			py::format_descriptor<float>::format(),
+			2,                                            // ndims
+			{height_, width_},                            // dims
+			{sizeof(float) * width_, sizeof(float)}       // strides
+		};
+	}
+
+private:
+	const size_t width_;
+	const size_t height_;
+	std::vector<float> grid_;
+	std::vector<float> kernel_;
+	int kernelRadius_ = 0;
+	mutable std::mutex mutex_;
+	uint64_t samples_ = 0;
+};
+
+// Heatmaps currently collecting; the pump walks this on every frame that has
+// a valid combined screen position. Expired entries are pruned as encountered.
+std::mutex heatmapMutex;
+std::vector<std::weak_ptr<Heatmap>> activeHeatmaps;
+
+void feedHeatmaps(Fove_Headset* const headset)
+{
+	{
+		std::lock_guard<std::mutex> lock(heatmapMutex);
+		if (activeHeatmaps.empty())
+			return; // skip the extra crossing when nobody is collecting
+	}
+	Fove_Vec2 pos = {};
+	if (fove_Headset_getGazeScreenPositionCombined(headset, &pos) != Fove_ErrorCode::None)
+		return;
+	std::lock_guard<std::mutex> lock(heatmapMutex);
+	for (auto it = activeHeatmaps.begin(); it != activeHeatmaps.end();)
+	{
+		if (const std::shared_ptr<Heatmap> heatmap = it->lock())
+		{
+			heatmap->feed(pos);
+			++it;
+		}
+		else
+			it = activeHeatmaps.erase(it);
+	}
+}
+
+// Native scanpath accumulator for gaze-trail rendering: ingests combined-gaze
+// screen positions from the pump thread and maintains an online-simplified
+// polyline under a bounded point budget, so trail rendering cost is constant
+// regardless of session length. A sample is kept only when it moves at least
+// the current tolerance away from the last kept point (radial-distance
+// simplification); when the budget is still exceeded, the stored polyline is
+// re-simplified with a doubled tolerance until it fits. The points are exposed
+// zero-copy through the buffer protocol, with storage reserved up front so
+// live views stay valid while the pump appends.
+class Scanpath
+{
+public:
+	Scanpath(const size_t budget, const float epsilon)
+	    : budget_(budget), epsilon_(epsilon), currentEpsilon_(epsilon)
+	{
+		if (budget < 2)
+			throw std::runtime_error("Scanpath: budget must be at least 2");
+		if (epsilon < 0)
+			throw std::runtime_error("Scanpath: epsilon must not be negative");
+		points_.reserve((budget_ + 1) * 2); // never reallocated; buffer views stay valid
+	}
+
+	// Appends one combined-gaze screen position; called from the pump thread
+	void feed(const Fove_Vec2& pos)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		++samples_;
+		if (!points_.empty())
+		{
+			const float dx = pos.x - points_[points_.size() - 2];
+			const float dy = pos.y - points_[points_.size() - 1];
+			if (dx * dx + dy * dy < currentEpsilon_ * currentEpsilon_)
+				return; // within tolerance of the last kept point
+		}
+		if (points_.size() / 2 >= budget_)
+			coarsen();
+		points_.push_back(pos.x);
+		points_.push_back(pos.y);
+	}
+
+	void clear()
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		points_.clear();
+		samples_ = 0;
+		currentEpsilon_ = epsilon_;
+	}
+
+	size_t pointCount() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return points_.size() / 2;
+	}
+
+	uint64_t samples() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return samples_;
+	}
+
+	float tolerance() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return currentEpsilon_;
+	}
+
+	py::buffer_info buffer()
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return py::buffer_info{
+			points_.data(),
+			sizeof(float),
+			py::format_descriptor<float>::format(),
+			2,                                      // ndims
+			{py::ssize_t(points_.size() / 2), py::ssize_t(2)},
+			{sizeof(float) * 2, sizeof(float)}      // strides
+		};
+	}
+
+private:
+	// Radial-distance passes with doubled tolerance until the path fits the
+	// budget again; the first and the newest point always survive, so the
+	// trail still starts where the session did and ends at the current gaze.
+	// Called with mutex_ held.
+	void coarsen()
+	{
+		while (points_.size() / 2 >= budget_)
+		{
+			currentEpsilon_ = currentEpsilon_ > 0 ? currentEpsilon_ * 2 : 1e-3f;
+			const float eps2 = currentEpsilon_ * currentEpsilon_;
+			const size_t n = points_.size();
+			size_t write = 2; // the first point is kept as-is
+			for (size_t read = 2; read < n - 2; read += 2)
+			{
+				const float dx = points_[read] - points_[write - 2];
+				const float dy = points_[read + 1] - points_[write - 1];
+				if (dx * dx + dy * dy >= eps2)
+				{
+					points_[write] = points_[read];
+					points_[write + 1] = points_[read + 1];
+					write += 2;
+				}
+			}
+			points_[write] = points_[n - 2];
+			points_[write + 1] = points_[n - 1];
+			points_.resize(write + 2);
+		}
+	}
+
+	const size_t budget_;
+	const float epsilon_;
+	float currentEpsilon_;
+	std::vector<float> points_; // interleaved x, y pairs
+	mutable std::mutex mutex_;
+	uint64_t samples_ = 0;
+};
+
+// Scanpaths currently collecting, walked by the pump like the heatmaps above
+std::mutex scanpathMutex;
+std::vector<std::weak_ptr<Scanpath>> activeScanpaths;
+
+void feedScanpaths(Fove_Headset* const headset)
+{
+	{
+		std::lock_guard<std::mutex> lock(scanpathMutex);
+		if (activeScanpaths.empty())
+			return; // skip the extra crossing when nobody is collecting
+	}
+	Fove_Vec2 pos = {};
+	if (fove_Headset_getGazeScreenPositionCombined(headset, &pos) != Fove_ErrorCode::None)
+		return;
+	std::lock_guard<std::mutex> lock(scanpathMutex);
+	for (auto it = activeScanpaths.begin(); it != activeScanpaths.end();)
+	{
+		if (const std::shared_ptr<Scanpath> scanpath = it->lock())
+		{
+			scanpath->feed(pos);
+			++it;
+		}
+		else
+			it = activeScanpaths.erase(it);
+	}
+}
+
+// Custom smoothing stage applied to the raw gaze vectors at fetch time, so UI
+// code gets a filtered channel without running filter math in Python per frame
+// per eye. The SDK's own smoothed channel (getGazeVector) is untouched; this
+// adds a third channel whose filter and parameters the client controls.
+// Supported kinds: a fixed-alpha low-pass and One-Euro (adaptive cutoff that
+// tracks fast movements while damping jitter at rest). Filter state resets on
+// tracking loss so a reacquired gaze does not get averaged with stale data.
+class GazeFilter
+{
+public:
+	enum class Kind
+	{
+		None,
+		Lowpass,
+		OneEuro,
+	};
+
+	void configure(const Kind kind, const float alpha, const float minCutoff, const float beta, const float dCutoff)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		kind_ = kind;
+		alpha_ = alpha;
+		minCutoff_ = minCutoff;
+		beta_ = beta;
+		dCutoff_ = dCutoff;
+		states_.clear();
+	}
+
+	// Runs the filter over both eyes of the just-fetched frame; called from the fetch hook
+	void feed(Fove_Headset* const headset, const uint64_t timestampUs)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (kind_ == Kind::None)
+			return;
+		HeadsetState& state = states_[headset];
+		for (const Fove_Eye eye : {Fove_Eye::Left, Fove_Eye::Right})
+		{
+			EyeState& eyeState = eye == Fove_Eye::Right ? state.right : state.left;
+			Fove_Vec3 raw = {};
+			const Fove_ErrorCode err = fove_Headset_getGazeVectorRaw(headset, eye, &raw);
+			eyeState.err = err;
+			if (err != Fove_ErrorCode::None && err != Fove_ErrorCode::Data_LowAccuracy)
+			{
+				// Tracking loss (Data_Unreliable and the like): restart the filter
+				eyeState.hasPrev = false;
+				continue;
+			}
+			eyeState.filtered = step(eyeState, raw, timestampUs);
+			eyeState.hasPrev = true;
+			eyeState.lastTimestampUs = timestampUs;
+		}
+	}
+
+	// Reads the filtered vector of one eye, with getGazeVectorRaw-style error reporting
+	Fove_ErrorCode get(Fove_Headset* const headset, const Fove_Eye eye, Fove_Vec3& out)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (kind_ == Kind::None)
+			return Fove_ErrorCode::API_NotRegistered;
+		const auto it = states_.find(headset);
+		if (it == states_.end())
+			return Fove_ErrorCode::Data_NoUpdate;
+		const EyeState& eyeState = eye == Fove_Eye::Right ? it->second.right : it->second.left;
+		if (!eyeState.hasPrev)
+			return eyeState.err == Fove_ErrorCode::None ? Fove_ErrorCode::Data_NoUpdate : eyeState.err;
+		out = eyeState.filtered;
+		return eyeState.err;
+	}
+
+	void forget(Fove_Headset* const headset)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		states_.erase(headset);
+	}
+
+private:
+	struct EyeState
+	{
+		bool hasPrev = false;
+		Fove_Vec3 filtered = {};
+		Fove_Vec3 derivative = {};
+		uint64_t lastTimestampUs = 0;
+		Fove_ErrorCode err = Fove_ErrorCode::Data_NoUpdate;
+	};
+
+	struct HeadsetState
+	{
+		EyeState left;
+		EyeState right;
+	};
+
+	static float smoothingAlpha(const float cutoffHz, const float dtS)
+	{
+		const float tau = 1.0f / (2.0f * 3.14159265358979f * cutoffHz);
+		return 1.0f / (1.0f + tau / dtS);
+	}
+
+	static Fove_Vec3 lerp(const Fove_Vec3& from, const Fove_Vec3& to, const float alpha)
+	{
+		return Fove_Vec3{from.x + (to.x - from.x) * alpha,
+						 from.y + (to.y - from.y) * alpha,
+						 from.z + (to.z - from.z) * alpha};
+	}
+
+	static Fove_Vec3 normalized(const Fove_Vec3& v)
+	{
+		const float norm2 = v.x * v.x + v.y * v.y + v.z * v.z;
+		if (norm2 <= 0)
+			return v;
+		const float inv = 1.0f / std::sqrt(norm2);
+		return Fove_Vec3{v.x * inv, v.y * inv, v.z * inv};
+	}
+
+	// One filter update; called with mutex_ held
+	Fove_Vec3 step(EyeState& eyeState, const Fove_Vec3& raw, const uint64_t timestampUs)
+	{
+		if (!eyeState.hasPrev || timestampUs <= eyeState.lastTimestampUs)
+		{
+			eyeState.derivative = Fove_Vec3{};
+			return raw;
+		}
+		const float dtS = static_cast<float>(timestampUs - eyeState.lastTimestampUs) * 1e-6f;
+		if (kind_ == Kind::Lowpass)
+			return normalized(lerp(eyeState.filtered, raw, alpha_));
+
+		// One-Euro: low-pass the derivative, then adapt the signal cutoff to it
+		const Fove_Vec3 rawDeriv{(raw.x - eyeState.filtered.x) / dtS,
+								 (raw.y - eyeState.filtered.y) / dtS,
+								 (raw.z - eyeState.filtered.z) / dtS};
+		eyeState.derivative = lerp(eyeState.derivative, rawDeriv, smoothingAlpha(dCutoff_, dtS));
+		const float speed = std::sqrt(eyeState.derivative.x * eyeState.derivative.x
+									  + eyeState.derivative.y * eyeState.derivative.y
+									  + eyeState.derivative.z * eyeState.derivative.z);
+		const float cutoff = minCutoff_ + beta_ * speed;
+		return normalized(lerp(eyeState.filtered, raw, smoothingAlpha(cutoff, dtS)));
+	}
+
+	std::mutex mutex_;
+	Kind kind_ = Kind::None;
+	float alpha_ = 0.5f;
+	float minCutoff_ = 1.0f;
+	float beta_ = 0.007f;
+	float dCutoff_ = 1.0f;
+	std::unordered_map<Fove_Headset*, HeadsetState> states_;
+};
+
+GazeFilter& gazeFilter()
+{
+	static GazeFilter filter;
+	return filter;
+}
+
+} // namespace
+
+void bind_GazeEvents(py::module& m)
+{
+	m.def(
+		"gaze_event_config", [](const float velocityThreshold, const float dispersionThreshold, const float minFixationMs) {
+			gazeEventEngine().configure(velocityThreshold, dispersionThreshold, minFixationMs);
+		},
+		py::arg("velocity_threshold") = 30.0f,
+		py::arg("dispersion_threshold") = 2.0f,
+		py::arg("min_fixation_ms") = 60.0f,
+		R"(Configures the streaming fixation/saccade classifier (and resets its state)
+
+\param velocity_threshold   The I-VT angular velocity threshold in degrees/second; samples above it classify as saccade
+\param dispersion_threshold Fixations whose direction drifts this many degrees from the running centroid are split
+\param min_fixation_ms      Fixations shorter than this emit no events
+\see poll_gaze_events
+)");
+
+	m.def(
+		"poll_gaze_events", [] { return gazeEventEngine().poll(); },
+		R"(Drains the fixation/saccade events detected since the last poll
+
+The classifier runs incrementally over the raw gaze directions of every frame
+fetched with `Headset_fetchEyeTrackingData`, entirely in the binding layer.
+Each returned dict has a `type` of `"fixation_start"`, `"fixation_end"` or
+`"saccade"` plus a `timestamp` (the event's start, in the `FrameTimestamp`
+domain); ends carry `duration_us` and the centroid `direction`, saccades carry
+`duration_us`, `peak_velocity_deg_s` and `amplitude_deg`.
+
+\return A list of event dicts, oldest first (empty if none occurred)
+\see gaze_event_config
+)");
+
+	m.def(
+		"gaze_kinematics_config", [](const size_t window, const float gapMs) {
+			if (gapMs <= 0)
+				throw std::runtime_error("gaze_kinematics_config: gap_ms must be positive");
+			gazeKinematics().configure(window, static_cast<uint64_t>(gapMs * 1000));
+		},
+		py::arg("window") = 1,
+		py::arg("gap_ms") = 100.0f,
+		R"(Configures the per-eye gaze kinematics differentiator (and resets its state)
+
+The differentiator derives the `gazeVelocity*` and `gazeAcceleration*` channels
+of pump snapshots and `Headset_getEyeTrackingSnapshot` from consecutive raw
+gaze directions, natively where the samples are produced. Invalid samples and
+blinks break the derivative chain, so no velocity or acceleration ever spans a
+blink gap; the channels read NaN until enough valid history accumulates again.
+
+\param window The box-smoothing window over the raw velocities, in samples
+       (1 = pure finite difference, clamped to 64); acceleration differentiates
+       the smoothed velocities
+\param gap_ms Consecutive samples further apart than this re-anchor the
+       differentiator instead of producing a derivative across the hole
+\see gaze_event_config
+)");
+
+	PYBIND11_NUMPY_DTYPE_EX(DwellTracker::Entry, objectId, "object_id", totalUs, "total_us", entryCount, "entry_count");
+
+	m.def(
+		"dwell_report", [] {
+			const std::vector<DwellTracker::Entry> entries = dwellTracker().report();
+			py::array_t<DwellTracker::Entry> out(static_cast<py::ssize_t>(entries.size()));
+			std::copy(entries.begin(), entries.end(), static_cast<DwellTracker::Entry*>(out.request().ptr));
+			return out;
+		},
+		R"(Reports the per-object gaze dwell times accumulated by the frame pump
+
+While a `FramePump` is running it samples `Headset_getGazedObjectId` every
+frame and accumulates contiguous-gaze runs natively, so heat reporting no
+longer needs per-frame Python bookkeeping. The still-open run, if any, is
+included up to the latest captured frame.
+
+\return A structured numpy array with fields `object_id`, `total_us` and
+        `entry_count`, sorted by object id (empty if nothing was gazed)
+\see dwell_reset
+)");
+
+	m.def(
+		"dwell_reset", [] { dwellTracker().reset(); },
+		R"(Clears the accumulated dwell totals (the in-progress run is discarded)
+
+\see dwell_report
+)");
+}
+
+void bind_GazeFilter(py::module& m)
+{
+	m.def(
+		"set_gaze_filter", [](const std::string& kind, const float alpha, const float minCutoff, const float beta, const float dCutoff) {
+			GazeFilter::Kind parsed;
+			if (kind == "none")
+				parsed = GazeFilter::Kind::None;
+			else if (kind == "lowpass")
+				parsed = GazeFilter::Kind::Lowpass;
+			else if (kind == "one_euro")
+				parsed = GazeFilter::Kind::OneEuro;
+			else
+				throw std::runtime_error("set_gaze_filter: kind must be 'none', 'lowpass' or 'one_euro', got '" + kind + "'");
+			gazeFilter().configure(parsed, alpha, minCutoff, beta, dCutoff);
+		},
+		py::arg("kind"),
+		py::arg("alpha") = 0.5f,
+		py::arg("min_cutoff") = 1.0f,
+		py::arg("beta") = 0.007f,
+		py::arg("d_cutoff") = 1.0f,
+		R"(Configures the native gaze filter stage (and resets its state)
+
+The filter runs over the raw gaze vectors at fetch time, inside
+`Headset_fetchEyeTrackingData`, so smoothing for UI costs no Python work.
+The SDK's own smoothed channel (`Headset_getGazeVector`) is unaffected.
+
+\param kind       `"none"` (disable, the default), `"lowpass"` (fixed-alpha
+                  exponential smoothing) or `"one_euro"` (adaptive cutoff)
+\param alpha      Low-pass smoothing factor in (0, 1]; only used by `"lowpass"`
+\param min_cutoff One-Euro minimum cutoff frequency in Hz
+\param beta       One-Euro speed coefficient; higher values follow saccades more tightly
+\param d_cutoff   One-Euro derivative cutoff frequency in Hz
+\see Headset_getGazeVectorFiltered
+)");
+}
+
+void bind_PupilStats(py::module& m)
+{
+	m.def(
+		"pupil_stats", [](const Fove_Eye eye, const uint64_t windowUs) {
+			const PupilStats::Aggregates agg = pupilStats().query(eye, windowUs);
+			const double baseline = pupilStats().baseline(eye);
+			py::dict result;
+			result["count"] = agg.count;
+			result["mean"] = agg.mean;
+			result["std"] = agg.stddev;
+			result["latest"] = agg.latest;
+			result["baseline"] = baseline;
+			result["percent_change"] = baseline > 0 ? (agg.mean - baseline) / baseline * 100.0 : 0.0;
+			return result;
+		},
+		py::arg("eye"), py::arg("window_us"),
+		R"(Returns rolling pupil-radius statistics over the trailing window
+
+A running `FramePump` feeds every valid pupil sample (blink gaps excluded)
+into a cumulative-sum ring, so the aggregates here cost a binary search and
+two subtractions regardless of window length — no per-frame numpy work.
+
+\param eye       Which eye to report on
+\param window_us Length of the trailing window in microseconds
+\return A dict with `count`, `mean`, `std`, `latest`, `baseline` and
+        `percent_change` (relative to the baseline, in percent; 0 if no
+        baseline was set). `count` 0 means no valid sample fell in the window.
+\see pupil_set_baseline, pupil_stats_reset
+)");
+
+	m.def(
+		"pupil_set_baseline", [](const uint64_t windowUs) {
+			for (const Fove_Eye eye : {Fove_Eye::Left, Fove_Eye::Right})
+			{
+				const PupilStats::Aggregates agg = pupilStats().query(eye, windowUs);
+				if (agg.count > 0)
+					pupilStats().setBaseline(eye, agg.mean);
+			}
+		},
+		py::arg("window_us"),
+		R"(Freezes the current rolling mean of both eyes as the pupillometry baseline
+
+Call this at the end of a rest period; subsequent `pupil_stats` calls report
+`percent_change` relative to it. Eyes with no valid sample in the window keep
+their previous baseline.
+
+\param window_us Length of the trailing window to average over, in microseconds
+\see pupil_stats
+)");
+
+	m.def(
+		"pupil_stats_reset", [] { pupilStats().reset(); },
+		R"(Discards all accumulated pupil samples and baselines
+
+\see pupil_stats
+)");
+}
+
+void defstruct_Heatmap(py::module& m)
+{
+	py::class_<Heatmap, std::shared_ptr<Heatmap>>(m, "Heatmap", py::buffer_protocol(),
+												  R"(A native attention-heatmap accumulator
+
+While enabled, a running `FramePump` splats the combined gaze screen position
+of every frame into a `height x width` float32 grid (a single bin per sample,
+or a precomputed Gaussian kernel when `sigma > 0`). The grid is exposed
+zero-copy through the buffer protocol: `numpy.asarray(heatmap)` views the live
+accumulation, so a dashboard refresh is a single array read.)")
+		.def(py::init<size_t, size_t, float>(),
+			 py::arg("width"), py::arg("height"), py::arg("sigma") = 0.0f,
+			 R"(Creates a heatmap grid (not yet collecting; call `enable`)
+
+\param width  Number of bins across the screen's horizontal extent
+\param height Number of bins across the vertical extent
+\param sigma  Gaussian splat radius in bins; 0 bins each sample into a single cell
+)")
+		.def(
+			"enable", [](const std::shared_ptr<Heatmap>& self) {
+				std::lock_guard<std::mutex> lock(heatmapMutex);
+				for (const std::weak_ptr<Heatmap>& entry : activeHeatmaps)
+					if (entry.lock() == self)
+						return;
+				activeHeatmaps.push_back(self);
+			},
+			"Starts accumulating samples from the running frame pump (idempotent)")
+		.def(
+			"disable", [](const std::shared_ptr<Heatmap>& self) {
+				std::lock_guard<std::mutex> lock(heatmapMutex);
+				activeHeatmaps.erase(
+					std::remove_if(activeHeatmaps.begin(), activeHeatmaps.end(),
+								   [&self](const std::weak_ptr<Heatmap>& entry) { return entry.lock() == self; }),
+					activeHeatmaps.end());
+			},
+			"Stops accumulating; the grid keeps its contents")
+		.def("clear", &Heatmap::clear, "Zeroes the grid and the sample counter")
+		.def_property_readonly("width", &Heatmap::width, "Number of horizontal bins")
+		.def_property_readonly("height", &Heatmap::height, "Number of vertical bins")
+		.def_property_readonly("samples", &Heatmap::samples, "Number of samples splatted since creation or the last `clear`")
+		.def_buffer([](Heatmap& heatmap) { return heatmap.buffer(); });
+}
+
+void defstruct_Scanpath(py::module& m)
+{
+	py::class_<Scanpath, std::shared_ptr<Scanpath>>(m, "Scanpath", py::buffer_protocol(),
+													R"(A native gaze-trail accumulator with online polyline simplification
+
+While enabled, a running `FramePump` appends the combined gaze screen position
+of every frame to a polyline that is simplified online: a sample within the
+current tolerance of the last kept point is dropped (radial-distance
+simplification), and whenever the path would exceed its point budget it is
+re-simplified with a doubled tolerance until it fits. Trail rendering cost is
+thus constant regardless of session length. The points are exposed zero-copy
+through the buffer protocol: `numpy.asarray(scanpath)` views the live `(n, 2)`
+float32 path, so a dashboard redraw is a single array read.)")
+		.def(py::init<size_t, float>(),
+			 py::arg("budget") = 512, py::arg("epsilon") = 0.0f,
+			 R"(Creates a scanpath (not yet collecting; call `enable`)
+
+\param budget  Largest number of points the simplified path may hold (at least 2)
+\param epsilon Initial simplification tolerance in screen units ([-1, 1] axes);
+       samples closer than this to the last kept point are dropped. 0 keeps
+       every sample until the budget forces coarsening
+)")
+		.def(
+			"enable", [](const std::shared_ptr<Scanpath>& self) {
+				std::lock_guard<std::mutex> lock(scanpathMutex);
+				for (const std::weak_ptr<Scanpath>& entry : activeScanpaths)
+					if (entry.lock() == self)
+						return;
+				activeScanpaths.push_back(self);
+			},
+			"Starts accumulating samples from the running frame pump (idempotent)")
+		.def(
+			"disable", [](const std::shared_ptr<Scanpath>& self) {
+				std::lock_guard<std::mutex> lock(scanpathMutex);
+				activeScanpaths.erase(
+					std::remove_if(activeScanpaths.begin(), activeScanpaths.end(),
+								   [&self](const std::weak_ptr<Scanpath>& entry) { return entry.lock() == self; }),
+					activeScanpaths.end());
+			},
+			"Stops accumulating; the path keeps its points")
+		.def("clear", &Scanpath::clear, "Discards the path and resets the tolerance and sample counter")
+		.def_property_readonly("points", &Scanpath::pointCount, "Number of points currently in the simplified path")
+		.def_property_readonly("samples", &Scanpath::samples, "Number of samples ingested since creation or the last `clear`")
+		.def_property_readonly("tolerance", &Scanpath::tolerance, "The current simplification tolerance (grows when the budget forces coarsening)")
+		.def_buffer([](Scanpath& scanpath) { return scanpath.buffer(); });
+}
+
+////////////////////////////////////////////////////////////////
+// C APIs
+
+
+void defstruct_Headsets(py::module& m)
+{
+	py::class_<Headset>(m, "Fove_Headset", "Opaque type representing a headset object")
+		.def(py::init<>());
+}
+
+#if FOVE_HAS_FEATURE(FOVE_FEATURE_COMPOSITOR)
+void defstruct_Compositor(py::module& m)
+{
+	py::class_<Compositor>(m, "Fove_Compositor", "Opaque type representing a compositor connection")
+		.def(py::init<>());
+}
+#endif // FOVE_FEATURE_COMPOSITOR
+
+////////////////////////////////////////////////////////////////
+// Numpy structured dtypes
+
+// Registers numpy structured dtypes for the fixed-layout POD structs, so
+// arrays of them cross the boundary without per-element object conversion:
+// the pump/recorder/pose-history batches already rely on these, and analysis
+// code can allocate compatible arrays up front with `dtype_of`.
+void defstruct_Dtypes(py::module& m)
+{
+	PYBIND11_NUMPY_DTYPE(Fove_Vec2, x, y);
+	PYBIND11_NUMPY_DTYPE(Fove_Vec3, x, y, z);
+	PYBIND11_NUMPY_DTYPE(Fove_Quaternion, x, y, z, w);
+	PYBIND11_NUMPY_DTYPE(Fove_Ray, origin, direction);
+	PYBIND11_NUMPY_DTYPE(Fove_FrameTimestamp, id, timestamp);
+	PYBIND11_NUMPY_DTYPE(Fove_Pose, id, timestamp, orientation, angularVelocity, angularAcceleration,
+						 position, standingPosition, velocity, acceleration);
+	PYBIND11_NUMPY_DTYPE(Fove_ObjectPose, scale, rotation, position, velocity);
+
+	m.def(
+		"dtype_of", [](const std::string& name) -> py::object {
+			if (name == "Vec2")
+				return py::dtype::of<Fove_Vec2>();
+			if (name == "Vec3")
+				return py::dtype::of<Fove_Vec3>();
+			if (name == "Quaternion")
+				return py::dtype::of<Fove_Quaternion>();
+			if (name == "Ray")
+				return py::dtype::of<Fove_Ray>();
+			if (name == "FrameTimestamp")
+				return py::dtype::of<Fove_FrameTimestamp>();
+			if (name == "Pose")
+				return py::dtype::of<Fove_Pose>();
+			if (name == "ObjectPose")
+				return py::dtype::of<Fove_ObjectPose>();
+			throw std::runtime_error("dtype_of: no registered dtype for '" + name + "'");
+		},
+		py::arg("name"),
+		R"(Returns the numpy structured dtype registered for a binding struct
+
+Lets analysis code preallocate arrays that the batch APIs fill without any
+per-element conversion, e.g. `np.empty(n, dtype=capi.dtype_of("Pose"))`.
+
+\param name One of "Vec2", "Vec3", "Quaternion", "Ray", "FrameTimestamp", "Pose" or "ObjectPose"
+\return The numpy dtype object
+)");
+}
+
+////////////////////////////////////////////////////////////////
+// Clock sync
+
+namespace
+{
+
+// Estimates the mapping from the device timestamp domain (`Fove_FrameTimestamp`,
+// microseconds since an unspecified epoch) to the host monotonic clock.
+//
+// Every timestamp fetch feeds an (deviceUs, hostUs) observation pair in. The
+// observed offset host - device is the true clock offset plus nonnegative
+// delivery latency, so a min filter over a window isolates the lowest-latency
+// samples; two consecutive windows give a drift slope, which keeps long
+// sessions aligned instead of slowly diverging with the oscillator difference.
+class ClockSync
+{
+public:
+	static uint64_t hostNowUs()
+	{
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+										 std::chrono::steady_clock::now().time_since_epoch())
+										 .count());
+	}
+
+	// Feeds one observation pair; called at frame rate from the fetch paths
+	void observe(const uint64_t deviceUs)
+	{
+		const int64_t offset = static_cast<int64_t>(hostNowUs()) - static_cast<int64_t>(deviceUs);
+		std::lock_guard<std::mutex> lock(mutex_);
+		++samples_;
+		if (samples_ == 1 || deviceUs - curWindowStart_ > windowSpanUs)
+		{
+			if (samples_ > 1)
+			{
+				prevMinOffset_ = curMinOffset_;
+				prevAnchor_ = curAnchor_;
+				havePrev_ = true;
+			}
+			curWindowStart_ = deviceUs;
+			curMinOffset_ = offset;
+			curAnchor_ = deviceUs;
+		}
+		else if (offset < curMinOffset_)
+		{
+			curMinOffset_ = offset;
+			curAnchor_ = deviceUs;
+		}
+	}
+
+	// Snapshot of the current estimate, for converting without holding the lock
+	struct Estimate
+	{
+		int64_t offsetUs;   // host - device at the anchor
+		uint64_t anchorUs;  // device time of the lowest-latency sample
+		double drift;       // d(offset)/d(deviceTime), dimensionless
+	};
+
+	Estimate estimate() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (samples_ == 0)
+			throw std::runtime_error("to_host_time: no timestamp observations yet; fetch some frames first");
+		double drift = 0;
+		if (havePrev_ && curAnchor_ != prevAnchor_)
+		{
+			drift = static_cast<double>(curMinOffset_ - prevMinOffset_) / static_cast<double>(curAnchor_ - prevAnchor_);
+			// An estimate beyond 1000 ppm is a latency artifact, not a real oscillator difference
+			drift = std::max(-1e-3, std::min(1e-3, drift));
+		}
+		return {curMinOffset_, curAnchor_, drift};
+	}
+
+	uint64_t sampleCount() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return samples_;
+	}
+
+	static uint64_t toHost(const Estimate& est, const uint64_t deviceUs)
+	{
+		const double corrected = static_cast<double>(est.offsetUs)
+							   + est.drift * (static_cast<double>(deviceUs) - static_cast<double>(est.anchorUs));
+		return deviceUs + static_cast<int64_t>(corrected);
+	}
+
+private:
+	static constexpr uint64_t windowSpanUs = 10 * 1000 * 1000; // 10 s min-filter windows
+
+	mutable std::mutex mutex_;
+	uint64_t samples_ = 0;
+	uint64_t curWindowStart_ = 0;
+	int64_t curMinOffset_ = 0;
+	uint64_t curAnchor_ = 0;
+	int64_t prevMinOffset_ = 0;
+	uint64_t prevAnchor_ = 0;
+	bool havePrev_ = false;
+};
+
+ClockSync& clockSync()
+{
+	static ClockSync sync;
+	return sync;
+}
+
+// Streaming histogram of how stale gaze data is when a fetch returns it:
+// host_now - to_host(frame_timestamp), in microseconds. Reuses the log2-bucket
+// PerfRecord so the quantile machinery is shared with the perf instrumentation.
+// Measured natively at the fetch site, so the probe does not perturb what it
+// measures the way a Python-side timer does.
+PerfRecord& gazeAgeRecord()
+{
+	static PerfRecord* const record = [] {
+		auto* const r = new PerfRecord;
+		r->name = "gaze_age";
+		return r;
+	}();
+	return *record;
+}
+
+// Called right after a successful fetch fed the estimator, so an estimate exists
+void recordGazeAge(const uint64_t deviceUs)
+{
+	const uint64_t host = ClockSync::toHost(clockSync().estimate(), deviceUs);
+	const uint64_t now = ClockSync::hostNowUs();
+	if (now > host)
+		gazeAgeRecord().add(now - host);
+}
+
+// Always-on frame delivery accounting: consecutive frame-id gaps observed at
+// fetch time, and wait durations measured against a configurable deadline.
+// Counter bumps under a mutex at frame rate are far too cheap to gate behind
+// perf_enable; the per-hour buckets give reliability SLOs their time axis.
+struct FrameHealth
+{
+	std::mutex mutex;
+	uint64_t deadlineUs = 12000; // ~one 120 Hz period plus scheduling margin
+	uint64_t framesObserved = 0;
+	uint64_t framesDropped = 0; // sum of the id gaps
+	uint64_t dropEvents = 0;    // number of gaps, regardless of width
+	uint64_t waits = 0;
+	uint64_t overruns = 0;
+	uint64_t longestStallUs = 0;
+	uint64_t lastId = 0;
+	bool hasLastId = false;
+
+	// Ring of the last 24 wall-clock hours, keyed by absolute hour number so
+	// stale entries are recognized and recycled lazily
+	struct HourBucket
+	{
+		uint64_t hour = 0; // hostNowUs / 1 hour; 0 = never used
+		uint64_t frames = 0;
+		uint64_t drops = 0;
+		uint64_t overruns = 0;
+	};
+	static constexpr size_t hourCount = 24;
+	HourBucket hours[hourCount];
+
+	HourBucket& bucketNow()
+	{
+		const uint64_t hour = ClockSync::hostNowUs() / (3600ull * 1000 * 1000);
+		HourBucket& bucket = hours[hour % hourCount];
+		if (bucket.hour != hour)
+			bucket = HourBucket{hour, 0, 0, 0};
+		return bucket;
+	}
+};
+
+FrameHealth& frameHealth()
+{
+	static FrameHealth health;
+	return health;
+}
+
+// Fed from every successful eye-tracking fetch: frame ids are consecutive, so
+// a gap between the ids of adjacent fetches is frames the service produced
+// but this client never saw
+void frameHealthObserveId(const uint64_t id)
+{
+	FrameHealth& health = frameHealth();
+	std::lock_guard<std::mutex> lock(health.mutex);
+	FrameHealth::HourBucket& bucket = health.bucketNow();
+	if (health.hasLastId && id == health.lastId)
+		return; // same frame refetched; not a new observation
+	++health.framesObserved;
+	++bucket.frames;
+	if (health.hasLastId && id > health.lastId + 1)
+	{
+		const uint64_t gap = id - health.lastId - 1;
+		health.framesDropped += gap;
+		++health.dropEvents;
+		bucket.drops += gap;
+	}
+	health.lastId = id; // a service restart resets ids; just re-anchor
+	health.hasLastId = true;
+}
+
+void frameHealthRecordWait(const uint64_t durationUs)
+{
+	FrameHealth& health = frameHealth();
+	std::lock_guard<std::mutex> lock(health.mutex);
+	++health.waits;
+	if (durationUs > health.longestStallUs)
+		health.longestStallUs = durationUs;
+	if (durationUs > health.deadlineUs)
+	{
+		++health.overruns;
+		++health.bucketNow().overruns;
+	}
+}
+
+// Drop-in for fove_Headset_waitForProcessedEyeFrame that feeds the wait
+// duration into the frame health accounting; used by the binding and by the
+// pump threads so every wait is accounted the same way
+Fove_ErrorCode waitForProcessedEyeFrameTimed(Fove_Headset* const headset)
+{
+	const auto start = std::chrono::steady_clock::now();
+	const Fove_ErrorCode err = fove_Headset_waitForProcessedEyeFrame(headset);
+	if (err == Fove_ErrorCode::None)
+		frameHealthRecordWait(static_cast<uint64_t>(
+			std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()));
+	return err;
+}
+
+// Live pumps the metrics exporter samples for queue depth. Pumps register a
+// stats callback (reading only their atomics) on construction and unregister
+// on destruction, so the exporter never holds a pointer into a dead object.
+struct MetricsPumpStats
+{
+	uint64_t queued;
+	uint64_t captured;
+	uint64_t dropped;
+};
+
+struct MetricsPumps
+{
+	std::mutex mutex;
+	std::map<const void*, std::function<MetricsPumpStats()>> pumps;
+};
+
+MetricsPumps& metricsPumps()
+{
+	static MetricsPumps pumps;
+	return pumps;
+}
+
+// Serializes every native instrumentation surface (per-call histograms, gaze
+// age, frame health, pump queue depths) into Prometheus text exposition format.
+// Called from the flusher thread (or synchronously when no flusher runs), never
+// from a capture or submit path.
+std::string buildMetricsText()
+{
+	std::string out;
+	out.reserve(4096);
+	const auto line = [&out](const char* const name, const std::string& labels, const uint64_t value) {
+		out += name;
+		if (!labels.empty())
+		{
+			out += '{';
+			out += labels;
+			out += '}';
+		}
+		out += ' ';
+		out += std::to_string(value);
+		out += '\n';
+	};
+
+	// Per-call latency records (populated once perf_enable is on)
+	{
+		PerfRegistry& registry = perfRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		for (const auto& record : registry.records)
+		{
+			const std::string labels = "call=\"" + record->name + "\"";
+			const uint64_t count = record->count.load();
+			line("fove_call_count", labels, count);
+			if (count > 0)
+			{
+				line("fove_call_total_ns", labels, record->totalNs.load());
+				line("fove_call_max_ns", labels, record->maxNs.load());
+				line("fove_call_p50_ns", labels, record->quantileNs(0.50));
+				line("fove_call_p95_ns", labels, record->quantileNs(0.95));
+				line("fove_call_p99_ns", labels, record->quantileNs(0.99));
+			}
+		}
+	}
+
+	// Gaze data age at fetch time (the buckets hold microseconds here)
+	{
+		const PerfRecord& record = gazeAgeRecord();
+		const uint64_t count = record.count.load();
+		line("fove_gaze_age_count", {}, count);
+		if (count > 0)
+		{
+			line("fove_gaze_age_mean_us", {}, record.totalNs.load() / count);
+			line("fove_gaze_age_max_us", {}, record.maxNs.load());
+			line("fove_gaze_age_p50_us", {}, record.quantileNs(0.50));
+			line("fove_gaze_age_p95_us", {}, record.quantileNs(0.95));
+			line("fove_gaze_age_p99_us", {}, record.quantileNs(0.99));
+		}
+	}
+
+	// Always-on frame delivery accounting
+	{
+		FrameHealth& health = frameHealth();
+		std::lock_guard<std::mutex> lock(health.mutex);
+		line("fove_frames_observed", {}, health.framesObserved);
+		line("fove_frames_dropped", {}, health.framesDropped);
+		line("fove_frame_drop_events", {}, health.dropEvents);
+		line("fove_frame_waits", {}, health.waits);
+		line("fove_frame_wait_overruns", {}, health.overruns);
+		line("fove_frame_longest_stall_us", {}, health.longestStallUs);
+		line("fove_frame_wait_deadline_us", {}, health.deadlineUs);
+	}
+
+	// One series per live pump, indexed by registration order within the scrape
+	{
+		MetricsPumps& pumps = metricsPumps();
+		std::lock_guard<std::mutex> lock(pumps.mutex);
+		int index = 0;
+		for (const auto& entry : pumps.pumps)
+		{
+			const MetricsPumpStats stats = entry.second();
+			const std::string labels = "pump=\"" + std::to_string(index++) + "\"";
+			line("fove_pump_queued", labels, stats.queued);
+			line("fove_pump_captured", labels, stats.captured);
+			line("fove_pump_dropped", labels, stats.dropped);
+		}
+	}
+
+	return out;
+}
+
+// Rebuilds the exposition text periodically on a background thread, so a scrape
+// handler pays one string copy instead of walking every stats surface under its
+// locks at request time. While no flusher runs, `metrics_text` falls back to a
+// synchronous build, which keeps the function usable without configuration.
+class MetricsFlusher
+{
+public:
+	// Starts (or retunes) the flusher; 0 stops the thread. Called with the GIL held.
+	void configure(const uint64_t intervalMs)
+	{
+		std::lock_guard<std::mutex> configLock(configMutex_);
+		intervalMs_.store(intervalMs);
+		if (intervalMs == 0)
+		{
+			stop();
+			return;
+		}
+		wake_.notify_all(); // pick up the new interval without waiting out the old one
+		if (!thread_.joinable())
+		{
+			running_.store(true);
+			thread_ = std::thread([this] { run(); });
+		}
+	}
+
+	std::string text()
+	{
+		if (!running_.load())
+			return buildMetricsText(); // flusher idle: build on demand
+		std::lock_guard<std::mutex> lock(textMutex_);
+		return text_;
+	}
+
+	uint64_t intervalMs() const { return intervalMs_.load(); }
+
+	// Called with the GIL held, from the module teardown capsule
+	void shutdown()
+	{
+		std::lock_guard<std::mutex> configLock(configMutex_);
+		stop();
+	}
+
+private:
+	void stop()
+	{
+		if (!thread_.joinable())
+			return;
+		running_.store(false);
+		wake_.notify_all();
+		py::gil_scoped_release release;
+		thread_.join();
+	}
+
+	void run()
+	{
+		const WorkerScope worker("metrics");
+		while (running_.load(std::memory_order_relaxed))
+		{
+			std::string built = buildMetricsText(); // outside textMutex_, so scrapes never wait on a build
+			{
+				std::lock_guard<std::mutex> lock(textMutex_);
+				text_.swap(built);
+			}
+			std::unique_lock<std::mutex> lock(wakeMutex_);
+			wake_.wait_for(lock, std::chrono::milliseconds(intervalMs_.load()), [this] { return !running_.load(); });
+		}
+	}
+
+	std::mutex configMutex_; // serializes configure/shutdown
+	std::mutex textMutex_;   // guards text_
+	std::string text_;
+	std::thread thread_;
+	std::atomic<bool> running_{false};
+	std::atomic<uint64_t> intervalMs_{0};
+	std::condition_variable wake_;
+	std::mutex wakeMutex_;
+};
+
+MetricsFlusher& metricsFlusher()
+{
+	static MetricsFlusher* const flusher = new MetricsFlusher; // leaked deliberately; the thread stops via the module teardown capsule
+	return *flusher;
+}
+
+#if FOVE_HAS_FEATURE(FOVE_FEATURE_CALIBRATION_GUI)
+
+// Client-side interpolation between calibration ticks: every successful
+// Headset_tickEyeTrackingCalibration records its targets against the host
+// clock, and calibration_targets_at serves positions lerped between the last
+// two ticks. A renderer can then tick the service at a low rate and still draw
+// smooth target motion every display frame, instead of paying the full
+// callback-and-copy cost of a tick per frame. Interpolated positions lag one
+// tick interval behind the service (the price of interpolating rather than
+// extrapolating), which is imperceptible for calibration visuals.
+struct CalibrationTargetLerp
+{
+	struct Sample
+	{
+		uint64_t hostUs = 0;
+		Fove_CalibrationTarget targetL = {};
+		Fove_CalibrationTarget targetR = {};
+	};
+
+	std::mutex mutex;
+	Sample samples[2]; // [0] = older, [1] = newer
+	int count = 0;
+	static constexpr uint64_t staleUs = 500 * 1000; // ticking stopped; restart rather than sweep across the gap
+
+	void observe(const Fove_CalibrationTarget& targetL, const Fove_CalibrationTarget& targetR)
+	{
+		const uint64_t nowUs = ClockSync::hostNowUs();
+		std::lock_guard<std::mutex> lock(mutex);
+		if (count > 0 && nowUs - samples[count - 1].hostUs > staleUs)
+			count = 0;
+		if (count == 2)
+		{
+			samples[0] = samples[1];
+			count = 1;
+		}
+		samples[count++] = Sample{nowUs, targetL, targetR};
+	}
+
+	static Fove_CalibrationTarget lerpTarget(const Fove_CalibrationTarget& a, const Fove_CalibrationTarget& b, const float u)
+	{
+		Fove_CalibrationTarget out = {};
+		out.position = Fove_Vec3{
+			a.position.x + (b.position.x - a.position.x) * u,
+			a.position.y + (b.position.y - a.position.y) * u,
+			a.position.z + (b.position.z - a.position.z) * u};
+		out.recommendedSize = a.recommendedSize + (b.recommendedSize - a.recommendedSize) * u;
+		return out;
+	}
+
+	bool at(const uint64_t nowUs, Fove_CalibrationTarget& outL, Fove_CalibrationTarget& outR)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (count == 0)
+			return false;
+		if (count == 1 || samples[1].hostUs <= samples[0].hostUs)
+		{
+			outL = samples[count - 1].targetL;
+			outR = samples[count - 1].targetR;
+			return true;
+		}
+		const float intervalUs = static_cast<float>(samples[1].hostUs - samples[0].hostUs);
+		float u = static_cast<float>(static_cast<int64_t>(nowUs - samples[1].hostUs)) / intervalUs;
+		u = std::max(0.0f, std::min(1.0f, u));
+		outL = lerpTarget(samples[0].targetL, samples[1].targetL, u);
+		outR = lerpTarget(samples[0].targetR, samples[1].targetR, u);
+		return true;
+	}
+};
+
+CalibrationTargetLerp& calibrationTargetLerp()
+{
+	static CalibrationTargetLerp lerp;
+	return lerp;
+}
+
+#endif // FOVE_FEATURE_CALIBRATION_GUI
+
+} // namespace
+
+void bind_ClockSync(py::module& m)
+{
+	m.def(
+		"to_host_time", [](const uint64_t deviceUs) {
+			return ClockSync::toHost(clockSync().estimate(), deviceUs);
+		},
+		py::arg("timestamp"),
+		R"(Converts a device timestamp to the host monotonic clock (CLOCK_MONOTONIC), in microseconds
+
+The device-to-host mapping is estimated natively from every timestamp fetch:
+a min filter over 10-second windows isolates the lowest-latency observations,
+and the slope between consecutive windows corrects oscillator drift, so the
+conversion stays aligned across long sessions.
+
+\param timestamp A timestamp in the `FrameTimestamp` domain (microseconds since an unspecified epoch)
+\return The corresponding host monotonic time in microseconds
+\see clock_sync_stats
+)");
+
+	m.def(
+		"to_host_time", [](const py::array_t<uint64_t, py::array::c_style | py::array::forcecast>& timestamps) {
+			const ClockSync::Estimate est = clockSync().estimate();
+			py::array_t<uint64_t> out{timestamps.size()};
+			const uint64_t* const src = timestamps.data();
+			uint64_t* const dst = static_cast<uint64_t*>(out.request().ptr);
+			const py::ssize_t n = timestamps.size();
+			{
+				py::gil_scoped_release release;
+				for (py::ssize_t i = 0; i < n; ++i)
+					dst[i] = ClockSync::toHost(est, src[i]);
+			}
+			return out;
+		},
+		py::arg("timestamps"),
+		R"(Batch variant of `to_host_time`: converts an array of device timestamps in one call
+
+\param timestamps A uint64 array of timestamps in the `FrameTimestamp` domain
+\return A uint64 array of host monotonic times in microseconds
+)");
+
+	m.def(
+		"gaze_age_stats", []() {
+			py::dict stats;
+			const PerfRecord& record = gazeAgeRecord();
+			const uint64_t count = record.count.load();
+			stats["count"] = count;
+			if (count > 0)
+			{
+				stats["mean_us"] = record.totalNs.load() / count; // buckets hold microseconds here
+				stats["max_us"] = record.maxNs.load();
+				stats["p50_us"] = record.quantileNs(0.50);
+				stats["p95_us"] = record.quantileNs(0.95);
+				stats["p99_us"] = record.quantileNs(0.99);
+			}
+			return stats;
+		},
+		R"(Returns the distribution of gaze data age at fetch time
+
+The age of each fetched frame (host time at the fetch minus the frame timestamp
+converted with the clock-sync estimate) is accumulated natively inside
+`Headset_fetchEyeTrackingData`, so latency SLOs can be verified without an
+external capture rig and without Python-side timing perturbing the measurement.
+
+\return A dict with `count` and, once fetches occurred, `mean_us`, `max_us` and
+        histogram-derived `p50_us`/`p95_us`/`p99_us` (upper bounds of log2 buckets)
+\see to_host_time
+)");
+
+	m.def(
+		"gaze_age_reset", []() { gazeAgeRecord().reset(); },
+		"Resets the gaze age distribution to empty");
+
+	m.def(
+		"frame_health", []() {
+			FrameHealth& health = frameHealth();
+			std::lock_guard<std::mutex> lock(health.mutex);
+			const uint64_t currentHour = ClockSync::hostNowUs() / (3600ull * 1000 * 1000);
+			py::list hours;
+			for (uint64_t ago = 0; ago < FrameHealth::hourCount && ago <= currentHour; ++ago)
+			{
+				const FrameHealth::HourBucket& bucket = health.hours[(currentHour - ago) % FrameHealth::hourCount];
+				if (bucket.hour != currentHour - ago || (bucket.frames == 0 && bucket.drops == 0 && bucket.overruns == 0))
+					continue; // slot belongs to another hour, or saw no activity
+				py::dict entry;
+				entry["hours_ago"] = ago;
+				entry["frames"] = bucket.frames;
+				entry["drops"] = bucket.drops;
+				entry["overruns"] = bucket.overruns;
+				hours.append(std::move(entry));
+			}
+			py::dict report;
+			report["frames"] = health.framesObserved;
+			report["dropped_frames"] = health.framesDropped;
+			report["drop_events"] = health.dropEvents;
+			report["waits"] = health.waits;
+			report["overruns"] = health.overruns;
+			report["longest_stall_us"] = health.longestStallUs;
+			report["deadline_us"] = health.deadlineUs;
+			report["hours"] = std::move(hours);
+			return report;
+		},
+		R"(Returns the always-on frame delivery accounting
+
+Every successful eye-tracking fetch checks the frame id against the previous
+one (a gap is frames the service produced but this client never saw), and every
+`Headset_waitForProcessedEyeFrame` — called directly or inside the pump,
+aligner, group and recorder threads — is measured against the configured
+deadline. The accounting is a few counter bumps per frame and is always on.
+
+\return A dict with `frames`, `dropped_frames`, `drop_events`, `waits`,
+        `overruns`, `longest_stall_us`, `deadline_us` and `hours`, a list of
+        per-hour buckets (`hours_ago`, `frames`, `drops`, `overruns`) covering
+        the last 24 wall-clock hours with activity
+\see set_frame_deadline, frame_health_reset
+)");
+
+	m.def(
+		"set_frame_deadline", [](const uint64_t deadlineUs) {
+			if (deadlineUs == 0)
+				throw std::runtime_error("set_frame_deadline: the deadline must be positive");
+			FrameHealth& health = frameHealth();
+			std::lock_guard<std::mutex> lock(health.mutex);
+			health.deadlineUs = deadlineUs;
+		},
+		py::arg("deadline_us"),
+		R"(Sets the wait-duration deadline used by the frame health accounting
+
+\param deadline_us Waits longer than this count as overruns; the default is
+       12000 (one 120 Hz frame period plus scheduling margin)
+\see frame_health
+)");
+
+	m.def(
+		"frame_health_reset", []() {
+			FrameHealth& health = frameHealth();
+			std::lock_guard<std::mutex> lock(health.mutex);
+			health.framesObserved = health.framesDropped = health.dropEvents = 0;
+			health.waits = health.overruns = health.longestStallUs = 0;
+			health.hasLastId = false;
+			for (FrameHealth::HourBucket& bucket : health.hours)
+				bucket = FrameHealth::HourBucket{};
+		},
+		"Resets the frame health counters and hour buckets (the deadline is kept)");
+
+	m.def(
+		"clock_sync_stats", []() {
+			py::dict stats;
+			stats["samples"] = clockSync().sampleCount();
+			try
+			{
+				const ClockSync::Estimate est = clockSync().estimate();
+				stats["offset_us"] = est.offsetUs;
+				stats["drift_ppm"] = est.drift * 1e6;
+			}
+			catch (const std::runtime_error&)
+			{
+				// No observations yet; report the sample count only
+			}
+			return stats;
+		},
+		R"(Returns the state of the device-to-host clock estimator
+
+\return A dict with `samples` and, once observations exist, `offset_us` and `drift_ppm`
+)");
+
+	m.def(
+		"metrics_configure", [](const uint64_t intervalMs) { metricsFlusher().configure(intervalMs); },
+		py::arg("interval_ms") = 1000,
+		R"(Starts, retunes or stops the background metrics flusher
+
+While the flusher runs, the Prometheus exposition text served by `metrics_text`
+is rebuilt on a native background thread at this interval, so a scrape handler
+pays one string copy instead of walking every stats surface at request time.
+
+\param interval_ms The rebuild period in milliseconds (default 1000); 0 stops the flusher
+\see metrics_text
+)");
+
+	m.def(
+		"metrics_text", []() {
+			std::string text;
+			{
+				py::gil_scoped_release release;
+				text = metricsFlusher().text();
+			}
+			return text;
+		},
+		R"(Returns the native instrumentation surfaces in Prometheus text exposition format
+
+One call covers the per-call latency records (once `perf_enable` is on), the
+gaze age distribution, the frame health counters and the queue depth of every
+live frame pump, replacing a Python-side thread that polls the individual stats
+functions and formats text. With the flusher running (`metrics_configure`), the
+returned string is the most recent snapshot, preformatted off the hot path;
+otherwise it is built synchronously in this call.
+
+\return The exposition text (`fove_call_*`, `fove_gaze_age_*`, `fove_frame*`, `fove_pump_*`)
+\see metrics_configure
+)");
+
+	m.add_object("_metrics_teardown", py::capsule(&metricsFlusher(), [](void* flusher) {
+					 static_cast<MetricsFlusher*>(flusher)->shutdown();
+				 }));
+}
+
+////////////////////////////////////////////////////////////////
+// Status query cache
+
+namespace
+{
+
+// Plugins gate per-frame behavior on feature-access and status queries whose
+// answers change only on license changes, reconnects or rare state
+// transitions, yet each query is string marshalling plus an IPC round-trip.
+// Repeat queries are served from this process-wide cache instead: feature
+// access is cached until explicitly invalidated (license activation or
+// deactivation, reconnect), the isEyeTrackingEnabled-class booleans for a
+// short TTL bounding how stale an externally-changed answer can get.
+struct StatusCache
+{
+	std::mutex mutex;
+	std::map<std::pair<Fove_Headset*, std::string>, bool> featureAccess;
+
+	struct Timed
+	{
+		bool value;
+		uint64_t expiresUs;
+	};
+	std::map<std::pair<Fove_Headset*, const char*>, Timed> status; // keyed by the literal's address
+	uint64_t ttlUs = 500 * 1000;
+	uint64_t hits = 0;
+	uint64_t misses = 0;
+};
+
+StatusCache& statusCache()
+{
+	static StatusCache cache;
+	return cache;
+}
+
+void statusCacheInvalidate()
+{
+	StatusCache& cache = statusCache();
+	std::lock_guard<std::mutex> lock(cache.mutex);
+	cache.featureAccess.clear();
+	cache.status.clear();
+}
+
+// The profile list and current-profile name change only through the profile
+// mutators (or out of process), yet profile UIs poll them every frame around
+// participant switches. Both answers are cached per headset: the list keeps
+// its Python tuple identity across unchanged polls, and every mutator binding
+// below invalidates on success. Invalidation only clears the valid flags (no
+// Python refcounting), so it is safe from the reconnect supervisor's thread;
+// the cached objects themselves are only touched under the GIL.
+struct ProfileCache
+{
+	py::object list; // the cached tuple identity returned by Headset_listProfiles
+	bool listValid = false;
+	std::string current;
+	bool currentValid = false;
+};
+
+std::map<Fove_Headset*, ProfileCache>& profileCaches()
+{
+	// Deliberately leaked: the held Python objects must not be released after
+	// interpreter teardown
+	static auto* const caches = new std::map<Fove_Headset*, ProfileCache>();
+	return *caches;
+}
+
+void profileCacheInvalidate()
+{
+	for (auto& entry : profileCaches())
+	{
+		entry.second.listValid = false;
+		entry.second.currentValid = false;
+	}
+}
+
+// Serves a `(headset, out bool)` status getter from the cache while the entry
+// is fresh; `name` must be a string literal, it doubles as the map key
+template <typename Fn>
+Fove_ErrorCode cachedStatusQuery(const char* const name, Headset& headset, Obj<bool>& out, const Fn fn)
+{
+	StatusCache& cache = statusCache();
+	const uint64_t now = ClockSync::hostNowUs();
+	{
+		std::lock_guard<std::mutex> lock(cache.mutex);
+		const auto entry = cache.status.find({headset.val, name});
+		if (entry != cache.status.end() && now < entry->second.expiresUs)
+		{
+			out.val = entry->second.value;
+			++cache.hits;
+			return Fove_ErrorCode::None;
+		}
+	}
+	const Fove_ErrorCode err = fn();
+	std::lock_guard<std::mutex> lock(cache.mutex);
+	++cache.misses;
+	if (err == Fove_ErrorCode::None)
+		cache.status[{headset.val, name}] = {out.val, now + cache.ttlUs};
+	return err;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////
+// Connection supervisor
+
+namespace
+{
+
+// Re-establishes the service connection in the background. Detection is
+// central: every instrumented call reports Connect_NotConnected through
+// noteConnectionError (bindings_common.h), which flips the process-wide down
+// flag so subsequent calls answer from the cached error without attempting
+// IPC. This thread then probes the service with exponential backoff and
+// clears the flag once it answers, so a service restart costs a handful of
+// probe calls instead of a retry storm through the full binding stack.
+class ConnectionSupervisor
+{
+public:
+	~ConnectionSupervisor()
+	{
+		// The worker's notify() takes the GIL for the on_change callback, so
+		// joining while holding it would deadlock; release it around the join
+		// the same way stop() does
+		py::gil_scoped_release release;
+		stopThread();
+	}
+
+	ConnectionSupervisor() = default;
+	ConnectionSupervisor(const ConnectionSupervisor&) = delete;
+	ConnectionSupervisor& operator=(const ConnectionSupervisor&) = delete;
+
+	Fove_ErrorCode start(py::object headsetObj, py::object onChange, const uint64_t initialBackoffMs, const uint64_t maxBackoffMs)
+	{
+		if (running_.load())
+			return Fove_ErrorCode::API_InvalidArgument;
+		Headset& headset = headsetObj.cast<Headset&>();
+		headsetObj_ = std::move(headsetObj); // keeps the headset alive while the supervisor runs
+		headset_ = headset;
+		onChange_ = std::move(onChange);
+		initialBackoffMs_ = std::max<uint64_t>(1, initialBackoffMs);
+		maxBackoffMs_ = std::max(initialBackoffMs_, maxBackoffMs);
+		probes_.store(0);
+		reconnects_.store(0);
+		connectionState().down.store(false);
+		connectionState().supervised.store(true);
+		running_.store(true);
+		thread_ = std::thread([this] { run(); });
+		return Fove_ErrorCode::None;
+	}
+
+	void stop()
+	{
+		{
+			py::gil_scoped_release release;
+			stopThread();
+		}
+		connectionState().supervised.store(false);
+		connectionState().down.store(false);
+		headsetObj_ = py::object();
+		onChange_ = py::object();
+	}
+
+	bool isRunning() const { return running_.load(); }
+	bool isDown() const { return connectionDown(); }
+	uint64_t probes() const { return probes_.load(); }
+	uint64_t reconnects() const { return reconnects_.load(); }
+
+private:
+	void stopThread()
+	{
+		running_.store(false);
+		if (thread_.joinable())
+			thread_.join();
+	}
+
+	void run()
+	{
+		const WorkerScope worker("supervisor");
+		bool wasDown = false;
+		uint64_t backoffMs = initialBackoffMs_;
+		while (running_.load(std::memory_order_relaxed))
+		{
+			if (!connectionState().down.load(std::memory_order_relaxed))
+			{
+				wasDown = false;
+				backoffMs = initialBackoffMs_;
+				sleepInterruptibly(20);
+				continue;
+			}
+			if (!wasDown)
+			{
+				wasDown = true;
+				notify(false);
+			}
+			sleepInterruptibly(backoffMs);
+			if (!running_.load(std::memory_order_relaxed))
+				break;
+			// Probe past the short-circuit with a direct, cheap query; any answer
+			// other than Connect_NotConnected means the service is back
+			bool connected = false;
+			probes_.fetch_add(1);
+			if (fove_Headset_isHardwareConnected(headset_, &connected) != Fove_ErrorCode::Connect_NotConnected)
+			{
+				statusCacheInvalidate(); // licenses may differ across a service restart
+				profileCacheInvalidate(); // as may the profile set
+				connectionState().down.store(false, std::memory_order_relaxed);
+				reconnects_.fetch_add(1);
+				notify(true);
+			}
+			else
+				backoffMs = std::min(backoffMs * 2, maxBackoffMs_);
+		}
+	}
+
+	// Sleeps in small slices so `stop` never waits out a long backoff
+	void sleepInterruptibly(uint64_t ms)
+	{
+		while (ms > 0 && running_.load(std::memory_order_relaxed))
+		{
+			const uint64_t slice = std::min<uint64_t>(ms, 20);
+			std::this_thread::sleep_for(std::chrono::milliseconds(slice));
+			ms -= slice;
+		}
+	}
+
+	void notify(const bool connected)
+	{
+		if (!onChange_ || onChange_.is_none())
+			return;
+		py::gil_scoped_acquire acquire;
+		try
+		{
+			onChange_(connected);
+		}
+		catch (py::error_already_set& e)
+		{
+			e.discard_as_unraisable("ConnectionSupervisor on_change callback");
+		}
+	}
+
+	std::atomic<bool> running_{false};
+	std::thread thread_;
+	py::object headsetObj_;
+	Fove_Headset* headset_ = nullptr;
+	py::object onChange_;
+	uint64_t initialBackoffMs_ = 100;
+	uint64_t maxBackoffMs_ = 5000;
+	std::atomic<uint64_t> probes_{0};
+	std::atomic<uint64_t> reconnects_{0};
+};
+
+} // namespace
+
+void defstruct_ConnectionSupervisor(py::module& m)
+{
+	py::class_<ConnectionSupervisor>(m, "ConnectionSupervisor",
+									 R"(Re-establishes the service connection in the background
+
+When FoveService restarts, every binding call otherwise returns
+#Fove_ErrorCode_Connect_NotConnected after a full IPC attempt, and retry loops
+burn CPU. While a supervisor runs, the first `Connect_NotConnected` seen by any
+binding call marks the connection down: subsequent calls answer the cached
+error immediately with no IPC, and the supervisor thread probes the service
+with exponential backoff, restoring normal dispatch once it answers.
+
+The optional `on_change` callback is invoked from the supervisor thread with
+`False` when the connection is lost and `True` when it is re-established.)")
+		.def(py::init<>())
+		.def("start", &ConnectionSupervisor::start,
+			 py::arg("headset"), py::arg("on_change") = py::none(),
+			 py::arg("initial_backoff_ms") = 100, py::arg("max_backoff_ms") = 5000,
+			 R"(Starts supervising the connection of the given headset
+
+\param headset The headset whose connection to supervise; kept alive until `stop`
+\param on_change Callable taking one bool, invoked on every connection state change
+\param initial_backoff_ms First probe delay after a detected disconnect
+\param max_backoff_ms Upper bound the probe delay doubles towards
+\return #Fove_ErrorCode_None if the supervisor started\n
+        #Fove_ErrorCode_API_InvalidArgument if it is already running
+)")
+		.def("stop", &ConnectionSupervisor::stop,
+			 "Stops the supervisor thread and restores normal call dispatch")
+		.def_property_readonly("running", &ConnectionSupervisor::isRunning, "Whether the supervisor thread is currently running")
+		.def_property_readonly("down", &ConnectionSupervisor::isDown, "Whether calls are currently short-circuited to `Connect_NotConnected`")
+		.def_property_readonly("probes", &ConnectionSupervisor::probes, "Number of reconnection probes sent since `start`")
+		.def_property_readonly("reconnects", &ConnectionSupervisor::reconnects, "Number of times the connection was re-established");
+}
+
+////////////////////////////////////////////////////////////////
+// Frame pump
+
+namespace
+{
+
+// A fixed-size record of one eye frame, suitable for a numpy structured dtype.
+// Unlike Python_EyeTrackingSnapshot this is free of enum class members (numpy
+// has no dtype for those), so states and error codes are stored as plain ints.
+// No NSDMIs here either: pybind11 requires the numpy-dtype structs to be PODs.
+struct PumpSnapshot
+{
+	uint64_t frameId;
+	uint64_t timestamp;
+	Fove_Vec3 gazeVectorLeft;
+	Fove_Vec3 gazeVectorRight;
+	Fove_Vec3 gazeVectorRawLeft;
+	Fove_Vec3 gazeVectorRawRight;
+	float pupilRadiusLeft;
+	float pupilRadiusRight;
+	float irisRadiusLeft;
+	float irisRadiusRight;
+	int32_t eyeStateLeft;
+	int32_t eyeStateRight;
+	uint8_t eyeBlinkingLeft;
+	uint8_t eyeBlinkingRight;
+	Fove_Ray combinedRay;
+	float combinedDepth;
+	float gazeVelocityLeft;       // deg/s, NaN until the differentiator has history
+	float gazeVelocityRight;      // deg/s
+	float gazeAccelerationLeft;   // deg/s^2, NaN until two velocity samples exist
+	float gazeAccelerationRight;  // deg/s^2
+	int16_t errGazeVectorLeft;
+	int16_t errGazeVectorRight;
+	int16_t errGazeVectorRawLeft;
+	int16_t errGazeVectorRawRight;
+	int16_t errPupilRadiusLeft;
+	int16_t errPupilRadiusRight;
+	int16_t errIrisRadiusLeft;
+	int16_t errIrisRadiusRight;
+	int16_t errEyeStateLeft;
+	int16_t errEyeStateRight;
+	int16_t errEyeBlinkingLeft;
+	int16_t errEyeBlinkingRight;
+	int16_t errCombinedRay;
+	int16_t errCombinedDepth;
+	// Appended after the error block on purpose: packed recordings index
+	// columns by table position (see pumpColumns), so new fields go last
+	int32_t gazedObjectId;      // closest local GazeCastScene hit, fove_ObjectIdInvalid when none
+	Fove_Vec3 gazedObjectPoint; // world-space hit point; zero while gazedObjectId is invalid
+};
+
+size_t roundUpPow2(size_t v)
+{
+	size_t p = 1;
+	while (p < v)
+		p <<= 1;
+	return p;
+}
+
+// Live local gaze-object channel: intersects the snapshot's combined gaze ray
+// against the GazeCastScene attached to the pump, if any (see
+// GazeCastScene.attachToPump). Defined next to the scene class below; builds
+// without the gazable-objects feature get the empty channel.
+void fillGazeObjectHit(PumpSnapshot& rec);
+#if !FOVE_HAS_FEATURE(FOVE_FEATURE_GAZABLE_OBJECTS)
+void fillGazeObjectHit(PumpSnapshot& rec)
+{
+	rec.gazedObjectId = fove_ObjectIdInvalid;
+	rec.gazedObjectPoint = {};
+}
+#endif
+
+// Runs one fetch/get cycle, writing every channel of the frame into `rec`
+void fillPumpSnapshot(Fove_Headset* headset, PumpSnapshot& rec)
+{
+	Fove_FrameTimestamp timestamp = {};
+	if (fove_Headset_fetchEyeTrackingData(headset, &timestamp) == Fove_ErrorCode::None)
+	{
+		clockSync().observe(timestamp.timestamp); // feed the clock-domain estimator
+		recordGazeAge(timestamp.timestamp);
+		frameHealthObserveId(timestamp.id);
+	}
+	rec.frameId = timestamp.id;
+	rec.timestamp = timestamp.timestamp;
+	rec.errGazeVectorLeft = static_cast<int16_t>(fove_Headset_getGazeVector(headset, Fove_Eye::Left, &rec.gazeVectorLeft));
+	rec.errGazeVectorRight = static_cast<int16_t>(fove_Headset_getGazeVector(headset, Fove_Eye::Right, &rec.gazeVectorRight));
+	rec.errGazeVectorRawLeft = static_cast<int16_t>(fove_Headset_getGazeVectorRaw(headset, Fove_Eye::Left, &rec.gazeVectorRawLeft));
+	rec.errGazeVectorRawRight = static_cast<int16_t>(fove_Headset_getGazeVectorRaw(headset, Fove_Eye::Right, &rec.gazeVectorRawRight));
+	rec.errPupilRadiusLeft = static_cast<int16_t>(fove_Headset_getPupilRadius(headset, Fove_Eye::Left, &rec.pupilRadiusLeft));
+	rec.errPupilRadiusRight = static_cast<int16_t>(fove_Headset_getPupilRadius(headset, Fove_Eye::Right, &rec.pupilRadiusRight));
+	rec.errIrisRadiusLeft = static_cast<int16_t>(fove_Headset_getIrisRadius(headset, Fove_Eye::Left, &rec.irisRadiusLeft));
+	rec.errIrisRadiusRight = static_cast<int16_t>(fove_Headset_getIrisRadius(headset, Fove_Eye::Right, &rec.irisRadiusRight));
+	Fove_EyeState state = Fove_EyeState::NotDetected;
+	rec.errEyeStateLeft = static_cast<int16_t>(fove_Headset_getEyeState(headset, Fove_Eye::Left, &state));
+	rec.eyeStateLeft = static_cast<int32_t>(state);
+	state = Fove_EyeState::NotDetected;
+	rec.errEyeStateRight = static_cast<int16_t>(fove_Headset_getEyeState(headset, Fove_Eye::Right, &state));
+	rec.eyeStateRight = static_cast<int32_t>(state);
+	bool blinking = false;
+	rec.errEyeBlinkingLeft = static_cast<int16_t>(fove_Headset_isEyeBlinking(headset, Fove_Eye::Left, &blinking));
+	rec.eyeBlinkingLeft = blinking ? 1 : 0;
+	blinking = false;
+	rec.errEyeBlinkingRight = static_cast<int16_t>(fove_Headset_isEyeBlinking(headset, Fove_Eye::Right, &blinking));
+	rec.eyeBlinkingRight = blinking ? 1 : 0;
+	rec.errCombinedRay = static_cast<int16_t>(fove_Headset_getCombinedGazeRay(headset, &rec.combinedRay));
+	rec.errCombinedDepth = static_cast<int16_t>(fove_Headset_getCombinedGazeDepth(headset, &rec.combinedDepth));
+	const int16_t noneErr = static_cast<int16_t>(Fove_ErrorCode::None);
+	fillGazeKinematics(rec, rec.errGazeVectorRawLeft == noneErr, rec.errGazeVectorRawRight == noneErr,
+					   rec.errEyeBlinkingLeft == noneErr && rec.eyeBlinkingLeft,
+					   rec.errEyeBlinkingRight == noneErr && rec.eyeBlinkingRight, rec.timestamp);
+	fillGazeObjectHit(rec);
+}
+
+////////////////////////////////////////////////////////////////
+// Black-box ring
+
+// Always-on crash forensics: a preallocated ring of the last N pump snapshots,
+// overwritten in place, so "the last 30 seconds of everything" is available
+// after a failure without having run the recorder. Feeding is one struct copy
+// per captured frame under an uncontended mutex and allocates nothing;
+// blackbox_dump (and the automatic dump on the first critical error code)
+// serializes the ring as an uncompressed recorder file, so the replay and
+// export tooling reads dumps directly.
+class BlackBox
+{
+public:
+	BlackBox() { ring_.assign(defaultCapacity, PumpSnapshot{}); }
+
+	// capacity 0 disables the ring (and frees it); a non-empty autoDumpPath
+	// arms the automatic dump on the first critical error observed by the pump
+	void configure(const size_t capacity, std::string autoDumpPath)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		ring_.assign(capacity, PumpSnapshot{});
+		ring_.shrink_to_fit();
+		count_ = 0;
+		next_ = 0;
+		autoDumpPath_ = std::move(autoDumpPath);
+		autoDumped_.store(false, std::memory_order_relaxed);
+		enabled_.store(capacity > 0, std::memory_order_release);
+	}
+
+	void feed(const PumpSnapshot& rec)
+	{
+		if (!enabled_.load(std::memory_order_acquire))
+			return;
+		bool critical;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (ring_.empty())
+				return;
+			ring_[next_] = rec;
+			next_ = (next_ + 1) % ring_.size();
+			if (count_ < ring_.size())
+				++count_;
+			critical = !autoDumpPath_.empty() && hasCriticalError(rec);
+		}
+		if (critical && !autoDumped_.exchange(true))
+			autoDump();
+	}
+
+	// The ring contents, oldest first
+	std::vector<PumpSnapshot> snapshot() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		std::vector<PumpSnapshot> out;
+		out.reserve(count_);
+		const size_t start = count_ < ring_.size() ? 0 : next_;
+		for (size_t i = 0; i < count_; ++i)
+			out.push_back(ring_[(start + i) % ring_.size()]);
+		return out;
+	}
+
+	std::string autoDumpPath() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return autoDumpPath_;
+	}
+
+	size_t capacity() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return ring_.size();
+	}
+
+	size_t records() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return count_;
+	}
+
+	static constexpr size_t defaultCapacity = 4096; // ~34 s at 120 Hz, ~1 MB
+
+private:
+	// The codes that mean the session broke, as opposed to per-sample quality
+	static bool hasCriticalError(const PumpSnapshot& rec)
+	{
+		for (const int16_t err : {rec.errGazeVectorLeft, rec.errGazeVectorRight})
+			switch (static_cast<Fove_ErrorCode>(err))
+			{
+			case Fove_ErrorCode::Connect_NotConnected:
+			case Fove_ErrorCode::Data_Unreadable:
+			case Fove_ErrorCode::Hardware_Disconnected:
+				return true;
+			default:
+				break;
+			}
+		return false;
+	}
+
+	void autoDump(); // defined with the recorder file format below
+
+	std::vector<PumpSnapshot> ring_;
+	size_t count_ = 0; // valid records in the ring
+	size_t next_ = 0;  // slot the next record overwrites
+	std::string autoDumpPath_;
+	std::atomic<bool> enabled_{true};
+	std::atomic<bool> autoDumped_{false};
+	mutable std::mutex mutex_;
+};
+
+BlackBox& blackBox()
+{
+	// Leaked deliberately: the pump can still feed during interpreter shutdown
+	static BlackBox& box = *new BlackBox;
+	return box;
+}
+
+// Serializes the ring (oldest first) as an uncompressed recorder file;
+// defined after the recorder's on-disk format below
+size_t blackboxWrite(const std::string& path);
+
+////////////////////////////////////////////////////////////////
+// Shared-memory snapshot bus
+
+// The image stream's pattern applied to gaze: one capture process runs the
+// pump and publishes every snapshot into a named POSIX shared-memory ring;
+// N consumer processes (stimulus, logging, analysis) read it with independent
+// cursors, replacing the multiprocessing-queue hop (a pickle and ~1 ms per
+// message) with a seqlock-verified struct copy. The writer never blocks on
+// readers; a reader that falls a full lap behind loses the overwritten
+// records and accounts them as dropped.
+//
+// POSIX-only like the image stream (no shm_open on Windows).
+#ifndef _WIN32
+
+constexpr uint32_t snapshotBusMagic = 0x564F4653; // "SFOV" little-endian
+constexpr uint32_t snapshotBusVersion = 1;
+
+struct SnapshotBusHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t slotCount;
+	uint32_t recordSize;               // sizeof(PumpSnapshot) at creation, for validation
+	std::atomic<uint64_t> latestFrame; // frame counter, 0 = nothing published; slot = (frame - 1) % slotCount
+};
+
+struct SnapshotSlotHeader
+{
+	std::atomic<uint64_t> seq; // seqlock: odd while the writer is copying
+	uint64_t frame;            // which frame the slot currently holds, for lap detection
+};
+
+constexpr size_t snapshotBusAlign = 64; // keep slots cacheline-aligned, as in the image stream
+
+inline size_t snapshotSlotStride()
+{
+	const size_t raw = sizeof(SnapshotSlotHeader) + sizeof(PumpSnapshot);
+	return (raw + snapshotBusAlign - 1) / snapshotBusAlign * snapshotBusAlign;
+}
+
+inline size_t snapshotBusTotalSize(const uint32_t slotCount)
+{
+	const size_t headerSize = (sizeof(SnapshotBusHeader) + snapshotBusAlign - 1) / snapshotBusAlign * snapshotBusAlign;
+	return headerSize + static_cast<size_t>(slotCount) * snapshotSlotStride();
+}
+
+inline char* snapshotSlotBase(SnapshotBusHeader* header, const uint32_t slot)
+{
+	const size_t headerSize = (sizeof(SnapshotBusHeader) + snapshotBusAlign - 1) / snapshotBusAlign * snapshotBusAlign;
+	return reinterpret_cast<char*>(header) + headerSize + slot * snapshotSlotStride();
+}
+
+// Writer side: creates the named ring; a running pump feeds it while enabled
+class SnapshotBus
+{
+public:
+	SnapshotBus(const std::string& name, const size_t slotCount)
+	    : name_(name)
+	{
+		if (slotCount < 2)
+			throw std::runtime_error("SnapshotBus needs at least 2 slots so readers never race the active write");
+
+		const int fd = shm_open(name.c_str(), O_CREAT | O_RDWR, 0600);
+		if (fd < 0)
+			throw std::runtime_error("Failed to create shared memory segment: " + name);
+
+		const size_t total = snapshotBusTotalSize(static_cast<uint32_t>(slotCount));
+		if (ftruncate(fd, static_cast<off_t>(total)) != 0)
+		{
+			::close(fd);
+			shm_unlink(name.c_str());
+			throw std::runtime_error("Failed to size shared memory segment: " + name);
+		}
+
+		void* base = mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		::close(fd);
+		if (base == MAP_FAILED)
+		{
+			shm_unlink(name.c_str());
+			throw std::runtime_error("Failed to map shared memory segment: " + name);
+		}
+
+		mapSize_ = total;
+		header_ = static_cast<SnapshotBusHeader*>(base);
+		header_->slotCount = static_cast<uint32_t>(slotCount);
+		header_->recordSize = static_cast<uint32_t>(sizeof(PumpSnapshot));
+		header_->latestFrame.store(0, std::memory_order_relaxed);
+		for (uint32_t slot = 0; slot < header_->slotCount; ++slot)
+			reinterpret_cast<SnapshotSlotHeader*>(snapshotSlotBase(header_, slot))->seq.store(0, std::memory_order_relaxed);
+		header_->version = snapshotBusVersion;
+		// The magic is written last so readers never see a half-initialized header
+		std::atomic_thread_fence(std::memory_order_release);
+		header_->magic = snapshotBusMagic;
+	}
+
+	~SnapshotBus() { close(); }
+
+	SnapshotBus(const SnapshotBus&) = delete;
+	SnapshotBus& operator=(const SnapshotBus&) = delete;
+
+	// Publishes one snapshot; called from the pump thread, no GIL involved
+	void publish(const PumpSnapshot& rec)
+	{
+		if (!header_)
+			return;
+		const uint64_t frame = header_->latestFrame.load(std::memory_order_relaxed) + 1;
+		const uint32_t slot = static_cast<uint32_t>((frame - 1) % header_->slotCount);
+		char* const base = snapshotSlotBase(header_, slot);
+		SnapshotSlotHeader* const slotHeader = reinterpret_cast<SnapshotSlotHeader*>(base);
+
+		const uint64_t seq = slotHeader->seq.load(std::memory_order_relaxed);
+		slotHeader->seq.store(seq + 1, std::memory_order_relaxed); // odd: write in progress
+		std::atomic_thread_fence(std::memory_order_release);
+		slotHeader->frame = frame;
+		std::memcpy(base + sizeof(SnapshotSlotHeader), &rec, sizeof rec);
+		slotHeader->seq.store(seq + 2, std::memory_order_release);
+
+		header_->latestFrame.store(frame, std::memory_order_release);
+	}
+
+	// Unmaps and unlinks the segment; readers that already mapped it keep their mapping
+	void close()
+	{
+		if (!header_)
+			return;
+		munmap(header_, mapSize_);
+		header_ = nullptr;
+		shm_unlink(name_.c_str());
+	}
+
+	const std::string& name() const { return name_; }
+	size_t slotCount() const { return header_ ? header_->slotCount : 0; }
+	uint64_t framesPublished() const { return header_ ? header_->latestFrame.load(std::memory_order_relaxed) : 0; }
+
+private:
+	std::string name_;
+	SnapshotBusHeader* header_ = nullptr;
+	size_t mapSize_ = 0;
+};
+
+// Buses currently publishing, walked by the pump like the heatmaps
+std::mutex snapshotBusMutex;
+std::vector<std::weak_ptr<SnapshotBus>> activeSnapshotBuses;
+
+void feedSnapshotBuses(const PumpSnapshot& rec)
+{
+	std::lock_guard<std::mutex> lock(snapshotBusMutex);
+	for (auto it = activeSnapshotBuses.begin(); it != activeSnapshotBuses.end();)
+	{
+		if (const std::shared_ptr<SnapshotBus> bus = it->lock())
+		{
+			bus->publish(rec);
+			++it;
+		}
+		else
+			it = activeSnapshotBuses.erase(it);
+	}
+}
+
+#else // _WIN32
+
+void feedSnapshotBuses(const PumpSnapshot&) {}
+
+#endif
+
+// Defined with the columnar exporter below; wraps a drained batch in an
+// object speaking the Arrow PyCapsule protocol (__arrow_c_array__)
+py::object exportSnapshotsToArrow(const PumpSnapshot* rows, size_t count);
+
+// Background thread running the wait/fetch/get cycle so that the Python side
+// does not have to wake up every eye frame. Snapshots go into a single-producer
+// single-consumer ring buffer (the pump thread produces, the thread calling
+// `drain` consumes); when the consumer falls behind, the newest frames are
+// dropped and counted rather than blocking the capture loop.
+class FramePump
+{
+public:
+	explicit FramePump(size_t capacity)
+	    : ring_(roundUpPow2(capacity))
+	{
+		MetricsPumps& pumps = metricsPumps();
+		std::lock_guard<std::mutex> lock(pumps.mutex);
+		pumps.pumps[this] = [this] { // reads only atomics; safe from the flusher thread
+			return MetricsPumpStats{
+				writeIndex_.load(std::memory_order_acquire) - readIndex_.load(std::memory_order_relaxed),
+				framesCaptured_.load(), framesDropped_.load()};
+		};
+	}
+
+	~FramePump()
+	{
+		{
+			MetricsPumps& pumps = metricsPumps();
+			std::lock_guard<std::mutex> lock(pumps.mutex);
+			pumps.pumps.erase(this);
+		}
+		stopThread();
+	}
+
+	FramePump(const FramePump&) = delete;
+	FramePump& operator=(const FramePump&) = delete;
+
+	Fove_ErrorCode start(py::object headsetObj, Fove_ClientCapabilities capabilities)
+	{
+		if (running_.load())
+			return Fove_ErrorCode::API_InvalidArgument;
+		Headset& headset = headsetObj.cast<Headset&>();
+		if (capabilities != Fove_ClientCapabilities::None)
+		{
+			const Fove_ErrorCode err = fove_Headset_registerCapabilities(headset, capabilities);
+			if (err != Fove_ErrorCode::None)
+				return err;
+			noteCapabilitiesRegistered(headset, capabilities);
+		}
+		headsetObj_ = std::move(headsetObj); // keeps the headset alive while the pump runs
+		headset_ = headset;
+		readIndex_.store(0);
+		writeIndex_.store(0);
+		framesCaptured_.store(0);
+		framesDropped_.store(0);
+		hasLatest_ = false;
+		hasPrevBlinkLeft_ = hasPrevBlinkRight_ = false;
+		blinkEvents_.clear();
+		hasPrevGuiVisible_ = hasPrevGuiTimeout_ = false;
+		guiEvents_.clear();
+		running_.store(true);
+		thread_ = std::thread([this] { run(); });
+		return Fove_ErrorCode::None;
+	}
+
+	void stop()
+	{
+		{
+			py::gil_scoped_release release;
+			stopThread();
+		}
+		headsetObj_ = py::object();
+	}
+
+	bool isRunning() const { return running_.load(); }
+
+	py::array drain()
+	{
+		const uint64_t write = writeIndex_.load(std::memory_order_acquire);
+		uint64_t read = readIndex_.load(std::memory_order_relaxed);
+		const size_t count = static_cast<size_t>(write - read);
+		py::array_t<PumpSnapshot> batch(static_cast<py::ssize_t>(count));
+		auto* const out = static_cast<PumpSnapshot*>(batch.request().ptr);
+		for (size_t i = 0; i < count; ++i, ++read)
+			out[i] = ring_[read & (ring_.size() - 1)];
+		readIndex_.store(read, std::memory_order_release);
+		return std::move(batch);
+	}
+
+	// Same consumption as `drain`, into a plain vector for the Arrow exporter
+	std::vector<PumpSnapshot> drainRaw()
+	{
+		const uint64_t write = writeIndex_.load(std::memory_order_acquire);
+		uint64_t read = readIndex_.load(std::memory_order_relaxed);
+		std::vector<PumpSnapshot> batch(static_cast<size_t>(write - read));
+		for (size_t i = 0; i < batch.size(); ++i, ++read)
+			batch[i] = ring_[read & (ring_.size() - 1)];
+		readIndex_.store(read, std::memory_order_release);
+		return batch;
+	}
+
+	py::array latest()
+	{
+		PumpSnapshot rec;
+		bool has = false;
+		{
+			std::lock_guard<std::mutex> lock(latestMutex_);
+			has = hasLatest_;
+			rec = latest_;
+		}
+		py::array_t<PumpSnapshot> out(has ? 1 : 0);
+		if (has)
+			*static_cast<PumpSnapshot*>(out.request().ptr) = rec;
+		return std::move(out);
+	}
+
+	uint64_t framesCaptured() const { return framesCaptured_.load(); }
+	uint64_t framesDropped() const { return framesDropped_.load(); }
+
+	// Registers a filtered stream; the filters run on the pump thread so only
+	// the requested data rate is ever queued for (or crosses into) Python
+	int subscribe(const uint64_t decimate, const uint64_t intervalUs, const bool conflate, const size_t capacity)
+	{
+		if (decimate < 1)
+			throw std::runtime_error("decimate must be >= 1");
+		if (capacity < 1)
+			throw std::runtime_error("capacity must be >= 1");
+		std::lock_guard<std::mutex> lock(subscriberMutex_);
+		const int id = nextSubscriberId_++;
+		Subscriber& sub = subscribers_[id];
+		sub.decimate = decimate;
+		sub.intervalUs = intervalUs;
+		sub.conflate = conflate;
+		sub.capacity = capacity;
+		return id;
+	}
+
+	void unsubscribe(const int id)
+	{
+		std::lock_guard<std::mutex> lock(subscriberMutex_);
+		if (subscribers_.erase(id) == 0)
+			throw std::runtime_error("Unknown stream id");
+	}
+
+	py::array drainStream(const int id)
+	{
+		std::deque<PumpSnapshot> drained;
+		{
+			std::lock_guard<std::mutex> lock(subscriberMutex_);
+			const auto it = subscribers_.find(id);
+			if (it == subscribers_.end())
+				throw std::runtime_error("Unknown stream id");
+			drained.swap(it->second.queue);
+		}
+		py::array_t<PumpSnapshot> batch(static_cast<py::ssize_t>(drained.size()));
+		auto* const out = static_cast<PumpSnapshot*>(batch.request().ptr);
+		size_t i = 0;
+		for (const PumpSnapshot& rec : drained)
+			out[i++] = rec;
+		return std::move(batch);
+	}
+
+	py::dict streamStats(const int id)
+	{
+		std::lock_guard<std::mutex> lock(subscriberMutex_);
+		const auto it = subscribers_.find(id);
+		if (it == subscribers_.end())
+			throw std::runtime_error("Unknown stream id");
+		py::dict stats;
+		stats["delivered"] = it->second.delivered;
+		stats["dropped"] = it->second.dropped;
+		stats["queued"] = it->second.queue.size();
+		return stats;
+	}
+
+	// Drains the HMD adjustment GUI transitions detected by the pump thread
+	py::list pollHmdAdjustmentEvents()
+	{
+		std::deque<GuiEvent> drained;
+		{
+			std::lock_guard<std::mutex> lock(guiMutex_);
+			drained.swap(guiEvents_);
+		}
+		py::list result;
+		for (const GuiEvent& event : drained)
+		{
+			py::dict entry;
+			entry["type"] = event.type;
+			entry["value"] = event.value;
+			entry["timestamp"] = event.timestampUs;
+			result.append(std::move(entry));
+		}
+		return result;
+	}
+
+	// Drains the per-eye blink transitions detected by the pump thread
+	py::list pollBlinkEvents()
+	{
+		std::deque<BlinkEvent> drained;
+		{
+			std::lock_guard<std::mutex> lock(blinkMutex_);
+			drained.swap(blinkEvents_);
+		}
+		py::list result;
+		for (const BlinkEvent& event : drained)
+		{
+			py::dict entry;
+			entry["type"] = event.start ? "blink_start" : "blink_end";
+			entry["eye"] = event.eye;
+			entry["timestamp"] = event.timestampUs;
+			result.append(std::move(entry));
+		}
+		return result;
+	}
+
+private:
+	struct BlinkEvent
+	{
+		Fove_Eye eye;
+		bool start;
+		uint64_t timestampUs;
+	};
+
+	struct GuiEvent
+	{
+		const char* type; // string literal naming the channel
+		bool value;
+		uint64_t timestampUs;
+	};
+
+	// One registered stream: its filter settings, queue, and counters
+	struct Subscriber
+	{
+		uint64_t decimate = 1;   // keep every n-th captured frame
+		uint64_t intervalUs = 0; // then at most one per interval (0 = no gate)
+		bool conflate = false;   // keep only the newest undrained snapshot
+		size_t capacity = 1024;
+		std::deque<PumpSnapshot> queue;
+		uint64_t counter = 0;
+		uint64_t nextDueUs = 0;
+		uint64_t delivered = 0;
+		uint64_t dropped = 0;
+	};
+
+	// Applies each stream's decimation/interval/conflation on the pump thread
+	void feedSubscribers(const PumpSnapshot& rec)
+	{
+		std::lock_guard<std::mutex> lock(subscriberMutex_);
+		for (auto& entry : subscribers_)
+		{
+			Subscriber& sub = entry.second;
+			++sub.counter;
+			if (sub.decimate > 1 && (sub.counter % sub.decimate) != 0)
+				continue;
+			if (sub.intervalUs > 0)
+			{
+				if (rec.timestamp < sub.nextDueUs)
+				{
+					if (sub.conflate && !sub.queue.empty())
+						sub.queue.back() = rec; // keep the interval's newest
+					continue;
+				}
+				sub.nextDueUs = rec.timestamp + sub.intervalUs;
+			}
+			if (sub.conflate)
+			{
+				// The stream holds at most the single newest snapshot
+				if (!sub.queue.empty())
+					sub.queue.back() = rec;
+				else
+					sub.queue.push_back(rec);
+			}
+			else if (sub.queue.size() >= sub.capacity)
+			{
+				++sub.dropped;
+				continue;
+			}
+			else
+				sub.queue.push_back(rec);
+			++sub.delivered;
+		}
+	}
+
+	void stopThread()
+	{
+		running_.store(false);
+		if (thread_.joinable())
+			thread_.join();
+	}
+
+	void run()
+	{
+		const WorkerScope worker("pump");
+		while (running_.load(std::memory_order_relaxed))
+		{
+			const Fove_ErrorCode waitErr = waitForProcessedEyeFrameTimed(headset_);
+			if (!running_.load(std::memory_order_relaxed))
+				break;
+			if (waitErr != Fove_ErrorCode::None)
+			{
+				// Not connected or capability missing: back off instead of spinning
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+				continue;
+			}
+			PumpSnapshot rec = {};
+			fillPumpSnapshot(headset_, rec);
+			detectBlinkEdges(rec);
+			detectGuiEdges(rec.timestamp);
+			int gazedObjectId = fove_ObjectIdInvalid;
+			if (fove_Headset_getGazedObjectId(headset_, &gazedObjectId) == Fove_ErrorCode::None)
+				dwellTracker().feed(gazedObjectId, rec.timestamp);
+			feedPupilStats(rec);
+			feedHeatmaps(headset_);
+			feedScanpaths(headset_);
+			blackBox().feed(rec);
+			feedSnapshotBuses(rec);
+			push(rec);
+		}
+	}
+
+	// Feeds the pupillometry engine with the valid pupil samples of this frame;
+	// samples taken mid-blink are skipped so blink gaps do not skew the stats
+	static void feedPupilStats(const PumpSnapshot& rec)
+	{
+		const int16_t none = static_cast<int16_t>(Fove_ErrorCode::None);
+		if (rec.errPupilRadiusLeft == none && !(rec.errEyeBlinkingLeft == none && rec.eyeBlinkingLeft))
+			pupilStats().feed(Fove_Eye::Left, rec.timestamp, rec.pupilRadiusLeft);
+		if (rec.errPupilRadiusRight == none && !(rec.errEyeBlinkingRight == none && rec.eyeBlinkingRight))
+			pupilStats().feed(Fove_Eye::Right, rec.timestamp, rec.pupilRadiusRight);
+	}
+
+	// Edge-detects the per-eye blink flags of the just-captured snapshot, so
+	// consumers subscribe to transitions instead of polling isEyeBlinking four
+	// times a frame; invalid samples (capability missing, not connected) do not
+	// update the reference state and thus produce no spurious edges
+	void detectBlinkEdges(const PumpSnapshot& rec)
+	{
+		const struct
+		{
+			Fove_Eye eye;
+			int16_t err;
+			uint8_t blinking;
+			uint8_t* prev;
+			bool* hasPrev;
+		} channels[] = {
+			{Fove_Eye::Left, rec.errEyeBlinkingLeft, rec.eyeBlinkingLeft, &prevBlinkLeft_, &hasPrevBlinkLeft_},
+			{Fove_Eye::Right, rec.errEyeBlinkingRight, rec.eyeBlinkingRight, &prevBlinkRight_, &hasPrevBlinkRight_},
+		};
+		for (const auto& channel : channels)
+		{
+			if (channel.err != static_cast<int16_t>(Fove_ErrorCode::None))
+				continue;
+			if (*channel.hasPrev && channel.blinking != *channel.prev)
+			{
+				std::lock_guard<std::mutex> lock(blinkMutex_);
+				if (blinkEvents_.size() >= 256)
+					blinkEvents_.pop_front(); // nobody is polling; keep the newest
+				blinkEvents_.push_back(BlinkEvent{channel.eye, channel.blinking != 0, rec.timestamp});
+			}
+			*channel.prev = channel.blinking;
+			*channel.hasPrev = true;
+		}
+	}
+
+	// Edge-detects the HMD adjustment GUI state once per captured frame, so an
+	// experiment pauses on a queued transition instead of paying two binding
+	// crossings per frame from Python for booleans that almost never change.
+	// Channels whose query fails (capability missing, not connected) do not
+	// update the reference state and thus produce no spurious edges.
+	void detectGuiEdges(const uint64_t timestampUs)
+	{
+		const struct
+		{
+			Fove_ErrorCode (*query)(Fove_Headset*, bool*);
+			const char* type;
+			bool* prev;
+			bool* hasPrev;
+		} channels[] = {
+			{&fove_Headset_isHmdAdjustmentGuiVisible, "hmd_adjustment_gui_visible", &prevGuiVisible_, &hasPrevGuiVisible_},
+			{&fove_Headset_hasHmdAdjustmentGuiTimeout, "hmd_adjustment_gui_timeout", &prevGuiTimeout_, &hasPrevGuiTimeout_},
+		};
+		for (const auto& channel : channels)
+		{
+			bool value = false;
+			if (channel.query(headset_, &value) != Fove_ErrorCode::None)
+				continue;
+			if (*channel.hasPrev && value != *channel.prev)
+			{
+				std::lock_guard<std::mutex> lock(guiMutex_);
+				if (guiEvents_.size() >= 64)
+					guiEvents_.pop_front(); // nobody is polling; keep the newest
+				guiEvents_.push_back(GuiEvent{channel.type, value, timestampUs});
+			}
+			*channel.prev = value;
+			*channel.hasPrev = true;
+		}
+	}
+
+	void push(const PumpSnapshot& rec)
+	{
+		const uint64_t write = writeIndex_.load(std::memory_order_relaxed);
+		const uint64_t read = readIndex_.load(std::memory_order_acquire);
+		if (write - read >= ring_.size())
+		{
+			// Consumer is not draining fast enough; log the first occurrence only
+			if (framesDropped_.fetch_add(1) == 0)
+				logDiagnostic(Fove_LogLevel::Warning, "FramePump: ring full, dropping frames");
+		}
+		else
+		{
+			ring_[write & (ring_.size() - 1)] = rec;
+			writeIndex_.store(write + 1, std::memory_order_release);
+		}
+		{
+			// `latest` is served from a side copy; the copy is small and only
+			// ever contended by the one thread calling `latest`
+			std::lock_guard<std::mutex> lock(latestMutex_);
+			latest_ = rec;
+			hasLatest_ = true;
+		}
+		feedSubscribers(rec);
+		framesCaptured_.fetch_add(1);
+	}
+
+	std::vector<PumpSnapshot> ring_;
+	std::atomic<uint64_t> readIndex_{0};
+	std::atomic<uint64_t> writeIndex_{0};
+	std::atomic<uint64_t> framesCaptured_{0};
+	std::atomic<uint64_t> framesDropped_{0};
+	std::atomic<bool> running_{false};
+	std::thread thread_;
+	py::object headsetObj_;
+	Fove_Headset* headset_ = nullptr;
+	std::mutex latestMutex_;
+	PumpSnapshot latest_ = {};
+	bool hasLatest_ = false;
+	uint8_t prevBlinkLeft_ = 0;
+	uint8_t prevBlinkRight_ = 0;
+	bool hasPrevBlinkLeft_ = false;
+	bool hasPrevBlinkRight_ = false;
+	std::mutex blinkMutex_;
+	std::deque<BlinkEvent> blinkEvents_;
+	bool prevGuiVisible_ = false;
+	bool prevGuiTimeout_ = false;
+	bool hasPrevGuiVisible_ = false;
+	bool hasPrevGuiTimeout_ = false;
+	std::mutex guiMutex_;
+	std::deque<GuiEvent> guiEvents_;
+	std::mutex subscriberMutex_;
+	std::map<int, Subscriber> subscribers_;
+	int nextSubscriberId_ = 1;
+};
+
+} // namespace
+
+void defstruct_FramePump(py::module& m)
+{
+	// Field dtypes (Vec3, Ray) are registered in defstruct_Dtypes, which runs first
+	PYBIND11_NUMPY_DTYPE(PumpSnapshot, frameId, timestamp,
+						 gazeVectorLeft, gazeVectorRight, gazeVectorRawLeft, gazeVectorRawRight,
+						 pupilRadiusLeft, pupilRadiusRight, irisRadiusLeft, irisRadiusRight,
+						 eyeStateLeft, eyeStateRight, eyeBlinkingLeft, eyeBlinkingRight,
+						 combinedRay, combinedDepth,
+						 gazeVelocityLeft, gazeVelocityRight, gazeAccelerationLeft, gazeAccelerationRight,
+						 errGazeVectorLeft, errGazeVectorRight, errGazeVectorRawLeft, errGazeVectorRawRight,
+						 errPupilRadiusLeft, errPupilRadiusRight, errIrisRadiusLeft, errIrisRadiusRight,
+						 errEyeStateLeft, errEyeStateRight, errEyeBlinkingLeft, errEyeBlinkingRight,
+						 errCombinedRay, errCombinedDepth,
+					 gazedObjectId, gazedObjectPoint);
+
+	py::class_<FramePump>(m, "FramePump",
+						  R"(A background eye-frame capture thread with a snapshot ring buffer
+
+Runs the `Headset_waitForProcessedEyeFrame` / fetch / get cycle on a native thread and
+accumulates one fixed-size snapshot record per eye frame into a single-producer
+single-consumer ring buffer, so that the Python side no longer has to wake up every
+frame: it drains whole batches at its own pace as a structured numpy array.
+
+If the ring fills up because the consumer does not drain often enough, the newest
+frames are dropped (and counted in `framesDropped`) rather than blocking capture.)")
+		.def(py::init<size_t>(), py::arg("capacity") = 1024)
+		.def("start", &FramePump::start,
+			 py::arg("headset"),
+			 py::arg_v("capabilities", Fove_ClientCapabilities::None, "ClientCapabilities.None"),
+			 R"(Starts the pump thread on the given headset
+
+\param headset The headset to pump frames from; kept alive by the pump until `stop`
+\param capabilities Additional capabilities to register before starting, if any
+\return #Fove_ErrorCode_None if the pump started\n
+        #Fove_ErrorCode_API_InvalidArgument if the pump is already running\n
+        Otherwise, the error returned by the capability registration
+)")
+		.def("stop", &FramePump::stop, "Stops the pump thread and releases the headset reference")
+		.def("drain", &FramePump::drain,
+			 R"(Removes and returns all pending snapshots
+
+\return A structured numpy array with one record per captured frame, oldest first; empty if no new frame
+)")
+		.def(
+			"drainArrow", [](FramePump& pump) {
+				const std::vector<PumpSnapshot> batch = pump.drainRaw();
+				return exportSnapshotsToArrow(batch.data(), batch.size());
+			},
+			R"(Removes all pending snapshots as an Arrow record batch
+
+Same consumption as `drain`, but the records are handed over through the
+Arrow C data interface: the returned `ArrowBatch` speaks the Arrow PyCapsule
+protocol, so `pyarrow.record_batch(...)`, `polars.DataFrame(...)` and DuckDB
+adopt the column buffers without copying. Columns follow the
+`export_columns` layout.
+
+\return An `ArrowBatch` holding one record per captured frame (possibly empty)
+\see drain, export_columns
+)")
+		.def("latest", &FramePump::latest,
+			 R"(Returns the most recent snapshot without consuming the ring
+
+\return A structured numpy array of length one, or of length zero if no frame was captured yet
+)")
+		.def("pollBlinkEvents", &FramePump::pollBlinkEvents,
+			 R"(Drains the per-eye blink transitions detected since the last call
+
+The pump thread edge-detects the blink flag of each captured frame, so a
+blink costs two queue entries instead of four `Headset_isEyeBlinking`
+crossings per frame. Each dict has `type` (`"blink_start"` or `"blink_end"`),
+`eye` and the frame `timestamp`. Frames whose blink channel reported an
+error produce no events.
+
+\return A list of event dicts, oldest first (empty if no transition occurred)
+)")
+		.def("pollHmdAdjustmentEvents", &FramePump::pollHmdAdjustmentEvents,
+			 R"(Drains the HMD adjustment GUI transitions detected since the last call
+
+The pump thread edge-detects `Headset_isHmdAdjustmentGuiVisible` and
+`Headset_hasHmdAdjustmentGuiTimeout` once per captured frame, so pausing an
+experiment when the GUI appears no longer costs two binding crossings per
+frame from Python. Each dict has `type` (`"hmd_adjustment_gui_visible"` or
+`"hmd_adjustment_gui_timeout"`), the new boolean `value` and the frame
+`timestamp`. Channels whose query reported an error produce no events.
+
+\return A list of event dicts, oldest first (empty if no transition occurred)
+)")
+		.def("subscribe", &FramePump::subscribe,
+			 py::arg("decimate") = 1, py::arg("interval_us") = 0, py::arg("conflate") = false, py::arg("capacity") = 1024,
+			 R"(Registers a filtered stream on the pump and returns its id
+
+Each stream sees the captured frames through its own filters, applied on the
+pump thread so only the requested data rate is ever queued: `decimate` keeps
+every n-th frame, `interval_us` then caps the stream at one snapshot per
+interval, and `conflate` makes the stream hold only the single newest
+undrained snapshot (refreshed as fresher frames arrive) instead of a backlog.
+A 10 Hz dashboard subscribes with `interval_us=100000, conflate=True` while
+the recorder drains the main ring at full rate; each consumer pays only for
+its own rate.
+
+\param decimate Keep every n-th captured frame (1 keeps all)
+\param interval_us Deliver at most one snapshot per this many microseconds of frame time (0 = no gate)
+\param conflate Hold only the newest undrained snapshot instead of queueing a backlog
+\param capacity Queue depth for non-conflated streams; further snapshots are dropped and counted
+\return The stream id to pass to `drainStream`, `streamStats` and `unsubscribe`
+)")
+		.def("drainStream", &FramePump::drainStream, py::arg("id"),
+			 R"(Removes and returns the pending snapshots of a subscribed stream
+
+\param id A stream id returned by `subscribe`
+\return A structured numpy array with the stream's pending records, oldest first (at most one when conflating)
+)")
+		.def("streamStats", &FramePump::streamStats, py::arg("id"),
+			 "Returns a dict with `delivered`, `dropped` and `queued` counts of the given stream")
+		.def("unsubscribe", &FramePump::unsubscribe, py::arg("id"),
+			 "Removes a subscribed stream and discards its queue")
+		.def_property_readonly("running", &FramePump::isRunning, "Whether the pump thread is currently running")
+		.def_property_readonly("framesCaptured", &FramePump::framesCaptured, "Total number of frames captured since `start`")
+		.def_property_readonly("framesDropped", &FramePump::framesDropped, "Number of frames dropped because the ring buffer was full");
+}
+
+////////////////////////////////////////////////////////////////
+// Frame aligner
+
+namespace
+{
+
+// Bundles the three independently-clocked fetch streams (eye tracking, eyes
+// image, pose) into aligned records, replacing the Python-side sort-merge that
+// reconstructed "which image goes with which gaze sample" every frame. A
+// background thread runs the wait/fetch cycle on all three streams and emits a
+// bundle only when the image and pose timestamps agree with the gaze timestamp
+// within the configured tolerance, one bundle per gaze frame at most.
+class FrameAligner
+{
+public:
+	FrameAligner(const uint64_t toleranceUs, const size_t capacity)
+	    : toleranceUs_(toleranceUs), capacity_(capacity == 0 ? 1 : capacity) {}
+
+	~FrameAligner() { stopThread(); }
+
+	FrameAligner(const FrameAligner&) = delete;
+	FrameAligner& operator=(const FrameAligner&) = delete;
+
+	Fove_ErrorCode start(py::object headsetObj, Fove_ClientCapabilities capabilities)
+	{
+		if (running_.load())
+			return Fove_ErrorCode::API_InvalidArgument;
+		Headset& headset = headsetObj.cast<Headset&>();
+		if (capabilities != Fove_ClientCapabilities::None)
+		{
+			const Fove_ErrorCode err = fove_Headset_registerCapabilities(headset, capabilities);
+			if (err != Fove_ErrorCode::None)
+				return err;
+			noteCapabilitiesRegistered(headset, capabilities);
+		}
+		headsetObj_ = std::move(headsetObj);
+		headset_ = headset;
+		bundlesEmitted_.store(0);
+		bundlesDropped_.store(0);
+		lastEmittedUs_ = 0;
+		running_.store(true);
+		thread_ = std::thread([this] { run(); });
+		return Fove_ErrorCode::None;
+	}
+
+	void stop()
+	{
+		{
+			py::gil_scoped_release release;
+			stopThread();
+		}
+		headsetObj_ = py::object();
+	}
+
+	bool isRunning() const { return running_.load(); }
+	uint64_t bundlesEmitted() const { return bundlesEmitted_.load(); }
+	uint64_t bundlesDropped() const { return bundlesDropped_.load(); }
+
+	// Removes and returns the aligned bundles accumulated since the last drain
+	py::list drain()
+	{
+		std::deque<Bundle> drained;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			drained.swap(bundles_);
+		}
+		py::list result;
+		for (Bundle& bundle : drained)
+		{
+			py::array_t<PumpSnapshot> gaze(1);
+			*static_cast<PumpSnapshot*>(gaze.request().ptr) = bundle.gaze;
+			py::dict entry;
+			entry["timestamp"] = bundle.gaze.timestamp;
+			entry["gaze"] = std::move(gaze);
+			entry["image"] = py::bytes(reinterpret_cast<const char*>(bundle.image.data()), bundle.image.size());
+			entry["image_timestamp"] = bundle.imageTimestampUs;
+			entry["pose"] = bundle.pose;
+			entry["pose_timestamp"] = bundle.poseTimestampUs;
+			result.append(std::move(entry));
+		}
+		return result;
+	}
+
+private:
+	struct Bundle
+	{
+		PumpSnapshot gaze;
+		std::vector<uint8_t> image;
+		uint64_t imageTimestampUs;
+		Fove_Pose pose;
+		uint64_t poseTimestampUs;
+	};
+
+	void stopThread()
+	{
+		running_.store(false);
+		if (thread_.joinable())
+			thread_.join();
+	}
+
+	void run()
+	{
+		const WorkerScope worker("aligner");
+		while (running_.load(std::memory_order_relaxed))
+		{
+			const Fove_ErrorCode waitErr = waitForProcessedEyeFrameTimed(headset_);
+			if (!running_.load(std::memory_order_relaxed))
+				break;
+			if (waitErr != Fove_ErrorCode::None)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+				continue;
+			}
+
+			// fillPumpSnapshot fetches the eye tracking stream itself
+			PumpSnapshot gaze = {};
+			fillPumpSnapshot(headset_, gaze);
+			if (gaze.timestamp == 0 || gaze.timestamp == lastEmittedUs_)
+				continue;
+
+			Fove_FrameTimestamp imageTs = {}, poseTs = {};
+			const bool haveImage = fove_Headset_fetchEyesImage(headset_, &imageTs) == Fove_ErrorCode::None;
+			const bool havePose = fove_Headset_fetchPoseData(headset_, &poseTs) == Fove_ErrorCode::None;
+			if (!haveImage || !havePose)
+				continue;
+			if (!withinTolerance(gaze.timestamp, imageTs.timestamp) || !withinTolerance(gaze.timestamp, poseTs.timestamp))
+				continue; // streams disagree; wait for a frame where all three line up
+
+			Fove_BitmapImage bitmap = {};
+			Fove_Pose pose = {};
+			if (fove_Headset_getEyesImage(headset_, &bitmap) != Fove_ErrorCode::None
+				|| fove_Headset_getPose(headset_, &pose) != Fove_ErrorCode::None)
+				continue;
+
+			Bundle bundle;
+			bundle.gaze = gaze;
+			const auto* const data = static_cast<const uint8_t*>(bitmap.image.data);
+			bundle.image.assign(data, data + bitmap.image.length);
+			bundle.imageTimestampUs = imageTs.timestamp;
+			bundle.pose = pose;
+			bundle.poseTimestampUs = poseTs.timestamp;
+			lastEmittedUs_ = gaze.timestamp;
+
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				if (bundles_.size() >= capacity_)
+				{
+					bundles_.pop_front();
+					bundlesDropped_.fetch_add(1);
+				}
+				bundles_.push_back(std::move(bundle));
+			}
+			bundlesEmitted_.fetch_add(1);
+		}
+	}
+
+	bool withinTolerance(const uint64_t a, const uint64_t b) const
+	{
+		return (a > b ? a - b : b - a) <= toleranceUs_;
+	}
+
+	const uint64_t toleranceUs_;
+	const size_t capacity_;
+	std::atomic<uint64_t> bundlesEmitted_{0};
+	std::atomic<uint64_t> bundlesDropped_{0};
+	std::atomic<bool> running_{false};
+	std::thread thread_;
+	py::object headsetObj_;
+	Fove_Headset* headset_ = nullptr;
+	uint64_t lastEmittedUs_ = 0;
+	std::mutex mutex_;
+	std::deque<Bundle> bundles_;
+};
+
+} // namespace
+
+void defstruct_FrameAligner(py::module& m)
+{
+	py::class_<FrameAligner>(m, "FrameAligner",
+							 R"(Aligns the eye tracking, eyes image and pose fetch streams by timestamp
+
+The three streams tick on independent clocks; training pipelines need to know
+which image goes with which gaze sample and pose. A background thread runs the
+wait/fetch cycle on all three and queues a bundle only when the image and pose
+timestamps agree with the gaze timestamp within the tolerance, so the Python
+side drains ready-aligned records instead of sort-merging three streams per
+frame.
+
+Each drained bundle is a dict with `timestamp`, `gaze` (a one-record structured
+array in the `FramePump` snapshot layout), `image` (the BMP bytes), `pose`, and
+the per-stream `image_timestamp` / `pose_timestamp`.)")
+		.def(py::init<uint64_t, size_t>(),
+			 py::arg("tolerance_us") = 2000, py::arg("capacity") = 64,
+			 R"(Creates an aligner (not yet running; call `start`)
+
+\param tolerance_us Maximum timestamp disagreement, in microseconds, for a bundle to be emitted
+\param capacity     Maximum number of pending bundles; the oldest are dropped beyond this
+)")
+		.def("start", &FrameAligner::start,
+			 py::arg("headset"),
+			 py::arg_v("capabilities", Fove_ClientCapabilities::None, "ClientCapabilities.None"),
+			 R"(Starts the aligner thread on the given headset
+
+\param headset The headset to align streams from; kept alive until `stop`
+\param capabilities Additional capabilities to register before starting, if any
+        (typically eye tracking + eyes image + position/orientation)
+\return #Fove_ErrorCode_None if the aligner started\n
+        #Fove_ErrorCode_API_InvalidArgument if it is already running\n
+        Otherwise, the error returned by the capability registration
+)")
+		.def("stop", &FrameAligner::stop, "Stops the aligner thread and releases the headset reference")
+		.def("drain", &FrameAligner::drain,
+			 R"(Removes and returns all pending aligned bundles
+
+\return A list of bundle dicts, oldest first (empty if none aligned since the last drain)
+)")
+		.def_property_readonly("running", &FrameAligner::isRunning, "Whether the aligner thread is currently running")
+		.def_property_readonly("bundlesEmitted", &FrameAligner::bundlesEmitted, "Total number of aligned bundles emitted since `start`")
+		.def_property_readonly("bundlesDropped", &FrameAligner::bundlesDropped, "Number of bundles dropped because the queue was full");
+}
+
+////////////////////////////////////////////////////////////////
+// Multi-headset group
+
+namespace
+{
+
+// Drives several headsets from one process: each device gets its own native
+// worker thread running the wait/fetch cycle (same records as FramePump), so
+// a 4-headset rig no longer needs 4 interpreter processes and IPC glue. The
+// workers never take the GIL; Python only shows up to drain the batches.
+class HeadsetGroup
+{
+public:
+	explicit HeadsetGroup(const size_t maxPending)
+	    : maxPending_(maxPending == 0 ? 1 : maxPending) {}
+
+	~HeadsetGroup()
+	{
+		stopThreads();
+		destroyHeadsets();
+	}
+
+	HeadsetGroup(const HeadsetGroup&) = delete;
+	HeadsetGroup& operator=(const HeadsetGroup&) = delete;
+
+	// Creates the headsets and spawns one worker per device; on any failure the
+	// already-created headsets are destroyed again and the error is returned
+	Fove_ErrorCode start(const size_t count, const Fove_ClientCapabilities capabilities)
+	{
+		if (running_.load() || !devices_.empty() || count == 0)
+			return Fove_ErrorCode::API_InvalidArgument;
+
+		devices_.reserve(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			Fove_Headset* headset = nullptr;
+			const Fove_ErrorCode err = fove_createHeadset(capabilities, &headset);
+			if (err != Fove_ErrorCode::None)
+			{
+				destroyHeadsets();
+				return err;
+			}
+			noteCapabilitiesRegistered(headset, capabilities);
+			devices_.push_back(std::unique_ptr<Device>(new Device));
+			devices_.back()->headset = headset;
+		}
+
+		running_.store(true);
+		for (const std::unique_ptr<Device>& device : devices_)
+		{
+			Device* const dev = device.get();
+			dev->worker = std::thread([this, dev] { run(*dev); });
+		}
+		return Fove_ErrorCode::None;
+	}
+
+	// Stops the workers and destroys the headsets
+	void close()
+	{
+		py::gil_scoped_release release;
+		stopThreads();
+		destroyHeadsets();
+	}
+
+	// Returns one structured array per device with everything captured since the
+	// last drain, oldest first
+	py::list drainAll()
+	{
+		py::list batches;
+		for (const std::unique_ptr<Device>& device : devices_)
+		{
+			std::vector<PumpSnapshot> pending;
+			{
+				std::lock_guard<std::mutex> lock(device->mutex);
+				pending.swap(device->pending);
+			}
+			py::array_t<PumpSnapshot> batch(static_cast<py::ssize_t>(pending.size()));
+			if (!pending.empty())
+				memcpy(batch.request().ptr, pending.data(), pending.size() * sizeof(PumpSnapshot));
+			batches.append(std::move(batch));
+		}
+		return batches;
+	}
+
+	// Returns the underlying headset of one device, e.g. for per-device
+	// configuration calls; only valid while the group is open
+	Headset headset(const size_t index) const
+	{
+		if (index >= devices_.size())
+			throw std::runtime_error("Headset index out of range");
+		return Headset{devices_[index]->headset};
+	}
+
+	size_t size() const { return devices_.size(); }
+	bool isRunning() const { return running_.load(); }
+
+	py::list framesCaptured() const
+	{
+		py::list counts;
+		for (const std::unique_ptr<Device>& device : devices_)
+			counts.append(device->framesCaptured.load());
+		return counts;
+	}
+
+	py::list framesDropped() const
+	{
+		py::list counts;
+		for (const std::unique_ptr<Device>& device : devices_)
+			counts.append(device->framesDropped.load());
+		return counts;
+	}
+
+private:
+	struct Device
+	{
+		Fove_Headset* headset = nullptr;
+		std::thread worker;
+		std::mutex mutex;
+		std::vector<PumpSnapshot> pending;
+		std::atomic<uint64_t> framesCaptured{0};
+		std::atomic<uint64_t> framesDropped{0};
+	};
+
+	void run(Device& device)
+	{
+		const WorkerScope worker("group");
+		while (running_.load(std::memory_order_relaxed))
+		{
+			const Fove_ErrorCode waitErr = waitForProcessedEyeFrameTimed(device.headset);
+			if (!running_.load(std::memory_order_relaxed))
+				break;
+			if (waitErr != Fove_ErrorCode::None)
+			{
+				// Not connected or capability missing: back off instead of spinning
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+				continue;
+			}
+			PumpSnapshot rec = {};
+			fillPumpSnapshot(device.headset, rec);
+			{
+				std::lock_guard<std::mutex> lock(device.mutex);
+				if (device.pending.size() >= maxPending_)
+					device.framesDropped.fetch_add(1); // consumer is not draining fast enough
+				else
+					device.pending.push_back(rec);
+			}
+			device.framesCaptured.fetch_add(1);
+		}
+	}
+
+	void stopThreads()
+	{
+		running_.store(false);
+		for (const std::unique_ptr<Device>& device : devices_)
+			if (device->worker.joinable())
+				device->worker.join();
+	}
+
+	void destroyHeadsets()
+	{
+		for (const std::unique_ptr<Device>& device : devices_)
+		{
+			if (device->headset)
+			{
+				forgetCapabilities(device->headset);
+				fove_Headset_destroy(device->headset);
+				device->headset = nullptr;
+			}
+		}
+		devices_.clear();
+	}
+
+	const size_t maxPending_;
+	std::atomic<bool> running_{false};
+	std::vector<std::unique_ptr<Device>> devices_;
+};
+
+} // namespace
+
+void defstruct_HeadsetGroup(py::module& m)
+{
+	py::class_<HeadsetGroup>(m, "HeadsetGroup",
+							 R"(Drives several headsets from one process, one native worker thread each
+
+Creates N headsets and runs the wait/fetch cycle for each on its own C++ thread,
+so a multi-headset rig does not need one interpreter process per device. The
+workers gather snapshots without the GIL; Python drains per-device batches:
+
+    group = capi.HeadsetGroup()
+    err = group.start(4, capi.ClientCapabilities.EyeTracking)
+    batches = group.drainAll()  # list of 4 structured arrays
+
+The records are the same structured dtype as `FramePump.drain`.)")
+		.def(py::init<size_t>(), py::arg("maxPending") = 1024)
+		.def("start", &HeadsetGroup::start,
+			 py::arg("count"),
+			 py::arg_v("capabilities", Fove_ClientCapabilities::None, "ClientCapabilities.None"),
+			 R"(Creates the headsets and starts one capture worker per device
+
+\param count Number of headsets to create
+\param capabilities The capabilities to register on each headset
+\return #Fove_ErrorCode_None if all headsets were created and the workers started\n
+        #Fove_ErrorCode_API_InvalidArgument if the group is already started or count is zero\n
+        Otherwise, the first error returned by `createHeadset` (already-created headsets are destroyed again)
+)")
+		.def("close", &HeadsetGroup::close, "Stops the workers and destroys the headsets")
+		.def("drainAll", &HeadsetGroup::drainAll,
+			 R"(Removes and returns everything captured since the last drain
+
+\return A list with one structured numpy array per device, records oldest first
+)")
+		.def("headset", &HeadsetGroup::headset, py::arg("index"),
+			 R"(Returns the underlying headset of one device, e.g. for configuration calls
+
+\param index The device index, 0 to size-1
+\return The `Headset` of that device; only valid while the group is open)")
+		.def_property_readonly("size", &HeadsetGroup::size, "Number of devices in the group")
+		.def_property_readonly("running", &HeadsetGroup::isRunning, "Whether the capture workers are currently running")
+		.def_property_readonly("framesCaptured", &HeadsetGroup::framesCaptured, "Per-device total of captured frames")
+		.def_property_readonly("framesDropped", &HeadsetGroup::framesDropped, "Per-device count of frames dropped because the pending batch was full");
+}
+
+////////////////////////////////////////////////////////////////
+// Awaitable frame waits
+
+namespace
+{
+
+// Serves asyncio-based clients: `nextFrame` returns an asyncio future that a
+// single persistent worker thread completes (via `loop.call_soon_threadsafe`)
+// once `fove_Headset_waitForProcessedEyeFrame` returns. One worker serves all
+// awaits, so no Python thread is spawned per await.
+class FrameWaiter
+{
+public:
+	FrameWaiter() = default;
+
+	~FrameWaiter()
+	{
+		{
+			py::gil_scoped_release release;
+			stopThread();
+		}
+		queue_.clear(); // with the GIL, releasing any leftover references
+	}
+
+	FrameWaiter(const FrameWaiter&) = delete;
+	FrameWaiter& operator=(const FrameWaiter&) = delete;
+
+	py::object nextFrame(py::object headsetObj, py::object loop)
+	{
+		Headset& headset = headsetObj.cast<Headset&>();
+		py::object future = loop.attr("create_future")();
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (!running_)
+			{
+				if (thread_.joinable())
+					thread_.join();
+				running_ = true;
+				thread_ = std::thread([this] { run(); });
+			}
+			queue_.push_back(Request{headset, std::move(headsetObj), std::move(loop), future});
+		}
+		condition_.notify_one();
+		return future;
+	}
+
+	void stop()
+	{
+		{
+			py::gil_scoped_release release;
+			stopThread();
+		}
+		// cancel whatever was still queued (GIL is held again here)
+		for (Request& request : queue_)
+			request.future.attr("cancel")();
+		queue_.clear();
+	}
+
+private:
+	struct Request
+	{
+		Fove_Headset* headset = nullptr;
+		py::object headsetObj;
+		py::object loop;
+		py::object future;
+	};
+
+	void stopThread()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			running_ = false;
+		}
+		condition_.notify_one();
+		if (thread_.joinable())
+			thread_.join();
+	}
+
+	void run()
+	{
+		const WorkerScope worker("waiter");
+		for (;;)
+		{
+			Request request;
+			{
+				std::unique_lock<std::mutex> lock(mutex_);
+				condition_.wait(lock, [this] { return !running_ || !queue_.empty(); });
+				if (!running_)
+					return; // leftovers are cancelled by stop()/the destructor
+				request = std::move(queue_.front());
+				queue_.pop_front();
+			}
+			Fove_ErrorCode err;
+			try
+			{
+				err = FOVE_PERF(fove_Headset_waitForProcessedEyeFrame(request.headset));
+			}
+			catch (const ErrorPolicyViolation& e)
+			{
+				err = e.code; // off the Python call boundary; the code goes out through the future
+			}
+			{
+				py::gil_scoped_acquire acquire;
+				try
+				{
+					request.loop.attr("call_soon_threadsafe")(py::cpp_function([future = request.future, err]() {
+						if (!future.attr("done")().cast<bool>())
+							future.attr("set_result")(err);
+					}));
+				}
+				catch (const py::error_already_set&)
+				{
+					// the loop is closed; nothing sensible left to deliver to
+				}
+				request = Request{}; // drop the references while we hold the GIL
+			}
+		}
+	}
+
+	std::mutex mutex_;
+	std::condition_variable condition_;
+	std::deque<Request> queue_;
+	bool running_ = false;
+	std::thread thread_;
+};
+
+// Bounded-wait support: fove_Headset_waitForProcessedEyeFrame has no timeout
+// parameter and blocks indefinitely when the service stalls. One persistent
+// waiter thread per headset runs the blocking wait in a loop and publishes a
+// frame sequence counter; the bounded wait blocks on that counter with a
+// deadline instead, so the calling loop regains control at a guaranteed
+// cadence even while the underlying service wait is stuck.
+struct BoundedWait
+{
+	std::mutex mutex;
+	std::condition_variable cv;
+	uint64_t sequence = 0;
+	Fove_ErrorCode lastError = Fove_ErrorCode::None;
+	bool stop = false;
+	std::thread thread;
+};
+
+std::mutex boundedWaitMutex;
+std::map<Fove_Headset*, std::shared_ptr<BoundedWait>>& boundedWaits()
+{
+	static std::map<Fove_Headset*, std::shared_ptr<BoundedWait>> waits;
+	return waits;
+}
+
+Fove_ErrorCode waitForProcessedEyeFrameBounded(Fove_Headset* const headset, const uint64_t timeoutUs)
+{
+	std::shared_ptr<BoundedWait> wait;
+	{
+		std::lock_guard<std::mutex> lock(boundedWaitMutex);
+		std::shared_ptr<BoundedWait>& slot = boundedWaits()[headset];
+		if (!slot)
+		{
+			slot = std::make_shared<BoundedWait>();
+			// The thread shares ownership of its state, so a detach on
+			// Headset_destroy (see forgetBoundedWait) cannot leave it dangling
+			slot->thread = std::thread([headset, state = slot] {
+				const WorkerScope worker("waiter");
+				for (;;)
+				{
+					{
+						std::lock_guard<std::mutex> lock(state->mutex);
+						if (state->stop)
+							return;
+					}
+					const Fove_ErrorCode err = waitForProcessedEyeFrameTimed(headset);
+					{
+						std::lock_guard<std::mutex> lock(state->mutex);
+						if (state->stop)
+							return;
+						++state->sequence;
+						state->lastError = err;
+					}
+					state->cv.notify_all();
+					if (err != Fove_ErrorCode::None)
+						std::this_thread::sleep_for(std::chrono::milliseconds(10)); // not connected; do not spin
+				}
+			});
+		}
+		wait = slot;
+	}
+	std::unique_lock<std::mutex> lock(wait->mutex);
+	const uint64_t start = wait->sequence;
+	if (!wait->cv.wait_for(lock, std::chrono::microseconds(timeoutUs), [&] { return wait->sequence != start; }))
+		return Fove_ErrorCode::API_Timeout;
+	return wait->lastError;
+}
+
+// Called from Headset_destroy. The waiter thread may still be blocked inside
+// the service wait, so it is detached rather than joined: it exits on its own
+// once that wait returns (destroying the headset unblocks it), without ever
+// touching the headset pointer again.
+void forgetBoundedWait(Fove_Headset* const headset)
+{
+	std::shared_ptr<BoundedWait> wait;
+	{
+		std::lock_guard<std::mutex> lock(boundedWaitMutex);
+		const auto it = boundedWaits().find(headset);
+		if (it == boundedWaits().end())
+			return;
+		wait = std::move(it->second);
+		boundedWaits().erase(it);
+	}
+	{
+		std::lock_guard<std::mutex> lock(wait->mutex);
+		wait->stop = true;
+	}
+	wait->cv.notify_all();
+	if (wait->thread.joinable())
+		wait->thread.detach();
+}
+
+} // namespace
+
+void defstruct_FrameWaiter(py::module& m)
+{
+	py::class_<FrameWaiter>(m, "FrameWaiter",
+							R"(Completes asyncio futures when eye frames are processed
+
+Backs the awaitable frame API: `nextFrame(headset, loop)` returns an asyncio future that
+resolves to the wait's error code once the next eye frame has been processed. A single
+persistent worker thread performs the blocking waits for all pending futures, so awaiting
+does not spawn a Python thread per call.)")
+		.def(py::init<>())
+		.def("nextFrame", &FrameWaiter::nextFrame,
+			 py::arg("headset"), py::arg("loop"),
+			 R"(Schedules a wait for the next processed eye frame
+
+\param headset The headset to wait on; kept alive until the future resolves
+\param loop The asyncio event loop the returned future belongs to
+\return An asyncio future resolving to the #Fove_ErrorCode of the wait
+)")
+		.def("stop", &FrameWaiter::stop, "Stops the worker thread and cancels any still-pending futures");
+}
+
+////////////////////////////////////////////////////////////////
+// Awaitable compositor readiness
+
+#if FOVE_HAS_FEATURE(FOVE_FEATURE_COMPOSITOR)
+
+namespace
+{
+
+// The C API exposes no readiness event, only the fove_Compositor_isReady
+// poll, so this is the closest to an immediate wakeup the service allows:
+// a native poll at millisecond granularity, replacing the 50-100 ms
+// quantization of a Python sleep-poll loop. Returns None once ready,
+// API_Timeout when the timeout (or a stop request) cuts the wait short.
+Fove_ErrorCode compositorWaitUntilReady(Fove_Compositor* const compositor, const uint64_t timeoutUs, const std::atomic<bool>* const keepWaiting = nullptr)
+{
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(timeoutUs);
+	for (;;)
+	{
+		bool ready = false;
+		const Fove_ErrorCode err = fove_Compositor_isReady(compositor, &ready);
+		if (err != Fove_ErrorCode::None)
+			return err;
+		if (ready)
+			return Fove_ErrorCode::None;
+		if (timeoutUs != 0 && std::chrono::steady_clock::now() >= deadline)
+			return Fove_ErrorCode::API_Timeout;
+		if (keepWaiting && !keepWaiting->load(std::memory_order_relaxed))
+			return Fove_ErrorCode::API_Timeout;
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+}
+
+// Compositor counterpart of FrameWaiter: `untilReady` returns an asyncio
+// future that a single persistent worker thread resolves once the compositor
+// accepts frames (or the timeout lapses), so startup code awaits readiness
+// instead of sleep-polling the event loop.
+class CompositorWaiter
+{
+public:
+	CompositorWaiter() = default;
+
+	~CompositorWaiter()
+	{
+		{
+			py::gil_scoped_release release;
+			stopThread();
+		}
+		queue_.clear(); // with the GIL, releasing any leftover references
+	}
+
+	CompositorWaiter(const CompositorWaiter&) = delete;
+	CompositorWaiter& operator=(const CompositorWaiter&) = delete;
+
+	py::object untilReady(py::object compositorObj, py::object loop, const uint64_t timeoutUs)
+	{
+		Compositor& compositor = compositorObj.cast<Compositor&>();
+		py::object future = loop.attr("create_future")();
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (!running_)
+			{
+				if (thread_.joinable())
+					thread_.join();
+				running_ = true;
+				keepWaiting_.store(true);
+				thread_ = std::thread([this] { run(); });
+			}
+			queue_.push_back(Request{compositor, std::move(compositorObj), std::move(loop), future, timeoutUs});
+		}
+		condition_.notify_one();
+		return future;
+	}
+
+	void stop()
+	{
+		{
+			py::gil_scoped_release release;
+			stopThread();
+		}
+		// cancel whatever was still queued (GIL is held again here)
+		for (Request& request : queue_)
+			request.future.attr("cancel")();
+		queue_.clear();
+	}
+
+private:
+	struct Request
+	{
+		Fove_Compositor* compositor = nullptr;
+		py::object compositorObj;
+		py::object loop;
+		py::object future;
+		uint64_t timeoutUs = 0;
+	};
+
+	void stopThread()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			running_ = false;
+		}
+		keepWaiting_.store(false); // unblocks a poll in progress
+		condition_.notify_one();
+		if (thread_.joinable())
+			thread_.join();
+	}
+
+	void run()
+	{
+		const WorkerScope worker("compositor");
+		for (;;)
+		{
+			Request request;
+			{
+				std::unique_lock<std::mutex> lock(mutex_);
+				condition_.wait(lock, [this] { return !running_ || !queue_.empty(); });
+				if (!running_)
+					return; // leftovers are cancelled by stop()/the destructor
+				request = std::move(queue_.front());
+				queue_.pop_front();
+			}
+			const Fove_ErrorCode err = compositorWaitUntilReady(request.compositor, request.timeoutUs, &keepWaiting_);
+			{
+				py::gil_scoped_acquire acquire;
+				try
+				{
+					request.loop.attr("call_soon_threadsafe")(py::cpp_function([future = request.future, err]() {
+						if (!future.attr("done")().cast<bool>())
+							future.attr("set_result")(err);
+					}));
+				}
+				catch (const py::error_already_set&)
+				{
+					// the loop is closed; nothing sensible left to deliver to
+				}
+				request = Request{}; // drop the references while the GIL is held
+			}
+		}
+	}
+
+	std::mutex mutex_;
+	std::condition_variable condition_;
+	std::deque<Request> queue_;
+	bool running_ = false;
+	std::atomic<bool> keepWaiting_{true};
+	std::thread thread_;
+};
+
+} // namespace
+
+void defstruct_CompositorWaiter(py::module& m)
+{
+	py::class_<CompositorWaiter>(m, "CompositorWaiter",
+								 R"(Completes asyncio futures when the compositor becomes ready
+
+Backs the awaitable compositor startup API: `untilReady(compositor, loop, timeout_us)`
+returns an asyncio future resolving to #Fove_ErrorCode_None once the compositor accepts
+frames, or #Fove_ErrorCode_API_Timeout if the timeout lapses first. A single persistent
+worker thread performs the native readiness polls for all pending futures.)")
+		.def(py::init<>())
+		.def("untilReady", &CompositorWaiter::untilReady,
+			 py::arg("compositor"), py::arg("loop"), py::arg("timeout_us") = 0,
+			 R"(Schedules a wait for compositor readiness
+
+\param compositor The compositor to wait on; kept alive until the future resolves
+\param loop The asyncio event loop the returned future belongs to
+\param timeout_us Give up after this long; 0 waits indefinitely
+\return An asyncio future resolving to the #Fove_ErrorCode of the wait
+)")
+		.def("stop", &CompositorWaiter::stop, "Stops the worker thread and cancels any still-pending futures");
+}
+
+#endif // FOVE_FEATURE_COMPOSITOR
+
+////////////////////////////////////////////////////////////////
+// Pose history
+
+namespace
+{
+
+// Continuously samples the head pose (one fove_Headset_getPose per new pose id)
+// into a fixed-capacity history ring, so trajectory reconstruction reads one
+// structured numpy array instead of making thousands of attribute reads.
+class PoseBuffer
+{
+public:
+	explicit PoseBuffer(size_t capacity)
+	    : ring_(capacity) {}
+
+	~PoseBuffer() { stopThread(); }
+
+	PoseBuffer(const PoseBuffer&) = delete;
+	PoseBuffer& operator=(const PoseBuffer&) = delete;
+
+	Fove_ErrorCode start(py::object headsetObj, const uint64_t intervalUs)
+	{
+		if (running_.load())
+			return Fove_ErrorCode::API_InvalidArgument;
+		Headset& headset = headsetObj.cast<Headset&>();
+		headsetObj_ = std::move(headsetObj);
+		headset_ = headset;
+		intervalUs_ = intervalUs;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			total_ = 0;
+			lastId_ = 0;
+		}
+		running_.store(true);
+		thread_ = std::thread([this] { run(); });
+		return Fove_ErrorCode::None;
+	}
+
+	void stop()
+	{
+		{
+			py::gil_scoped_release release;
+			stopThread();
+		}
+		headsetObj_ = py::object();
+	}
+
+	bool isRunning() const { return running_.load(); }
+
+	// Returns the retained history, oldest pose first
+	py::array read()
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		const size_t count = total_ < ring_.size() ? static_cast<size_t>(total_) : ring_.size();
+		py::array_t<Fove_Pose> out(static_cast<py::ssize_t>(count));
+		auto* const p = static_cast<Fove_Pose*>(out.request().ptr);
+		for (size_t i = 0; i < count; ++i)
+			p[i] = ring_[(total_ - count + i) % ring_.size()];
+		return std::move(out);
+	}
+
+	py::array latest()
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		const bool has = total_ > 0;
+		py::array_t<Fove_Pose> out(has ? 1 : 0);
+		if (has)
+			*static_cast<Fove_Pose*>(out.request().ptr) = ring_[(total_ - 1) % ring_.size()];
+		return std::move(out);
+	}
+
+	uint64_t posesCaptured()
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return total_;
+	}
+
+private:
+	void stopThread()
+	{
+		running_.store(false);
+		if (thread_.joinable())
+			thread_.join();
+	}
+
+	void run()
+	{
+		const WorkerScope worker("pose");
+		std::chrono::steady_clock::time_point wake = std::chrono::steady_clock::now();
+		while (running_.load(std::memory_order_relaxed))
+		{
+			fove_Headset_fetchPoseData(headset_, nullptr);
+			Fove_Pose pose = {};
+			const Fove_ErrorCode err = fove_Headset_getPose(headset_, &pose);
+			if (err == Fove_ErrorCode::None)
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				if (pose.id != lastId_ || total_ == 0) // only retain fresh poses
+				{
+					ring_[total_ % ring_.size()] = pose;
+					++total_;
+					lastId_ = pose.id;
+				}
+			}
+			// Absolute-deadline cadence: sleep_for would stack the sampling work
+			// and the scheduler's wake-up error onto every interval and drift
+			wake += std::chrono::microseconds(intervalUs_);
+			const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+			if (wake < now)
+				wake = now + std::chrono::microseconds(intervalUs_); // fell behind; resync, no burst
+			std::this_thread::sleep_until(wake);
+		}
+	}
+
+	std::vector<Fove_Pose> ring_;
+	std::mutex mutex_;
+	uint64_t total_ = 0;
+	uint64_t lastId_ = 0;
+	std::atomic<bool> running_{false};
+	std::thread thread_;
+	py::object headsetObj_;
+	Fove_Headset* headset_ = nullptr;
+	uint64_t intervalUs_ = 1000;
+};
+
+// Adaptive idle wait for polling threads with no native wait call to block
+// in: learns the source period (EWMA over fresh-sample gaps), sleeps in one
+// shot until just before the predicted next arrival, and spin-finishes the
+// last stretch at yield granularity. This gets both low jitter (the poll
+// lands inside a short window around the arrival instead of a whole sleep
+// quantum away) and low idle CPU (the spin window is bounded; a stalled
+// source degrades to periodic sleeps, never a hot spin).
+class AdaptiveIdler
+{
+public:
+	explicit AdaptiveIdler(const uint64_t nominalPeriodUs)
+	    : periodUs_(nominalPeriodUs) {}
+
+	// Call when a fresh sample arrived; feeds the period estimator
+	void observeFresh()
+	{
+		const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		if (hasLast_)
+		{
+			const uint64_t gapUs = static_cast<uint64_t>(
+				std::chrono::duration_cast<std::chrono::microseconds>(now - last_).count());
+			if (gapUs > 0 && gapUs < 100000) // gaps over 100 ms are stalls, not periods
+				periodUs_ = (periodUs_ * 7 + gapUs) / 8;
+		}
+		last_ = now;
+		hasLast_ = true;
+	}
+
+	// Call when a poll came up stale; waits toward the predicted next arrival
+	void idle()
+	{
+		const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		if (!hasLast_)
+		{
+			std::this_thread::sleep_for(std::chrono::microseconds(periodUs_));
+			return;
+		}
+		const std::chrono::steady_clock::time_point next = last_ + std::chrono::microseconds(periodUs_);
+		const std::chrono::microseconds spinWindow{spinWindowUs};
+		if (now < next - spinWindow)
+			std::this_thread::sleep_until(next - spinWindow); // coarse part: one sleep, no quantum stacking
+		else if (now < next + spinWindow)
+			std::this_thread::yield(); // spin-finish window around the predicted arrival
+		else
+			std::this_thread::sleep_for(std::chrono::microseconds(periodUs_)); // missed: periodic backoff
+	}
+
+private:
+	static constexpr uint64_t spinWindowUs = 150; // covers scheduler wake-up error
+
+	uint64_t periodUs_;
+	std::chrono::steady_clock::time_point last_{};
+	bool hasLast_ = false;
+};
+
+// High-rate counterpart of PoseBuffer for motion analysis that needs every IMU
+// pose: a dedicated thread fetches at the maximum rate the service delivers
+// (freshness-checked through fove_Headset_getPoseDataTimestamp so stale polls
+// cost no getPose) and pushes each new pose into a single-producer
+// single-consumer ring with the same batch-drain semantics as FramePump, so
+// one consumer loop can drain the gaze and pose pumps together. Runs
+// independently of the eye-frame loop; the eye and pose services clock at
+// different rates and neither should gate the other.
+class PosePump
+{
+public:
+	explicit PosePump(size_t capacity)
+	    : ring_(roundUpPow2(capacity)) {}
+
+	~PosePump() { stopThread(); }
+
+	PosePump(const PosePump&) = delete;
+	PosePump& operator=(const PosePump&) = delete;
+
+	Fove_ErrorCode start(py::object headsetObj, Fove_ClientCapabilities capabilities)
+	{
+		if (running_.load())
+			return Fove_ErrorCode::API_InvalidArgument;
+		Headset& headset = headsetObj.cast<Headset&>();
+		if (capabilities != Fove_ClientCapabilities::None)
+		{
+			const Fove_ErrorCode err = fove_Headset_registerCapabilities(headset, capabilities);
+			if (err != Fove_ErrorCode::None)
+				return err;
+			noteCapabilitiesRegistered(headset, capabilities);
+		}
+		headsetObj_ = std::move(headsetObj); // keeps the headset alive while the pump runs
+		headset_ = headset;
+		readIndex_.store(0);
+		writeIndex_.store(0);
+		posesCaptured_.store(0);
+		posesDropped_.store(0);
+		hasLatest_ = false;
+		running_.store(true);
+		thread_ = std::thread([this] { run(); });
+		return Fove_ErrorCode::None;
+	}
+
+	void stop()
+	{
+		{
+			py::gil_scoped_release release;
+			stopThread();
+		}
+		headsetObj_ = py::object();
+	}
+
+	bool isRunning() const { return running_.load(); }
+
+	py::array drain()
+	{
+		const uint64_t write = writeIndex_.load(std::memory_order_acquire);
+		uint64_t read = readIndex_.load(std::memory_order_relaxed);
+		const size_t count = static_cast<size_t>(write - read);
+		py::array_t<Fove_Pose> batch(static_cast<py::ssize_t>(count));
+		auto* const out = static_cast<Fove_Pose*>(batch.request().ptr);
+		for (size_t i = 0; i < count; ++i, ++read)
+			out[i] = ring_[read & (ring_.size() - 1)];
+		readIndex_.store(read, std::memory_order_release);
+		return std::move(batch);
+	}
+
+	py::array latest()
+	{
+		Fove_Pose pose;
+		bool has = false;
+		{
+			std::lock_guard<std::mutex> lock(latestMutex_);
+			has = hasLatest_;
+			pose = latest_;
+		}
+		py::array_t<Fove_Pose> out(has ? 1 : 0);
+		if (has)
+			*static_cast<Fove_Pose*>(out.request().ptr) = pose;
+		return std::move(out);
+	}
+
+	uint64_t posesCaptured() const { return posesCaptured_.load(); }
+	uint64_t posesDropped() const { return posesDropped_.load(); }
+
+private:
+	void stopThread()
+	{
+		running_.store(false);
+		if (thread_.joinable())
+			thread_.join();
+	}
+
+	void run()
+	{
+		const WorkerScope worker("pose");
+		uint64_t lastId = 0;
+		bool hasLast = false;
+		AdaptiveIdler idler{1000}; // the IMU's nominal 1 kHz until measured
+		while (running_.load(std::memory_order_relaxed))
+		{
+			const Fove_ErrorCode fetchErr = fove_Headset_fetchPoseData(headset_, nullptr);
+			if (fetchErr != Fove_ErrorCode::None)
+			{
+				// Not connected or capability missing: back off instead of spinning
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+				continue;
+			}
+			// The timestamp query is much cheaper than copying the full pose,
+			// so stale polls pay only for it
+			Fove_FrameTimestamp timestamp = {};
+			if (fove_Headset_getPoseDataTimestamp(headset_, &timestamp) == Fove_ErrorCode::None && (!hasLast || timestamp.id != lastId))
+			{
+				Fove_Pose pose = {};
+				if (fove_Headset_getPose(headset_, &pose) == Fove_ErrorCode::None)
+				{
+					push(pose);
+					idler.observeFresh();
+					lastId = timestamp.id;
+					hasLast = true;
+					continue; // another pose may already be pending; poll again immediately
+				}
+			}
+			// Stale: wait toward the predicted next arrival instead of a fixed quantum
+			idler.idle();
+		}
+	}
+
+	void push(const Fove_Pose& pose)
+	{
+		const uint64_t write = writeIndex_.load(std::memory_order_relaxed);
+		const uint64_t read = readIndex_.load(std::memory_order_acquire);
+		if (write - read >= ring_.size())
+		{
+			// Consumer is not draining fast enough; log the first occurrence only
+			if (posesDropped_.fetch_add(1) == 0)
+				logDiagnostic(Fove_LogLevel::Warning, "PosePump: ring full, dropping poses");
+		}
+		else
+		{
+			ring_[write & (ring_.size() - 1)] = pose;
+			writeIndex_.store(write + 1, std::memory_order_release);
+		}
+		{
+			std::lock_guard<std::mutex> lock(latestMutex_);
+			latest_ = pose;
+			hasLatest_ = true;
+		}
+		posesCaptured_.fetch_add(1);
+	}
+
+	std::vector<Fove_Pose> ring_;
+	std::atomic<uint64_t> readIndex_{0};
+	std::atomic<uint64_t> writeIndex_{0};
+	std::atomic<uint64_t> posesCaptured_{0};
+	std::atomic<uint64_t> posesDropped_{0};
+	std::atomic<bool> running_{false};
+	std::thread thread_;
+	py::object headsetObj_;
+	Fove_Headset* headset_ = nullptr;
+	std::mutex latestMutex_;
+	Fove_Pose latest_ = {};
+	bool hasLatest_ = false;
+};
+
+} // namespace
+
+void defstruct_PoseBuffer(py::module& m)
+{
+	// The Pose dtype is registered in defstruct_Dtypes, which runs first
+
+	py::class_<PoseBuffer>(m, "PoseBuffer",
+						   R"(A continuously filled fixed-capacity ring of head poses
+
+A background thread fetches pose data and retains every new pose (deduplicated by pose id)
+into a ring of the given capacity. `read` returns the retained history as a structured
+numpy array with the exact #Fove_Pose fields, so trajectory analysis is a single
+vectorized operation instead of per-sample attribute reads.
+
+`Fove_ClientCapabilities_OrientationTracking` (and `PositionTracking` for position data)
+should be registered on the headset.)")
+		.def(py::init<size_t>(), py::arg("capacity") = 1024)
+		.def("start", &PoseBuffer::start,
+			 py::arg("headset"), py::arg("interval_us") = 1000,
+			 R"(Starts sampling poses from the given headset
+
+\param headset The headset to sample; kept alive by the buffer until `stop`
+\param interval_us The polling interval of the sampling thread, in microseconds
+\return #Fove_ErrorCode_None if sampling started\n
+        #Fove_ErrorCode_API_InvalidArgument if already running
+)")
+		.def("stop", &PoseBuffer::stop, "Stops the sampling thread and releases the headset reference")
+		.def("read", &PoseBuffer::read,
+			 "Returns the retained pose history, oldest first, as a structured numpy array")
+		.def("latest", &PoseBuffer::latest,
+			 "Returns the most recent pose as a structured numpy array of length one (zero if empty)")
+		.def_property_readonly("running", &PoseBuffer::isRunning, "Whether the sampling thread is currently running")
+		.def_property_readonly("posesCaptured", &PoseBuffer::posesCaptured, "Total number of distinct poses captured since `start`");
+}
+
+void defstruct_PosePump(py::module& m)
+{
+	py::class_<PosePump>(m, "PosePump",
+						 R"(A background pose capture thread running at the service rate
+
+Head poses update at IMU rate, far faster than eye frames; sampling `Headset_getPose`
+from the eye-frame loop aliases away the fast motion. This pump fetches pose data on a
+dedicated native thread at the maximum rate the service delivers — staleness is checked
+through `Headset_getPoseDataTimestamp`, so polls that find no new pose are cheap — and
+accumulates every distinct pose into a single-producer single-consumer ring buffer.
+
+`drain` has the same batch semantics as `FramePump.drain`, so one consumer loop can
+drain the gaze and pose pumps together; if the ring fills up, the newest poses are
+dropped (and counted in `posesDropped`) rather than blocking capture.
+
+`Fove_ClientCapabilities_OrientationTracking` (and `PositionTracking` for position data)
+should be registered on the headset.)")
+		.def(py::init<size_t>(), py::arg("capacity") = 4096)
+		.def("start", &PosePump::start,
+			 py::arg("headset"),
+			 py::arg_v("capabilities", Fove_ClientCapabilities::None, "ClientCapabilities.None"),
+			 R"(Starts the pump thread on the given headset
+
+\param headset The headset to pump poses from; kept alive by the pump until `stop`
+\param capabilities Additional capabilities to register before starting, if any
+\return #Fove_ErrorCode_None if the pump started\n
+        #Fove_ErrorCode_API_InvalidArgument if the pump is already running\n
+        Otherwise, the error returned by the capability registration
+)")
+		.def("stop", &PosePump::stop, "Stops the pump thread and releases the headset reference")
+		.def("drain", &PosePump::drain,
+			 R"(Removes and returns all pending poses
+
+\return A structured numpy array with the exact #Fove_Pose fields, one record per
+        captured pose, oldest first; empty if no new pose
+)")
+		.def("latest", &PosePump::latest,
+			 "Returns the most recent pose as a structured numpy array of length one (zero if empty)")
+		.def_property_readonly("running", &PosePump::isRunning, "Whether the pump thread is currently running")
+		.def_property_readonly("posesCaptured", &PosePump::posesCaptured, "Total number of distinct poses captured since `start`")
+		.def_property_readonly("posesDropped", &PosePump::posesDropped, "Number of poses dropped because the ring buffer was full");
+}
+
+////////////////////////////////////////////////////////////////
+// Flight recorder
+
+namespace
+{
+
+// Column table: one entry per PumpSnapshot field, in declaration order. It
+// drives the columnar exporter (vector fields flatten to float32 sub-rows,
+// (n, 3) for Vec3 and (n, 6) for Ray, since analysis frameworks want flat
+// numeric columns) and the capability-driven packed recording schema below.
+// `caps` names the capability whose data the column carries; None marks the
+// always-recorded columns (frame id, timestamp, and the per-channel errors).
+struct ColumnSpec
+{
+	enum class Kind
+	{
+		U64,
+		F32,
+		I32,
+		I16,
+		U8,
+		Vec3,
+		Ray,
+	};
+
+	const char* name;
+	size_t offset;
+	Kind kind;
+	Fove_ClientCapabilities caps;
+};
+
+const ColumnSpec pumpColumns[] = {
+	{"frameId", offsetof(PumpSnapshot, frameId), ColumnSpec::Kind::U64, Fove_ClientCapabilities::None},
+	{"timestamp", offsetof(PumpSnapshot, timestamp), ColumnSpec::Kind::U64, Fove_ClientCapabilities::None},
+	{"gazeVectorLeft", offsetof(PumpSnapshot, gazeVectorLeft), ColumnSpec::Kind::Vec3, Fove_ClientCapabilities::EyeTracking},
+	{"gazeVectorRight", offsetof(PumpSnapshot, gazeVectorRight), ColumnSpec::Kind::Vec3, Fove_ClientCapabilities::EyeTracking},
+	{"gazeVectorRawLeft", offsetof(PumpSnapshot, gazeVectorRawLeft), ColumnSpec::Kind::Vec3, Fove_ClientCapabilities::EyeTracking},
+	{"gazeVectorRawRight", offsetof(PumpSnapshot, gazeVectorRawRight), ColumnSpec::Kind::Vec3, Fove_ClientCapabilities::EyeTracking},
+	{"pupilRadiusLeft", offsetof(PumpSnapshot, pupilRadiusLeft), ColumnSpec::Kind::F32, Fove_ClientCapabilities::PupilRadius},
+	{"pupilRadiusRight", offsetof(PumpSnapshot, pupilRadiusRight), ColumnSpec::Kind::F32, Fove_ClientCapabilities::PupilRadius},
+	{"irisRadiusLeft", offsetof(PumpSnapshot, irisRadiusLeft), ColumnSpec::Kind::F32, Fove_ClientCapabilities::IrisRadius},
+	{"irisRadiusRight", offsetof(PumpSnapshot, irisRadiusRight), ColumnSpec::Kind::F32, Fove_ClientCapabilities::IrisRadius},
+	{"eyeStateLeft", offsetof(PumpSnapshot, eyeStateLeft), ColumnSpec::Kind::I32, Fove_ClientCapabilities::EyeTracking},
+	{"eyeStateRight", offsetof(PumpSnapshot, eyeStateRight), ColumnSpec::Kind::I32, Fove_ClientCapabilities::EyeTracking},
+	{"eyeBlinkingLeft", offsetof(PumpSnapshot, eyeBlinkingLeft), ColumnSpec::Kind::U8, Fove_ClientCapabilities::EyeBlink},
+	{"eyeBlinkingRight", offsetof(PumpSnapshot, eyeBlinkingRight), ColumnSpec::Kind::U8, Fove_ClientCapabilities::EyeBlink},
+	{"combinedRay", offsetof(PumpSnapshot, combinedRay), ColumnSpec::Kind::Ray, Fove_ClientCapabilities::EyeTracking},
+	{"combinedDepth", offsetof(PumpSnapshot, combinedDepth), ColumnSpec::Kind::F32, Fove_ClientCapabilities::GazeDepth},
+	{"gazeVelocityLeft", offsetof(PumpSnapshot, gazeVelocityLeft), ColumnSpec::Kind::F32, Fove_ClientCapabilities::EyeTracking},
+	{"gazeVelocityRight", offsetof(PumpSnapshot, gazeVelocityRight), ColumnSpec::Kind::F32, Fove_ClientCapabilities::EyeTracking},
+	{"gazeAccelerationLeft", offsetof(PumpSnapshot, gazeAccelerationLeft), ColumnSpec::Kind::F32, Fove_ClientCapabilities::EyeTracking},
+	{"gazeAccelerationRight", offsetof(PumpSnapshot, gazeAccelerationRight), ColumnSpec::Kind::F32, Fove_ClientCapabilities::EyeTracking},
+	{"errGazeVectorLeft", offsetof(PumpSnapshot, errGazeVectorLeft), ColumnSpec::Kind::I16, Fove_ClientCapabilities::None},
+	{"errGazeVectorRight", offsetof(PumpSnapshot, errGazeVectorRight), ColumnSpec::Kind::I16, Fove_ClientCapabilities::None},
+	{"errGazeVectorRawLeft", offsetof(PumpSnapshot, errGazeVectorRawLeft), ColumnSpec::Kind::I16, Fove_ClientCapabilities::None},
+	{"errGazeVectorRawRight", offsetof(PumpSnapshot, errGazeVectorRawRight), ColumnSpec::Kind::I16, Fove_ClientCapabilities::None},
+	{"errPupilRadiusLeft", offsetof(PumpSnapshot, errPupilRadiusLeft), ColumnSpec::Kind::I16, Fove_ClientCapabilities::None},
+	{"errPupilRadiusRight", offsetof(PumpSnapshot, errPupilRadiusRight), ColumnSpec::Kind::I16, Fove_ClientCapabilities::None},
+	{"errIrisRadiusLeft", offsetof(PumpSnapshot, errIrisRadiusLeft), ColumnSpec::Kind::I16, Fove_ClientCapabilities::None},
+	{"errIrisRadiusRight", offsetof(PumpSnapshot, errIrisRadiusRight), ColumnSpec::Kind::I16, Fove_ClientCapabilities::None},
+	{"errEyeStateLeft", offsetof(PumpSnapshot, errEyeStateLeft), ColumnSpec::Kind::I16, Fove_ClientCapabilities::None},
+	{"errEyeStateRight", offsetof(PumpSnapshot, errEyeStateRight), ColumnSpec::Kind::I16, Fove_ClientCapabilities::None},
+	{"errEyeBlinkingLeft", offsetof(PumpSnapshot, errEyeBlinkingLeft), ColumnSpec::Kind::I16, Fove_ClientCapabilities::None},
+	{"errEyeBlinkingRight", offsetof(PumpSnapshot, errEyeBlinkingRight), ColumnSpec::Kind::I16, Fove_ClientCapabilities::None},
+	{"errCombinedRay", offsetof(PumpSnapshot, errCombinedRay), ColumnSpec::Kind::I16, Fove_ClientCapabilities::None},
+	{"errCombinedDepth", offsetof(PumpSnapshot, errCombinedDepth), ColumnSpec::Kind::I16, Fove_ClientCapabilities::None},
+	{"gazedObjectId", offsetof(PumpSnapshot, gazedObjectId), ColumnSpec::Kind::I32, Fove_ClientCapabilities::EyeTracking},
+	{"gazedObjectPoint", offsetof(PumpSnapshot, gazedObjectPoint), ColumnSpec::Kind::Vec3, Fove_ClientCapabilities::EyeTracking},
+};
+
+constexpr size_t pumpColumnCount = sizeof(pumpColumns) / sizeof(pumpColumns[0]);
+
+size_t columnElemSize(const ColumnSpec::Kind kind)
+{
+	switch (kind)
+	{
+	case ColumnSpec::Kind::U64: return sizeof(uint64_t);
+	case ColumnSpec::Kind::F32: return sizeof(float);
+	case ColumnSpec::Kind::I32: return sizeof(int32_t);
+	case ColumnSpec::Kind::I16: return sizeof(int16_t);
+	case ColumnSpec::Kind::U8: return sizeof(uint8_t);
+	case ColumnSpec::Kind::Vec3: return sizeof(float) * 3;
+	case ColumnSpec::Kind::Ray: return sizeof(float) * 6;
+	}
+	return 0;
+}
+
+// Compiles the active-column bitmask for a capability set: a column is kept
+// when the set contains its capability, or when it has no capability
+// requirement at all. The error columns thus always survive packing, so a
+// reader can still tell *why* a dropped channel carried no data.
+uint64_t snapshotSchemaMask(const Fove_ClientCapabilities caps)
+{
+	uint64_t mask = 0;
+	for (size_t c = 0; c < pumpColumnCount; ++c)
+		if (pumpColumns[c].caps == Fove_ClientCapabilities::None
+			|| (caps & pumpColumns[c].caps) != Fove_ClientCapabilities::None)
+			mask |= uint64_t(1) << c;
+	return mask;
+}
+
+size_t packedRecordSize(const uint64_t mask)
+{
+	size_t size = 0;
+	for (size_t c = 0; c < pumpColumnCount; ++c)
+		if (mask & (uint64_t(1) << c))
+			size += columnElemSize(pumpColumns[c].kind);
+	return size;
+}
+
+// Gathers the active columns of a snapshot, in table order, into a packed
+// row with no padding (the layout `snapshot_schema` describes)
+void packSnapshot(const PumpSnapshot& rec, const uint64_t mask, uint8_t* out)
+{
+	const uint8_t* const raw = reinterpret_cast<const uint8_t*>(&rec);
+	for (size_t c = 0; c < pumpColumnCount; ++c)
+	{
+		if ((mask & (uint64_t(1) << c)) == 0)
+			continue;
+		const size_t elemSize = columnElemSize(pumpColumns[c].kind);
+		std::memcpy(out, raw + pumpColumns[c].offset, elemSize);
+		out += elemSize;
+	}
+}
+
+// Inverse of packSnapshot; columns absent from the mask are zeroed
+void unpackSnapshot(const uint8_t* in, const uint64_t mask, PumpSnapshot& rec)
+{
+	rec = {};
+	uint8_t* const raw = reinterpret_cast<uint8_t*>(&rec);
+	for (size_t c = 0; c < pumpColumnCount; ++c)
+	{
+		if ((mask & (uint64_t(1) << c)) == 0)
+			continue;
+		const size_t elemSize = columnElemSize(pumpColumns[c].kind);
+		std::memcpy(raw + pumpColumns[c].offset, in, elemSize);
+		in += elemSize;
+	}
+}
+
+// On-disk layout: this fixed header followed by packed PumpSnapshot records,
+// or, when the compression flag is set, by length-prefixed compressed blocks
+struct RecorderFileHeader
+{
+	char magic[8];        // "FOVEREC\0"
+	uint32_t version;     // bumped whenever PumpSnapshot changes layout
+	uint32_t recordSize;  // sizeof(PumpSnapshot) at write time, for validation
+	uint32_t flags;       // recorderFlag* bits; readers reject unknown bits
+	uint32_t reserved;
+};
+
+constexpr char recorderMagic[8] = {'F', 'O', 'V', 'E', 'R', 'E', 'C', '\0'};
+constexpr uint32_t recorderVersion = 1;
+
+// Snapshot blocks are delta+RLE compressed: each record is XORed byte-wise
+// against the previous one (consecutive frames differ in few fields) and the
+// resulting mostly-zero stream is run-length encoded
+constexpr uint32_t recorderFlagDeltaRle = 0x1;
+
+// The file carries a capability-compiled schema: a uint64 column bitmask
+// (bit i = pumpColumns[i] present) follows the file header, and each record
+// stores only those columns, packed in table order with no padding.
+// recordSize is then the packed row size. See snapshotSchemaMask above.
+constexpr uint32_t recorderFlagColumnMask = 0x2;
+
+// Precedes each compressed block on disk. Blocks are self-contained (the
+// delta baseline resets per block) so that a reader can decode any block
+// without its predecessors, which is what makes time-range seeks possible.
+struct RecorderBlockHeader
+{
+	uint32_t compressedSize; // bytes of encoded data following this header
+	uint32_t recordCount;    // records the block decodes to
+	uint64_t firstTimestamp; // timestamp of the first record in the block
+	uint64_t lastTimestamp;  // timestamp of the last record in the block
+};
+
+// One index entry per block, appended (followed by the footer) when the file
+// is closed cleanly; readers fall back to scanning block headers without it
+struct RecorderIndexEntry
+{
+	uint64_t offset;         // file offset of the block's RecorderBlockHeader
+	uint64_t firstTimestamp;
+	uint64_t lastTimestamp;
+};
+
+struct RecorderIndexFooter
+{
+	char magic[8]; // "FOVEIDX\0"
+	uint64_t entryCount;
+};
+
+constexpr char recorderIndexMagic[8] = {'F', 'O', 'V', 'E', 'I', 'D', 'X', '\0'};
+
+size_t blackboxWrite(const std::string& path)
+{
+	const std::vector<PumpSnapshot> records = blackBox().snapshot();
+	std::FILE* const file = std::fopen(path.c_str(), "wb");
+	if (!file)
+		throw std::runtime_error("blackbox_dump: cannot open " + path);
+	RecorderFileHeader header = {};
+	std::memcpy(header.magic, recorderMagic, sizeof header.magic);
+	header.version = recorderVersion;
+	header.recordSize = static_cast<uint32_t>(sizeof(PumpSnapshot));
+	header.flags = 0; // uncompressed: a dump is small and must not fail in a fancy code path
+	bool ok = std::fwrite(&header, sizeof header, 1, file) == 1;
+	if (ok && !records.empty())
+		ok = std::fwrite(records.data(), sizeof(PumpSnapshot), records.size(), file) == records.size();
+	ok = std::fclose(file) == 0 && ok;
+	if (!ok)
+		throw std::runtime_error("blackbox_dump: short write to " + path);
+	return records.size();
+}
+
+void BlackBox::autoDump()
+{
+	// Dumped from a detached thread so the pump never blocks on disk; the
+	// ring keeps collecting (and overwriting) while the dump copies it
+	std::thread([] {
+		try
+		{
+			const size_t written = blackboxWrite(blackBox().autoDumpPath());
+			logDiagnostic(Fove_LogLevel::Warning,
+						  ("black box: dumped " + std::to_string(written) + " records on critical error").c_str());
+		}
+		catch (const std::exception& e)
+		{
+			logDiagnostic(Fove_LogLevel::Error, (std::string("black box: auto dump failed: ") + e.what()).c_str());
+		}
+	}).detach();
+}
+
+// Encodes a byte stream as (zero-run, literal-run) token pairs: one byte of
+// zero count, one byte of literal count, then the literal bytes. Runs longer
+// than 255 continue in the next token.
+void zeroRleEncode(const uint8_t* const data, const size_t size, std::vector<char>& out)
+{
+	size_t i = 0;
+	while (i < size)
+	{
+		size_t zeros = 0;
+		while (i + zeros < size && zeros < 255 && data[i + zeros] == 0)
+			++zeros;
+		i += zeros;
+		size_t literals = 0;
+		if (zeros < 255) // a full zero token continues the run instead
+			while (i + literals < size && literals < 255 && data[i + literals] != 0)
+				++literals;
+		out.push_back(static_cast<char>(zeros));
+		out.push_back(static_cast<char>(literals));
+		out.insert(out.end(), reinterpret_cast<const char*>(data + i), reinterpret_cast<const char*>(data + i + literals));
+		i += literals;
+	}
+}
+
+// Inverse of zeroRleEncode; returns false if the input is malformed or does
+// not decode to exactly outSize bytes
+bool zeroRleDecode(const char* const in, const size_t inSize, uint8_t* const out, const size_t outSize)
+{
+	size_t i = 0;
+	size_t o = 0;
+	while (i + 2 <= inSize)
+	{
+		const size_t zeros = static_cast<uint8_t>(in[i]);
+		const size_t literals = static_cast<uint8_t>(in[i + 1]);
+		i += 2;
+		if (o + zeros + literals > outSize || i + literals > inSize)
+			return false;
+		std::memset(out + o, 0, zeros);
+		o += zeros;
+		std::memcpy(out + o, in + i, literals);
+		o += literals;
+		i += literals;
+	}
+	return i == inSize && o == outSize;
+}
+
+// Decodes one compressed block (delta baseline starts at zero) and appends
+// its records, unpacking the rows of schema-packed files back into full
+// snapshots. `delta` is a reusable scratch buffer.
+void decodeRecorderBlock(const std::vector<char>& block, const uint32_t recordCount, const uint64_t mask,
+						 std::vector<uint8_t>& delta, std::vector<PumpSnapshot>& records,
+						 const std::string& path, const char* const who)
+{
+	const size_t recordSize = mask != 0 ? packedRecordSize(mask) : sizeof(PumpSnapshot);
+	delta.resize(static_cast<size_t>(recordCount) * recordSize);
+	if (!zeroRleDecode(block.data(), block.size(), delta.data(), delta.size()))
+		throw std::runtime_error(std::string(who) + ": " + path + " contains a corrupt block");
+	// Undo the per-record XOR delta in place, then copy (or unpack) the rows
+	for (size_t r = 1; r < recordCount; ++r)
+	{
+		uint8_t* const row = delta.data() + r * recordSize;
+		const uint8_t* const prev = row - recordSize;
+		for (size_t b = 0; b < recordSize; ++b)
+			row[b] ^= prev[b];
+	}
+	const size_t base = records.size();
+	records.resize(base + recordCount);
+	for (size_t r = 0; r < recordCount; ++r)
+	{
+		const uint8_t* const row = delta.data() + r * recordSize;
+		if (mask != 0)
+			unpackSnapshot(row, mask, records[base + r]);
+		else
+			std::memcpy(&records[base + r], row, sizeof(PumpSnapshot));
+	}
+}
+
+// Reads the compressed blocks of an already-validated recording (the file
+// position must be just past the file header) whose timestamp ranges overlap
+// [startUs, endUs], endUs 0 meaning unbounded. When the file carries an index
+// footer the relevant blocks are found by binary search; otherwise the block
+// headers are scanned, skipping non-overlapping payloads with a seek. `who`
+// prefixes error messages ("Recorder.load", "ReplayHeadset").
+std::vector<PumpSnapshot> readCompressedRecords(std::FILE* const file, const std::string& path, const char* const who,
+												const uint64_t mask = 0, const uint64_t startUs = 0, const uint64_t endUs = 0)
+{
+	const long dataStart = std::ftell(file);
+	std::fseek(file, 0, SEEK_END);
+	const long fileEnd = std::ftell(file);
+	long dataEnd = fileEnd;
+
+	// A cleanly closed file ends with [index entries][footer]
+	std::vector<RecorderIndexEntry> index;
+	if (fileEnd - dataStart >= static_cast<long>(sizeof(RecorderIndexFooter)))
+	{
+		RecorderIndexFooter footer = {};
+		std::fseek(file, fileEnd - static_cast<long>(sizeof footer), SEEK_SET);
+		if (std::fread(&footer, sizeof footer, 1, file) == 1
+			&& std::memcmp(footer.magic, recorderIndexMagic, sizeof footer.magic) == 0)
+		{
+			const long indexStart = fileEnd - static_cast<long>(sizeof footer)
+				- static_cast<long>(footer.entryCount * sizeof(RecorderIndexEntry));
+			if (indexStart >= dataStart)
+			{
+				index.resize(footer.entryCount);
+				std::fseek(file, indexStart, SEEK_SET);
+				if (std::fread(index.data(), sizeof(RecorderIndexEntry), index.size(), file) != index.size())
+					throw std::runtime_error(std::string(who) + ": " + path + " has a truncated index");
+				dataEnd = indexStart;
+			}
+		}
+	}
+
+	const auto overlaps = [&](const uint64_t first, const uint64_t last) {
+		return last >= startUs && (endUs == 0 || first <= endUs);
+	};
+
+	std::vector<PumpSnapshot> records;
+	std::vector<char> block;
+	std::vector<uint8_t> delta;
+	RecorderBlockHeader blockHeader = {};
+	const auto readBlockHere = [&] {
+		block.resize(blockHeader.compressedSize);
+		if (std::fread(block.data(), 1, block.size(), file) != block.size())
+			throw std::runtime_error(std::string(who) + ": " + path + " is truncated mid-block");
+		decodeRecorderBlock(block, blockHeader.recordCount, mask, delta, records, path, who);
+	};
+
+	if (!index.empty())
+	{
+		// Block ranges are sorted; binary-search the first block that can hold startUs
+		auto it = std::lower_bound(index.begin(), index.end(), startUs,
+								   [](const RecorderIndexEntry& e, const uint64_t ts) { return e.lastTimestamp < ts; });
+		for (; it != index.end() && overlaps(it->firstTimestamp, it->lastTimestamp); ++it)
+		{
+			std::fseek(file, static_cast<long>(it->offset), SEEK_SET);
+			if (std::fread(&blockHeader, sizeof blockHeader, 1, file) != 1)
+				throw std::runtime_error(std::string(who) + ": " + path + " has an index entry past the end of the file");
+			readBlockHere();
+		}
+	}
+	else
+	{
+		std::fseek(file, dataStart, SEEK_SET);
+		long offset = dataStart;
+		while (offset + static_cast<long>(sizeof blockHeader) <= dataEnd
+			   && std::fread(&blockHeader, sizeof blockHeader, 1, file) == 1)
+		{
+			offset += static_cast<long>(sizeof blockHeader);
+			if (overlaps(blockHeader.firstTimestamp, blockHeader.lastTimestamp))
+				readBlockHere();
+			else
+				std::fseek(file, static_cast<long>(blockHeader.compressedSize), SEEK_CUR);
+			offset += static_cast<long>(blockHeader.compressedSize);
+		}
+	}
+
+	// Trim the edge blocks' out-of-range records
+	if (startUs != 0 || endUs != 0)
+		records.erase(std::remove_if(records.begin(), records.end(),
+									 [&](const PumpSnapshot& rec) {
+										 return rec.timestamp < startUs || (endUs != 0 && rec.timestamp > endUs);
+									 }),
+					  records.end());
+	return records;
+}
+
+// Records eye frames to a binary file: a capture thread runs the wait/fetch
+// cycle and appends snapshot records to an in-memory buffer, while a writer
+// thread periodically swaps that buffer out and writes it to disk in large
+// blocks. The capture thread thus never blocks on I/O.
+class Recorder
+{
+public:
+	explicit Recorder(std::string path, const bool compress = false,
+					  const uint64_t segmentBytes = 0, const double segmentSeconds = 0, const bool packed = false)
+	    : path_(std::move(path)), compress_(compress), packed_(packed), segmentBytes_(segmentBytes), segmentSeconds_(segmentSeconds)
+	{
+		if (segmentSeconds < 0)
+			throw std::runtime_error("Recorder: segment_seconds must be >= 0");
+		openFile(rotating() ? segmentPath(0) : path_);
+		if (rotating())
+			syncThread_ = std::thread([this] { runSync(); });
+	}
+
+	~Recorder() { close(); }
+
+	Recorder(const Recorder&) = delete;
+	Recorder& operator=(const Recorder&) = delete;
+
+	Fove_ErrorCode start(py::object headsetObj, Fove_ClientCapabilities capabilities)
+	{
+		if (running_.load() || !file_)
+			return Fove_ErrorCode::API_InvalidArgument;
+		Headset& headset = headsetObj.cast<Headset&>();
+		if (capabilities != Fove_ClientCapabilities::None)
+		{
+			const Fove_ErrorCode err = fove_Headset_registerCapabilities(headset, capabilities);
+			if (err != Fove_ErrorCode::None)
+				return err;
+			noteCapabilitiesRegistered(headset, capabilities);
+		}
+		// The packed schema is compiled once, at the first start, from the
+		// capabilities the headset is known to have registered (see the
+		// capability cache) plus the ones registered just above; the header is
+		// rewritten in place since no records precede it. Later starts on the
+		// same file keep the layout, as records must stay uniform.
+		if (packed_ && schemaMask_ == 0)
+		{
+			schemaMask_ = snapshotSchemaMask(registeredCapabilities(headset) | capabilities);
+			packedSize_ = packedRecordSize(schemaMask_);
+			std::fseek(file_, 0, SEEK_SET);
+			writeFileHeader();
+		}
+		headsetObj_ = std::move(headsetObj);
+		headset_ = headset;
+		running_.store(true);
+		captureThread_ = std::thread([this] { runCapture(); });
+		writerThread_ = std::thread([this] { runWriter(); });
+		return Fove_ErrorCode::None;
+	}
+
+	void stop()
+	{
+		{
+			py::gil_scoped_release release;
+			stopThreads();
+		}
+		headsetObj_ = py::object();
+	}
+
+	void close()
+	{
+		stopThreads();
+		if (file_)
+		{
+			sealFile();
+			std::fflush(file_);
+#ifndef _WIN32
+			fsync(fileno(file_)); // cold path: the final segment is synced inline
+#endif
+			std::fclose(file_);
+			file_ = nullptr;
+		}
+		if (syncThread_.joinable())
+		{
+			{
+				std::lock_guard<std::mutex> lock(syncMutex_);
+				syncStop_ = true;
+			}
+			syncCv_.notify_all();
+			syncThread_.join();
+		}
+	}
+
+	bool isRunning() const { return running_.load(); }
+	uint64_t recordsWritten() const { return recordsWritten_.load(); }
+	uint64_t bytesWritten() const { return bytesWritten_.load(); }
+	uint64_t segmentsCompleted() const { return segmentsCompleted_.load(); }
+	bool isCompressed() const { return compress_; }
+	bool isPacked() const { return packed_; }
+	const std::string& path() const { return path_; }
+
+	// Memory-maps a recording back as a structured numpy array (zero-copy on
+	// POSIX; on Windows the file is simply read into a fresh array instead).
+	// A non-zero time range selects a slice: uncompressed files binary-search
+	// the mapped records directly, compressed files binary-search the block
+	// index and decode only the overlapping blocks.
+	static py::array load(const std::string& path, const uint64_t startUs = 0, const uint64_t endUs = 0)
+	{
+		if (endUs != 0 && endUs < startUs)
+			throw std::runtime_error("Recorder.load: end_us must be 0 or >= start_us");
+		std::FILE* const file = std::fopen(path.c_str(), "rb");
+		if (!file)
+			throw std::runtime_error("Recorder.load: cannot open " + path);
+		RecorderFileHeader header = {};
+		if (std::fread(&header, sizeof header, 1, file) != 1
+			|| std::memcmp(header.magic, recorderMagic, sizeof header.magic) != 0)
+		{
+			std::fclose(file);
+			throw std::runtime_error("Recorder.load: " + path + " is not a recorder file");
+		}
+		if (header.version != recorderVersion
+			|| (header.flags & ~(recorderFlagDeltaRle | recorderFlagColumnMask)) != 0)
+		{
+			std::fclose(file);
+			throw std::runtime_error("Recorder.load: " + path + " was written by an incompatible version");
+		}
+		uint64_t mask = 0;
+		if ((header.flags & recorderFlagColumnMask) != 0
+				? std::fread(&mask, sizeof mask, 1, file) != 1 || header.recordSize != packedRecordSize(mask)
+				: header.recordSize != sizeof(PumpSnapshot))
+		{
+			std::fclose(file);
+			throw std::runtime_error("Recorder.load: " + path + " was written by an incompatible version");
+		}
+		if (header.flags & recorderFlagDeltaRle)
+		{
+			// Compressed recordings cannot be memory-mapped; decode into a fresh array
+			std::vector<PumpSnapshot> records;
+			try
+			{
+				records = readCompressedRecords(file, path, "Recorder.load", mask, startUs, endUs);
+			}
+			catch (...)
+			{
+				std::fclose(file);
+				throw;
+			}
+			std::fclose(file);
+			py::array_t<PumpSnapshot> result(static_cast<py::ssize_t>(records.size()));
+			std::memcpy(result.request().ptr, records.data(), records.size() * sizeof(PumpSnapshot));
+			return std::move(result);
+		}
+		if (mask != 0)
+		{
+			// Packed uncompressed recordings are decoded into a fresh array as
+			// well; only full-layout files are memory-mapped
+			std::fseek(file, 0, SEEK_END);
+			const long fileEnd = std::ftell(file);
+			const long dataStart = static_cast<long>(sizeof header + sizeof mask);
+			const size_t count = static_cast<size_t>(fileEnd - dataStart) / header.recordSize;
+			std::vector<uint8_t> rows(count * header.recordSize);
+			std::fseek(file, dataStart, SEEK_SET);
+			const bool ok = std::fread(rows.data(), 1, rows.size(), file) == rows.size();
+			std::fclose(file);
+			if (!ok)
+				throw std::runtime_error("Recorder.load: " + path + " is truncated");
+			std::vector<PumpSnapshot> records(count);
+			for (size_t r = 0; r < count; ++r)
+				unpackSnapshot(rows.data() + r * header.recordSize, mask, records[r]);
+			const PumpSnapshot* lo = records.data();
+			const PumpSnapshot* hi = records.data() + count;
+			if (startUs != 0)
+				lo = std::lower_bound(lo, hi, startUs,
+									  [](const PumpSnapshot& rec, const uint64_t ts) { return rec.timestamp < ts; });
+			if (endUs != 0)
+				hi = std::upper_bound(lo, hi, endUs,
+									  [](const uint64_t ts, const PumpSnapshot& rec) { return ts < rec.timestamp; });
+			py::array_t<PumpSnapshot> result(static_cast<py::ssize_t>(hi - lo));
+			std::memcpy(result.request().ptr, lo, static_cast<size_t>(hi - lo) * sizeof(PumpSnapshot));
+			return std::move(result);
+		}
+#ifndef _WIN32
+		const int fd = fileno(file);
+		struct stat st = {};
+		fstat(fd, &st);
+		const size_t fileSize = static_cast<size_t>(st.st_size);
+		const size_t count = (fileSize - sizeof header) / sizeof(PumpSnapshot);
+		void* const mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+		std::fclose(file); // the mapping survives the fd
+		if (mapping == MAP_FAILED)
+			throw std::runtime_error("Recorder.load: mmap of " + path + " failed");
+		struct MapInfo
+		{
+			void* addr;
+			size_t length;
+		};
+		py::capsule base{new MapInfo{mapping, fileSize}, [](void* p) {
+							 auto* const info = static_cast<MapInfo*>(p);
+							 munmap(info->addr, info->length);
+							 delete info;
+						 }};
+		// Timestamps are monotonic, so a time range is a binary search over
+		// the mapping; the slice is still a zero-copy view (the kernel only
+		// faults in the touched pages)
+		const PumpSnapshot* const records = reinterpret_cast<const PumpSnapshot*>(static_cast<const char*>(mapping) + sizeof header);
+		const PumpSnapshot* lo = records;
+		const PumpSnapshot* hi = records + count;
+		if (startUs != 0)
+			lo = std::lower_bound(records, records + count, startUs,
+								  [](const PumpSnapshot& rec, const uint64_t ts) { return rec.timestamp < ts; });
+		if (endUs != 0)
+			hi = std::upper_bound(lo, records + count, endUs,
+								  [](const uint64_t ts, const PumpSnapshot& rec) { return ts < rec.timestamp; });
+		return py::array{py::dtype::of<PumpSnapshot>(),
+						 {static_cast<py::ssize_t>(hi - lo)},
+						 {static_cast<py::ssize_t>(sizeof(PumpSnapshot))},
+						 lo,
+						 base};
+#else
+		std::fseek(file, 0, SEEK_END);
+		const size_t fileSize = static_cast<size_t>(std::ftell(file));
+		const size_t count = (fileSize - sizeof header) / sizeof(PumpSnapshot);
+		std::fseek(file, sizeof header, SEEK_SET);
+		std::vector<PumpSnapshot> all(count);
+		std::fread(all.data(), sizeof(PumpSnapshot), count, file);
+		std::fclose(file);
+		const PumpSnapshot* lo = all.data();
+		const PumpSnapshot* hi = all.data() + count;
+		if (startUs != 0)
+			lo = std::lower_bound(lo, hi, startUs,
+								  [](const PumpSnapshot& rec, const uint64_t ts) { return rec.timestamp < ts; });
+		if (endUs != 0)
+			hi = std::upper_bound(lo, hi, endUs,
+								  [](const uint64_t ts, const PumpSnapshot& rec) { return ts < rec.timestamp; });
+		py::array_t<PumpSnapshot> records(static_cast<py::ssize_t>(hi - lo));
+		std::memcpy(records.request().ptr, lo, static_cast<size_t>(hi - lo) * sizeof(PumpSnapshot));
+		return std::move(records);
+#endif
+	}
+
+private:
+	bool rotating() const { return segmentBytes_ != 0 || segmentSeconds_ != 0; }
+
+	std::string segmentPath(const uint64_t index) const
+	{
+		char suffix[16];
+		std::snprintf(suffix, sizeof suffix, ".%04llu", static_cast<unsigned long long>(index));
+		return path_ + suffix;
+	}
+
+	void openFile(const std::string& path)
+	{
+		file_ = std::fopen(path.c_str(), "wb");
+		if (!file_)
+			throw std::runtime_error("Recorder: cannot open " + path + " for writing");
+		writeFileHeader();
+		index_.clear();
+		segmentStart_ = std::chrono::steady_clock::now();
+	}
+
+	// Writes the file header at the current position, followed by the column
+	// mask once the packed schema is compiled, and resets writeOffset_
+	void writeFileHeader()
+	{
+		RecorderFileHeader header = {};
+		std::memcpy(header.magic, recorderMagic, sizeof header.magic);
+		header.version = recorderVersion;
+		header.recordSize = static_cast<uint32_t>(schemaMask_ != 0 ? packedSize_ : sizeof(PumpSnapshot));
+		header.flags = (compress_ ? recorderFlagDeltaRle : 0) | (schemaMask_ != 0 ? recorderFlagColumnMask : 0);
+		std::fwrite(&header, sizeof header, 1, file_);
+		if (schemaMask_ != 0)
+			std::fwrite(&schemaMask_, sizeof schemaMask_, 1, file_);
+		writeOffset_ = sizeof header + (schemaMask_ != 0 ? sizeof schemaMask_ : 0);
+	}
+
+	// Seals compressed files with the block index so readers can binary-search
+	// time ranges; crash-interrupted files stay loadable through the
+	// header-scanning fallback
+	void sealFile()
+	{
+		if (compress_ && !index_.empty())
+		{
+			std::fwrite(index_.data(), sizeof(RecorderIndexEntry), index_.size(), file_);
+			RecorderIndexFooter footer = {};
+			std::memcpy(footer.magic, recorderIndexMagic, sizeof footer.magic);
+			footer.entryCount = index_.size();
+			std::fwrite(&footer, sizeof footer, 1, file_);
+		}
+	}
+
+	// Writer thread only: seals the current segment, hands it to the sync
+	// thread for background fsync+close, and opens the next one. The capture
+	// thread never sees any of this.
+	void rotate()
+	{
+		sealFile();
+		std::fflush(file_);
+		{
+			std::lock_guard<std::mutex> lock(syncMutex_);
+			syncQueue_.push_back(file_);
+		}
+		syncCv_.notify_one();
+		file_ = nullptr;
+		segmentsCompleted_.fetch_add(1);
+		openFile(segmentPath(segmentsCompleted_.load()));
+	}
+
+	// Fsyncs and closes completed segments in the background, so a power cut
+	// loses at most the segment in progress
+	void runSync()
+	{
+#ifdef __linux__
+		// Idle scheduling: segment fsyncs never compete with the capture or
+		// writer threads for CPU
+		sched_param param = {};
+		pthread_setschedparam(pthread_self(), SCHED_IDLE, &param);
+#endif
+		std::unique_lock<std::mutex> lock(syncMutex_);
+		for (;;)
+		{
+			syncCv_.wait(lock, [this] { return syncStop_ || !syncQueue_.empty(); });
+			if (syncQueue_.empty())
+				return; // only reachable when stopping
+			std::vector<std::FILE*> batch;
+			batch.swap(syncQueue_);
+			lock.unlock();
+			for (std::FILE* const segment : batch)
+			{
+#ifndef _WIN32
+				fsync(fileno(segment));
+#endif
+				std::fclose(segment);
+			}
+			lock.lock();
+		}
+	}
+
+	void stopThreads()
+	{
+		running_.store(false);
+		if (captureThread_.joinable())
+			captureThread_.join();
+		if (writerThread_.joinable())
+			writerThread_.join();
+		flushPending(); // final partial buffer
+		if (file_)
+			std::fflush(file_);
+	}
+
+	void runCapture()
+	{
+		const WorkerScope worker("recorder");
+		while (running_.load(std::memory_order_relaxed))
+		{
+			const Fove_ErrorCode waitErr = waitForProcessedEyeFrameTimed(headset_);
+			if (!running_.load(std::memory_order_relaxed))
+				break;
+			if (waitErr != Fove_ErrorCode::None)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+				continue;
+			}
+			PumpSnapshot rec = {};
+			fillPumpSnapshot(headset_, rec);
+			std::lock_guard<std::mutex> lock(pendingMutex_);
+			pending_.push_back(rec);
+		}
+	}
+
+	void runWriter()
+	{
+		const WorkerScope worker("recorder");
+		while (running_.load(std::memory_order_relaxed))
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+			flushPending();
+		}
+	}
+
+	void flushPending()
+	{
+		// Swap the capture buffer out under the lock, write outside of it
+		std::vector<PumpSnapshot> batch;
+		{
+			std::lock_guard<std::mutex> lock(pendingMutex_);
+			batch.swap(pending_);
+		}
+		if (batch.empty() || !file_)
+			return;
+		const size_t recordSize = schemaMask_ != 0 ? packedSize_ : sizeof(PumpSnapshot);
+		const uint8_t* rows = reinterpret_cast<const uint8_t*>(batch.data());
+		if (schemaMask_ != 0)
+		{
+			// Gather only the schema's columns; the scratch is reused across flushes
+			packScratch_.resize(batch.size() * packedSize_);
+			uint8_t* out = packScratch_.data();
+			for (const PumpSnapshot& rec : batch)
+			{
+				packSnapshot(rec, schemaMask_, out);
+				out += packedSize_;
+			}
+			rows = packScratch_.data();
+		}
+		if (compress_)
+		{
+			// XOR-delta against the previous record, then RLE the (mostly
+			// zero) result; the baseline resets per block so that readers can
+			// decode any block independently for time-range seeks. Both
+			// scratch buffers are reused across blocks.
+			deltaScratch_.resize(batch.size() * recordSize);
+			const uint8_t* prevRaw = nullptr;
+			uint8_t* out = deltaScratch_.data();
+			for (size_t r = 0; r < batch.size(); ++r)
+			{
+				const uint8_t* const raw = rows + r * recordSize;
+				for (size_t b = 0; b < recordSize; ++b)
+					out[b] = prevRaw != nullptr ? raw[b] ^ prevRaw[b] : raw[b];
+				prevRaw = raw;
+				out += recordSize;
+			}
+			blockScratch_.clear();
+			zeroRleEncode(deltaScratch_.data(), deltaScratch_.size(), blockScratch_);
+			RecorderBlockHeader blockHeader = {};
+			blockHeader.compressedSize = static_cast<uint32_t>(blockScratch_.size());
+			blockHeader.recordCount = static_cast<uint32_t>(batch.size());
+			blockHeader.firstTimestamp = batch.front().timestamp;
+			blockHeader.lastTimestamp = batch.back().timestamp;
+			index_.push_back({writeOffset_, blockHeader.firstTimestamp, blockHeader.lastTimestamp});
+			std::fwrite(&blockHeader, sizeof blockHeader, 1, file_);
+			std::fwrite(blockScratch_.data(), 1, blockScratch_.size(), file_);
+			writeOffset_ += sizeof blockHeader + blockScratch_.size();
+			bytesWritten_.fetch_add(sizeof blockHeader + blockScratch_.size());
+		}
+		else
+		{
+			std::fwrite(rows, recordSize, batch.size(), file_);
+			writeOffset_ += batch.size() * recordSize;
+			bytesWritten_.fetch_add(batch.size() * recordSize);
+		}
+		recordsWritten_.fetch_add(batch.size());
+		if (rotating()
+			&& ((segmentBytes_ != 0 && writeOffset_ >= segmentBytes_)
+				|| (segmentSeconds_ != 0
+					&& std::chrono::duration<double>(std::chrono::steady_clock::now() - segmentStart_).count() >= segmentSeconds_)))
+			rotate();
+	}
+
+	std::string path_;
+	std::FILE* file_ = nullptr;
+	std::thread captureThread_;
+	std::thread writerThread_;
+	std::atomic<bool> running_{false};
+	std::atomic<uint64_t> recordsWritten_{0};
+	std::atomic<uint64_t> bytesWritten_{0};
+	py::object headsetObj_;
+	Fove_Headset* headset_ = nullptr;
+	std::mutex pendingMutex_;
+	std::vector<PumpSnapshot> pending_;
+	const bool compress_;
+	const bool packed_;
+	uint64_t schemaMask_ = 0; // compiled at the first start; 0 = full snapshot layout
+	size_t packedSize_ = 0;
+	std::vector<uint8_t> packScratch_;
+	std::vector<uint8_t> deltaScratch_;
+	std::vector<char> blockScratch_;
+	uint64_t writeOffset_ = sizeof(RecorderFileHeader); // file offset of the next block, for the index
+	std::vector<RecorderIndexEntry> index_;             // one entry per block written, flushed when the segment is sealed
+
+	// Segment rotation (either limit 0 disables that trigger; both 0 = single file)
+	const uint64_t segmentBytes_;
+	const double segmentSeconds_;
+	std::chrono::steady_clock::time_point segmentStart_;
+	std::atomic<uint64_t> segmentsCompleted_{0};
+	std::thread syncThread_;
+	std::mutex syncMutex_;
+	std::condition_variable syncCv_;
+	std::vector<std::FILE*> syncQueue_;
+	bool syncStop_ = false;
+};
+
+} // namespace
+
+void defstruct_Recorder(py::module& m)
+{
+	py::class_<Recorder>(m, "Recorder",
+						 R"(Records eye frames into a fixed-width binary file
+
+A capture thread runs the wait/fetch cycle (one snapshot record per eye frame, same
+layout as `FramePump.drain` batches) and a separate writer thread flushes the records
+to disk in large blocks, so capture is never blocked by disk I/O.
+
+Recordings are loaded back with `Recorder.load`, which memory-maps the file as a
+structured numpy array.
+
+With `compress=True` the writer thread delta+RLE encodes each block before the
+write: consecutive snapshots differ in few bytes, so long recordings shrink
+severalfold while the capture thread is unaffected. Compressed recordings are
+decoded (not memory-mapped) by `load` and `ReplayHeadset`.
+
+With `segment_bytes` and/or `segment_seconds` set, the recording rotates into
+numbered segment files (`<path>.0000`, `<path>.0001`, ...) whenever the current
+segment exceeds either limit. Completed segments are fsynced and closed on a
+background idle-priority thread, so a power cut loses at most the segment in
+progress and the capture path never waits on the disk. Each segment is a
+complete recorder file: load them individually with `load` or `ReplayHeadset`.
+
+With `packed=True` the record layout itself is compiled at the first `start` from
+the capabilities registered on the headset: columns whose capability is not
+registered, and so would only ever hold error codes, are dropped from the file,
+roughly halving it again for typical configurations. The per-channel error
+columns are always kept. `load` and `ReplayHeadset` restore the full snapshot
+layout (dropped columns read as zero), and `snapshot_schema` exposes the packed
+layout to external readers.)")
+		.def(py::init<std::string, bool, uint64_t, double, bool>(),
+			 py::arg("path"), py::arg("compress") = false, py::arg("segment_bytes") = 0, py::arg("segment_seconds") = 0.0, py::arg("packed") = false,
+			 "Creates the recording file (or the first segment) and writes its header; recording starts with `start`")
+		.def_static("open", [](const std::string& path, const bool compress, const uint64_t segmentBytes, const double segmentSeconds, const bool packed) { return new Recorder(path, compress, segmentBytes, segmentSeconds, packed); },
+					py::arg("path"), py::arg("compress") = false, py::arg("segment_bytes") = 0, py::arg("segment_seconds") = 0.0, py::arg("packed") = false,
+					"Same as constructing a Recorder: creates the recording file at the given path")
+		.def("start", &Recorder::start,
+			 py::arg("headset"),
+			 py::arg_v("capabilities", Fove_ClientCapabilities::None, "ClientCapabilities.None"),
+			 R"(Starts recording frames from the given headset
+
+\param headset The headset to record from; kept alive by the recorder until `stop`
+\param capabilities Additional capabilities to register before starting, if any
+\return #Fove_ErrorCode_None if recording started\n
+        #Fove_ErrorCode_API_InvalidArgument if already recording or the file is closed\n
+        Otherwise, the error returned by the capability registration
+)")
+		.def("stop", &Recorder::stop, "Stops recording and flushes the remaining records; the file stays open for another `start`")
+		.def("close", &Recorder::close, "Stops recording if needed and closes the file")
+		.def_static("load", &Recorder::load, py::arg("path"), py::arg("start_us") = 0, py::arg("end_us") = 0,
+					R"(Loads a recording, or a time slice of one, as a structured numpy array
+
+The file is memory-mapped, so loading is cheap regardless of recording length.
+A non-zero time range selects only the records whose timestamps fall within
+it: uncompressed recordings binary-search the mapping (the slice stays a
+zero-copy view), compressed ones binary-search the block index and decode only
+the overlapping blocks, so scrubbing a short window of a long recording never
+touches the rest of the file.
+
+\param path The recording file to load
+\param start_us Lowest record timestamp to include, or 0 for the start of the recording
+\param end_us Highest record timestamp to include, or 0 for the end of the recording
+\return A structured numpy array with one record per recorded frame in range
+)")
+		.def_property_readonly("running", &Recorder::isRunning, "Whether recording is currently in progress")
+		.def_property_readonly("recordsWritten", &Recorder::recordsWritten, "Number of records flushed to disk so far")
+		.def_property_readonly("bytesWritten", &Recorder::bytesWritten, "Number of payload bytes flushed to disk so far (after compression, if enabled)")
+		.def_property_readonly("segmentsCompleted", &Recorder::segmentsCompleted, "Number of rotated segments already sealed and handed to the background fsync thread")
+		.def_property_readonly("compressed", &Recorder::isCompressed, "Whether this recorder delta+RLE compresses its blocks")
+		.def_property_readonly("packed", &Recorder::isPacked, "Whether this recorder compiles a capability-driven packed schema at the first `start`")
+		.def_property_readonly("path", &Recorder::path, "The path of the recording file");
+}
+
+namespace
+{
+
+// numpy format string for a column, matching the packed file layout byte for byte
+const char* columnFormat(const ColumnSpec::Kind kind)
+{
+	switch (kind)
+	{
+	case ColumnSpec::Kind::U64: return "<u8";
+	case ColumnSpec::Kind::F32: return "<f4";
+	case ColumnSpec::Kind::I32: return "<i4";
+	case ColumnSpec::Kind::I16: return "<i2";
+	case ColumnSpec::Kind::U8: return "u1";
+	case ColumnSpec::Kind::Vec3: return "3f4";
+	case ColumnSpec::Kind::Ray: return "6f4";
+	}
+	return "";
+}
+
+py::array makeColumnArray(const ColumnSpec& spec, const py::ssize_t count)
+{
+	switch (spec.kind)
+	{
+	case ColumnSpec::Kind::U64: return py::array_t<uint64_t>(count);
+	case ColumnSpec::Kind::F32: return py::array_t<float>(count);
+	case ColumnSpec::Kind::I32: return py::array_t<int32_t>(count);
+	case ColumnSpec::Kind::I16: return py::array_t<int16_t>(count);
+	case ColumnSpec::Kind::U8: return py::array_t<uint8_t>(count);
+	case ColumnSpec::Kind::Vec3: return py::array_t<float>({count, py::ssize_t(3)});
+	case ColumnSpec::Kind::Ray: return py::array_t<float>({count, py::ssize_t(6)});
+	}
+	return py::array();
+}
+
+} // namespace
+
+void bind_ColumnExport(py::module& m)
+{
+	m.def(
+		"export_columns", [](const py::array_t<PumpSnapshot>& records) {
+			const auto info = records.request();
+			if (info.ndim != 1)
+				throw std::runtime_error("export_columns: expected a 1-D snapshot array");
+			const auto* const rows = static_cast<const char*>(info.ptr);
+			const size_t count = static_cast<size_t>(info.shape[0]);
+			const size_t rowStride = static_cast<size_t>(info.strides[0]);
+
+			constexpr size_t columnCount = sizeof(pumpColumns) / sizeof(pumpColumns[0]);
+			py::dict result;
+			char* columnPtrs[columnCount];
+			for (size_t c = 0; c < columnCount; ++c)
+			{
+				py::array column = makeColumnArray(pumpColumns[c], static_cast<py::ssize_t>(count));
+				columnPtrs[c] = static_cast<char*>(column.request().ptr);
+				result[pumpColumns[c].name] = std::move(column);
+			}
+
+			// The gathers touch only preallocated buffers; run them in parallel
+			// with the GIL released, splitting columns across a few workers
+			{
+				py::gil_scoped_release release;
+				const size_t workerCount = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), 4);
+				std::vector<std::thread> workers;
+				for (size_t worker = 0; worker < workerCount; ++worker)
+					workers.emplace_back([=] {
+						for (size_t c = worker; c < columnCount; c += workerCount)
+						{
+							const size_t elemSize = columnElemSize(pumpColumns[c].kind);
+							char* out = columnPtrs[c];
+							for (size_t i = 0; i < count; ++i, out += elemSize)
+								std::memcpy(out, rows + i * rowStride + pumpColumns[c].offset, elemSize);
+						}
+					});
+				for (std::thread& worker : workers)
+					worker.join();
+			}
+			return result;
+		},
+		py::arg("records"),
+		R"(Converts a snapshot batch to contiguous per-field columns
+
+Accepts the structured arrays produced by `Recorder.load` and
+`FramePump.drain` and gathers every field into its own contiguous array
+(vector fields flattened to `(n, 3)` / ray fields to `(n, 6)` float32),
+using multiple native threads with the GIL released. The resulting dict
+feeds `pyarrow.RecordBatch.from_arrays`, `polars.from_dict` or
+`pandas.DataFrame` directly, with no per-sample Python work.
+
+\param records A 1-D structured array in the pump snapshot layout
+\return A dict mapping field names to contiguous numpy columns
+\see Recorder.load
+)");
+
+	m.def(
+		"snapshot_schema", [](const Fove_ClientCapabilities capabilities) {
+			const uint64_t mask = snapshotSchemaMask(capabilities);
+			py::list names;
+			py::list formats;
+			for (size_t c = 0; c < pumpColumnCount; ++c)
+				if (mask & (uint64_t(1) << c))
+				{
+					names.append(pumpColumns[c].name);
+					formats.append(columnFormat(pumpColumns[c].kind));
+				}
+			py::dict spec;
+			spec["names"] = names;
+			spec["formats"] = formats;
+			py::dict result;
+			result["mask"] = py::int_(mask);
+			result["itemsize"] = packedRecordSize(mask);
+			result["names"] = names;
+			result["dtype"] = py::module_::import("numpy").attr("dtype")(spec);
+			return result;
+		},
+		py::arg("capabilities"),
+		R"(Compiles the packed snapshot schema for a capability set
+
+Returns the record layout a packed `Recorder` file written under these
+capabilities uses: the active column bitmask (`mask`), the packed record size
+in bytes (`itemsize`), the active column `names`, and the matching packed
+numpy `dtype`. External tools can read the rows of such a file directly with
+this dtype; the uint64 column mask stored after the file header identifies
+the schema the file was actually written with.
+
+Columns with no capability requirement (frame id, timestamp, and the
+per-channel error codes) are part of every schema.
+
+\param capabilities The `ClientCapabilities` the recording was (or will be) made with
+\return A dict with keys `mask`, `itemsize`, `names`, and `dtype`
+\see Recorder
+)");
+
+	m.def(
+		"batch_quality_mask", [](const py::array_t<PumpSnapshot>& records, const py::object& channels, const std::string& level) {
+			const auto info = records.request();
+			if (info.ndim != 1)
+				throw std::runtime_error("batch_quality_mask: expected a 1-D snapshot array");
+
+			// Resolve the err columns to test: all of them by default, or the
+			// ones behind the named value channels
+			std::vector<const ColumnSpec*> errColumns;
+			const auto findErrColumn = [](const std::string& name) -> const ColumnSpec* {
+				const std::string errName = "err" + std::string(1, std::toupper(name[0])) + name.substr(1);
+				for (const ColumnSpec& spec : pumpColumns)
+					if (spec.kind == ColumnSpec::Kind::I16 && (name == spec.name || errName == spec.name))
+						return &spec;
+				return nullptr;
+			};
+			if (channels.is_none())
+			{
+				for (const ColumnSpec& spec : pumpColumns)
+					if (spec.kind == ColumnSpec::Kind::I16 && std::strncmp(spec.name, "err", 3) == 0)
+						errColumns.push_back(&spec);
+			}
+			else
+				for (const py::handle channel : py::iterable(channels))
+				{
+					const std::string name = channel.cast<std::string>();
+					const ColumnSpec* const spec = name.empty() ? nullptr : findErrColumn(name);
+					if (!spec)
+						throw std::runtime_error("batch_quality_mask: unknown channel '" + name + "'");
+					errColumns.push_back(spec);
+				}
+
+			// The accepted codes, mirroring Result.isReliable/isValid/isAcceptable
+			std::vector<int16_t> accepted;
+			if (level == "reliable")
+				accepted = {static_cast<int16_t>(Fove_ErrorCode::None)};
+			else if (level == "valid")
+				accepted = {static_cast<int16_t>(Fove_ErrorCode::None), static_cast<int16_t>(Fove_ErrorCode::Data_LowAccuracy)};
+			else if (level == "acceptable")
+			{
+				ErrorPolicy& policy = errorPolicy();
+				std::lock_guard<std::mutex> lock(policy.mutex);
+				for (const Fove_ErrorCode code : policy.acceptable)
+					accepted.push_back(static_cast<int16_t>(code));
+			}
+			else
+				throw std::runtime_error("batch_quality_mask: level must be 'acceptable', 'valid' or 'reliable'");
+
+			const auto* const rows = static_cast<const char*>(info.ptr);
+			const size_t count = static_cast<size_t>(info.shape[0]);
+			const size_t rowStride = static_cast<size_t>(info.strides[0]);
+			py::array_t<bool> mask(static_cast<py::ssize_t>(count));
+			bool* const out = static_cast<bool*>(mask.request().ptr);
+			{
+				py::gil_scoped_release release;
+				for (size_t i = 0; i < count; ++i)
+				{
+					bool ok = true;
+					for (const ColumnSpec* const spec : errColumns)
+					{
+						int16_t code;
+						std::memcpy(&code, rows + i * rowStride + spec->offset, sizeof code);
+						bool codeOk = false;
+						for (const int16_t acceptedCode : accepted)
+							if (code == acceptedCode)
+							{
+								codeOk = true;
+								break;
+							}
+						if (!codeOk)
+						{
+							ok = false;
+							break;
+						}
+					}
+					out[i] = ok;
+				}
+			}
+			return mask;
+		},
+		py::arg("records"), py::arg("channels") = py::none(), py::arg("level") = "acceptable",
+		R"(Computes a per-record quality mask over a snapshot batch, natively
+
+Snapshot batches already carry one status code per channel per record (the
+`err*` int16 fields); this reduces them to a boolean keep/drop mask in one
+call, so quality filtering during unreliable-data storms stays a vectorized
+`batch[mask]` instead of per-sample Result branching — exactly when the
+system is already struggling.
+
+\param records A 1-D structured array in the pump snapshot layout
+        (from `FramePump.drain` or `Recorder.load`)
+\param channels The value channels whose status must pass (e.g.
+        `["gazeVectorLeft", "combinedRay"]`; `err*` names are accepted too),
+        or None to require every channel to pass
+\param level Which codes count as passing: `"acceptable"` (the configured
+        error policy, like `Result.isAcceptable`), `"valid"` (`None_` or
+        `Data_LowAccuracy`) or `"reliable"` (`None_` only)
+\return A boolean numpy array, one entry per record
+\see export_columns, set_error_policy
+)");
+
+	m.def(
+		"blackbox_config", [](const size_t capacity, const std::string& autoDumpPath) {
+			blackBox().configure(capacity, autoDumpPath);
+		},
+		py::arg("capacity") = BlackBox::defaultCapacity, py::arg("auto_dump_path") = "",
+		R"(Reconfigures the always-on black-box snapshot ring
+
+The ring is preallocated and overwritten in place (zero steady-state I/O and
+allocation) and is fed by any running `FramePump` at one struct copy per
+frame. Reconfiguring discards the current contents.
+
+\param capacity Ring size in records; the default 4096 is roughly 34 seconds
+       at 120 Hz. 0 disables (and frees) the ring
+\param auto_dump_path If non-empty, the ring is dumped to this path once,
+       automatically, when the pump first observes a critical error code
+       (connection lost, hardware disconnected, shared memory unreadable)
+\see blackbox_dump, blackbox_stats
+)");
+
+	m.def(
+		"blackbox_dump", [](const std::string& path) {
+			size_t written;
+			{
+				py::gil_scoped_release release;
+				written = blackboxWrite(path);
+			}
+			return written;
+		},
+		py::arg("path"),
+		R"(Serializes the black-box ring, oldest record first
+
+The dump is an uncompressed recorder file, so `Recorder.load`,
+`ReplayHeadset` and `export_columns` read it like any recording.
+
+\param path File to write
+\return The number of records written
+\see blackbox_config
+)");
+
+	m.def(
+		"blackbox_stats", []() {
+			py::dict stats;
+			stats["capacity"] = blackBox().capacity();
+			stats["records"] = blackBox().records();
+			stats["auto_dump_path"] = blackBox().autoDumpPath();
+			return stats;
+		},
+		"Returns `capacity`, `records` and `auto_dump_path` of the black-box ring");
+}
+
+namespace
+{
+
+// Arrow C data interface (stable ABI as published by Apache Arrow; declaring
+// these structs locally is the intended way to produce Arrow data without
+// linking the Arrow library)
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+struct ArrowSchema
+{
+	const char* format;
+	const char* name;
+	const char* metadata;
+	int64_t flags;
+	int64_t n_children;
+	struct ArrowSchema** children;
+	struct ArrowSchema* dictionary;
+	void (*release)(struct ArrowSchema*);
+	void* private_data;
+};
+
+struct ArrowArray
+{
+	int64_t length;
+	int64_t null_count;
+	int64_t offset;
+	int64_t n_buffers;
+	int64_t n_children;
+	const void** buffers;
+	struct ArrowArray** children;
+	struct ArrowArray* dictionary;
+	void (*release)(struct ArrowArray*);
+	void* private_data;
+};
+
+#endif // ARROW_C_DATA_INTERFACE
+
+const char* arrowFormatOf(const ColumnSpec::Kind kind)
+{
+	switch (kind)
+	{
+	case ColumnSpec::Kind::U64: return "L";
+	case ColumnSpec::Kind::F32: return "f";
+	case ColumnSpec::Kind::I32: return "i";
+	case ColumnSpec::Kind::I16: return "s";
+	case ColumnSpec::Kind::U8: return "C";
+	case ColumnSpec::Kind::Vec3: return "+w:3";
+	case ColumnSpec::Kind::Ray: return "+w:6";
+	}
+	return "";
+}
+
+// Everything a produced batch owns: the column buffers plus all the child
+// struct/pointer storage the ArrowArray tree references. Freed by the
+// top-level array's release callback once the consumer is done.
+struct ArrowBatchHolder
+{
+	std::vector<std::vector<char>> columnData;
+	std::deque<ArrowArray> nodes;              // stable addresses for child arrays
+	std::deque<std::array<const void*, 2>> buffers;
+	std::vector<ArrowArray*> childPtrs;
+	std::vector<ArrowArray*> leafPtrs;         // one slot per fixed-size-list column
+};
+
+// Children are owned by the batch; their release just marks them consumed
+void arrowChildRelease(ArrowArray* const array)
+{
+	array->release = nullptr;
+}
+
+void arrowTopArrayRelease(ArrowArray* const array)
+{
+	auto* const holder = static_cast<ArrowBatchHolder*>(array->private_data);
+	for (ArrowArray& node : holder->nodes)
+		node.release = nullptr;
+	delete holder;
+	array->release = nullptr;
+}
+
+struct ArrowSchemaHolder
+{
+	std::deque<ArrowSchema> nodes;
+	std::vector<ArrowSchema*> childPtrs;
+	std::vector<ArrowSchema*> leafPtrs;
+};
+
+void arrowChildSchemaRelease(ArrowSchema* const schema)
+{
+	schema->release = nullptr;
+}
+
+void arrowTopSchemaRelease(ArrowSchema* const schema)
+{
+	auto* const holder = static_cast<ArrowSchemaHolder*>(schema->private_data);
+	for (ArrowSchema& node : holder->nodes)
+		node.release = nullptr;
+	delete holder;
+	schema->release = nullptr;
+}
+
+ArrowSchema* buildArrowSchema()
+{
+	auto* const holder = new ArrowSchemaHolder;
+	holder->childPtrs.resize(pumpColumnCount);
+	holder->leafPtrs.reserve(pumpColumnCount); // pointers into it are taken while filling
+	for (size_t c = 0; c < pumpColumnCount; ++c)
+	{
+		const ColumnSpec& spec = pumpColumns[c];
+		const bool isList = spec.kind == ColumnSpec::Kind::Vec3 || spec.kind == ColumnSpec::Kind::Ray;
+		ArrowSchema child = {};
+		child.format = arrowFormatOf(spec.kind);
+		child.name = spec.name;
+		child.release = arrowChildSchemaRelease;
+		if (isList)
+		{
+			ArrowSchema leaf = {};
+			leaf.format = "f";
+			leaf.name = "item";
+			leaf.release = arrowChildSchemaRelease;
+			holder->nodes.push_back(leaf);
+			holder->leafPtrs.push_back(&holder->nodes.back());
+			child.n_children = 1;
+			child.children = &holder->leafPtrs.back();
+		}
+		holder->nodes.push_back(child);
+		holder->childPtrs[c] = &holder->nodes.back();
+	}
+	auto* const schema = new ArrowSchema{};
+	schema->format = "+s";
+	schema->name = "";
+	schema->n_children = static_cast<int64_t>(pumpColumnCount);
+	schema->children = holder->childPtrs.data();
+	schema->release = arrowTopSchemaRelease;
+	schema->private_data = holder;
+	return schema;
+}
+
+ArrowArray* buildArrowArray(const PumpSnapshot* const rows, const size_t count)
+{
+	auto* const holder = new ArrowBatchHolder;
+	holder->childPtrs.resize(pumpColumnCount);
+	holder->leafPtrs.reserve(pumpColumnCount); // pointers into it are taken while filling
+	const auto* const rowBytes = reinterpret_cast<const char*>(rows);
+	for (size_t c = 0; c < pumpColumnCount; ++c)
+	{
+		const ColumnSpec& spec = pumpColumns[c];
+		const size_t elemSize = columnElemSize(spec.kind);
+		std::vector<char> data(elemSize * count);
+		for (size_t i = 0; i < count; ++i)
+			std::memcpy(data.data() + i * elemSize, rowBytes + i * sizeof(PumpSnapshot) + spec.offset, elemSize);
+		holder->columnData.push_back(std::move(data));
+		const void* const columnPtr = holder->columnData.back().data();
+
+		const bool isList = spec.kind == ColumnSpec::Kind::Vec3 || spec.kind == ColumnSpec::Kind::Ray;
+		ArrowArray child = {};
+		child.length = static_cast<int64_t>(count);
+		child.release = arrowChildRelease;
+		if (isList)
+		{
+			const size_t width = elemSize / sizeof(float);
+			ArrowArray leaf = {};
+			leaf.length = static_cast<int64_t>(count * width);
+			leaf.n_buffers = 2;
+			holder->buffers.push_back({nullptr, columnPtr});
+			leaf.buffers = holder->buffers.back().data();
+			leaf.release = arrowChildRelease;
+			holder->nodes.push_back(leaf);
+			holder->leafPtrs.push_back(&holder->nodes.back());
+
+			child.n_buffers = 1;
+			holder->buffers.push_back({nullptr, nullptr});
+			child.buffers = holder->buffers.back().data();
+			child.n_children = 1;
+			child.children = &holder->leafPtrs.back();
+		}
+		else
+		{
+			child.n_buffers = 2;
+			holder->buffers.push_back({nullptr, columnPtr});
+			child.buffers = holder->buffers.back().data();
+		}
+		holder->nodes.push_back(child);
+		holder->childPtrs[c] = &holder->nodes.back();
+	}
+	auto* const array = new ArrowArray{};
+	array->length = static_cast<int64_t>(count);
+	array->n_buffers = 1;
+	holder->buffers.push_back({nullptr, nullptr});
+	array->buffers = holder->buffers.back().data();
+	array->n_children = static_cast<int64_t>(pumpColumnCount);
+	array->children = holder->childPtrs.data();
+	array->release = arrowTopArrayRelease;
+	array->private_data = holder;
+	return array;
+}
+
+// A drained batch exported through the Arrow C data interface. Consumers that
+// speak the Arrow PyCapsule protocol (pyarrow, polars, DuckDB) adopt the
+// buffers directly via __arrow_c_array__; ownership transfers on that call.
+class ArrowBatch
+{
+public:
+	ArrowBatch(ArrowSchema* const schema, ArrowArray* const array)
+	    : schema_(schema), array_(array) {}
+
+	~ArrowBatch()
+	{
+		// Never handed out: free through the regular release path
+		if (schema_)
+		{
+			if (schema_->release)
+				schema_->release(schema_);
+			delete schema_;
+		}
+		if (array_)
+		{
+			if (array_->release)
+				array_->release(array_);
+			delete array_;
+		}
+	}
+
+	ArrowBatch(const ArrowBatch&) = delete;
+	ArrowBatch& operator=(const ArrowBatch&) = delete;
+
+	int64_t length() const { return array_ ? array_->length : 0; }
+
+	py::tuple arrowCArray()
+	{
+		if (!schema_ || !array_)
+			throw std::runtime_error("ArrowBatch: the batch was already consumed");
+		py::capsule schemaCapsule{schema_, "arrow_schema", [](void* p) {
+									  auto* const schema = static_cast<ArrowSchema*>(p);
+									  if (schema->release)
+										  schema->release(schema);
+									  delete schema;
+								  }};
+		py::capsule arrayCapsule{array_, "arrow_array", [](void* p) {
+									 auto* const array = static_cast<ArrowArray*>(p);
+									 if (array->release)
+										 array->release(array);
+									 delete array;
+								 }};
+		schema_ = nullptr; // the capsules own the structs now
+		array_ = nullptr;
+		return py::make_tuple(std::move(schemaCapsule), std::move(arrayCapsule));
+	}
+
+private:
+	ArrowSchema* schema_;
+	ArrowArray* array_;
+};
+
+py::object exportSnapshotsToArrow(const PumpSnapshot* const rows, const size_t count)
+{
+	ArrowSchema* const schema = buildArrowSchema();
+	ArrowArray* const array = buildArrowArray(rows, count);
+	return py::cast(new ArrowBatch(schema, array), py::return_value_policy::take_ownership);
+}
+
+} // namespace
+
+void defstruct_ArrowBatch(py::module& m)
+{
+	py::class_<ArrowBatch>(m, "ArrowBatch",
+						   R"(A snapshot batch exported through the Arrow C data interface
+
+Wraps one record batch in the columnar layout of `export_columns` (vector
+fields as fixed-size lists of float32). Any consumer speaking the Arrow
+PyCapsule protocol ingests it without copying:
+
+    pyarrow.record_batch(batch)
+    polars.DataFrame(batch)
+
+Ownership of the buffers transfers to the consumer on the first
+`__arrow_c_array__` call; the batch cannot be consumed twice.)")
+		.def("__arrow_c_array__",
+			 [](ArrowBatch& batch, const py::object&) { return batch.arrowCArray(); },
+			 py::arg("requested_schema") = py::none(),
+			 "Arrow PyCapsule protocol entry point; returns (schema, array) capsules and transfers ownership")
+		.def("__len__", &ArrowBatch::length, "Number of records in the batch");
+}
+
+////////////////////////////////////////////////////////////////
+// Relay stream
+
+namespace
+{
+
+// Delta codec for relaying snapshot streams over constrained links. Most
+// fields repeat bit-identically frame-to-frame (error codes, eye states,
+// stale channels), so each snapshot is split into 8-byte groups and a delta
+// packet carries a change mask plus only the groups that differ from the
+// previous frame; a full keyframe goes out every `keyframeInterval` frames so
+// receivers can join mid-stream. Lossless, ~90 bytes per typical frame.
+constexpr size_t relayGroupSize = 8;
+constexpr size_t relayGroupCount = (sizeof(PumpSnapshot) + relayGroupSize - 1) / relayGroupSize;
+static_assert(relayGroupCount <= 32, "PumpSnapshot grew past the 32-bit relay change mask; widen the mask");
+
+// Packet header: type (0 = keyframe, 1 = delta), changed-group count, sequence
+// number. Delta packets append a uint32 change mask and the changed groups;
+// keyframes append all groups.
+struct RelayPacketHeader
+{
+	uint8_t type;
+	uint8_t changedGroups;
+	uint16_t sequence;
+};
+
+class RelayEncoder
+{
+public:
+	explicit RelayEncoder(const size_t keyframeInterval)
+	    : keyframeInterval_(keyframeInterval == 0 ? 1 : keyframeInterval) {}
+
+	// Encodes a drained batch into a packet stream, continuing the delta state
+	// of the previous call
+	py::bytes encode(const py::array_t<PumpSnapshot>& records)
+	{
+		const auto info = records.request();
+		if (info.ndim != 1)
+			throw std::runtime_error("RelayEncoder.encode: expected a 1-D snapshot array");
+		const auto* const rows = static_cast<const PumpSnapshot*>(info.ptr);
+		const size_t count = static_cast<size_t>(info.shape[0]);
+
+		// Staged in the scratch arena instead of a growing std::string: a delta
+		// packet never beats a keyframe by more than the mask, so the worst case
+		// per record is header + mask + every group.
+		const size_t worstPerRecord = sizeof(RelayPacketHeader) + sizeof(uint32_t) + relayGroupCount * relayGroupSize;
+		char* const staging = scratchAllocOf<char>(count * worstPerRecord);
+		char* write = staging;
+		const auto append = [&write](const void* bytes, const size_t size) {
+			std::memcpy(write, bytes, size);
+			write += size;
+		};
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			uint8_t current[relayGroupCount * relayGroupSize] = {};
+			std::memcpy(current, &rows[i], sizeof(PumpSnapshot));
+
+			RelayPacketHeader header = {};
+			header.sequence = sequence_++;
+			if (!hasPrev_ || sinceKeyframe_ >= keyframeInterval_)
+			{
+				header.type = 0;
+				append(&header, sizeof header);
+				append(current, sizeof current);
+				sinceKeyframe_ = 1;
+			}
+			else
+			{
+				uint32_t mask = 0;
+				for (size_t group = 0; group < relayGroupCount; ++group)
+					if (std::memcmp(current + group * relayGroupSize, prev_ + group * relayGroupSize, relayGroupSize) != 0)
+						mask |= 1u << group;
+				header.type = 1;
+				header.changedGroups = static_cast<uint8_t>(popcount(mask));
+				append(&header, sizeof header);
+				append(&mask, sizeof mask);
+				for (size_t group = 0; group < relayGroupCount; ++group)
+					if (mask & (1u << group))
+						append(current + group * relayGroupSize, relayGroupSize);
+				++sinceKeyframe_;
+			}
+			std::memcpy(prev_, current, sizeof prev_);
+			hasPrev_ = true;
+		}
+		return py::bytes(staging, static_cast<size_t>(write - staging));
+	}
+
+	void reset()
+	{
+		hasPrev_ = false;
+		sinceKeyframe_ = 0;
+	}
+
+private:
+	static int popcount(uint32_t v)
+	{
+		int count = 0;
+		for (; v; v &= v - 1)
+			++count;
+		return count;
+	}
+
+	const size_t keyframeInterval_;
+	uint8_t prev_[relayGroupCount * relayGroupSize] = {};
+	bool hasPrev_ = false;
+	size_t sinceKeyframe_ = 0;
+	uint16_t sequence_ = 0;
+};
+
+class RelayDecoder
+{
+public:
+	// Decodes a packet stream back into snapshots. Tolerates joining
+	// mid-stream and lost packets: after a sequence gap, delta packets are
+	// discarded (and counted) until the next keyframe resynchronizes.
+	py::array decode(const py::bytes& data)
+	{
+		// Read straight out of the bytes object (no copy) and stage the decoded
+		// records in the scratch arena; each packet carries at least a header,
+		// so the payload size over the header size bounds the record count.
+		const std::string_view buffer = data;
+		const auto* cursor = reinterpret_cast<const uint8_t*>(buffer.data());
+		const uint8_t* const end = cursor + buffer.size();
+		PumpSnapshot* const out = scratchAllocOf<PumpSnapshot>(buffer.size() / sizeof(RelayPacketHeader));
+		size_t outCount = 0;
+
+		while (static_cast<size_t>(end - cursor) >= sizeof(RelayPacketHeader))
+		{
+			RelayPacketHeader header;
+			std::memcpy(&header, cursor, sizeof header);
+			cursor += sizeof header;
+
+			if (header.type == 0)
+			{
+				if (static_cast<size_t>(end - cursor) < sizeof prev_)
+					throw std::runtime_error("RelayDecoder.decode: truncated keyframe packet");
+				std::memcpy(prev_, cursor, sizeof prev_);
+				cursor += sizeof prev_;
+				synced_ = true;
+			}
+			else if (header.type == 1)
+			{
+				uint32_t mask = 0;
+				if (static_cast<size_t>(end - cursor) < sizeof mask)
+					throw std::runtime_error("RelayDecoder.decode: truncated delta packet");
+				std::memcpy(&mask, cursor, sizeof mask);
+				cursor += sizeof mask;
+				size_t changed = 0;
+				for (size_t group = 0; group < relayGroupCount; ++group)
+					if (mask & (1u << group))
+						++changed;
+				if (static_cast<size_t>(end - cursor) < changed * relayGroupSize)
+					throw std::runtime_error("RelayDecoder.decode: truncated delta packet");
+				const bool usable = synced_ && hasSequence_ && header.sequence == static_cast<uint16_t>(lastSequence_ + 1);
+				for (size_t group = 0; group < relayGroupCount; ++group)
+					if (mask & (1u << group))
+					{
+						if (usable)
+							std::memcpy(prev_ + group * relayGroupSize, cursor, relayGroupSize);
+						cursor += relayGroupSize;
+					}
+				if (!usable)
+				{
+					// Lost continuity: wait for the next keyframe
+					synced_ = false;
+					++packetsDiscarded_;
+				}
+			}
+			else
+				throw std::runtime_error("RelayDecoder.decode: unknown packet type");
+
+			hasSequence_ = true;
+			lastSequence_ = header.sequence;
+			if (synced_)
+				std::memcpy(&out[outCount++], prev_, sizeof(PumpSnapshot));
+		}
+
+		py::array_t<PumpSnapshot> batch(static_cast<py::ssize_t>(outCount));
+		std::copy(out, out + outCount, static_cast<PumpSnapshot*>(batch.request().ptr));
+		return std::move(batch);
+	}
+
+	uint64_t packetsDiscarded() const { return packetsDiscarded_; }
+
+private:
+	uint8_t prev_[relayGroupCount * relayGroupSize] = {};
+	bool synced_ = false;
+	bool hasSequence_ = false;
+	uint16_t lastSequence_ = 0;
+	uint64_t packetsDiscarded_ = 0;
+};
+
+} // namespace
+
+void defstruct_Relay(py::module& m)
+{
+	py::class_<RelayEncoder>(m, "RelayEncoder",
+							 R"(Delta-encodes snapshot batches into a compact relay stream
+
+Consecutive snapshots differ in only a handful of 8-byte groups, so each delta
+packet carries a change mask plus the changed groups — lossless, roughly 90
+bytes per typical frame instead of the full record, which keeps 120 Hz
+telemetry for several headsets well under 100 kB/s. A full keyframe is
+emitted every `keyframe_interval` frames so receivers can join mid-stream.
+
+Feed it the batches drained from a `FramePump` and send the returned bytes
+over the wire; a `RelayDecoder` on the other end reconstructs the records.)")
+		.def(py::init<size_t>(), py::arg("keyframe_interval") = 64,
+			 R"(Creates an encoder
+
+\param keyframe_interval Number of frames between full keyframes
+)")
+		.def("encode", &RelayEncoder::encode, py::arg("records"),
+			 R"(Encodes a snapshot batch, continuing the delta state of the previous call
+
+\param records A 1-D structured array in the pump snapshot layout
+\return The packet stream as bytes, ready to send
+)")
+		.def("reset", &RelayEncoder::reset, "Forces the next encoded frame to be a keyframe");
+
+	py::class_<RelayDecoder>(m, "RelayDecoder",
+							 R"(Decodes a `RelayEncoder` packet stream back into snapshot batches
+
+Stateful across calls: packets may be split across `decode` calls only at
+packet boundaries. Joining mid-stream or losing packets is handled by waiting
+for the next keyframe; discarded delta packets are counted in
+`packetsDiscarded`.)")
+		.def(py::init<>())
+		.def("decode", &RelayDecoder::decode, py::arg("data"),
+			 R"(Decodes a chunk of the packet stream
+
+\param data Bytes as produced by `RelayEncoder.encode` (whole packets)
+\return A structured numpy array of the reconstructed snapshots, oldest first
+)")
+		.def_property_readonly("packetsDiscarded", &RelayDecoder::packetsDiscarded,
+							   "Number of delta packets discarded while waiting for a keyframe");
+}
+
+////////////////////////////////////////////////////////////////
+// Replay headset
+
+namespace
+{
+
+// Serves a recording made by `Recorder` back through the same per-channel
+// getter surface as the live `Headset_*` functions, so analysis code ports
+// between live and recorded sessions without a second slow code path.
+// The file is memory-mapped; seeking and reading are pointer arithmetic.
+class ReplayHeadset
+{
+public:
+	explicit ReplayHeadset(const std::string& path, const double speed)
+	    : speed_(speed)
+	{
+		if (speed < 0)
+			throw std::runtime_error("ReplayHeadset: speed must be >= 0");
+		std::FILE* const file = std::fopen(path.c_str(), "rb");
+		if (!file)
+			throw std::runtime_error("ReplayHeadset: cannot open " + path);
+		RecorderFileHeader header = {};
+		if (std::fread(&header, sizeof header, 1, file) != 1
+			|| std::memcmp(header.magic, recorderMagic, sizeof header.magic) != 0)
+		{
+			std::fclose(file);
+			throw std::runtime_error("ReplayHeadset: " + path + " is not a recorder file");
+		}
+		if (header.version != recorderVersion
+			|| (header.flags & ~(recorderFlagDeltaRle | recorderFlagColumnMask)) != 0)
+		{
+			std::fclose(file);
+			throw std::runtime_error("ReplayHeadset: " + path + " was written by an incompatible version");
+		}
+		uint64_t mask = 0;
+		if ((header.flags & recorderFlagColumnMask) != 0
+				? std::fread(&mask, sizeof mask, 1, file) != 1 || header.recordSize != packedRecordSize(mask)
+				: header.recordSize != sizeof(PumpSnapshot))
+		{
+			std::fclose(file);
+			throw std::runtime_error("ReplayHeadset: " + path + " was written by an incompatible version");
+		}
+		if (header.flags & recorderFlagDeltaRle)
+		{
+			// Compressed recordings are decoded up front instead of mapped
+			try
+			{
+				fileCopy_ = readCompressedRecords(file, path, "ReplayHeadset", mask);
+			}
+			catch (...)
+			{
+				std::fclose(file);
+				throw;
+			}
+			std::fclose(file);
+			records_ = fileCopy_.data();
+			count_ = fileCopy_.size();
+			return;
+		}
+		if (mask != 0)
+		{
+			// So are packed recordings; only full-layout uncompressed files are
+			// memory-mapped
+			std::fseek(file, 0, SEEK_END);
+			const long fileEnd = std::ftell(file);
+			const long dataStart = static_cast<long>(sizeof header + sizeof mask);
+			const size_t count = static_cast<size_t>(fileEnd - dataStart) / header.recordSize;
+			std::vector<uint8_t> rows(count * header.recordSize);
+			std::fseek(file, dataStart, SEEK_SET);
+			const bool ok = std::fread(rows.data(), 1, rows.size(), file) == rows.size();
+			std::fclose(file);
+			if (!ok)
+				throw std::runtime_error("ReplayHeadset: " + path + " is truncated");
+			fileCopy_.resize(count);
+			for (size_t r = 0; r < count; ++r)
+				unpackSnapshot(rows.data() + r * header.recordSize, mask, fileCopy_[r]);
+			records_ = fileCopy_.data();
+			count_ = fileCopy_.size();
+			return;
+		}
+#ifndef _WIN32
+		const int fd = fileno(file);
+		struct stat st = {};
+		fstat(fd, &st);
+		mapLength_ = static_cast<size_t>(st.st_size);
+		mapping_ = mmap(nullptr, mapLength_, PROT_READ, MAP_PRIVATE, fd, 0);
+		std::fclose(file); // the mapping survives the fd
+		if (mapping_ == MAP_FAILED)
+		{
+			mapping_ = nullptr;
+			throw std::runtime_error("ReplayHeadset: mmap of " + path + " failed");
+		}
+		records_ = reinterpret_cast<const PumpSnapshot*>(static_cast<const char*>(mapping_) + sizeof header);
+		count_ = (mapLength_ - sizeof header) / sizeof(PumpSnapshot);
+#else
+		std::fseek(file, 0, SEEK_END);
+		const size_t fileSize = static_cast<size_t>(std::ftell(file));
+		std::fseek(file, sizeof header, SEEK_SET);
+		fileCopy_.resize((fileSize - sizeof header) / sizeof(PumpSnapshot));
+		std::fread(fileCopy_.data(), sizeof(PumpSnapshot), fileCopy_.size(), file);
+		std::fclose(file);
+		records_ = fileCopy_.data();
+		count_ = fileCopy_.size();
+#endif
+	}
+
+	~ReplayHeadset()
+	{
+#ifndef _WIN32
+		if (mapping_)
+			munmap(mapping_, mapLength_);
+#endif
+	}
+
+	ReplayHeadset(const ReplayHeadset&) = delete;
+	ReplayHeadset& operator=(const ReplayHeadset&) = delete;
+
+	// Advances to the next record; at speed 0 this never sleeps, otherwise it
+	// paces by the recorded timestamps scaled by the speed factor
+	Fove_ErrorCode waitForProcessedEyeFrame()
+	{
+		if (next_ + 1 >= count_)
+			return Fove_ErrorCode::Data_NoUpdate;
+		++next_;
+		if (speed_ > 0)
+		{
+			const PumpSnapshot& rec = records_[next_];
+			if (!wallStartValid_)
+			{
+				wallStart_ = std::chrono::steady_clock::now();
+				recStart_ = rec.timestamp;
+				wallStartValid_ = true;
+			}
+			else
+			{
+				const auto due = wallStart_ + std::chrono::microseconds(
+					static_cast<uint64_t>((rec.timestamp - recStart_) / speed_));
+				std::this_thread::sleep_until(due);
+			}
+		}
+		return Fove_ErrorCode::None;
+	}
+
+	Fove_ErrorCode fetchEyeTrackingData(Fove_FrameTimestamp* const outTimestamp)
+	{
+		if (count_ == 0)
+			return Fove_ErrorCode::Data_NoUpdate;
+		current_ = next_;
+		if (outTimestamp)
+		{
+			outTimestamp->id = records_[current_].frameId;
+			outTimestamp->timestamp = records_[current_].timestamp;
+		}
+		return Fove_ErrorCode::None;
+	}
+
+	Fove_ErrorCode getEyeTrackingDataTimestamp(Fove_FrameTimestamp& out) const
+	{
+		if (count_ == 0)
+			return Fove_ErrorCode::Data_NoUpdate;
+		out.id = records_[current_].frameId;
+		out.timestamp = records_[current_].timestamp;
+		return Fove_ErrorCode::None;
+	}
+
+	Fove_ErrorCode getGazeVector(const Fove_Eye eye, Fove_Vec3& out) const
+	{
+		if (count_ == 0)
+			return Fove_ErrorCode::Data_NoUpdate;
+		const PumpSnapshot& rec = records_[current_];
+		out = eye == Fove_Eye::Right ? rec.gazeVectorRight : rec.gazeVectorLeft;
+		return static_cast<Fove_ErrorCode>(eye == Fove_Eye::Right ? rec.errGazeVectorRight : rec.errGazeVectorLeft);
+	}
+
+	Fove_ErrorCode getGazeVectorRaw(const Fove_Eye eye, Fove_Vec3& out) const
+	{
+		if (count_ == 0)
+			return Fove_ErrorCode::Data_NoUpdate;
+		const PumpSnapshot& rec = records_[current_];
+		out = eye == Fove_Eye::Right ? rec.gazeVectorRawRight : rec.gazeVectorRawLeft;
+		return static_cast<Fove_ErrorCode>(eye == Fove_Eye::Right ? rec.errGazeVectorRawRight : rec.errGazeVectorRawLeft);
+	}
+
+	Fove_ErrorCode getPupilRadius(const Fove_Eye eye, float& out) const
+	{
+		if (count_ == 0)
+			return Fove_ErrorCode::Data_NoUpdate;
+		const PumpSnapshot& rec = records_[current_];
+		out = eye == Fove_Eye::Right ? rec.pupilRadiusRight : rec.pupilRadiusLeft;
+		return static_cast<Fove_ErrorCode>(eye == Fove_Eye::Right ? rec.errPupilRadiusRight : rec.errPupilRadiusLeft);
+	}
+
+	Fove_ErrorCode getIrisRadius(const Fove_Eye eye, float& out) const
+	{
+		if (count_ == 0)
+			return Fove_ErrorCode::Data_NoUpdate;
+		const PumpSnapshot& rec = records_[current_];
+		out = eye == Fove_Eye::Right ? rec.irisRadiusRight : rec.irisRadiusLeft;
+		return static_cast<Fove_ErrorCode>(eye == Fove_Eye::Right ? rec.errIrisRadiusRight : rec.errIrisRadiusLeft);
+	}
+
+	Fove_ErrorCode getEyeState(const Fove_Eye eye, Fove_EyeState& out) const
+	{
+		if (count_ == 0)
+			return Fove_ErrorCode::Data_NoUpdate;
+		const PumpSnapshot& rec = records_[current_];
+		out = static_cast<Fove_EyeState>(eye == Fove_Eye::Right ? rec.eyeStateRight : rec.eyeStateLeft);
+		return static_cast<Fove_ErrorCode>(eye == Fove_Eye::Right ? rec.errEyeStateRight : rec.errEyeStateLeft);
+	}
+
+	Fove_ErrorCode isEyeBlinking(const Fove_Eye eye, bool& out) const
+	{
+		if (count_ == 0)
+			return Fove_ErrorCode::Data_NoUpdate;
+		const PumpSnapshot& rec = records_[current_];
+		out = (eye == Fove_Eye::Right ? rec.eyeBlinkingRight : rec.eyeBlinkingLeft) != 0;
+		return static_cast<Fove_ErrorCode>(eye == Fove_Eye::Right ? rec.errEyeBlinkingRight : rec.errEyeBlinkingLeft);
+	}
+
+	Fove_ErrorCode getCombinedGazeRay(Fove_Ray& out) const
+	{
+		if (count_ == 0)
+			return Fove_ErrorCode::Data_NoUpdate;
+		out = records_[current_].combinedRay;
+		return static_cast<Fove_ErrorCode>(records_[current_].errCombinedRay);
+	}
+
+	Fove_ErrorCode getCombinedGazeDepth(float& out) const
+	{
+		if (count_ == 0)
+			return Fove_ErrorCode::Data_NoUpdate;
+		out = records_[current_].combinedDepth;
+		return static_cast<Fove_ErrorCode>(records_[current_].errCombinedDepth);
+	}
+
+	void seek(const size_t index)
+	{
+		if (index >= count_)
+			throw std::runtime_error("ReplayHeadset.seek: index out of range");
+		next_ = current_ = index;
+		wallStartValid_ = false; // re-anchor realtime pacing at the new position
+	}
+
+	void rewind()
+	{
+		next_ = current_ = 0;
+		wallStartValid_ = false;
+	}
+
+	size_t length() const { return count_; }
+	size_t position() const { return current_; }
+	double speed() const { return speed_; }
+	void setSpeed(const double speed)
+	{
+		if (speed < 0)
+			throw std::runtime_error("ReplayHeadset: speed must be >= 0");
+		speed_ = speed;
+		wallStartValid_ = false;
+	}
+
+private:
+	const PumpSnapshot* records_ = nullptr;
+	size_t count_ = 0;
+	size_t current_ = 0;
+	size_t next_ = 0;
+	double speed_ = 0;
+	bool wallStartValid_ = false;
+	std::chrono::steady_clock::time_point wallStart_;
+	uint64_t recStart_ = 0;
+#ifndef _WIN32
+	void* mapping_ = nullptr;
+	size_t mapLength_ = 0;
+#endif
+	std::vector<PumpSnapshot> fileCopy_; // backs compressed (and, on Windows, all) recordings
+};
+
+} // namespace
+
+void defstruct_ReplayHeadset(py::module& m)
+{
+	py::class_<ReplayHeadset>(m, "ReplayHeadset",
+							  R"(Plays a `Recorder` file back through the per-channel getter surface
+
+Methods mirror the live `Headset_*` functions one to one (same out-parameter
+shapes, same error codes as captured at record time), so analysis code runs
+unchanged against live or recorded sessions. The recording is memory-mapped,
+and `waitForProcessedEyeFrame` paces playback: at speed 0 it never sleeps
+(as-fast-as-possible replay for regression benchmarks), at speed 1 it follows
+the recorded timestamps in real time, and other factors scale accordingly.
+
+Pose and camera image channels are not part of the recording format and are
+therefore not served.)")
+		.def(py::init<const std::string&, double>(), py::arg("path"), py::arg("speed") = 0.0,
+			 R"(Memory-maps a recording for playback
+
+\param path The recording file, as written by `Recorder`
+\param speed The playback speed factor; 0 replays as fast as possible
+)")
+		.def("waitForProcessedEyeFrame", &ReplayHeadset::waitForProcessedEyeFrame,
+			 py::call_guard<py::gil_scoped_release>(),
+			 R"(Advances to the next recorded frame, sleeping as dictated by the speed factor
+
+\return #Fove_ErrorCode_None while frames remain\n
+        #Fove_ErrorCode_Data_NoUpdate when the end of the recording is reached
+)")
+		.def(
+			"fetchEyeTrackingData", [](ReplayHeadset& replay, Fove_FrameTimestamp* out) {
+				return replay.fetchEyeTrackingData(out);
+			},
+			"Makes the last waited-on record current; mirrors `Headset_fetchEyeTrackingData`")
+		.def(
+			"getEyeTrackingDataTimestamp", [](const ReplayHeadset& replay, Fove_FrameTimestamp& out) {
+				return replay.getEyeTrackingDataTimestamp(out);
+			},
+			"Writes out the timestamp of the current record")
+		.def(
+			"getGazeVector", [](const ReplayHeadset& replay, Fove_Eye eye, Fove_Vec3& out) {
+				return replay.getGazeVector(eye, out);
+			},
+			"Writes out the recorded gaze vector of an individual eye")
+		.def(
+			"getGazeVectorRaw", [](const ReplayHeadset& replay, Fove_Eye eye, Fove_Vec3& out) {
+				return replay.getGazeVectorRaw(eye, out);
+			},
+			"Writes out the recorded unfiltered gaze vector of an individual eye")
+		.def(
+			"getPupilRadius", [](const ReplayHeadset& replay, Fove_Eye eye, Obj<float>& out) {
+				return replay.getPupilRadius(eye, out);
+			},
+			"Writes out the recorded pupil radius of an individual eye")
+		.def(
+			"getIrisRadius", [](const ReplayHeadset& replay, Fove_Eye eye, Obj<float>& out) {
+				return replay.getIrisRadius(eye, out);
+			},
+			"Writes out the recorded iris radius of an individual eye")
+		.def(
+			"getEyeState", [](const ReplayHeadset& replay, Fove_Eye eye, Obj<Fove_EyeState>& out) {
+				return replay.getEyeState(eye, out);
+			},
+			"Writes out the recorded state of an individual eye")
+		.def(
+			"isEyeBlinking", [](const ReplayHeadset& replay, Fove_Eye eye, Obj<bool>& out) {
+				return replay.isEyeBlinking(eye, out);
+			},
+			"Writes out whether a blink was recorded for the given eye")
+		.def(
+			"getCombinedGazeRay", [](const ReplayHeadset& replay, Fove_Ray& out) {
+				return replay.getCombinedGazeRay(out);
+			},
+			"Writes out the recorded combined gaze ray")
+		.def(
+			"getCombinedGazeDepth", [](const ReplayHeadset& replay, Obj<float>& out) {
+				return replay.getCombinedGazeDepth(out);
+			},
+			"Writes out the recorded combined gaze depth")
+		.def("seek", &ReplayHeadset::seek, py::arg("index"),
+			 "Jumps playback to the given record index and re-anchors realtime pacing there")
+		.def("rewind", &ReplayHeadset::rewind, "Jumps playback back to the first record")
+		.def("__len__", &ReplayHeadset::length, "Number of records in the recording")
+		.def_property_readonly("position", &ReplayHeadset::position, "Index of the current record")
+		.def_property("speed", &ReplayHeadset::speed, &ReplayHeadset::setSpeed,
+					  "The playback speed factor; 0 replays as fast as possible");
+}
+
+#if FOVE_HAS_FEATURE(FOVE_FEATURE_GAZABLE_OBJECTS)
+////////////////////////////////////////////////////////////////
+// Local gaze raycast
+
+namespace
+{
+
+// Small vector/quaternion helpers for the raycast engine.
+// FoveAPI.h structs carry no operations in the C binding mode, so we keep these local.
+inline Fove_Vec3 vecAdd(const Fove_Vec3& a, const Fove_Vec3& b) { return {a.x + b.x, a.y + b.y, a.z + b.z}; }
+inline Fove_Vec3 vecSub(const Fove_Vec3& a, const Fove_Vec3& b) { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+inline Fove_Vec3 vecMul(const Fove_Vec3& a, const Fove_Vec3& b) { return {a.x * b.x, a.y * b.y, a.z * b.z}; }
+inline Fove_Vec3 vecCross(const Fove_Vec3& a, const Fove_Vec3& b)
+{
+	return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+inline float vecDot(const Fove_Vec3& a, const Fove_Vec3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+// Rotates a vector by a unit quaternion
+inline Fove_Vec3 quatRotate(const Fove_Quaternion& q, const Fove_Vec3& v)
+{
+	const Fove_Vec3 u = {q.x, q.y, q.z};
+	const Fove_Vec3 t = vecCross(u, v);
+	const Fove_Vec3 t2 = {2 * t.x, 2 * t.y, 2 * t.z};
+	return vecAdd(v, vecAdd({q.w * t2.x, q.w * t2.y, q.w * t2.z}, vecCross(u, t2)));
+}
+
+inline Fove_Quaternion quatConjugate(const Fove_Quaternion& q) { return {-q.x, -q.y, -q.z, q.w}; }
+
+// World transform of one registered object, with the inverse pieces precomputed
+// so that rays can be taken into object-local space cheaply
+struct GazeObjectXform
+{
+	Fove_Vec3 position;
+	Fove_Quaternion rotation;
+	Fove_Vec3 scale;
+	Fove_Vec3 invScale;
+};
+
+// One BVH leaf primitive: a whole cube/sphere collider, or a single mesh triangle.
+// Geometry is kept in object-local space (copied, never aliased from Python buffers);
+// the world-space AABB is what the BVH is built over.
+struct GazePrimitive
+{
+	Fove_Vec3 bmin;
+	Fove_Vec3 bmax;
+	Fove_Vec3 centroid;
+	int objectId;
+	int xformIndex;
+	Fove_ColliderType kind;
+	// Cube: a = local center, b = half size. Sphere: a = local center, radius in b.x.
+	// Mesh: a, b, c are the triangle vertices.
+	Fove_Vec3 a;
+	Fove_Vec3 b;
+	Fove_Vec3 c;
+};
+
+struct GazeBvhNode
+{
+	Fove_Vec3 bmin;
+	Fove_Vec3 bmax;
+	int left = -1;  // child index, or -1 for leaves
+	int right = -1;
+	int parent = -1; // for the bottom-up refit walk
+	int start = 0;   // primitive range for leaves
+	int count = 0;
+};
+
+// Slab test; returns whether [tNear, tFar] of the box overlaps [0, tMax]
+inline bool rayHitsAabb(const Fove_Vec3& origin, const Fove_Vec3& invDir, const Fove_Vec3& bmin, const Fove_Vec3& bmax, const float tMax)
+{
+	float t0 = 0, t1 = tMax;
+	const float ox[3] = {origin.x, origin.y, origin.z};
+	const float ix[3] = {invDir.x, invDir.y, invDir.z};
+	const float lo[3] = {bmin.x, bmin.y, bmin.z};
+	const float hi[3] = {bmax.x, bmax.y, bmax.z};
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		float tA = (lo[axis] - ox[axis]) * ix[axis];
+		float tB = (hi[axis] - ox[axis]) * ix[axis];
+		if (tA > tB)
+			swap(tA, tB);
+		t0 = tA > t0 ? tA : t0;
+		t1 = tB < t1 ? tB : t1;
+		if (t0 > t1)
+			return false;
+	}
+	return true;
+}
+
+// Structure-of-arrays collider storage for the intersection kernels: spheres,
+// cubes and mesh triangles are de-interleaved into type-segregated contiguous
+// arrays at build time, so the leaf loops run branch-free over homogeneous
+// scalar lanes instead of striding through tagged unions.
+struct ColliderSoA
+{
+	// Cubes: local center and half size
+	std::vector<float> cubeCx, cubeCy, cubeCz, cubeHx, cubeHy, cubeHz;
+	std::vector<int> cubeXform, cubeId;
+	// Spheres: local center and radius
+	std::vector<float> sphereCx, sphereCy, sphereCz, sphereR;
+	std::vector<int> sphereXform, sphereId;
+	// Mesh triangles: vertex a and the two edges from it
+	std::vector<float> triAx, triAy, triAz, triE1x, triE1y, triE1z, triE2x, triE2y, triE2z;
+	std::vector<int> triXform, triId;
+};
+
+// Re-intersects gaze rays against a locally mirrored copy of the gazable object
+// scene, so that recorded sessions can be replayed offline without the runtime.
+// Colliders are flattened into world-AABB primitives under a binned-SAH BVH
+// built task-parallel over subtrees (so multi-million-triangle meshes load fast);
+// `cast` fans the ray batch out over a thread pool with the GIL released.
+class GazeCastScene
+{
+public:
+	// Registers one gazable object; copies its colliders (mesh data included)
+	void add(const Fove_GazableObject& object)
+	{
+		std::unique_lock<std::shared_mutex> lock(mutex_);
+		if (built_)
+			throw std::runtime_error("GazeCastScene: cannot add objects after the BVH is built");
+
+		GazeObjectXform xform;
+		xform.position = object.pose.position;
+		xform.rotation = object.pose.rotation;
+		xform.scale = object.pose.scale;
+		xform.invScale = {safeInv(object.pose.scale.x), safeInv(object.pose.scale.y), safeInv(object.pose.scale.z)};
+		const int xformIndex = static_cast<int>(xforms_.size());
+		xforms_.push_back(xform);
+		xformOfObject_[object.id] = xformIndex;
+
+		for (unsigned int i = 0; i < object.colliderCount; ++i)
+		{
+			const Fove_ObjectCollider& collider = object.colliders[i];
+			switch (collider.shapeType)
+			{
+			case Fove_ColliderType::Cube:
+			{
+				GazePrimitive prim = {};
+				prim.objectId = object.id;
+				prim.xformIndex = xformIndex;
+				prim.kind = Fove_ColliderType::Cube;
+				prim.a = collider.center;
+				const Fove_Vec3& size = collider.shapeDefinition.cube.size;
+				prim.b = {size.x * 0.5f, size.y * 0.5f, size.z * 0.5f};
+				finishPrimitive(prim, vecSub(prim.a, prim.b), vecAdd(prim.a, prim.b));
+				break;
+			}
+			case Fove_ColliderType::Sphere:
+			{
+				GazePrimitive prim = {};
+				prim.objectId = object.id;
+				prim.xformIndex = xformIndex;
+				prim.kind = Fove_ColliderType::Sphere;
+				prim.a = collider.center;
+				const float radius = collider.shapeDefinition.sphere.radius;
+				prim.b = {radius, 0, 0};
+				const Fove_Vec3 r = {radius, radius, radius};
+				finishPrimitive(prim, vecSub(prim.a, r), vecAdd(prim.a, r));
+				break;
+			}
+			case Fove_ColliderType::Mesh:
+			{
+				const Fove_ColliderMesh& mesh = collider.shapeDefinition.mesh;
+				if (!mesh.vertices)
+					break;
+				for (unsigned int tri = 0; tri < mesh.triangleCount; ++tri)
+				{
+					unsigned int i0, i1, i2;
+					if (mesh.indices)
+					{
+						i0 = mesh.indices[3 * tri + 0];
+						i1 = mesh.indices[3 * tri + 1];
+						i2 = mesh.indices[3 * tri + 2];
+					}
+					else
+					{
+						i0 = 3 * tri + 0;
+						i1 = 3 * tri + 1;
+						i2 = 3 * tri + 2;
+					}
+					GazePrimitive prim = {};
+					prim.objectId = object.id;
+					prim.xformIndex = xformIndex;
+					prim.kind = Fove_ColliderType::Mesh;
+					prim.a = vecAdd(collider.center, {mesh.vertices[3 * i0], mesh.vertices[3 * i0 + 1], mesh.vertices[3 * i0 + 2]});
+					prim.b = vecAdd(collider.center, {mesh.vertices[3 * i1], mesh.vertices[3 * i1 + 1], mesh.vertices[3 * i1 + 2]});
+					prim.c = vecAdd(collider.center, {mesh.vertices[3 * i2], mesh.vertices[3 * i2 + 1], mesh.vertices[3 * i2 + 2]});
+					Fove_Vec3 lo = prim.a, hi = prim.a;
+					growAabb(lo, hi, prim.b);
+					growAabb(lo, hi, prim.c);
+					finishPrimitive(prim, lo, hi);
+				}
+				break;
+			}
+			}
+		}
+	}
+
+	// Builds the BVH; called implicitly by the first cast
+	void build()
+	{
+		std::unique_lock<std::shared_mutex> lock(mutex_);
+		if (built_)
+			return;
+		rebuildTree();
+		built_ = true;
+	}
+
+	// Moves one object to a new pose and refits the BVH incrementally: only the
+	// object's own primitives are retransformed and only their leaf-to-root node
+	// chains recomputed, so the per-frame cost scales with moved objects, not
+	// scene size. Refitting never resplits, so a scene whose objects drift far
+	// from their build positions degrades; once the accumulated node-surface-area
+	// growth exceeds half the area at build time the tree is rebuilt from scratch.
+	void updatePose(const int id, const Fove_ObjectPose& pose)
+	{
+		build();
+		std::unique_lock<std::shared_mutex> lock(mutex_);
+		refitObject(id, pose);
+		finishRefit();
+	}
+
+	// Batch pose update, the local mirror of `Headset_updateGazableObjects`:
+	// rows of poses are laid out like Fove_ObjectPose (scale, rotation, position,
+	// velocity), and all moved leaves share one bottom-up refit pass
+	void updatePoses(const py::array_t<int32_t, py::array::c_style | py::array::forcecast>& ids, const FloatBatch& poses)
+	{
+		if (ids.ndim() != 1)
+			throw std::runtime_error("ids must be a one-dimensional array");
+		const py::ssize_t n = ids.shape(0);
+		if (batchLength(poses, 13, "poses") != n)
+			throw std::runtime_error("ids and poses must have the same length");
+
+		build();
+		std::unique_lock<std::shared_mutex> lock(mutex_);
+		const int32_t* const pIds = ids.data();
+		const float* const pPoses = poses.data();
+		for (py::ssize_t i = 0; i < n; ++i)
+		{
+			Fove_ObjectPose pose;
+			std::memcpy(&pose, pPoses + i * 13, sizeof pose);
+			refitObject(pIds[i], pose);
+		}
+		finishRefit();
+	}
+
+	// Casts a single ray; returns the id of the closest hit object, or fove_ObjectIdInvalid
+	int castOne(const Fove_Vec3& origin, const Fove_Vec3& direction)
+	{
+		build();
+		std::shared_lock<std::shared_mutex> lock(mutex_);
+		return castRay(origin, direction);
+	}
+
+	// Single-ray cast that also reports the world-space hit point, for the
+	// pump's live gaze-object channel
+	int castOneHit(const Fove_Vec3& origin, const Fove_Vec3& direction, Fove_Vec3& outPoint)
+	{
+		build();
+		std::shared_lock<std::shared_mutex> lock(mutex_);
+		float t = 0;
+		const int id = castRay(origin, direction, t);
+		if (id != fove_ObjectIdInvalid)
+			outPoint = {origin.x + direction.x * t, origin.y + direction.y * t, origin.z + direction.z * t};
+		return id;
+	}
+
+	// Casts a batch of rays, multithreaded; rays are rows of (ox, oy, oz, dx, dy, dz)
+	py::array_t<int> cast(const py::array_t<float, py::array::c_style | py::array::forcecast>& rays)
+	{
+		if (rays.ndim() != 2 || rays.shape(1) != 6)
+			throw std::runtime_error("Expected a ray array of shape (N, 6): origin xyz followed by direction xyz");
+
+		build();
+
+		const py::ssize_t count = rays.shape(0);
+		py::array_t<int> ids(count);
+		const float* rayData = rays.data();
+		int* idData = ids.mutable_data();
+
+		{
+			py::gil_scoped_release release;
+			std::shared_lock<std::shared_mutex> lock(mutex_); // workers only read; this blocks refits for the batch
+			const size_t threadCount = min<size_t>(max(1u, thread::hardware_concurrency()), static_cast<size_t>(count) / 256 + 1);
+			if (threadCount <= 1)
+			{
+				castRange(rayData, idData, 0, static_cast<size_t>(count));
+			}
+			else
+			{
+				vector<thread> workers;
+				const size_t chunk = (static_cast<size_t>(count) + threadCount - 1) / threadCount;
+				for (size_t t = 0; t < threadCount; ++t)
+				{
+					const size_t begin = t * chunk;
+					const size_t end = min(begin + chunk, static_cast<size_t>(count));
+					if (begin >= end)
+						break;
+					workers.emplace_back([this, rayData, idData, begin, end] { castRange(rayData, idData, begin, end); });
+				}
+				for (thread& worker : workers)
+					worker.join();
+			}
+		}
+		return ids;
+	}
+
+	size_t primitiveCount() const { return primitives_.size(); }
+
+private:
+	static float safeInv(const float v) { return v != 0 ? 1 / v : 0; }
+
+	static void growAabb(Fove_Vec3& lo, Fove_Vec3& hi, const Fove_Vec3& p)
+	{
+		lo = {min(lo.x, p.x), min(lo.y, p.y), min(lo.z, p.z)};
+		hi = {max(hi.x, p.x), max(hi.y, p.y), max(hi.z, p.z)};
+	}
+
+	// Transforms a local AABB's 8 corners to world space and returns the enclosing box
+	static void worldBounds(const GazeObjectXform& xform, const Fove_Vec3& localMin, const Fove_Vec3& localMax, Fove_Vec3& lo, Fove_Vec3& hi)
+	{
+		lo = {numeric_limits<float>::max(), numeric_limits<float>::max(), numeric_limits<float>::max()};
+		hi = {-numeric_limits<float>::max(), -numeric_limits<float>::max(), -numeric_limits<float>::max()};
+		for (int corner = 0; corner < 8; ++corner)
+		{
+			const Fove_Vec3 local = {
+				(corner & 1) ? localMax.x : localMin.x,
+				(corner & 2) ? localMax.y : localMin.y,
+				(corner & 4) ? localMax.z : localMin.z};
+			const Fove_Vec3 world = vecAdd(quatRotate(xform.rotation, vecMul(local, xform.scale)), xform.position);
+			growAabb(lo, hi, world);
+		}
+	}
+
+	// The primitive's AABB in object-local space, recovered from its geometry
+	// (stored so the refit path can retransform it under a new pose)
+	static void localBounds(const GazePrimitive& prim, Fove_Vec3& lo, Fove_Vec3& hi)
+	{
+		switch (prim.kind)
+		{
+		case Fove_ColliderType::Cube:
+			lo = vecSub(prim.a, prim.b);
+			hi = vecAdd(prim.a, prim.b);
+			break;
+		case Fove_ColliderType::Sphere:
+		{
+			const Fove_Vec3 r = {prim.b.x, prim.b.x, prim.b.x};
+			lo = vecSub(prim.a, r);
+			hi = vecAdd(prim.a, r);
+			break;
+		}
+		case Fove_ColliderType::Mesh:
+			lo = hi = prim.a;
+			growAabb(lo, hi, prim.b);
+			growAabb(lo, hi, prim.c);
+			break;
+		}
+	}
+
+	static float aabbArea(const Fove_Vec3& lo, const Fove_Vec3& hi)
+	{
+		const Fove_Vec3 d = vecSub(hi, lo);
+		return 2 * (d.x * d.y + d.y * d.z + d.z * d.x);
+	}
+
+	// Completes a primitive given its local AABB: transforms the 8 corners to world
+	// space for the BVH bounds, then appends it
+	void finishPrimitive(GazePrimitive& prim, const Fove_Vec3& localMin, const Fove_Vec3& localMax)
+	{
+		const GazeObjectXform& xform = xforms_[prim.xformIndex];
+		Fove_Vec3 lo, hi;
+		worldBounds(xform, localMin, localMax, lo, hi);
+		prim.bmin = lo;
+		prim.bmax = hi;
+		prim.centroid = {(lo.x + hi.x) * 0.5f, (lo.y + hi.y) * 0.5f, (lo.z + hi.z) * 0.5f};
+		primitives_.push_back(prim);
+	}
+
+	// (Re)builds the tree over the current primitive AABBs and derives the
+	// topology the refit path walks: parent links, the leaf holding each
+	// primitive (the build reorders primitives), the primitives of each object,
+	// and the reference surface area the rebuild heuristic compares against
+	void rebuildTree()
+	{
+		nodes_.clear();
+		if (!primitives_.empty())
+			buildTreeParallel();
+
+		// Sort each leaf's primitives by collider type, then de-interleave the
+		// tagged geometry into the type-segregated arrays: the intersection loop
+		// can then run each homogeneous run branch-free (see the run kernels)
+		for (const GazeBvhNode& node : nodes_)
+			if (node.left < 0)
+				stable_sort(primitives_.begin() + node.start, primitives_.begin() + node.start + node.count,
+							[](const GazePrimitive& a, const GazePrimitive& b) { return static_cast<int>(a.kind) < static_cast<int>(b.kind); });
+		buildSoA();
+
+		for (size_t i = 0; i < nodes_.size(); ++i)
+			if (nodes_[i].left >= 0)
+			{
+				nodes_[nodes_[i].left].parent = static_cast<int>(i);
+				nodes_[nodes_[i].right].parent = static_cast<int>(i);
+			}
+
+		leafOfPrimitive_.assign(primitives_.size(), -1);
+		for (size_t i = 0; i < nodes_.size(); ++i)
+			if (nodes_[i].left < 0)
+				for (int p = nodes_[i].start; p < nodes_[i].start + nodes_[i].count; ++p)
+					leafOfPrimitive_[p] = static_cast<int>(i);
+
+		primsOfXform_.assign(xforms_.size(), std::vector<int>());
+		for (size_t i = 0; i < primitives_.size(); ++i)
+			primsOfXform_[primitives_[i].xformIndex].push_back(static_cast<int>(i));
+
+		areaAtBuild_ = 0;
+		for (const GazeBvhNode& node : nodes_)
+			areaAtBuild_ += aabbArea(node.bmin, node.bmax);
+		areaDrift_ = 0;
+	}
+
+	// Applies a new pose to one object's primitives and marks their leaves dirty
+	void refitObject(const int id, const Fove_ObjectPose& pose)
+	{
+		const auto found = xformOfObject_.find(id);
+		if (found == xformOfObject_.end())
+			throw std::runtime_error("GazeCastScene: no object with id " + std::to_string(id));
+
+		GazeObjectXform& xform = xforms_[found->second];
+		xform.position = pose.position;
+		xform.rotation = pose.rotation;
+		xform.scale = pose.scale;
+		xform.invScale = {safeInv(pose.scale.x), safeInv(pose.scale.y), safeInv(pose.scale.z)};
+
+		for (const int primIndex : primsOfXform_[found->second])
+		{
+			GazePrimitive& prim = primitives_[primIndex];
+			Fove_Vec3 localLo, localHi;
+			localBounds(prim, localLo, localHi);
+			worldBounds(xform, localLo, localHi, prim.bmin, prim.bmax);
+			prim.centroid = {(prim.bmin.x + prim.bmax.x) * 0.5f, (prim.bmin.y + prim.bmax.y) * 0.5f, (prim.bmin.z + prim.bmax.z) * 0.5f};
+			dirtyLeaves_.push_back(leafOfPrimitive_[primIndex]);
+		}
+	}
+
+	// Recomputes the dirty leaves and walks each one's ancestor chain, stopping
+	// as soon as a node's box comes out unchanged; accumulated area growth feeds
+	// the rebuild heuristic
+	void finishRefit()
+	{
+		sort(dirtyLeaves_.begin(), dirtyLeaves_.end());
+		dirtyLeaves_.erase(unique(dirtyLeaves_.begin(), dirtyLeaves_.end()), dirtyLeaves_.end());
+		for (const int leaf : dirtyLeaves_)
+		{
+			for (int index = leaf; index >= 0;)
+			{
+				GazeBvhNode& node = nodes_[index];
+				Fove_Vec3 lo, hi;
+				if (node.left < 0)
+				{
+					lo = primitives_[node.start].bmin;
+					hi = primitives_[node.start].bmax;
+					for (int i = node.start + 1; i < node.start + node.count; ++i)
+					{
+						growAabb(lo, hi, primitives_[i].bmin);
+						growAabb(lo, hi, primitives_[i].bmax);
+					}
+				}
+				else
+				{
+					lo = nodes_[node.left].bmin;
+					hi = nodes_[node.left].bmax;
+					growAabb(lo, hi, nodes_[node.right].bmin);
+					growAabb(lo, hi, nodes_[node.right].bmax);
+				}
+				if (lo.x == node.bmin.x && lo.y == node.bmin.y && lo.z == node.bmin.z
+					&& hi.x == node.bmax.x && hi.y == node.bmax.y && hi.z == node.bmax.z)
+					break; // ancestors cannot change either
+				areaDrift_ += max(0.0f, aabbArea(lo, hi) - aabbArea(node.bmin, node.bmax));
+				node.bmin = lo;
+				node.bmax = hi;
+				index = node.parent;
+			}
+		}
+		dirtyLeaves_.clear();
+
+		if (areaAtBuild_ > 0 && areaDrift_ > 0.5f * areaAtBuild_)
+			rebuildTree();
+	}
+
+	// Primitive and centroid bounds of [start, start + count)
+	void rangeBounds(const int start, const int count, Fove_Vec3& lo, Fove_Vec3& hi, Fove_Vec3& centroidLo, Fove_Vec3& centroidHi) const
+	{
+		lo = primitives_[start].bmin;
+		hi = primitives_[start].bmax;
+		centroidLo = centroidHi = primitives_[start].centroid;
+		for (int i = start + 1; i < start + count; ++i)
+		{
+			growAabb(lo, hi, primitives_[i].bmin);
+			growAabb(lo, hi, primitives_[i].bmax);
+			growAabb(centroidLo, centroidHi, primitives_[i].centroid);
+		}
+	}
+
+	// Binned SAH split of [start, start + count): picks the bin boundary on the
+	// widest centroid axis minimizing the surface-area cost, then partitions the
+	// primitives around it in place. Returns the partition point, or -1 when the
+	// centroids are degenerate or every primitive lands on one side (the caller
+	// then falls back to the centroid median).
+	int splitSah(const int start, const int count, const Fove_Vec3& centroidLo, const Fove_Vec3& centroidHi)
+	{
+		constexpr int binCount = 16;
+		const Fove_Vec3 extent = vecSub(centroidHi, centroidLo);
+		const int axis = extent.x > extent.y ? (extent.x > extent.z ? 0 : 2) : (extent.y > extent.z ? 1 : 2);
+		const float axisLo = axis == 0 ? centroidLo.x : axis == 1 ? centroidLo.y : centroidLo.z;
+		const float axisExtent = axis == 0 ? extent.x : axis == 1 ? extent.y : extent.z;
+		if (!(axisExtent > 0))
+			return -1;
+		const float scale = binCount / axisExtent;
+		const auto binOf = [axis, axisLo, scale](const GazePrimitive& prim) {
+			const float centroid = axis == 0 ? prim.centroid.x : axis == 1 ? prim.centroid.y : prim.centroid.z;
+			return min(binCount - 1, static_cast<int>((centroid - axisLo) * scale));
+		};
+
+		int binCounts[binCount] = {};
+		Fove_Vec3 binLo[binCount];
+		Fove_Vec3 binHi[binCount];
+		for (int bin = 0; bin < binCount; ++bin)
+		{
+			binLo[bin] = {numeric_limits<float>::max(), numeric_limits<float>::max(), numeric_limits<float>::max()};
+			binHi[bin] = {-numeric_limits<float>::max(), -numeric_limits<float>::max(), -numeric_limits<float>::max()};
+		}
+		for (int i = start; i < start + count; ++i)
+		{
+			const int bin = binOf(primitives_[i]);
+			++binCounts[bin];
+			growAabb(binLo[bin], binHi[bin], primitives_[i].bmin);
+			growAabb(binLo[bin], binHi[bin], primitives_[i].bmax);
+		}
+
+		// Prefix sweep: area and count of the left side of a split after each bin
+		float leftArea[binCount - 1];
+		int leftCount[binCount - 1];
+		{
+			Fove_Vec3 lo = binLo[0], hi = binHi[0];
+			int n = 0;
+			for (int bin = 0; bin < binCount - 1; ++bin)
+			{
+				if (binCounts[bin] > 0)
+				{
+					growAabb(lo, hi, binLo[bin]);
+					growAabb(lo, hi, binHi[bin]);
+				}
+				n += binCounts[bin];
+				leftArea[bin] = n > 0 ? aabbArea(lo, hi) : 0;
+				leftCount[bin] = n;
+			}
+		}
+
+		// Suffix sweep picks the boundary minimizing area(L)*n(L) + area(R)*n(R)
+		float bestCost = numeric_limits<float>::max();
+		int bestSplit = -1;
+		{
+			Fove_Vec3 lo = binLo[binCount - 1], hi = binHi[binCount - 1];
+			int n = 0;
+			for (int bin = binCount - 1; bin > 0; --bin)
+			{
+				if (binCounts[bin] > 0)
+				{
+					growAabb(lo, hi, binLo[bin]);
+					growAabb(lo, hi, binHi[bin]);
+				}
+				n += binCounts[bin];
+				if (leftCount[bin - 1] == 0 || n == 0)
+					continue;
+				const float cost = leftArea[bin - 1] * leftCount[bin - 1] + aabbArea(lo, hi) * n;
+				if (cost < bestCost)
+				{
+					bestCost = cost;
+					bestSplit = bin;
+				}
+			}
+		}
+		if (bestSplit < 0)
+			return -1;
+
+		const auto mid = partition(primitives_.begin() + start, primitives_.begin() + start + count,
+								   [&binOf, bestSplit](const GazePrimitive& prim) { return binOf(prim) < bestSplit; });
+		const int midIndex = static_cast<int>(mid - primitives_.begin());
+		return midIndex > start && midIndex < start + count ? midIndex : -1;
+	}
+
+	// Recursive binned-SAH build over [start, start + count) into `nodes`, with
+	// subtree-local indices so parallel subtree builds can run into private
+	// vectors; degenerate splits fall back to the centroid median
+	int buildNode(std::vector<GazeBvhNode>& nodes, const int start, const int count)
+	{
+		const int nodeIndex = static_cast<int>(nodes.size());
+		nodes.push_back(GazeBvhNode{});
+
+		Fove_Vec3 lo, hi, centroidLo, centroidHi;
+		rangeBounds(start, count, lo, hi, centroidLo, centroidHi);
+		nodes[nodeIndex].bmin = lo;
+		nodes[nodeIndex].bmax = hi;
+
+		if (count <= 4)
+		{
+			nodes[nodeIndex].start = start;
+			nodes[nodeIndex].count = count;
+			return nodeIndex;
+		}
+
+		int mid = splitSah(start, count, centroidLo, centroidHi);
+		if (mid < 0)
+		{
+			// Split at the centroid median of the widest axis
+			const Fove_Vec3 extent = vecSub(centroidHi, centroidLo);
+			const int axis = extent.x > extent.y ? (extent.x > extent.z ? 0 : 2) : (extent.y > extent.z ? 1 : 2);
+			const auto centroidAxis = [axis](const GazePrimitive& prim) {
+				return axis == 0 ? prim.centroid.x : axis == 1 ? prim.centroid.y : prim.centroid.z;
+			};
+			mid = start + count / 2;
+			nth_element(primitives_.begin() + start, primitives_.begin() + mid, primitives_.begin() + start + count,
+						[&centroidAxis](const GazePrimitive& a, const GazePrimitive& b) { return centroidAxis(a) < centroidAxis(b); });
+		}
+
+		const int left = buildNode(nodes, start, mid - start);
+		const int right = buildNode(nodes, mid, start + count - mid);
+		nodes[nodeIndex].left = left;
+		nodes[nodeIndex].right = right;
+		return nodeIndex;
+	}
+
+	// Builds the tree over all primitives, task-parallel over subtrees: the top
+	// of the tree is split serially into roughly one range per core, the
+	// subtrees are built concurrently into private node vectors (each task owns
+	// a disjoint primitive range, so the in-place partitions cannot race), and
+	// the results are spliced into nodes_ with their indices rebased. A
+	// multi-million-triangle environment mesh thus builds in roughly the time
+	// of its largest subtree instead of stalling scene load for seconds.
+	void buildTreeParallel()
+	{
+		nodes_.reserve(2 * primitives_.size());
+
+		struct SubtreeTask
+		{
+			int nodeIndex; // the spine placeholder that becomes the subtree root
+			int start;
+			int count;
+			std::vector<GazeBvhNode> nodes;
+		};
+		std::vector<SubtreeTask> tasks;
+
+		// Serial split of the top of the tree down to per-core grains
+		const size_t threadCount = max<size_t>(1, thread::hardware_concurrency());
+		const int grain = max<int>(4096, static_cast<int>(primitives_.size() / (4 * threadCount)));
+		struct SpineRange
+		{
+			int nodeIndex;
+			int start;
+			int count;
+		};
+		nodes_.push_back(GazeBvhNode{});
+		std::vector<SpineRange> pending{{0, 0, static_cast<int>(primitives_.size())}};
+		while (!pending.empty())
+		{
+			const SpineRange range = pending.back();
+			pending.pop_back();
+			Fove_Vec3 lo, hi, centroidLo, centroidHi;
+			rangeBounds(range.start, range.count, lo, hi, centroidLo, centroidHi);
+			nodes_[range.nodeIndex].bmin = lo;
+			nodes_[range.nodeIndex].bmax = hi;
+			const int mid = range.count > grain ? splitSah(range.start, range.count, centroidLo, centroidHi) : -1;
+			if (mid < 0)
+			{
+				tasks.push_back(SubtreeTask{range.nodeIndex, range.start, range.count, {}});
+				continue;
+			}
+			const int left = static_cast<int>(nodes_.size());
+			nodes_.push_back(GazeBvhNode{});
+			const int right = static_cast<int>(nodes_.size());
+			nodes_.push_back(GazeBvhNode{});
+			nodes_[range.nodeIndex].left = left;
+			nodes_[range.nodeIndex].right = right;
+			pending.push_back(SpineRange{left, range.start, mid - range.start});
+			pending.push_back(SpineRange{right, mid, range.start + range.count - mid});
+		}
+
+		// Build the subtrees concurrently, pure native work
+		{
+			py::gil_scoped_release release;
+			std::atomic<size_t> nextTask{0};
+			const auto worker = [this, &tasks, &nextTask] {
+				for (size_t t; (t = nextTask.fetch_add(1)) < tasks.size();)
+				{
+					SubtreeTask& task = tasks[t];
+					task.nodes.reserve(2 * task.count);
+					buildNode(task.nodes, task.start, task.count);
+				}
+			};
+			const size_t workerCount = min(threadCount, tasks.size());
+			if (workerCount <= 1)
+			{
+				worker();
+			}
+			else
+			{
+				vector<thread> workers;
+				for (size_t t = 0; t < workerCount; ++t)
+					workers.emplace_back(worker);
+				for (thread& w : workers)
+					w.join();
+			}
+		}
+
+		// Splice: each subtree's local root replaces its spine placeholder, the
+		// rest is appended with child indices rebased
+		for (SubtreeTask& task : tasks)
+		{
+			const int offset = static_cast<int>(nodes_.size()) - 1; // local index 1 lands at offset + 1
+			GazeBvhNode root = task.nodes[0];
+			if (root.left >= 0)
+			{
+				root.left += offset;
+				root.right += offset;
+			}
+			nodes_[task.nodeIndex] = root;
+			for (size_t i = 1; i < task.nodes.size(); ++i)
+			{
+				GazeBvhNode node = task.nodes[i];
+				if (node.left >= 0)
+				{
+					node.left += offset;
+					node.right += offset;
+				}
+				nodes_.push_back(node);
+			}
+		}
+	}
+
+	void castRange(const float* rayData, int* idData, const size_t begin, const size_t end) const
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			const Fove_Vec3 origin = {rayData[6 * i], rayData[6 * i + 1], rayData[6 * i + 2]};
+			const Fove_Vec3 direction = {rayData[6 * i + 3], rayData[6 * i + 4], rayData[6 * i + 5]};
+			idData[i] = castRay(origin, direction);
+		}
+	}
+
+	int castRay(const Fove_Vec3& origin, const Fove_Vec3& direction) const
+	{
+		float t = 0;
+		return castRay(origin, direction, t);
+	}
+
+	// As above, also reporting the hit distance along the (unnormalized) direction
+	int castRay(const Fove_Vec3& origin, const Fove_Vec3& direction, float& tOut) const
+	{
+		if (nodes_.empty())
+			return fove_ObjectIdInvalid;
+
+		const Fove_Vec3 invDir = {safeInv(direction.x), safeInv(direction.y), safeInv(direction.z)};
+		float tBest = numeric_limits<float>::max();
+		int idBest = fove_ObjectIdInvalid;
+
+		int stack[64];
+		int stackSize = 0;
+		stack[stackSize++] = 0;
+		while (stackSize > 0)
+		{
+			const GazeBvhNode& node = nodes_[stack[--stackSize]];
+			if (!rayHitsAabb(origin, invDir, node.bmin, node.bmax, tBest))
+				continue;
+			if (node.left < 0)
+			{
+				// Leaves are sorted by collider type at build time and the
+				// geometry de-interleaved per type, so each homogeneous run is
+				// one tight loop without a per-primitive type switch
+				const int rangeEnd = node.start + node.count;
+				for (int i = node.start; i < rangeEnd;)
+				{
+					const Fove_ColliderType kind = primitives_[i].kind;
+					int runEnd = i + 1;
+					while (runEnd < rangeEnd && primitives_[runEnd].kind == kind)
+						++runEnd;
+					switch (kind)
+					{
+					case Fove_ColliderType::Cube:
+						intersectCubeRun(soaIndex_[i], runEnd - i, origin, direction, tBest, idBest);
+						break;
+					case Fove_ColliderType::Sphere:
+						intersectSphereRun(soaIndex_[i], runEnd - i, origin, direction, tBest, idBest);
+						break;
+					case Fove_ColliderType::Mesh:
+						intersectTriRun(soaIndex_[i], runEnd - i, origin, direction, tBest, idBest);
+						break;
+					}
+					i = runEnd;
+				}
+			}
+			else if (stackSize + 2 <= 64)
+			{
+				stack[stackSize++] = node.left;
+				stack[stackSize++] = node.right;
+			}
+		}
+		tOut = tBest;
+		return idBest;
+	}
+
+	// De-interleaves the tagged primitives into the structure-of-arrays
+	// intersection storage. Leaves were just sorted by type, so one leaf's
+	// primitives of a given type are contiguous in that type's arrays too, and
+	// the geometry stays in object-local space: pose refits only move the
+	// transforms, never these arrays. Triangle edges are precomputed here
+	// rather than per intersection.
+	void buildSoA()
+	{
+		soa_ = ColliderSoA{};
+		soaIndex_.assign(primitives_.size(), 0);
+		for (size_t i = 0; i < primitives_.size(); ++i)
+		{
+			const GazePrimitive& prim = primitives_[i];
+			switch (prim.kind)
+			{
+			case Fove_ColliderType::Cube:
+				soaIndex_[i] = static_cast<int>(soa_.cubeId.size());
+				soa_.cubeCx.push_back(prim.a.x);
+				soa_.cubeCy.push_back(prim.a.y);
+				soa_.cubeCz.push_back(prim.a.z);
+				soa_.cubeHx.push_back(prim.b.x);
+				soa_.cubeHy.push_back(prim.b.y);
+				soa_.cubeHz.push_back(prim.b.z);
+				soa_.cubeXform.push_back(prim.xformIndex);
+				soa_.cubeId.push_back(prim.objectId);
+				break;
+			case Fove_ColliderType::Sphere:
+				soaIndex_[i] = static_cast<int>(soa_.sphereId.size());
+				soa_.sphereCx.push_back(prim.a.x);
+				soa_.sphereCy.push_back(prim.a.y);
+				soa_.sphereCz.push_back(prim.a.z);
+				soa_.sphereR.push_back(prim.b.x);
+				soa_.sphereXform.push_back(prim.xformIndex);
+				soa_.sphereId.push_back(prim.objectId);
+				break;
+			case Fove_ColliderType::Mesh:
+			{
+				soaIndex_[i] = static_cast<int>(soa_.triId.size());
+				const Fove_Vec3 edge1 = vecSub(prim.b, prim.a);
+				const Fove_Vec3 edge2 = vecSub(prim.c, prim.a);
+				soa_.triAx.push_back(prim.a.x);
+				soa_.triAy.push_back(prim.a.y);
+				soa_.triAz.push_back(prim.a.z);
+				soa_.triE1x.push_back(edge1.x);
+				soa_.triE1y.push_back(edge1.y);
+				soa_.triE1z.push_back(edge1.z);
+				soa_.triE2x.push_back(edge2.x);
+				soa_.triE2y.push_back(edge2.y);
+				soa_.triE2z.push_back(edge2.z);
+				soa_.triXform.push_back(prim.xformIndex);
+				soa_.triId.push_back(prim.objectId);
+				break;
+			}
+			}
+		}
+	}
+
+	// The run kernels below intersect [first, first + n) of one type's arrays
+	// and update the running closest hit. All parameters are world space; the
+	// ray is taken into object-local space per primitive, and since the
+	// transform is affine the local ray parameter equals the world one, so no
+	// back-transform is needed.
+
+	void intersectCubeRun(const int first, const int n, const Fove_Vec3& origin, const Fove_Vec3& direction, float& tBest, int& idBest) const
+	{
+		for (int i = first; i < first + n; ++i)
+		{
+			const GazeObjectXform& xform = xforms_[soa_.cubeXform[i]];
+			const Fove_Quaternion invRot = quatConjugate(xform.rotation);
+			const Fove_Vec3 localOrigin = vecMul(quatRotate(invRot, vecSub(origin, xform.position)), xform.invScale);
+			const Fove_Vec3 localDir = vecMul(quatRotate(invRot, direction), xform.invScale);
+			const Fove_Vec3 invDir = {safeInv(localDir.x), safeInv(localDir.y), safeInv(localDir.z)};
+			float t0 = 0, t1 = numeric_limits<float>::max();
+			const float ox[3] = {localOrigin.x, localOrigin.y, localOrigin.z};
+			const float ix[3] = {invDir.x, invDir.y, invDir.z};
+			const float ce[3] = {soa_.cubeCx[i], soa_.cubeCy[i], soa_.cubeCz[i]};
+			const float he[3] = {soa_.cubeHx[i], soa_.cubeHy[i], soa_.cubeHz[i]};
+			bool miss = false;
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				float tA = (ce[axis] - he[axis] - ox[axis]) * ix[axis];
+				float tB = (ce[axis] + he[axis] - ox[axis]) * ix[axis];
+				if (tA > tB)
+					swap(tA, tB);
+				t0 = tA > t0 ? tA : t0;
+				t1 = tB < t1 ? tB : t1;
+				miss = miss || t0 > t1;
+			}
+			if (!miss && t0 < tBest)
+			{
+				tBest = t0;
+				idBest = soa_.cubeId[i];
+			}
+		}
+	}
+
+	void intersectSphereRun(const int first, const int n, const Fove_Vec3& origin, const Fove_Vec3& direction, float& tBest, int& idBest) const
+	{
+		for (int i = first; i < first + n; ++i)
+		{
+			const GazeObjectXform& xform = xforms_[soa_.sphereXform[i]];
+			const Fove_Quaternion invRot = quatConjugate(xform.rotation);
+			const Fove_Vec3 localOrigin = vecMul(quatRotate(invRot, vecSub(origin, xform.position)), xform.invScale);
+			const Fove_Vec3 localDir = vecMul(quatRotate(invRot, direction), xform.invScale);
+			const Fove_Vec3 oc = vecSub(localOrigin, Fove_Vec3{soa_.sphereCx[i], soa_.sphereCy[i], soa_.sphereCz[i]});
+			const float a = vecDot(localDir, localDir);
+			if (a == 0)
+				continue;
+			const float halfB = vecDot(oc, localDir);
+			const float c = vecDot(oc, oc) - soa_.sphereR[i] * soa_.sphereR[i];
+			const float disc = halfB * halfB - a * c;
+			if (disc < 0)
+				continue;
+			const float sqrtDisc = sqrt(disc);
+			float t = (-halfB - sqrtDisc) / a;
+			if (t < 0)
+				t = (-halfB + sqrtDisc) / a;
+			if (t >= 0 && t < tBest)
+			{
+				tBest = t;
+				idBest = soa_.sphereId[i];
+			}
+		}
+	}
+
+	void intersectTriRun(const int first, const int n, const Fove_Vec3& origin, const Fove_Vec3& direction, float& tBest, int& idBest) const
+	{
+		for (int i = first; i < first + n; ++i)
+		{
+			const GazeObjectXform& xform = xforms_[soa_.triXform[i]];
+			const Fove_Quaternion invRot = quatConjugate(xform.rotation);
+			const Fove_Vec3 localOrigin = vecMul(quatRotate(invRot, vecSub(origin, xform.position)), xform.invScale);
+			const Fove_Vec3 localDir = vecMul(quatRotate(invRot, direction), xform.invScale);
+
+			// Moller-Trumbore, double sided, over the precomputed edges
+			const Fove_Vec3 a = {soa_.triAx[i], soa_.triAy[i], soa_.triAz[i]};
+			const Fove_Vec3 edge1 = {soa_.triE1x[i], soa_.triE1y[i], soa_.triE1z[i]};
+			const Fove_Vec3 edge2 = {soa_.triE2x[i], soa_.triE2y[i], soa_.triE2z[i]};
+			const Fove_Vec3 pvec = vecCross(localDir, edge2);
+			const float det = vecDot(edge1, pvec);
+			if (fabs(det) < 1e-12f)
+				continue;
+			const float invDet = 1 / det;
+			const Fove_Vec3 tvec = vecSub(localOrigin, a);
+			const float u = vecDot(tvec, pvec) * invDet;
+			if (u < 0 || u > 1)
+				continue;
+			const Fove_Vec3 qvec = vecCross(tvec, edge1);
+			const float v = vecDot(localDir, qvec) * invDet;
+			if (v < 0 || u + v > 1)
+				continue;
+			const float t = vecDot(edge2, qvec) * invDet;
+			if (t >= 0 && t < tBest)
+			{
+				tBest = t;
+				idBest = soa_.triId[i];
+			}
+		}
+	}
+
+	std::vector<GazeObjectXform> xforms_;
+	std::vector<GazePrimitive> primitives_;
+	std::vector<GazeBvhNode> nodes_;
+	std::unordered_map<int, int> xformOfObject_;
+	std::vector<std::vector<int>> primsOfXform_; // per xform, its primitive indices in post-build order
+	std::vector<int> leafOfPrimitive_;
+	std::vector<int> dirtyLeaves_;
+	ColliderSoA soa_;
+	std::vector<int> soaIndex_; // primitive index -> its slot in its type's arrays
+	float areaAtBuild_ = 0; // total node surface area right after the last (re)build
+	float areaDrift_ = 0;   // area growth accumulated by refits since then
+	bool built_ = false;
+
+	// Casts take this shared, pose refits and (re)builds exclusive, so the
+	// pump thread's per-frame cast never races a render loop moving objects
+	mutable std::shared_mutex mutex_;
+};
+
+// Shared collider meshes: one upload, many instances. Registering N identical
+// objects used to mean N Python-side copies of the same mesh; here the mesh
+// data is uploaded once into native storage and referenced by handle from any
+// number of registrations (see create_collider_mesh and
+// Headset_registerGazableObjectInstances in bind_CAPIs).
+struct SharedColliderMesh
+{
+	std::vector<float> vertices;       // x, y, z per vertex
+	std::vector<unsigned int> indices; // empty = plain triangle list
+};
+
+std::mutex sharedMeshMutex;
+std::unordered_map<int, std::shared_ptr<SharedColliderMesh>> sharedMeshes;
+int nextSharedMeshHandle = 1;
+
+// Looks up a shared mesh; throws on an unknown or released handle
+std::shared_ptr<SharedColliderMesh> sharedMeshByHandle(const int handle)
+{
+	std::lock_guard<std::mutex> lock(sharedMeshMutex);
+	const auto found = sharedMeshes.find(handle);
+	if (found == sharedMeshes.end())
+		throw std::runtime_error("Unknown collider mesh handle " + std::to_string(handle));
+	return found->second;
+}
+
+// Fills a Fove_ColliderMesh aliasing the shared storage
+Fove_ColliderMesh colliderMeshOf(const SharedColliderMesh& mesh)
+{
+	Fove_ColliderMesh out = {};
+	out.vertices = const_cast<float*>(mesh.vertices.data());
+	out.vertexCount = static_cast<unsigned int>(mesh.vertices.size() / 3);
+	out.indices = mesh.indices.empty() ? nullptr : const_cast<unsigned int*>(mesh.indices.data());
+	out.triangleCount = static_cast<unsigned int>(mesh.indices.empty() ? mesh.vertices.size() / 9 : mesh.indices.size() / 3);
+	return out;
+}
+
+// The scene the pump intersects each frame's combined gaze ray against, when
+// one is attached (GazeCastScene.attachToPump); weak so that dropping the
+// last Python reference detaches the scene
+std::mutex pumpGazeSceneMutex;
+std::weak_ptr<GazeCastScene> pumpGazeScene;
+
+void fillGazeObjectHit(PumpSnapshot& rec)
+{
+	rec.gazedObjectId = fove_ObjectIdInvalid;
+	rec.gazedObjectPoint = {};
+	std::shared_ptr<GazeCastScene> scene;
+	{
+		std::lock_guard<std::mutex> lock(pumpGazeSceneMutex);
+		scene = pumpGazeScene.lock();
+	}
+	if (!scene || rec.errCombinedRay != static_cast<int16_t>(Fove_ErrorCode::None))
+		return;
+	rec.gazedObjectId = scene->castOneHit(rec.combinedRay.origin, rec.combinedRay.direction, rec.gazedObjectPoint);
+}
+
+} // namespace
+
+void defstruct_GazeCastScene(py::module& m)
+{
+	py::class_<GazeCastScene, std::shared_ptr<GazeCastScene>>(m, "GazeCastScene",
+							  R"(Local BVH-accelerated gaze raycast engine
+
+Re-intersects gaze rays against registered gazable objects without going through
+the runtime, so that recorded sessions can be replayed offline at batch speed.
+Build the scene from the same `GazableObject` instances passed to
+`Headset_registerGazableObject`, then cast recorded rays in bulk:
+
+    scene = capi.GazeCastScene()
+    scene.add(obj)
+    ids = scene.cast(rays)  # rays: float array of shape (N, 6)
+
+Collider data is copied on `add`; the source objects need not be kept alive.
+The BVH is built lazily on the first cast, after which no more objects can be
+added. Moving objects are handled by `updatePose`/`updatePoses`, which refit
+the tree incrementally in cost proportional to the moved objects (with an
+automatic full rebuild once refits have degraded the tree quality too far).
+
+A scene can also be attached to the running frame pump (`attachToPump`): each
+snapshot's combined gaze ray is then intersected against it locally and the
+closest hit stored in the `gazedObjectId`/`gazedObjectPoint` snapshot fields.)")
+		.def(py::init<>())
+		.def("add", &GazeCastScene::add, py::arg("object"),
+			 R"(Adds a gazable object to the scene
+
+\param object The object whose colliders (cube, sphere or mesh) to register; copied)")
+		.def("build", &GazeCastScene::build,
+			 "Builds the BVH explicitly; otherwise built lazily by the first cast")
+		.def("castOne", &GazeCastScene::castOne, py::arg("origin"), py::arg("direction"),
+			 R"(Casts a single gaze ray against the scene
+
+\param origin The world-space ray origin
+\param direction The world-space ray direction (need not be normalized)
+\return The id of the closest hit object, or `ObjectIdInvalid` if nothing is hit)")
+		.def("updatePose", &GazeCastScene::updatePose, py::arg("id"), py::arg("pose"),
+			 R"(Moves a registered object to a new pose and refits the BVH incrementally
+
+Only the object's own primitives are retransformed and only their leaf-to-root
+node chains recomputed, so updating a few movers in a large scene is cheap.
+Prefer `updatePoses` when moving many objects per frame.
+
+\param id The object id passed in the `GazableObject` given to `add`
+\param pose The new `ObjectPose` (scale, rotation, position; velocity is ignored))")
+		.def("updatePoses", &GazeCastScene::updatePoses, py::arg("ids"), py::arg("poses"),
+			 R"(Updates the poses of a batch of registered objects in one call
+
+The local counterpart of `Headset_updateGazableObjects`, taking the identical
+array layout; all moved leaves share a single bottom-up refit pass.
+
+\param ids An array of shape [N] with the ids of the objects to move
+\param poses An array of shape [N, 13] of float32 laid out like `ObjectPose`: scale (x, y, z), rotation (x, y, z, w), position (x, y, z), velocity (x, y, z))")
+		.def("cast", &GazeCastScene::cast, py::arg("rays"),
+			 R"(Casts a batch of gaze rays against the scene, multithreaded
+
+\param rays A float array of shape `(N, 6)`: origin xyz followed by direction xyz per row
+\return An int array of length `N` with the closest hit object id per ray, or `ObjectIdInvalid`)")
+		.def(
+			"attachToPump", [](const std::shared_ptr<GazeCastScene>& self) {
+				std::lock_guard<std::mutex> lock(pumpGazeSceneMutex);
+				pumpGazeScene = self;
+			},
+			R"(Makes this scene the live gaze-object channel of the frame pump
+
+While attached, every pump (and recorder) snapshot's combined gaze ray is cast
+against this scene natively -- a few microseconds per frame -- and the closest
+hit written to the `gazedObjectId` and `gazedObjectPoint` snapshot fields.
+Unlike `Headset_getGazedObjectId` this needs no service-side raycast, so the
+scene can be far richer than what is pushed through
+`Headset_registerGazableObject`. One scene is attached at a time; attaching
+replaces the previous one. Poses may keep being updated from the render loop:
+casts and refits synchronize internally.)")
+		.def(
+			"detachFromPump", [](const std::shared_ptr<GazeCastScene>& self) {
+				std::lock_guard<std::mutex> lock(pumpGazeSceneMutex);
+				if (pumpGazeScene.lock() == self)
+					pumpGazeScene.reset();
+			},
+			"Detaches this scene from the pump's gaze-object channel, if it is the attached one")
+		.def_property_readonly("primitiveCount", &GazeCastScene::primitiveCount,
+							   "Number of BVH primitives (mesh colliders count one per triangle)");
+}
+#endif // FOVE_FEATURE_GAZABLE_OBJECTS
+
+#if FOVE_HAS_FEATURE(FOVE_FEATURE_COMPOSITOR)
+////////////////////////////////////////////////////////////////
+// Compositor submit fast path
+
+namespace
+{
+
+// Backing storage for one eye's texture struct; which member is live is
+// determined by the graphicsAPI in the common Fove_CompositorTexture prefix
+union SubmitTextureStorage
+{
+	Fove_CompositorTexture base;
+	Fove_DX11Texture dx11;
+	Fove_GLTexture gl;
+	Fove_MetalTexture metal;
+};
+
+// Caches the Fove_CompositorLayerSubmitInfo struct tree once so that the
+// per-frame submit only rewrites the pose (and optionally the bounds) in place,
+// instead of rebuilding ~8 Python objects every frame.
+class SubmitContext
+{
+public:
+	explicit SubmitContext(const int layerId)
+	{
+		info_ = {};
+		info_.layerId = layerId;
+	}
+
+	// The submit info holds pointers into this object; forbid relocation
+	SubmitContext(const SubmitContext&) = delete;
+	SubmitContext& operator=(const SubmitContext&) = delete;
+
+	void setTextures(py::object left, py::object right)
+	{
+		storeTexture(leftTexture_, leftValid_, std::move(left));
+		storeTexture(rightTexture_, rightValid_, std::move(right));
+		info_.left.texInfo = leftValid_ ? &leftTexture_.base : nullptr;
+		info_.right.texInfo = rightValid_ ? &rightTexture_.base : nullptr;
+	}
+
+	// Swapchain fast path: rewrites the cached GL texture structs in place from
+	// raw texture ids, so per-frame buffer cycling costs two int casts instead of
+	// Python-side texture object traffic. Id 0 (never returned by glGenTextures)
+	// means "do not submit this eye".
+	void setTextureIds(const uint32_t left, const uint32_t right)
+	{
+		leftTexture_.gl = makeGLTexture(left);
+		rightTexture_.gl = makeGLTexture(right);
+		leftValid_ = left != 0;
+		rightValid_ = right != 0;
+		info_.left.texInfo = leftValid_ ? &leftTexture_.base : nullptr;
+		info_.right.texInfo = rightValid_ ? &rightTexture_.base : nullptr;
+	}
+
+	void setBounds(const Fove_TextureBounds& left, const Fove_TextureBounds& right)
+	{
+		info_.left.bounds = left;
+		info_.right.bounds = right;
+	}
+
+	Fove_ErrorCode submit(Compositor& compositor, const Fove_Pose& pose)
+	{
+		if (!leftValid_ && !rightValid_)
+			return Fove_ErrorCode::API_InvalidArgument;
+		info_.pose = pose;
+		return pacingTimedSubmit([&] { return FOVE_PERF(fove_Compositor_submit(compositor, &info_, 1)); });
+	}
+
+	int layerId() const { return info_.layerId; }
+	void setLayerId(const int layerId) { info_.layerId = layerId; }
+
+private:
+	static Fove_GLTexture makeGLTexture(const uint32_t textureId)
+	{
+		Fove_GLTexture texture = {};
+		texture.parent.graphicsAPI = Fove_GraphicsAPI::OpenGL;
+		texture.textureId = textureId;
+		return texture;
+	}
+
+	static void storeTexture(SubmitTextureStorage& storage, bool& valid, py::object texture)
+	{
+		if (texture.is_none())
+		{
+			valid = false;
+			return;
+		}
+		if (py::isinstance<Fove_DX11Texture>(texture))
+			storage.dx11 = texture.cast<Fove_DX11Texture&>();
+		else if (py::isinstance<Fove_GLTexture>(texture))
+			storage.gl = texture.cast<Fove_GLTexture&>();
+		else if (py::isinstance<Fove_MetalTexture>(texture))
+			storage.metal = texture.cast<Fove_MetalTexture&>();
+		else if (py::isinstance<py::int_>(texture)) // a raw OpenGL texture id, as returned by glGenTextures
+			storage.gl = makeGLTexture(texture.cast<uint32_t>());
+		else if (py::hasattr(texture, "textureId")) // duck-typed GL wrapper (e.g. a CUDA-GL interop object exposing its GL side)
+			storage.gl = makeGLTexture(texture.attr("textureId").cast<uint32_t>());
+		else if (py::hasattr(texture, "__cuda_array_interface__") || py::hasattr(texture, "__dlpack__"))
+			throw std::runtime_error(
+				"A bare CUDA array cannot be submitted: the compositor consumes GL/DX11/Metal handles only. "
+				"Register a GL texture with your CUDA interop layer, render into it, and pass the GL texture "
+				"id (an int, or a wrapper exposing `.textureId`) instead.");
+		else
+			throw std::runtime_error("Expected a DX11Texture, GLTexture, MetalTexture, GL texture id or None");
+		valid = true;
+	}
+
+	Fove_CompositorLayerSubmitInfo info_;
+	SubmitTextureStorage leftTexture_ = {};
+	SubmitTextureStorage rightTexture_ = {};
+	bool leftValid_ = false;
+	bool rightValid_ = false;
+};
+
+} // namespace
+
+void defstruct_SubmitContext(py::module& m)
+{
+	py::class_<SubmitContext>(m, "SubmitContext",
+							  R"(Caches the native compositor submit structs between frames
+
+Building the `CompositorLayerSubmitInfo` tree in Python allocates ~8 objects per
+submit; a `SubmitContext` builds the native tree once and the per-frame call
+only rewrites the pose in place:
+
+    ctx = capi.SubmitContext(layer.layerId)
+    ctx.setTextures(texLeft, texRight)
+    ctx.setBounds(boundsLeft, boundsRight)
+    # per frame:
+    err = ctx.submit(compositor, pose)
+
+Texture structs are copied into the context; re-call `setTextures` (or, for GL
+swapchains, the cheaper `setTextureIds`) if the underlying GPU texture handle
+changes.)")
+		.def(py::init<int>(), py::arg("layerId") = 0)
+		.def("setTextures", &SubmitContext::setTextures, py::arg("left"), py::arg("right"),
+			 R"(Sets (copies) the per-eye texture structs used by subsequent submits
+
+OpenGL textures may be passed as a bare texture id (int) or as any object
+exposing an integer `textureId` attribute, such as the GL side of a CUDA-GL
+interop wrapper; the native `GLTexture` struct is built here, once, and reused
+by every subsequent submit.
+
+\param left The `DX11Texture`/`GLTexture`/`MetalTexture`, a GL texture id, or `None` to submit only the right eye
+\param right The texture for the right eye, in the same forms, or `None` to submit only the left eye)")
+		.def("setTextureIds", &SubmitContext::setTextureIds, py::arg("left"), py::arg("right"),
+			 R"(Rewrites the cached per-eye OpenGL texture ids in place
+
+The swapchain fast path: cycling double/triple-buffered render targets per
+frame costs two integer casts here, with no Python texture objects involved.
+
+\param left The left eye's GL texture id, or 0 to submit only the right eye
+\param right The right eye's GL texture id, or 0 to submit only the left eye)")
+		.def("setBounds", &SubmitContext::setBounds, py::arg("left"), py::arg("right"),
+			 "Sets the per-eye `TextureBounds` used by subsequent submits")
+		.def("submit", &SubmitContext::submit, py::arg("compositor"), py::arg("pose"),
+			 R"(Submits the cached layer with the given pose
+
+\param compositor The compositor to submit to
+\param pose The render pose for this frame, usually from `Compositor_waitForRenderPose`
+\return #Fove_ErrorCode_None if the submission succeeded\n
+        #Fove_ErrorCode_API_InvalidArgument if no texture has been set\n
+        Otherwise, the error returned by `Compositor_submit`
+)")
+		.def_property("layerId", &SubmitContext::layerId, &SubmitContext::setLayerId,
+					  "The layer ID as fetched from `CompositorLayer`");
+}
+#endif // FOVE_FEATURE_COMPOSITOR
+
+////////////////////////////////////////////////////////////////
+// Shared-memory image streaming
+
+// Publishes fetched eye images into a named POSIX shared-memory ring so that
+// sibling processes (e.g. an ML inference worker) read them without the
+// numpy-copy/pickle/socket path. Each slot is seqlock-stamped: the writer bumps
+// the slot sequence to odd before copying and to even after, and readers retry
+// if the sequence changed (or is odd) across their read.
+//
+// Windows has no shm_open; the classes are POSIX-only for now, matching the
+// mmap-based Recorder.load fast path.
+#ifndef _WIN32
+
+namespace
+{
+
+constexpr uint32_t imageStreamMagic = 0x564F4649; // "IFOV" little-endian
+constexpr uint32_t imageStreamVersion = 1;
+
+struct ImageStreamHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t slotCount;
+	uint32_t slotSize; // image payload capacity per slot, bytes
+	std::atomic<uint64_t> latestFrame; // frame counter, 0 = nothing published; slot = (frame - 1) % slotCount
+};
+
+struct ImageSlotHeader
+{
+	std::atomic<uint64_t> seq; // seqlock: odd while the writer is copying
+	uint64_t timestamp;        // Fove_BitmapImage timestamp, microseconds
+	uint32_t dataSize;         // bytes of BMP data actually present
+	uint32_t pad;
+};
+
+// Keeps slots cacheline-aligned so writer stamping does not false-share with neighbours
+constexpr size_t imageStreamAlign = 64;
+
+inline size_t imageSlotStride(const uint32_t slotSize)
+{
+	const size_t raw = sizeof(ImageSlotHeader) + slotSize;
+	return (raw + imageStreamAlign - 1) / imageStreamAlign * imageStreamAlign;
+}
+
+inline size_t imageStreamTotalSize(const uint32_t slotCount, const uint32_t slotSize)
+{
+	const size_t headerSize = (sizeof(ImageStreamHeader) + imageStreamAlign - 1) / imageStreamAlign * imageStreamAlign;
+	return headerSize + static_cast<size_t>(slotCount) * imageSlotStride(slotSize);
+}
+
+inline char* imageSlotBase(ImageStreamHeader* header, const uint32_t slot)
+{
+	const size_t headerSize = (sizeof(ImageStreamHeader) + imageStreamAlign - 1) / imageStreamAlign * imageStreamAlign;
+	return reinterpret_cast<char*>(header) + headerSize + slot * imageSlotStride(header->slotSize);
+}
+
+// Writer side: creates (or reuses) the named shared-memory ring and publishes images into it
+class ImageStream
+{
+public:
+	ImageStream(const std::string& name, const size_t slotSize, const size_t slotCount)
+	    : name_(name)
+	{
+		if (slotCount < 2)
+			throw std::runtime_error("ImageStream needs at least 2 slots so readers never race the active write");
+
+		const int fd = shm_open(name.c_str(), O_CREAT | O_RDWR, 0600);
+		if (fd < 0)
+			throw std::runtime_error("Failed to create shared memory segment: " + name);
+
+		const size_t total = imageStreamTotalSize(static_cast<uint32_t>(slotCount), static_cast<uint32_t>(slotSize));
+		if (ftruncate(fd, static_cast<off_t>(total)) != 0)
+		{
+			::close(fd);
+			shm_unlink(name.c_str());
+			throw std::runtime_error("Failed to size shared memory segment: " + name);
+		}
+
+		void* base = mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		::close(fd);
+		if (base == MAP_FAILED)
+		{
+			shm_unlink(name.c_str());
+			throw std::runtime_error("Failed to map shared memory segment: " + name);
+		}
+
+		mapSize_ = total;
+		header_ = static_cast<ImageStreamHeader*>(base);
+		header_->slotCount = static_cast<uint32_t>(slotCount);
+		header_->slotSize = static_cast<uint32_t>(slotSize);
+		header_->latestFrame.store(0, std::memory_order_relaxed);
+		for (uint32_t slot = 0; slot < header_->slotCount; ++slot)
+			reinterpret_cast<ImageSlotHeader*>(imageSlotBase(header_, slot))->seq.store(0, std::memory_order_relaxed);
+		header_->version = imageStreamVersion;
+		// The magic is written last so readers never see a half-initialized header
+		std::atomic_thread_fence(std::memory_order_release);
+		header_->magic = imageStreamMagic;
+	}
 
-			if (info.strides[0] != sizeof(unsigned int))
-				throw std::runtime_error("Row stride should be 1 unsigned int");
+	~ImageStream() { close(); }
 
-			if (info.shape[0] % 3 != 0)
-				throw std::runtime_error("Index buffer index count should be a multiple of 3 as it represent triangles");
+	ImageStream(const ImageStream&) = delete;
+	ImageStream& operator=(const ImageStream&) = delete;
 
-			return IndexBuffer{static_cast<unsigned int*>(info.ptr), static_cast<unsigned int>(info.shape[0] / 3)};
-		}));
-}
+	// Publishes one image into the next ring slot; returns the frame number it got
+	uint64_t publish(const Fove_BitmapImage& image)
+	{
+		if (!header_)
+			throw std::runtime_error("ImageStream is closed");
+		if (!image.image.data || image.image.length == 0)
+			throw std::runtime_error("Cannot publish an empty image");
+		if (image.image.length > header_->slotSize)
+			throw std::runtime_error("Image does not fit the stream slot size; recreate the stream with a larger slotSize");
+
+		const uint64_t frame = header_->latestFrame.load(std::memory_order_relaxed) + 1;
+		const uint32_t slot = static_cast<uint32_t>((frame - 1) % header_->slotCount);
+		ImageSlotHeader* slotHeader = reinterpret_cast<ImageSlotHeader*>(imageSlotBase(header_, slot));
+
+		const uint64_t seq = slotHeader->seq.load(std::memory_order_relaxed);
+		slotHeader->seq.store(seq + 1, std::memory_order_relaxed); // odd: write in progress
+		std::atomic_thread_fence(std::memory_order_release);
+		slotHeader->timestamp = image.timestamp;
+		slotHeader->dataSize = static_cast<uint32_t>(image.image.length);
+		memcpy(imageSlotBase(header_, slot) + sizeof(ImageSlotHeader), image.image.data, image.image.length);
+		slotHeader->seq.store(seq + 2, std::memory_order_release);
+
+		header_->latestFrame.store(frame, std::memory_order_release);
+		return frame;
+	}
 
-void defstruct_ColliderMesh(py::module& m)
-{
-	defstruct_VertexBuffer(m);
-	defstruct_IndexBuffer(m);
+	// Same as publish, but skips (returning 0) when the image timestamp has not
+	// advanced since the last publication — polled sources like the position
+	// camera have no wait/sync call, so the poll loop republishes stale frames
+	// without this check
+	uint64_t publishIfNew(const Fove_BitmapImage& image)
+	{
+		if (hasPublished_ && image.timestamp <= lastPublishedTimestamp_)
+			return 0;
+		const uint64_t frame = publish(image);
+		lastPublishedTimestamp_ = image.timestamp;
+		hasPublished_ = true;
+		return frame;
+	}
 
-	py::class_<Fove_ColliderMesh>(m, "ColliderMesh",
-								  R"(Define a mesh collider shape
+	// Unmaps and unlinks the segment; readers that already mapped it keep their mapping
+	void close()
+	{
+		if (!header_)
+			return;
+		munmap(header_, mapSize_);
+		header_ = nullptr;
+		shm_unlink(name_.c_str());
+	}
 
-A mesh collider can either be defined through a triangle list or through a vertex/index buffer set.
-If the index buffer pointer is null, then the vertex buffer is interpreted as a regular triangle list.
-)")
-		.def(py::init<>())
-		.def_property("vertexBuffer",
-					  [](Fove_ColliderMesh& self) -> const VertexBuffer {
-						  return VertexBuffer{self.vertices, self.vertexCount};
-					  },
-					  [](Fove_ColliderMesh& self, const VertexBuffer& value) {
-						  self.vertices = value.vertices;
-						  self.vertexCount = value.vertexCount;
-					  },
-					  R"(The vertices of the mesh.
-
-It contains the X, Y, Z positions of mesh vertices.
-Triangles are defined using "indices
-)")
-		.def_property("indexBuffer",
-					  [](Fove_ColliderMesh& self) -> const IndexBuffer {
-						  return IndexBuffer{self.indices, self.triangleCount};
-					  },
-					  [](Fove_ColliderMesh& self, const IndexBuffer& value) {
-						  self.indices = value.indices;
-						  self.triangleCount = value.triangleCount;
-					  },
-					  R"(The vertex indices defining the triangles of the mesh
-
-Triangles are listed one after the others (and not combined using a fan or strip algorithm).
-The number of elements must equal `3 x triangleCount`.
-
-Outward faces are defined to be specified counter-clockwise.
-Face-direction information is not currently used but may be in the future.
-
-If null, the vertices are interpreted as a simple triangle list.
-)")
-		.def_readwrite("boundingBox", &Fove_ColliderMesh::boundingBox, "If null the bounding box is re-calculated internally")
-		.def("__repr__", repr<Fove_ColliderMesh>, "Returns a string representation of the mesh collider.");
-}
-
-void defstruct_ObjectCollider(py::module& m)
-{
-	py::class_<Fove_ObjectCollider>(m, "ObjectCollider",
-									R"(Represents a colliding part of a gazable object
-Colliders are used to calculate intersection between gaze rays and gazable objects)")
-		.def(py::init<Fove_Vec3>(), py::arg_v("center", default_Vec3(), "Vec3()"))
-		.def_readwrite("center", &Fove_ObjectCollider::center, "The offset of the collider center collider raw shape")
-		.def_readonly("shapeType", &Fove_ObjectCollider::shapeType, "The shape type of the collider")
-		.def_property("cubeDefinition",
-					  [](Fove_ObjectCollider& self) -> const Fove_ColliderCube& {
-						  if (self.shapeType != Fove_ColliderType::Cube)
-							  throw std::runtime_error("Error the collider is not of cube type");
-
-						  return self.shapeDefinition.cube;
-					  },
-					  [](Fove_ObjectCollider& self, const Fove_ColliderCube& value) {
-						  self.shapeType = Fove_ColliderType::Cube;
-						  self.shapeDefinition.cube = value;
-					  },
-					  R"(Set the object collider as a cube collider)")
-		.def_property("sphereDefinition",
-					  [](Fove_ObjectCollider& self) -> const Fove_ColliderSphere& {
-						  if (self.shapeType != Fove_ColliderType::Sphere)
-							  throw std::runtime_error("Error the collider is not of sphere type");
-
-						  return self.shapeDefinition.sphere;
-					  },
-					  [](Fove_ObjectCollider& self, const Fove_ColliderSphere& value) {
-						  self.shapeType = Fove_ColliderType::Sphere;
-						  self.shapeDefinition.sphere = value;
-					  },
-					  R"(Set the object collider as a sphere collider)")
-		.def_property("meshDefinition",
-					  [](Fove_ObjectCollider& self) -> const Fove_ColliderMesh& {
-						  if (self.shapeType != Fove_ColliderType::Mesh)
-							  throw std::runtime_error("Error the collider is not of mesh type");
-
-						  return self.shapeDefinition.mesh;
-					  },
-					  [](Fove_ObjectCollider& self, const Fove_ColliderMesh& value) {
-						  self.shapeType = Fove_ColliderType::Mesh;
-						  self.shapeDefinition.mesh = value;
-					  },
-					  R"(Set the object collider as a mesh collider)")
-		.def("__repr__", repr<Fove_ObjectCollider>, "Returns a string representation of the object collider.");
-}
-
-struct ColliderArray
-{
-	std::vector<Fove_ObjectCollider> colliders;
-};
-
-void defstruct_ColliderArray(py::module& m)
-{
-	py::class_<ColliderArray>(m, "ColliderArray", py::buffer_protocol(),
-							  R"(Contains the triangle indices defining a mesh)")
-		.def(py::init<>())
-		.def("add", [](ColliderArray& colliderArray, const Fove_ObjectCollider& collider) {
-			colliderArray.colliders.push_back(collider);
-		});
-}
+	const std::string& name() const { return name_; }
+	size_t slotSize() const { return header_ ? header_->slotSize : 0; }
+	size_t slotCount() const { return header_ ? header_->slotCount : 0; }
+	uint64_t framesPublished() const { return header_ ? header_->latestFrame.load(std::memory_order_relaxed) : 0; }
+
+private:
+	std::string name_;
+	ImageStreamHeader* header_ = nullptr;
+	size_t mapSize_ = 0;
+	uint64_t lastPublishedTimestamp_ = 0;
+	bool hasPublished_ = false;
+};
 
-void defstruct_GazableObject(py::module& m)
+// Reader side: maps an existing stream and exposes the latest frame as numpy
+class ImageStreamReader
 {
-	defstruct_ColliderArray(m);
+public:
+	explicit ImageStreamReader(const std::string& name)
+	    : name_(name)
+	{
+		const int fd = shm_open(name.c_str(), O_RDONLY, 0);
+		if (fd < 0)
+			throw std::runtime_error("No such image stream: " + name);
+
+		struct stat st = {};
+		if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(ImageStreamHeader)))
+		{
+			::close(fd);
+			throw std::runtime_error("Image stream is not initialized yet: " + name);
+		}
+
+		void* base = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+		::close(fd);
+		if (base == MAP_FAILED)
+			throw std::runtime_error("Failed to map image stream: " + name);
+
+		mapSize_ = static_cast<size_t>(st.st_size);
+		header_ = static_cast<ImageStreamHeader*>(base);
+		if (header_->magic != imageStreamMagic || header_->version != imageStreamVersion)
+		{
+			munmap(base, mapSize_);
+			header_ = nullptr;
+			throw std::runtime_error("Image stream has an unexpected format: " + name);
+		}
+	}
 
-	py::class_<Fove_GazableObject>(m, "GazableObject",
-								   R"(Represents an object in a 3D world
-The bounding shapes of this object are used for ray casts to determine what the user is looking at.
-Note that multiple bounding shape types can be used simultaneously, such as a sphere and a mesh.
-\see fove_Headset_registerGazableObject
-\see fove_Headset_updateGazableObject
-\see fove_Headset_removeGazableObject
-)")
-		.def(py::init<int, Fove_ObjectPose, Fove_ObjectGroup>(),
-			 py::arg("id") = fove_ObjectIdInvalid,
-			 py::arg_v("pose", default_ObjectPose(), "ObjectPose()"),
-			 py::arg_v("group", Fove_ObjectGroup::Group0, "ObjectGroup(0)"))
-		.def_readwrite("id", &Fove_GazableObject::id, "Unique ID of the object. User-defined objects should use positive integers.")
-		.def_readwrite("pose", &Fove_GazableObject::pose, "The initial pose of the object")
-		.def_readwrite("group", &Fove_GazableObject::group, "The gazable object group this object belongs to")
-		.def("setColliders", [](Fove_GazableObject& self, ColliderArray& value) {
-			self.colliders = value.colliders.data();
-			self.colliderCount = static_cast<unsigned>(value.colliders.size());
-		},
-			 R"(Set the colliders of the gazable object)")
-		.def("__repr__", repr<Fove_GazableObject>, "Returns a string representation of the gazable object.");
-}
-
-void defstruct_CameraObject(py::module& m)
-{
-	py::class_<Fove_CameraObject>(m, "CameraObject",
-								  R"(Represents a camera in a 3D world
-The camera view pose determine what the user is looking at and the object mask specify which objects are rendered.)")
-		.def(py::init<int, Fove_ObjectPose, Fove_ObjectGroup>(),
-			 py::arg("id") = fove_ObjectIdInvalid,
-			 py::arg_v("pose", default_ObjectPose(), "ObjectPose()"),
-			 py::arg_v("groupMask", static_cast<Fove_ObjectGroup>(0xffffffff), "ObjectGroup(0xffffffff)"))
-		.def_readwrite("id", &Fove_CameraObject::id, "Unique ID of the camera. User-defined id should use positive integers.")
-		.def_readwrite("pose", &Fove_CameraObject::pose, "The camera initial pose")
-		.def_readwrite("groupMask", &Fove_CameraObject::groupMask, "The bit mask specifying which object groups the camera renders")
-		.def("__repr__", repr<Fove_CameraObject>, "Returns a string representation of the camera object.");
-}
-
-void defenum_GraphicsAPI(py::module& m)
-{
-	py::enum_<Fove_GraphicsAPI>(m, "GraphicsAPI",
-								R"(enum for type of Graphics API
-
-Type of Graphics API
-Note: We currently only support DirectX)
-
-- `DirectX`: , DirectX (Windows only)
-- `OpenGL`: , OpenGL (All platforms, currently in BETA)
-- `Metal`: Metal (Mac only))")
-		.value("DirectX", Fove_GraphicsAPI::DirectX) // = 0
-		.value("OpenGL", Fove_GraphicsAPI::OpenGL)   // = 1
-		.value("Metal", Fove_GraphicsAPI::Metal)     // = 2
-		;
-}
-
-void defenum_AlphaMode(py::module& m)
-{
-	py::enum_<Fove_AlphaMode>(m, "AlphaMode",
-							  R"(Enum to help interpret the alpha of texture
-
-Determines how to interpret the alpha of a compositor client texture
-
-- `Auto`: Base layers will use One, overlay layers will use Sample
-- `One`: Alpha will always be one (fully opaque)
-- `Sample`: Alpha fill be sampled from the alpha channel of the buffer)")
-		.value("Auto", Fove_AlphaMode::Auto)     // = 0
-		.value("One", Fove_AlphaMode::One)       // = 1
-		.value("Sample", Fove_AlphaMode::Sample) // = 2
-		;
-}
-
-void defstruct_CompositorLayerCreateInfo(py::module& m)
-{
-	py::class_<Fove_CompositorLayerCreateInfo>(m, "CompositorLayerCreateInfo",
-											   R"(Struct used to define the settings for a compositor client.
-
-Structure used to define the settings for a compositor client.)")
-		.def(py::init<Fove_CompositorLayerType, bool, Fove_AlphaMode, bool, bool>(),
-			 py::arg_v("type", Fove_CompositorLayerType::Base, "CompositorLayer()"),
-			 py::arg("disableTimeWarp") = false,
-			 py::arg_v("alphaMode", Fove_AlphaMode::Auto, "AlphaMode(0)"),
-			 py::arg("disableFading") = false,
-			 py::arg("disableDistortion") = false)
-		.def_readwrite("type", &Fove_CompositorLayerCreateInfo::type,
-					   "The type (layer) upon which the client will draw") // Fove_CompositorLayerType Fove_CompositorLayerType::Base
-		.def_readwrite("disableTimeWarp", &Fove_CompositorLayerCreateInfo::disableTimeWarp,
-					   "Setting to disable timewarp, e.g. if an overlay client is operating in screen space") // bool false
-		.def_readwrite("alphaMode", &Fove_CompositorLayerCreateInfo::alphaMode,
-					   "Setting about whether to use alpha sampling or not, e.g. for a base client") // Fove_AlphaMode Fove_AlphaMode::Auto
-		.def_readwrite("disableFading", &Fove_CompositorLayerCreateInfo::disableFading,
-					   "Setting to disable fading when the base layer is misbehaving, e.g. for a diagnostic client") // bool false
-		.def_readwrite("disableDistortion", &Fove_CompositorLayerCreateInfo::disableDistortion,
-					   "Setting to disable a distortion pass, e.g. for a diagnostic client, or a client intending to do its own distortion") // bool false
-		;
-}
-
-// Struct used to store information about an existing compositor layer (after it is created)
-void defstruct_CompositorLayer(py::module& m)
-{
-	py::class_<Fove_CompositorLayer>(m, "CompositorLayer",
-									 R"(Struct used to store information about an existing compositor layer (after it is created)
-
-This exists primarily for future expandability.)")
-		.def(py::init<int, Fove_Vec2i>(),
-			 py::arg("layerId") = 0,
-			 py::arg_v("idealResolutionPerEye", default_Vec2i(), "Vec2i()"))
-		.def_readwrite("layerId", &Fove_CompositorLayer::layerId,
-					   "Uniquely identifies a layer created within an IFVRCompositor object") // int 0
-		.def_readwrite("idealResolutionPerEye", &Fove_CompositorLayer::idealResolutionPerEye,
-					   R"(The optimal resolution for a submitted buffer on this layer (for a single eye).
-
-		Clients are allowed to submit buffers of other resolutions.
-		In particular, clients can use a lower resolution buffer to reduce their rendering overhead.)") // Fove_Vec2i {}
-		;
-}
-
-void defstruct_CompositorTexture(py::module& m)
-{
-	py::class_<Fove_CompositorTexture>(m, "CompositorTexture",
-									   "Base class of API-specific texture classes")
-		.def(py::init<Fove_GraphicsAPI>(),
-			 py::arg_v("graphicsAPI", Fove_GraphicsAPI::DirectX, "GraphicsAPI(0)"))
-		.def_readwrite("graphicsAPI", &Fove_CompositorTexture::graphicsAPI,
-					   R"(If this is DirectX, this object must be a Fove_DX11Texture
-If this is OpenGL, this object must be a Fove_GLTexture
-In C++ this field is initialized automatically by the subclass)" // GraphicsAPI
-		);
-}
-
-void defstruct_DX11Texture(py::module& m)
-{
-	py::class_<Fove_DX11Texture>(m, "DX11Texture", "Struct used to submit a DirectX 11 texture")
-		.def(py::init<>([]() {
-			return Fove_DX11Texture{Fove_CompositorTexture{Fove_GraphicsAPI::DirectX}, nullptr};
-		}))
-		.def_readonly("parent", &Fove_DX11Texture::parent,
-					  "Parent object") // Fove_GraphicsAPI Fove_GraphicsAPI::OpenGL
-		.def_readwrite("texture", &Fove_DX11Texture::texture,
-					   "This must point to a ID3D11Texture2D") // void* nullptr
-		;
-}
-
-void defstruct_GLTexture(py::module& m)
-{
-	py::class_<Fove_GLTexture>(m, "GLTexture",
-							   R"(Struct used to submit an OpenGL texture
-
-The GL context must be active on the thread that submits this.)")
-		.def(py::init([]() {
-			return Fove_GLTexture{Fove_CompositorTexture{Fove_GraphicsAPI::OpenGL}, 0, nullptr};
-		}))
-		.def_readonly("parent", &Fove_GLTexture::parent, "Parent object")
-		.def_readwrite("textureId", &Fove_GLTexture::textureId,
-					   "The opengl id of the texture, as returned by glGenTextures") // uint32_t 0
-		.def_readwrite("context", &Fove_GLTexture::context,
-					   "On mac, this is a CGLContextObj, otherwise this field is reserved and you must pass null") // void* nullptr
-		;
-}
-
-void defstruct_MetalTexture(py::module& m)
-{
-	py::class_<Fove_MetalTexture>(m, "MetalTexture", "Struct used to submit a texture using the Apple Metal API")
-		.def(py::init<>([]() {
-			return Fove_MetalTexture{Fove_CompositorTexture{Fove_GraphicsAPI::Metal}, nullptr};
-		}))
-		.def_readonly("parent", &Fove_MetalTexture::parent, "Parent object") // Fove_GraphicsAPI Fove_GraphicsAPI::Metal
-		.def_readwrite("texture", &Fove_MetalTexture::texture,
-					   "Pointer to an MTLTexture (which must have MTLTextureUsageShaderRead specified).") // void* nullptr
-		;
-}
-
-void defstruct_TextureBounds(py::module& m)
-{
-	py::class_<Fove_TextureBounds>(m, "TextureBounds",
-								   R"(Struct to represent coordinates in normalized space
-
-Coordinates in normalized space where 0 is left/top and 1 is bottom/right)")
-		.def(py::init<float, float, float, float>(),
-			 py::arg("left") = 0.0f,
-			 py::arg("top") = 0.0f,
-			 py::arg("right") = 0.0f,
-			 py::arg("bottom") = 0.0f)
-		.def_readwrite("left", &Fove_TextureBounds::left)     // float 0.0f
-		.def_readwrite("top", &Fove_TextureBounds::top)       // float 0.0f
-		.def_readwrite("right", &Fove_TextureBounds::right)   // float 0.0f
-		.def_readwrite("bottom", &Fove_TextureBounds::bottom) // float 0.0f
-		.def(
-			"__eq__", [](const Fove_TextureBounds& self, const Fove_TextureBounds& other) {
-				return self == other;
-			},
-			py::is_operator(), "Returns `True` if the two texture bounds are the same.")
-		.def("__ne__", [](const Fove_TextureBounds& self, const Fove_TextureBounds& other) {
-			return !(self == other);
-		},
-			 py::is_operator(), "Returns `True` if the two texture bounds are not the same.");
-}
-
-void defstruct_CompositorLayerEyeSubmitInfo(py::module& m)
-{
-	py::class_<Fove_CompositorLayerEyeSubmitInfo>(m, "CompositorLayerEyeSubmitInfo",
-												  "Struct used to conglomerate the texture settings for a single eye, when submitting a given layer")
-		.def(py::init<const Fove_CompositorTexture*, Fove_TextureBounds>(),
-			 py::arg("texInfo") = nullptr,
-			 py::arg_v("bounds", default_TextureBounds(), "TextureBounds()"))
-		.def_readwrite("texInfo", &Fove_CompositorLayerEyeSubmitInfo::texInfo, R"(Texture to submit for this eye
-This may be null as long as the other submitted eye's texture isn't (thus allowing each eye to be submitted separately))")
-		.def_readwrite("bounds", &Fove_CompositorLayerEyeSubmitInfo::bounds, "The portion of the texture that is used to represent the eye (Eg. half of it if the texture contains both eyes)");
-}
-
-void defstruct_CompositorLayerSubmitInfo(py::module& m)
-{
-	py::class_<Fove_CompositorLayerSubmitInfo>(m, "CompositorLayerSubmitInfo", "Struct used to conglomerate the texture settings when submitting a given layer")
-		.def(py::init<int, Fove_Pose, Fove_CompositorLayerEyeSubmitInfo, Fove_CompositorLayerEyeSubmitInfo>(),
-			 py::arg("layerId") = 0,
-			 py::arg_v("pose", default_Pose(), "Pose()"),
-			 py::arg_v("left", default_CompositorLayerEyeSubmitInfo(), "CompositorLayerEyeSubmitInfo()"),
-			 py::arg_v("right", default_CompositorLayerEyeSubmitInfo(), "CompositorLayerEyeSubmitInfo()"))
-		.def_readwrite("layerId", &Fove_CompositorLayerSubmitInfo::layerId, "The layer ID as fetched from Fove_CompositorLayer")
-		.def_readwrite("pose", &Fove_CompositorLayerSubmitInfo::pose, "The pose used to draw this layer, usually coming from Compositor_waitForRenderPose")
-		.def_readwrite("left", &Fove_CompositorLayerSubmitInfo::left, "Information about the left eye")
-		.def_readwrite("right", &Fove_CompositorLayerSubmitInfo::right, "Information about the left eye");
-}
-
-// Struct used to identify a GPU adapter
-// Currently only used on Windows
-void defstruct_AdapterId(py::module& m)
-{
-	py::class_<Fove_AdapterId>(m, "AdapterId", "Struct used to identify a GPU adapter (Windows only)")
-	// This is a corner case. We choose to throw if users try to construct Fove_AdapterId
-	// on non-Win platforms
-	// .def(py::init<>())
-#ifdef _WIN32
-		.def(py::init<uint32_t, int32_t>(),
-			 py::arg("lowPart") = 0u,
-			 py::arg("highPart") = 0)
-		.def_readwrite("lowPart", &Fove_AdapterId::lowPart, "On windows, this together with `highPart` forms a LUID structure")
-		.def_readwrite("highPart", &Fove_AdapterId::highPart, "On windows, this together with `lowPart` forms a LUID structure")
-#endif // _WIN32
-		;
-}
-
-void defstruct_Buffer(py::module& m)
-{
-	py::class_<Fove_Buffer>(m, "Buffer", py::buffer_protocol(),
-							R"(A generic memory buffer
-
-No ownership or lifetime semantics are specified. Please see the comments on the functions that use this.)")
-		.def(py::init<void*, std::size_t>(),
-			 py::arg("data") = nullptr,
-			 py::arg("length") = 0)
-		.def_readwrite("data", &Fove_Buffer::data, "Pointer to the start of the memory buffer")
-		.def_readwrite("length", &Fove_Buffer::length, "Length, in bytes, of the buffer")
-		.def_buffer([](Fove_Buffer& buf) {
-			return py::buffer_info{
-				reinterpret_cast<unsigned char*>(const_cast<void*>(buf.data)), // XXX const
-				sizeof(unsigned char),
-				py::format_descriptor<unsigned char>::format(),
-				1,                      // ndims
-				{buf.length},           // dims
-				{sizeof(unsigned char)} // strides
-			};
-		});
-}
+	~ImageStreamReader() { close(); }
 
-using Python_EyeShape = Obj<Fove_EyeShape>;
-void defstruct_EyeShape(py::module& m)
-{
-	py::class_<Python_EyeShape>(m, "EyeShape", py::buffer_protocol(),
-								R"(Specify the shape of an eye
+	ImageStreamReader(const ImageStreamReader&) = delete;
+	ImageStreamReader& operator=(const ImageStreamReader&) = delete;
 
-This struct implements buffer_protocol, and thus can be converted to a numpy array:
-m = fove.capi.EyeShape()
-a = numpy.array(m, copy=False)
-)")
-		.def(py::init<>())
-		.def_buffer([](Python_EyeShape& obj) {
-			return py::buffer_info{
-				reinterpret_cast<void*>(&obj.val.outline[0]),
-				sizeof(float),
-				py::format_descriptor<float>::format(),
-				2,                                 // ndims
-				{12, 2},                           // dims
-				{sizeof(float) * 2, sizeof(float)} // strides
-			};
-		});
-}
+	void close()
+	{
+		if (!header_)
+			return;
+		munmap(header_, mapSize_);
+		header_ = nullptr;
+	}
 
-void defstruct_PupilShape(py::module& m)
-{
-	py::class_<Fove_PupilShape>(m, "PupilShape", R"(Specity the shape of a pupil as an ellipse
+	// Returns (frame, timestamp, bytes) of the newest published image, or None.
+	// With copy=False the array aliases the shared slot directly (zero-copy); the
+	// writer may overwrite it once it has lapped the ring, so consume it promptly
+	// or leave copy=True.
+	py::object latest(py::object selfObj, const bool copy)
+	{
+		ImageStreamHeader* header = header_;
+		if (!header)
+			throw std::runtime_error("ImageStreamReader is closed");
+
+		for (int attempt = 0; attempt < 64; ++attempt)
+		{
+			const uint64_t frame = header->latestFrame.load(std::memory_order_acquire);
+			if (frame == 0)
+				return py::none();
+
+			const uint32_t slot = static_cast<uint32_t>((frame - 1) % header->slotCount);
+			const ImageSlotHeader* slotHeader = reinterpret_cast<const ImageSlotHeader*>(imageSlotBase(header, slot));
+
+			const uint64_t seqBefore = slotHeader->seq.load(std::memory_order_acquire);
+			if (seqBefore % 2 != 0)
+				continue; // write in progress, retry
+			const uint64_t timestamp = slotHeader->timestamp;
+			const uint32_t dataSize = slotHeader->dataSize;
+			if (dataSize > header->slotSize)
+				continue;
+			const char* data = imageSlotBase(header, slot) + sizeof(ImageSlotHeader);
+
+			if (copy)
+			{
+				// Draw the output from the recycled image pool when one is
+				// configured (see configure_image_pool), else allocate
+				py::array_t<uint8_t, py::array::c_style> bytes;
+				if (unsigned char* const pooled = imagePoolAcquire(dataSize))
+					bytes = imagePoolArray(pooled, {static_cast<py::ssize_t>(dataSize)});
+				else
+					bytes = py::array_t<uint8_t, py::array::c_style>(static_cast<py::ssize_t>(dataSize));
+				memcpy(bytes.mutable_data(), data, dataSize);
+				std::atomic_thread_fence(std::memory_order_acquire);
+				if (slotHeader->seq.load(std::memory_order_acquire) != seqBefore)
+					continue; // writer lapped us mid-copy, retry
+				return py::make_tuple(frame, timestamp, std::move(bytes));
+			}
 
-Coordinates are in eye-image pixels from (0,0) to (camerawidth, cameraheight), with (0,0) being the top left.)")
-		.def(py::init<Fove_Vec2, Fove_Vec2, float>(),
-			 py::arg_v("center", default_Vec2(), "Vec2()"),
-			 py::arg_v("size", default_Vec2(), "Vec2()"),
-			 py::arg("angle") = 0.0f)
-		.def_readwrite("center", &Fove_PupilShape::center, "The center of the ellipse")
-		.def_readwrite("size", &Fove_PupilShape::size, "The width and height of the ellipse")
-		.def_readwrite("angle", &Fove_PupilShape::angle, "A clockwise rotation around the center, in degrees");
-}
+			// Zero-copy view; the reader object (base) keeps the mapping alive
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (slotHeader->seq.load(std::memory_order_acquire) != seqBefore)
+				continue;
+			py::array view(py::dtype::of<uint8_t>(), {static_cast<py::ssize_t>(dataSize)}, {py::ssize_t(1)}, data, selfObj);
+			return py::make_tuple(frame, timestamp, std::move(view));
+		}
+		throw std::runtime_error("Image stream is being overwritten faster than it can be read");
+	}
 
-void defstruct_BitmapImage(py::module& m)
-{
-	py::class_<Fove_BitmapImage>(m, "BitmapImage", "A 2D bitmap image")
-		.def(py::init<uint64_t, Fove_Buffer>(),
-			 py::arg("timestamp") = 0,
-			 py::arg_v("image", default_Buffer(), "Buffer()"))
-		.def_readwrite("timestamp", &Fove_BitmapImage::timestamp,
-					   "Timestamp of the image, in microseconds since an unspecified epoch") // uint64_t 0
-		.def_readwrite("image", &Fove_BitmapImage::image,
-					   R"(BMP data (including full header that contains size, format, etc)
+	const std::string& name() const { return name_; }
+	size_t slotSize() const { return header_ ? header_->slotSize : 0; }
+	size_t slotCount() const { return header_ ? header_->slotCount : 0; }
+	uint64_t latestFrame() const { return header_ ? header_->latestFrame.load(std::memory_order_acquire) : 0; }
 
-The height may be negative to specify a top-down bitmap.)") // Fove_Buffer {}
-		;
-}
+private:
+	std::string name_;
+	ImageStreamHeader* header_ = nullptr;
+	size_t mapSize_ = 0;
+};
 
-void defstruct_CalibrationTarget(py::module& m)
+} // namespace
+
+void defstruct_ImageStream(py::module& m)
 {
-	py::class_<Fove_CalibrationTarget>(m, "CalibrationTarget", "Represent a calibration target of the calibration process")
-		.def(py::init<Fove_Vec3, float>(),
-			 py::arg_v("position", default_Vec3(), "Vec3()"),
-			 py::arg("scale") = 0)
-		.def_readwrite("position", &Fove_CalibrationTarget::position,
-					   "The position of the calibration target in the 3D world space")
-		.def_readwrite("recommendedSize", &Fove_CalibrationTarget::recommendedSize,
-					   R"(The recommended size for the calibration target in world space unit.
-A recommended size of 0 means that the display of the target is not recommended at the current time)")
+	py::class_<ImageStream>(m, "ImageStream",
+							R"(Publishes eye images into a named shared-memory ring
+
+Sibling processes open the same name with `ImageStreamReader` and read the
+newest image without any serialization or socket hop:
+
+    stream = capi.ImageStream("/fove-eyes", slotSize=2 * 1024 * 1024)
+    err = capi.Headset_getEyesImage(headset, image)
+    stream.publish(image.val)
+
+Slots are seqlock-stamped, so a reader never observes a torn image; the writer
+never blocks on readers.)")
+		.def(py::init<std::string, size_t, size_t>(),
+			 py::arg("name"), py::arg("slotSize") = 2 * 1024 * 1024, py::arg("slotCount") = 4,
+			 "Creates (or re-initializes) the named shared-memory ring")
+		.def("publish", &ImageStream::publish, py::arg("image"),
+			 R"(Publishes one image into the next ring slot
+
+\param image The `BitmapImage` to publish; its BMP bytes are copied into shared memory
+\return The frame number assigned to the image (monotonically increasing from 1))")
+		.def("publishIfNew", &ImageStream::publishIfNew, py::arg("image"),
+			 R"(Publishes the image only if its timestamp advanced since the last publication
+
+Polled sources like the position camera have no wait/sync call, so a publish loop
+would otherwise re-copy the same frame into the ring every iteration.
+
+\param image The `BitmapImage` to publish
+\return The frame number assigned to the image, or 0 if it was skipped as stale)")
+		.def("close", &ImageStream::close,
+			 "Unmaps and unlinks the segment; existing reader mappings stay valid")
+		.def_property_readonly("name", &ImageStream::name, "The shared-memory segment name")
+		.def_property_readonly("slotSize", &ImageStream::slotSize, "Image payload capacity per slot, in bytes")
+		.def_property_readonly("slotCount", &ImageStream::slotCount, "Number of ring slots")
+		.def_property_readonly("framesPublished", &ImageStream::framesPublished, "Number of images published so far");
+
+	py::class_<ImageStreamReader>(m, "ImageStreamReader",
+								  R"(Maps a shared-memory image ring published by `ImageStream`
+
+`latest()` returns `(frame, timestamp, bytes)` of the newest image, or `None` if
+nothing has been published yet. With `copy=False` the returned array aliases the
+shared slot directly (zero-copy); consume it before the writer laps the ring.)")
+		.def(py::init<std::string>(), py::arg("name"),
+			 "Maps the named stream; raises if no publisher has created it")
 		.def(
-			"__eq__", [](const Fove_CalibrationTarget& self, const Fove_CalibrationTarget& other) {
-				return self == other;
+			"latest", [](py::object selfObj, const bool copy) {
+				return selfObj.cast<ImageStreamReader&>().latest(selfObj, copy);
 			},
-			py::is_operator(), "Returns `True` if the two targets are the same.")
-		.def("__ne__", [](Fove_CalibrationTarget& self, Fove_CalibrationTarget& other) {
-			return !(self == other);
-		},
-			 py::is_operator(), "Returns `True` if the two targets are not the same.");
-	;
+			py::arg("copy") = true,
+			R"(Reads the newest published image
+
+\param copy Whether to copy the bytes out of shared memory; pass `False` for a zero-copy view
+\return `(frame, timestamp, bytes)` where bytes is a uint8 array of BMP data, or `None`)")
+		.def("close", &ImageStreamReader::close, "Unmaps the stream")
+		.def_property_readonly("name", &ImageStreamReader::name, "The shared-memory segment name")
+		.def_property_readonly("slotSize", &ImageStreamReader::slotSize, "Image payload capacity per slot, in bytes")
+		.def_property_readonly("slotCount", &ImageStreamReader::slotCount, "Number of ring slots")
+		.def_property_readonly("latestFrame", &ImageStreamReader::latestFrame, "Frame number of the newest published image, 0 if none");
 }
 
-void defenum_CalibrationState(py::module& m)
+namespace
 {
-	py::enum_<Fove_CalibrationState>(m, "CalibrationState", R"(Indicates the state of a calibration process
-A calibration process always starts from the `NotStarted` state,
-	then it can go back and forth between the `WaitingForUser` & `CollectingData` states,
-	then it goes to the `ProcessingData` state and finishes with the `Successful` state.
 
-	A failure can happen any time during the process, and stops the process where it was.
-
-	From the `ProcessingData` state the calibration process do not require any rendering
-	and gameplay can be started if wanted but new calibration won't be effective before reaching the `Successful` state.)")
-		.value("NotStarted", Fove_CalibrationState::NotStarted)
-		.value("HeadsetAdjustment", Fove_CalibrationState::HeadsetAdjustment)
-		.value("WaitingForUser", Fove_CalibrationState::WaitingForUser)
-		.value("CollectingData", Fove_CalibrationState::CollectingData)
-		.value("ProcessingData", Fove_CalibrationState::ProcessingData)
-		.value("Successful_HighQuality", Fove_CalibrationState::Successful_HighQuality)
-		.value("Successful_MediumQuality", Fove_CalibrationState::Successful_MediumQuality)
-		.value("Successful_LowQuality", Fove_CalibrationState::Successful_LowQuality)
-		.value("Failed_Unknown", Fove_CalibrationState::Failed_Unknown)
-		.value("Failed_InaccurateData", Fove_CalibrationState::Failed_InaccurateData)
-		.value("Failed_NoRenderer", Fove_CalibrationState::Failed_NoRenderer)
-		.value("Failed_NoUser", Fove_CalibrationState::Failed_NoUser)
-		.value("Failed_Aborted", Fove_CalibrationState::Failed_Aborted);
-}
-
-void defenum_CalibrationMethod(py::module& m)
+// Consumer side of the snapshot bus: maps an existing ring and reads new
+// records with a private cursor, so N consumers progress independently
+class SnapshotBusReader
 {
-	py::enum_<Fove_CalibrationMethod>(m, "CalibrationMethod", "Indicates the calibration method to use")
-		.value("Default", Fove_CalibrationMethod::Default)
-		.value("OnePoint", Fove_CalibrationMethod::OnePoint)
-		.value("Spiral", Fove_CalibrationMethod::Spiral)
-		.value("OnePointWithNoGlassesSpiralWithGlasses", Fove_CalibrationMethod::OnePointWithNoGlassesSpiralWithGlasses)
-		.value("ZeroPoint", Fove_CalibrationMethod::ZeroPoint)
-		.value("DefaultCalibration", Fove_CalibrationMethod::DefaultCalibration);
-}
+public:
+	explicit SnapshotBusReader(const std::string& name)
+	    : name_(name)
+	{
+		const int fd = shm_open(name.c_str(), O_RDONLY, 0);
+		if (fd < 0)
+			throw std::runtime_error("No such snapshot bus: " + name);
+
+		struct stat st = {};
+		if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(SnapshotBusHeader)))
+		{
+			::close(fd);
+			throw std::runtime_error("Snapshot bus is not initialized yet: " + name);
+		}
+
+		void* base = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+		::close(fd);
+		if (base == MAP_FAILED)
+			throw std::runtime_error("Failed to map snapshot bus: " + name);
+
+		mapSize_ = static_cast<size_t>(st.st_size);
+		header_ = static_cast<SnapshotBusHeader*>(base);
+		if (header_->magic != snapshotBusMagic || header_->version != snapshotBusVersion
+			|| header_->recordSize != sizeof(PumpSnapshot))
+		{
+			munmap(base, mapSize_);
+			header_ = nullptr;
+			throw std::runtime_error("Snapshot bus has an unexpected format: " + name);
+		}
+	}
 
-void defenum_EyeByEyeCalibration(py::module& m)
-{
-	py::enum_<Fove_EyeByEyeCalibration>(m, "EyeByEyeCalibration", "Indicate whether each eye should be calibrated separately or not")
-		.value("Default", Fove_EyeByEyeCalibration::Default)
-		.value("Disabled", Fove_EyeByEyeCalibration::Disabled)
-		.value("Enabled", Fove_EyeByEyeCalibration::Enabled);
-}
+	~SnapshotBusReader() { close(); }
 
-void defenum_EyeTorsionCalibration(py::module& m)
-{
-	py::enum_<Fove_EyeTorsionCalibration>(m, "EyeTorsionCalibration", "Indicate whether eye torsion calibration should be run or not")
-		.value("Default", Fove_EyeTorsionCalibration::Default)
-		.value("IfEnabled", Fove_EyeTorsionCalibration::IfEnabled)
-		.value("Always", Fove_EyeTorsionCalibration::Always);
-}
+	SnapshotBusReader(const SnapshotBusReader&) = delete;
+	SnapshotBusReader& operator=(const SnapshotBusReader&) = delete;
 
-struct CalibrationData
-{
-	Fove_CalibrationMethod method;
-	Fove_CalibrationState state;
-	std::string stateInfo;
-	Fove_CalibrationTarget targetL;
-	Fove_CalibrationTarget targetR;
+	void close()
+	{
+		if (!header_)
+			return;
+		munmap(header_, mapSize_);
+		header_ = nullptr;
+	}
 
-	static CalibrationData FromNative(const Fove_CalibrationData* nativeData)
+	// All records published since the previous drain, oldest first. Records
+	// the writer overwrote before we got to them (or tore while we copied)
+	// are skipped and counted in `dropped`.
+	py::array_t<PumpSnapshot> drain()
 	{
-		return {
-			nativeData->method,
-			nativeData->state,
-			nativeData->stateInfo,
-			nativeData->targetL,
-			nativeData->targetR,
-		};
+		SnapshotBusHeader* const header = header_;
+		if (!header)
+			throw std::runtime_error("SnapshotBusReader is closed");
+
+		std::vector<PumpSnapshot> out;
+		{
+			py::gil_scoped_release release;
+			const uint64_t latest = header->latestFrame.load(std::memory_order_acquire);
+			uint64_t begin = nextFrame_;
+			const uint64_t oldest = latest > header->slotCount ? latest - header->slotCount + 1 : 1;
+			if (begin < oldest)
+			{
+				dropped_ += oldest - begin; // fell a full lap behind
+				begin = oldest;
+			}
+			if (begin <= latest)
+			{
+				out.reserve(static_cast<size_t>(latest - begin + 1));
+				for (uint64_t frame = begin; frame <= latest; ++frame)
+				{
+					char* const base = snapshotSlotBase(header, static_cast<uint32_t>((frame - 1) % header->slotCount));
+					const SnapshotSlotHeader* const slotHeader = reinterpret_cast<const SnapshotSlotHeader*>(base);
+
+					const uint64_t seqBefore = slotHeader->seq.load(std::memory_order_acquire);
+					if (seqBefore % 2 != 0)
+					{
+						++dropped_; // the writer is on this very slot: the record is gone
+						continue;
+					}
+					PumpSnapshot rec;
+					const uint64_t slotFrame = slotHeader->frame;
+					std::memcpy(&rec, base + sizeof(SnapshotSlotHeader), sizeof rec);
+					std::atomic_thread_fence(std::memory_order_acquire);
+					if (slotHeader->seq.load(std::memory_order_acquire) != seqBefore || slotFrame != frame)
+					{
+						++dropped_; // lapped mid-copy
+						continue;
+					}
+					out.push_back(rec);
+				}
+				nextFrame_ = latest + 1;
+			}
+		}
+
+		py::array_t<PumpSnapshot> result(static_cast<py::ssize_t>(out.size()));
+		if (!out.empty())
+			std::memcpy(result.mutable_data(), out.data(), out.size() * sizeof(PumpSnapshot));
+		return result;
 	}
-};
 
-void defstruct_CalibrationData(py::module& m)
-{
-	py::class_<CalibrationData>(m, "CalibrationData", "Provide all the calibration data needed to render the current state of the calibration process")
-		.def(py::init<Fove_CalibrationMethod, Fove_CalibrationState, std::string, Fove_CalibrationTarget, Fove_CalibrationTarget>(),
-			 py::arg_v("method", Fove_CalibrationMethod::Spiral, "CalibrationMethod(0)"),
-			 py::arg_v("state", Fove_CalibrationState::NotStarted, "CalibrationState(0)"),
-			 py::arg("stateInfo") = std::string(),
-			 py::arg_v("targetL", default_CalibrationTarget(), "CalibrationTarget()"),
-			 py::arg_v("targetR", default_CalibrationTarget(), "CalibrationTarget()"))
-		.def_readwrite("method", &CalibrationData::method, "The calibration method currently used, or Default if the method is unknown (from a future update)")
-		.def_readwrite("state", &CalibrationData::state, "The current state of the calibration")
-		.def_readwrite("stateInfo", &CalibrationData::state, "Human readable extra information about the current calibration state")
-		.def_readwrite("targetL", &CalibrationData::targetL, "The current calibration target to display for the left eye")
-		.def_readwrite("targetR", &CalibrationData::targetR, "The current calibration target to display for the right eye");
-}
-
-void defstruct_HmdAdjustmentData(py::module& m)
-{
-	py::class_<Fove_HmdAdjustmentData>(m, "HmdAdjustmentData", "Provide all the HMD positioning data needed to render the current state of the HMD adjustment process")
-		.def(py::init<Fove_Vec2, float, bool, bool, Fove_Vec2, Fove_Vec2, float, float, Fove_Vec2, Fove_Vec2>(),
-			 py::arg_v("translation", default_Vec2(), "Vec2()"),
-			 py::arg("rotation") = 0,
-			 py::arg("adjustmentNeeded") = false,
-			 py::arg("hasTimeout") = false,
-			 py::arg_v("idealPositionL", default_Vec2(), "Vec2()"),
-			 py::arg_v("idealPositionR", default_Vec2(), "Vec2()"),
-			 py::arg("idealPositionSpanL") = 0,
-			 py::arg("idealPositionSpanR") = 0,
-			 py::arg_v("estimatedPositionL", default_Vec2(), "Vec2()"),
-			 py::arg_v("estimatedPositionR", default_Vec2(), "Vec2()"))
-		.def_readwrite("translation", &Fove_HmdAdjustmentData::translation, "The HMD translation offset in eyes camera in relative units ([-1, 1])")
-		.def_readwrite("rotation", &Fove_HmdAdjustmentData::rotation, "The rotation of HMD to the eye line in radian")
-		.def_readwrite("adjustmentNeeded", &Fove_HmdAdjustmentData::adjustmentNeeded, "Indicate whether the HMD adjustment GUI should be displayed to correct user HMD alignment")
-		.def_readwrite("hasTimeout", &Fove_HmdAdjustmentData::hasTimeout, "Indicate if the adjustment process has timeout in which case the GUI should close")
-		.def_readwrite("idealPositionL", &Fove_HmdAdjustmentData::idealPositionL, "Pixel coordinate on the left camera image for the expected ideal eye position")
-		.def_readwrite("idealPositionR", &Fove_HmdAdjustmentData::idealPositionR, "Pixel coordinate on the right camera image for the expected ideal eye position")
-		.def_readwrite("idealPositionSpanL", &Fove_HmdAdjustmentData::idealPositionSpanL, "Radius of the tolerance area for the expected ideal eye position on the left camera image in pixels")
-		.def_readwrite("idealPositionSpanR", &Fove_HmdAdjustmentData::idealPositionSpanR, "Radius of the tolerance area for the expected ideal eye position on the right camera image in pixels")
-		.def_readwrite("estimatedPositionL", &Fove_HmdAdjustmentData::estimatedPositionL, "Pixel coordinate of left eye position which is independent on eye orientation")
-		.def_readwrite("estimatedPositionR", &Fove_HmdAdjustmentData::estimatedPositionR, "Pixel coordinate of right eye position which is independent on eye orientation");
-}
-
-void defstruct_CalibrationOptions(py::module& m)
-{
-	py::class_<Fove_CalibrationOptions>(m, "CalibrationOptions", "Options specifying how to run a calibration process")
-		.def(py::init<bool, bool, Fove_EyeByEyeCalibration, Fove_CalibrationMethod, Fove_EyeTorsionCalibration>(),
-			 py::arg("lazy") = false,
-			 py::arg("restart") = false,
-			 py::arg_v("eyeByEye", Fove_EyeByEyeCalibration::Default, "EyeByEyeCalibration(0)"),
-			 py::arg_v("method", Fove_CalibrationMethod::Default, "CalibrationMethod(0)"),
-			 py::arg_v("eyeTorsion", Fove_EyeTorsionCalibration::Default, "EyeTorsionCalibration(0)"))
-		.def_readwrite("lazy", &Fove_CalibrationOptions::lazy, "Do not restart the calibration process if it is already calibrated")
-		.def_readwrite("restart", &Fove_CalibrationOptions::restart, "Restart the calibration process from the beginning if it is already running")
-		.def_readwrite("eyeByEye", &Fove_CalibrationOptions::eyeByEye, "Calibrate both eyes simultaneously or separately")
-		.def_readwrite("method", &Fove_CalibrationOptions::method, "The calibration method to use")
-		.def_readwrite("eyeTorsion", &Fove_CalibrationOptions::eyeTorsion, "Whether to perform eye torsion calibration or not");
-}
+	// Returns (frame, record) of the newest published snapshot, or None. With
+	// copy=False the one-element array aliases the shared slot (zero-copy);
+	// the writer may overwrite it once it laps the ring.
+	py::object latest(py::object selfObj, const bool copy)
+	{
+		SnapshotBusHeader* const header = header_;
+		if (!header)
+			throw std::runtime_error("SnapshotBusReader is closed");
+
+		for (int attempt = 0; attempt < 64; ++attempt)
+		{
+			const uint64_t frame = header->latestFrame.load(std::memory_order_acquire);
+			if (frame == 0)
+				return py::none();
+
+			char* const base = snapshotSlotBase(header, static_cast<uint32_t>((frame - 1) % header->slotCount));
+			const SnapshotSlotHeader* const slotHeader = reinterpret_cast<const SnapshotSlotHeader*>(base);
+			const uint64_t seqBefore = slotHeader->seq.load(std::memory_order_acquire);
+			if (seqBefore % 2 != 0)
+				continue; // write in progress, retry
+
+			if (copy)
+			{
+				py::array_t<PumpSnapshot> record(1);
+				std::memcpy(record.mutable_data(), base + sizeof(SnapshotSlotHeader), sizeof(PumpSnapshot));
+				std::atomic_thread_fence(std::memory_order_acquire);
+				if (slotHeader->seq.load(std::memory_order_acquire) != seqBefore)
+					continue; // writer lapped us mid-copy, retry
+				return py::make_tuple(frame, std::move(record));
+			}
 
-////////////////////////////////////////////////////////////////
-// C APIs
+			// Zero-copy view; the reader object (base) keeps the mapping alive
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (slotHeader->seq.load(std::memory_order_acquire) != seqBefore)
+				continue;
+			py::array view(py::dtype::of<PumpSnapshot>(), {py::ssize_t(1)}, {py::ssize_t(sizeof(PumpSnapshot))},
+						   base + sizeof(SnapshotSlotHeader), selfObj);
+			return py::make_tuple(frame, std::move(view));
+		}
+		throw std::runtime_error("Snapshot bus is being overwritten faster than it can be read");
+	}
 
-using Headset = Obj<Fove_Headset*>;
-using Compositor = Obj<Fove_Compositor*>;
+	const std::string& name() const { return name_; }
+	size_t slotCount() const { return header_ ? header_->slotCount : 0; }
+	uint64_t latestFrame() const { return header_ ? header_->latestFrame.load(std::memory_order_acquire) : 0; }
+	uint64_t dropped() const { return dropped_; }
+
+private:
+	std::string name_;
+	SnapshotBusHeader* header_ = nullptr;
+	size_t mapSize_ = 0;
+	uint64_t nextFrame_ = 1; // the private cursor: first frame the next drain returns
+	uint64_t dropped_ = 0;
+};
 
-void defstruct_Headsets(py::module& m)
-{
-	py::class_<Headset>(m, "Fove_Headset", "Opaque type representing a headset object")
-		.def(py::init<>());
-}
+} // namespace
 
-void defstruct_Compositor(py::module& m)
+void defstruct_SnapshotBus(py::module& m)
 {
-	py::class_<Compositor>(m, "Fove_Compositor", "Opaque type representing a compositor connection")
-		.def(py::init<>());
+	py::class_<SnapshotBus, std::shared_ptr<SnapshotBus>>(m, "SnapshotBus",
+														  R"(Publishes pump snapshots into a named shared-memory ring
+
+One capture process runs a `FramePump` and enables a bus; sibling consumer
+processes (stimulus, logging, analysis) open the same name with
+`SnapshotBusReader` and read every snapshot without a pickle or socket hop:
+
+    bus = capi.SnapshotBus("/fove-gaze")
+    bus.enable()
+    pump = capi.FramePump()
+    pump.start(headset)
+
+Slots are seqlock-stamped, so a reader never observes a torn record; the
+writer never blocks on readers.)")
+		.def(py::init<std::string, size_t>(),
+			 py::arg("name"), py::arg("slotCount") = 512,
+			 "Creates (or re-initializes) the named shared-memory ring")
+		.def(
+			"enable", [](const std::shared_ptr<SnapshotBus>& self) {
+				std::lock_guard<std::mutex> lock(snapshotBusMutex);
+				for (const std::weak_ptr<SnapshotBus>& entry : activeSnapshotBuses)
+					if (entry.lock() == self)
+						return;
+				activeSnapshotBuses.push_back(self);
+			},
+			"Starts publishing every snapshot captured by a running frame pump (idempotent)")
+		.def(
+			"disable", [](const std::shared_ptr<SnapshotBus>& self) {
+				std::lock_guard<std::mutex> lock(snapshotBusMutex);
+				activeSnapshotBuses.erase(
+					std::remove_if(activeSnapshotBuses.begin(), activeSnapshotBuses.end(),
+								   [&self](const std::weak_ptr<SnapshotBus>& entry) { return entry.lock() == self; }),
+					activeSnapshotBuses.end());
+			},
+			"Stops publishing; the segment and its contents stay mapped for readers")
+		.def("close", &SnapshotBus::close,
+			 "Unmaps and unlinks the segment; existing reader mappings stay valid")
+		.def_property_readonly("name", &SnapshotBus::name, "The shared-memory segment name")
+		.def_property_readonly("slotCount", &SnapshotBus::slotCount, "Number of ring slots")
+		.def_property_readonly("framesPublished", &SnapshotBus::framesPublished, "Number of snapshots published so far");
+
+	py::class_<SnapshotBusReader>(m, "SnapshotBusReader",
+								  R"(Maps a shared-memory snapshot ring published by `SnapshotBus`
+
+Each reader keeps a private cursor, so N consumers drain the same bus at
+their own pace. `drain()` returns every record published since the previous
+drain as a structured array in the pump snapshot layout; records the writer
+overwrote before the reader got to them are skipped and counted in
+`dropped`.)")
+		.def(py::init<std::string>(), py::arg("name"),
+			 "Maps the named bus; raises if no publisher has created it")
+		.def("drain", &SnapshotBusReader::drain,
+			 R"(Reads all records published since the previous drain
+
+\return A structured numpy array in the pump snapshot layout, oldest first
+        (empty if nothing new)
+\see latest
+)")
+		.def(
+			"latest", [](py::object selfObj, const bool copy) {
+				return selfObj.cast<SnapshotBusReader&>().latest(selfObj, copy);
+			},
+			py::arg("copy") = true,
+			R"(Reads the newest published snapshot without moving the drain cursor
+
+\param copy Whether to copy the record out of shared memory; pass `False`
+       for a zero-copy one-element view that the writer may later overwrite
+\return `(frame, record)` where record is a one-element structured array,
+        or `None` if nothing has been published yet)")
+		.def("close", &SnapshotBusReader::close, "Unmaps the bus")
+		.def_property_readonly("name", &SnapshotBusReader::name, "The shared-memory segment name")
+		.def_property_readonly("slotCount", &SnapshotBusReader::slotCount, "Number of ring slots")
+		.def_property_readonly("latestFrame", &SnapshotBusReader::latestFrame, "Frame number of the newest published snapshot, 0 if none")
+		.def_property_readonly("dropped", &SnapshotBusReader::dropped, "Records this reader lost by falling behind the writer");
 }
 
+#else // _WIN32
+
+// Shared-memory image streaming is POSIX-only for now (no shm_open on Windows)
+void defstruct_ImageStream(py::module&) {}
+void defstruct_SnapshotBus(py::module&) {}
+
+#endif
+
 void defstruct_Wrappers(py::module& m)
 {
 	py::class_<Obj<bool>>(m, "Bool", R"(An object wrapper for boolean values.
@@ -2097,6 +9497,294 @@ This is necessary as we use CalibrationState enum values as out variables, but p
 			"__ne__", [](const Fove_CalibrationState other, const Obj<Fove_CalibrationState>& self) { return self.val != other; }, py::is_operator());
 }
 
+////////////////////////////////////////////////////////////////
+// Scratch pool
+
+namespace
+{
+
+// A preallocated set of the out-parameter wrappers the getters take, one
+// instance per type, created once and handed back by reference on every
+// attribute access. A hot loop that fetches its wrappers from a Scratch
+// instead of constructing them performs zero allocations per call; the
+// attribute lookups are plain increfs of the cached objects.
+//
+// Each Scratch holds exactly one instance per type, so values are only valid
+// until the next call that writes the same slot; callers that need to hold
+// two values of one type at once (e.g. left and right eye) use two Scratches.
+class Scratch
+{
+public:
+	Scratch()
+	    : boolObj(py::cast(Obj<bool>{}))
+	    , intObj(py::cast(Obj<int>{}))
+	    , floatObj(py::cast(Obj<float>{}))
+	    , stringObj(py::cast(Obj<std::string>{}))
+	    , eyeStateObj(py::cast(Obj<Fove_EyeState>{}))
+	    , calibrationStateObj(py::cast(Obj<Fove_CalibrationState>{}))
+	    , vec3Obj(py::cast(Fove_Vec3{}))
+	    , vec2Obj(py::cast(Fove_Vec2{}))
+	    , rayObj(py::cast(Fove_Ray{}))
+	    , poseObj(py::cast(Fove_Pose{}))
+	    , frameTimestampObj(py::cast(Fove_FrameTimestamp{}))
+	    , matrix44Obj(py::cast(Python_Matrix44{}))
+	    , eyeShapeObj(py::cast(Obj<Fove_EyeShape>{}))
+	    , pupilShapeObj(py::cast(Fove_PupilShape{}))
+	    , bitmapImageObj(py::cast(Fove_BitmapImage{}))
+	{
+	}
+
+	py::object boolObj;
+	py::object intObj;
+	py::object floatObj;
+	py::object stringObj;
+	py::object eyeStateObj;
+	py::object calibrationStateObj;
+	py::object vec3Obj;
+	py::object vec2Obj;
+	py::object rayObj;
+	py::object poseObj;
+	py::object frameTimestampObj;
+	py::object matrix44Obj;
+	py::object eyeShapeObj;
+	py::object pupilShapeObj;
+	py::object bitmapImageObj;
+};
+
+} // namespace
+
+void defstruct_Scratch(py::module& m)
+{
+	py::class_<Scratch>(m, "Scratch",
+						R"(A preallocated set of reusable out-parameter wrappers
+
+Construct one (or call `scratch()`) outside a hot loop and pass its members as
+the out-parameters of the getters; every attribute access returns the same
+cached instance, so the loop performs no per-call allocations:
+
+    s = capi.scratch()
+    while running:
+        err = capi.Headset_getCombinedGazeDepth(headset, s.float)
+        depth = s.float.val
+
+Each Scratch holds exactly one instance per type, so a value is only valid
+until the next call that writes the same slot; use two Scratch objects to hold
+e.g. left- and right-eye results of one type at the same time.)")
+		.def(py::init<>(), "Preallocates one wrapper instance of each type")
+		.def_readonly("bool", &Scratch::boolObj, "The reusable `Bool` instance")
+		.def_readonly("int", &Scratch::intObj, "The reusable `Int` instance")
+		.def_readonly("float", &Scratch::floatObj, "The reusable `Float` instance")
+		.def_readonly("string", &Scratch::stringObj, "The reusable `String` instance")
+		.def_readonly("eyeState", &Scratch::eyeStateObj, "The reusable `EyeStateObj` instance")
+		.def_readonly("calibrationState", &Scratch::calibrationStateObj, "The reusable `CalibrationStateObj` instance")
+		.def_readonly("vec3", &Scratch::vec3Obj, "The reusable `Vec3` instance")
+		.def_readonly("vec2", &Scratch::vec2Obj, "The reusable `Vec2` instance")
+		.def_readonly("ray", &Scratch::rayObj, "The reusable `Ray` instance")
+		.def_readonly("pose", &Scratch::poseObj, "The reusable `Pose` instance")
+		.def_readonly("frameTimestamp", &Scratch::frameTimestampObj, "The reusable `FrameTimestamp` instance")
+		.def_readonly("matrix44", &Scratch::matrix44Obj, "The reusable `Matrix44` instance")
+		.def_readonly("eyeShape", &Scratch::eyeShapeObj, "The reusable `EyeShape` instance")
+		.def_readonly("pupilShape", &Scratch::pupilShapeObj, "The reusable `PupilShape` instance")
+		.def_readonly("bitmapImage", &Scratch::bitmapImageObj, "The reusable `BitmapImage` instance");
+
+	m.def(
+		"scratch", [] { return Scratch(); },
+		"Returns a fresh `Scratch` pool of reusable out-parameter wrappers");
+}
+
+////////////////////////////////////////////////////////////////
+// Fastcall getter dispatch
+
+namespace
+{
+
+// METH_FASTCALL binding of the hottest per-frame getters. pybind11's generic
+// dispatcher builds an argument tuple and runs keyword and overload
+// processing on every call, which for these tiny out-parameter getters costs
+// more than the fove_* call itself. The trampolines below instead receive the
+// arguments as a plain C array (the vectorcall convention), cast them with
+// the same pybind11 casters the regular bindings use, and call the fove_*
+// function directly. The signatures are positional-only: keyword arguments
+// are not accepted, which these bindings never documented anyway. Per-call
+// latency instrumentation is preserved by giving each target the same
+// PerfRecord that FOVE_PERF would use.
+//
+// Measured against bench_getter (the regular m.def dispatch of the same
+// shape) in src/bench/bindings_bench.cpp, the fastcall path saves roughly
+// 100 ns per call; see BM_FastcallGetter there for the current number.
+struct FastcallTarget
+{
+	void* fn;         // the fove_* function this entry dispatches to
+	PerfRecord* perf; // the same record FOVE_PERF would use for that function
+	PyMethodDef def;  // must outlive the bound function object
+};
+
+// Deque so addresses stay stable: Python holds on to both the PyMethodDef
+// and the capsule pointer for the lifetime of the process
+std::deque<FastcallTarget>& fastcallTargets()
+{
+	static std::deque<FastcallTarget> targets;
+	return targets;
+}
+
+FastcallTarget& fastcallTarget(PyObject* const self)
+{
+	return *static_cast<FastcallTarget*>(PyCapsule_GetPointer(self, nullptr));
+}
+
+// Maps the bound out-parameter reference to the pointer the C function takes
+template <typename T>
+T* fastcallOutPtr(T& out) { return &out; }
+template <typename T>
+T* fastcallOutPtr(Obj<T>& out) { return out; }
+
+// The C out type behind a bound out-parameter type (unwraps Obj<>)
+template <typename Wrapper>
+struct FastcallOutType
+{
+	using type = Wrapper;
+};
+template <typename T>
+struct FastcallOutType<Obj<T>>
+{
+	using type = T;
+};
+
+PyObject* fastcallBadArguments(const FastcallTarget& target)
+{
+	return PyErr_Format(PyExc_TypeError, "%s(): incompatible positional-only arguments", target.def.ml_name);
+}
+
+// Trampoline for the `(headset) -> err` shape; releases the GIL around the
+// call, as its one user (the blocking waitForProcessedEyeFrame) requires
+PyObject* fastcallHeadset(PyObject* const self, PyObject* const* args, const Py_ssize_t nargs)
+{
+	FastcallTarget& target = fastcallTarget(self);
+	if (nargs != 1)
+		return PyErr_Format(PyExc_TypeError, "%s() takes 1 positional argument (%zd given)", target.def.ml_name, nargs);
+	try
+	{
+		if (connectionDown())
+			return py::cast(applyErrorPolicy(Fove_ErrorCode::Connect_NotConnected)).release().ptr();
+		Headset& headset = py::handle(args[0]).cast<Headset&>();
+		const auto fn = reinterpret_cast<Fove_ErrorCode (*)(Fove_Headset*)>(target.fn);
+		Fove_ErrorCode err;
+		{
+			py::gil_scoped_release release;
+			err = perfMeasure(*target.perf, [&] { return fn(headset); });
+		}
+		noteConnectionError(err);
+		return py::cast(applyErrorPolicy(err)).release().ptr();
+	}
+	catch (const py::cast_error&)
+	{
+		return fastcallBadArguments(target);
+	}
+	catch (const ErrorPolicyViolation& e)
+	{
+		PyErr_SetObject(errorPolicyExceptionType, py::cast(e.code).ptr());
+		return nullptr;
+	}
+	catch (py::error_already_set& e)
+	{
+		e.restore();
+		return nullptr;
+	}
+}
+
+// Trampoline for the `(headset, out) -> err` getter shape
+template <typename Wrapper>
+PyObject* fastcallHeadsetOut(PyObject* const self, PyObject* const* args, const Py_ssize_t nargs)
+{
+	FastcallTarget& target = fastcallTarget(self);
+	if (nargs != 2)
+		return PyErr_Format(PyExc_TypeError, "%s() takes 2 positional arguments (%zd given)", target.def.ml_name, nargs);
+	try
+	{
+		if (connectionDown())
+			return py::cast(applyErrorPolicy(Fove_ErrorCode::Connect_NotConnected)).release().ptr();
+		Headset& headset = py::handle(args[0]).cast<Headset&>();
+		Wrapper& out = py::handle(args[1]).cast<Wrapper&>();
+		using Out = typename FastcallOutType<Wrapper>::type;
+		const auto fn = reinterpret_cast<Fove_ErrorCode (*)(Fove_Headset*, Out*)>(target.fn);
+		const Fove_ErrorCode err = perfMeasure(*target.perf, [&] { return fn(headset, fastcallOutPtr(out)); });
+		noteConnectionError(err);
+		return py::cast(applyErrorPolicy(err)).release().ptr();
+	}
+	catch (const py::cast_error&)
+	{
+		return fastcallBadArguments(target);
+	}
+	catch (const ErrorPolicyViolation& e)
+	{
+		PyErr_SetObject(errorPolicyExceptionType, py::cast(e.code).ptr());
+		return nullptr;
+	}
+	catch (py::error_already_set& e)
+	{
+		e.restore();
+		return nullptr;
+	}
+}
+
+// Trampoline for the `(headset, eye, out) -> err` getter shape
+template <typename Wrapper>
+PyObject* fastcallHeadsetEyeOut(PyObject* const self, PyObject* const* args, const Py_ssize_t nargs)
+{
+	FastcallTarget& target = fastcallTarget(self);
+	if (nargs != 3)
+		return PyErr_Format(PyExc_TypeError, "%s() takes 3 positional arguments (%zd given)", target.def.ml_name, nargs);
+	try
+	{
+		if (connectionDown())
+			return py::cast(applyErrorPolicy(Fove_ErrorCode::Connect_NotConnected)).release().ptr();
+		Headset& headset = py::handle(args[0]).cast<Headset&>();
+		const Fove_Eye eye = py::handle(args[1]).cast<Fove_Eye>();
+		Wrapper& out = py::handle(args[2]).cast<Wrapper&>();
+		using Out = typename FastcallOutType<Wrapper>::type;
+		const auto fn = reinterpret_cast<Fove_ErrorCode (*)(Fove_Headset*, Fove_Eye, Out*)>(target.fn);
+		const Fove_ErrorCode err = perfMeasure(*target.perf, [&] { return fn(headset, eye, fastcallOutPtr(out)); });
+		noteConnectionError(err);
+		return py::cast(applyErrorPolicy(err)).release().ptr();
+	}
+	catch (const py::cast_error&)
+	{
+		return fastcallBadArguments(target);
+	}
+	catch (const ErrorPolicyViolation& e)
+	{
+		PyErr_SetObject(errorPolicyExceptionType, py::cast(e.code).ptr());
+		return nullptr;
+	}
+	catch (py::error_already_set& e)
+	{
+		e.restore();
+		return nullptr;
+	}
+}
+
+using FastcallImpl = PyObject* (*)(PyObject*, PyObject* const*, Py_ssize_t);
+
+// Registers one METH_FASTCALL function on the module; used in place of m.def
+// for the getters above, with the same name and docstring conventions
+void defFastcall(py::module& m, const char* const name, const FastcallImpl impl, void* const fn, const char* const perfName, const char* const doc)
+{
+	fastcallTargets().push_back({fn, &perfRegistry().lookup(perfName), {}});
+	FastcallTarget& target = fastcallTargets().back();
+	target.def = {name, reinterpret_cast<PyCFunction>(impl), METH_FASTCALL, doc};
+	const py::capsule self{static_cast<void*>(&target)};
+	PyObject* const func = PyCFunction_NewEx(&target.def, self.ptr(), nullptr);
+	if (!func)
+		throw py::error_already_set();
+	m.attr(name) = py::reinterpret_steal<py::object>(func);
+}
+
+// Names the perf record after the target function, like FOVE_PERF does
+#define FOVE_DEF_FASTCALL(m, pyName, impl, fn, doc) \
+	defFastcall(m, pyName, impl, reinterpret_cast<void*>(&fn), #fn, doc)
+
+} // namespace
+
 void bind_CAPIs(py::module& m)
 {
 	m.def("logText", &fove_logText,
@@ -2111,7 +9799,10 @@ void bind_CAPIs(py::module& m)
 	// - "A pointer" -> "Fove_Headset" object
 	m.def(
 		"createHeadset", [](const Fove_ClientCapabilities capabilities, Headset& outHeadset) {
-			return fove_createHeadset(capabilities, outHeadset);
+			const Fove_ErrorCode err = FOVE_PERF_DIRECT(fove_createHeadset(capabilities, outHeadset));
+			if (err == Fove_ErrorCode::None)
+				noteCapabilitiesRegistered(outHeadset, capabilities); // seed the capability cache
+			return err;
 		},
 		R"(Creates and returns an Fove_Headset object, which is the entry point to the entire API
 
@@ -2123,7 +9814,13 @@ The result headset should be destroyed using `Headset_destroy` when no longer ne
 
 	m.def(
 		"Headset_destroy", [](Headset& headset) {
-			return fove_Headset_destroy(headset);
+			forgetWarmRevalidation(headset); // drained before the handle dies
+			forgetCapabilities(headset);
+			forgetStartupInfo(headset);
+			forgetGazeHistory(headset);
+			gazeFilter().forget(headset);
+			forgetBoundedWait(headset);
+			return FOVE_PERF_DIRECT(fove_Headset_destroy(headset));
 		},
 		R"(Frees resources used by a headset object, including memory and sockets
 
@@ -2131,9 +9828,65 @@ Upon return, this headset pointer, and any research headsets from it, should no
 \see createHeadset
 )");
 
+	m.def(
+		"acquire_shared_headset", [](const Fove_ClientCapabilities capabilities, Headset& outHeadset) {
+			Fove_Headset* headset = nullptr;
+			const Fove_ErrorCode err = sharedHeadsetPool().acquire(capabilities, headset);
+			if (err == Fove_ErrorCode::None)
+				outHeadset.val = headset;
+			return err;
+		},
+		py::arg("capabilities"), py::arg("out_headset"),
+		R"(Acquires the process-wide shared service connection
+
+The first acquisition performs the full `createHeadset` handshake; later ones
+reuse the same underlying headset and only register whichever of the requested
+capabilities no current holder has asked for yet, making them effectively
+free. Every successful acquisition must be balanced by a
+`release_shared_headset` with the same capability set; the connection is torn
+down by the last release. `fove.headset.Headset` goes through this pool by
+default.
+
+\param capabilities The capabilities this holder needs
+\param out_headset A Fove_Headset object where the shared headset is written upon success
+\return #Fove_ErrorCode_None on success\n
+        Otherwise, the error of the handshake or of the capability registration
+\see release_shared_headset
+)");
+
+	m.def(
+		"release_shared_headset", [](Headset& headset, const Fove_ClientCapabilities capabilities) {
+			bool destroyed = false;
+			const Fove_ErrorCode err = sharedHeadsetPool().release(headset, capabilities, destroyed);
+			if (destroyed)
+			{
+				forgetStartupInfo(headset);
+				forgetGazeHistory(headset);
+				gazeFilter().forget(headset);
+				forgetBoundedWait(headset);
+			}
+			return err;
+		},
+		py::arg("headset"), py::arg("capabilities"),
+		R"(Releases one acquisition of the shared service connection
+
+Capabilities no remaining holder requested are unregistered again, and the
+last release destroys the underlying headset.
+
+\param headset The shared headset written by `acquire_shared_headset`
+\param capabilities The capability set passed to the matching acquire
+\return #Fove_ErrorCode_None on success\n
+        #Fove_ErrorCode_API_InvalidArgument if the headset is not the shared one or no holder acquired with this capability set
+\see acquire_shared_headset
+)");
+
+	m.def(
+		"shared_headset_holders", [] { return sharedHeadsetPool().holderCount(); },
+		"Number of live acquisitions of the shared service connection (0 means disconnected)");
+
 	m.def(
 		"Headset_isHardwareConnected", [](Headset& headset, Obj<bool>& outConnected) {
-			return fove_Headset_isHardwareConnected(headset, outConnected);
+			return FOVE_PERF(fove_Headset_isHardwareConnected(headset, outConnected));
 		},
 		R"(Writes out whether an HMD is know to be connected or not
 
@@ -2144,7 +9897,7 @@ Upon return, this headset pointer, and any research headsets from it, should no
 
 	m.def(
 		"Headset_isMotionReady", [](Headset& headset, Obj<bool>& outMotionReady) {
-			return fove_Headset_isMotionReady(headset, outMotionReady);
+			return FOVE_PERF(fove_Headset_isMotionReady(headset, outMotionReady));
 		},
 		R"(Writes out whether motion tracking hardware has started
 
@@ -2152,7 +9905,7 @@ Upon return, this headset pointer, and any research headsets from it, should no
 
 	m.def(
 		"Headset_checkSoftwareVersions", [](Headset& headset) {
-			return fove_Headset_checkSoftwareVersions(headset);
+			return FOVE_PERF(fove_Headset_checkSoftwareVersions(headset));
 		},
 		R"(Checks whether the client can run against the installed version of the FOVE SDK
 
@@ -2256,14 +10009,142 @@ Allows you to get serial number, manufacturer, and model name of the headset.
 )");
 
 	m.def(
-		"Headset_registerCapabilities", [](Headset& headset, Fove_ClientCapabilities caps) {
-			return fove_Headset_registerCapabilities(headset, caps);
-		},
+		"Headset_getStartupInfo", [](Headset& headset, const bool force) {
+			if (!force)
+			{
+				std::lock_guard<std::mutex> lock(startupInfoMutex);
+				const auto it = startupInfoCache.find(headset);
+				if (it != startupInfoCache.end())
+					return it->second;
+			}
+			StartupInfo info = queryStartupInfo(headset); // blocking; done outside the cache lock
+			if (info.versionsError == Fove_ErrorCode::None && info.hardwareError == Fove_ErrorCode::None && info.licensesError == Fove_ErrorCode::None)
+			{
+				std::lock_guard<std::mutex> lock(startupInfoMutex);
+				startupInfoCache[headset] = info;
+			}
+			return info;
+		},
+		py::arg("headset"), py::arg("force") = false,
+		R"(Returns the software versions, hardware info and licenses in one call
+
+The first successful call performs the three underlying queries (including the
+two-call array-size dance of `Headset_queryLicenses`) in a single binding
+crossing and caches the result per headset, so polling this for health checks
+costs a map lookup afterwards. A snapshot with any failed query is not cached
+and is re-queried on the next call; `Headset_destroy` drops the cache entry.
+
+\param force Set to `True` to bypass the cache and contact the service again
+\return The `StartupInfo` record; check its three error fields individually
+\see Headset_querySoftwareVersions
+\see Headset_queryHardwareInfo
+\see Headset_queryLicenses
+)");
+
+	m.def(
+		"Headset_getStartupInfoWarm", [](Headset& headset, const std::string& path) {
+			Fove_Headset* const rawHeadset = headset;
+			{
+				std::lock_guard<std::mutex> lock(startupInfoMutex);
+				const auto it = startupInfoCache.find(rawHeadset);
+				if (it != startupInfoCache.end())
+					return it->second; // already validated this session; the disk copy has nothing newer
+			}
+			std::vector<StartupInfo> entries;
+			{
+				std::lock_guard<std::mutex> lock(warmStartFileMutex);
+				entries = warmStartRead(path);
+			}
+			if (entries.empty())
+			{
+				// Cold start: nothing usable on disk, pay the round-trips up front
+				StartupInfo info = queryStartupInfo(rawHeadset);
+				if (info.versionsError == Fove_ErrorCode::None && info.hardwareError == Fove_ErrorCode::None && info.licensesError == Fove_ErrorCode::None)
+				{
+					{
+						std::lock_guard<std::mutex> lock(startupInfoMutex);
+						startupInfoCache[rawHeadset] = info;
+					}
+					warmStartStore(path, info);
+				}
+				return info;
+			}
+
+			// Warm start: serve the most recently validated device immediately and
+			// revalidate against the service off-thread. The thread is registered
+			// per headset and joined by Headset_destroy (and the last shared-pool
+			// release) before the native handle is freed, so it never queries a
+			// dangling handle; it touches no Python state, so interpreter teardown
+			// does not need to wait on it either.
+			StartupInfo cached = entries.back();
+			std::thread revalidate([rawHeadset, path] {
+				try
+				{
+					const StartupInfo fresh = queryStartupInfo(rawHeadset);
+					if (fresh.versionsError == Fove_ErrorCode::None && fresh.hardwareError == Fove_ErrorCode::None && fresh.licensesError == Fove_ErrorCode::None)
+					{
+						{
+							std::lock_guard<std::mutex> lock(startupInfoMutex);
+							startupInfoCache[rawHeadset] = fresh;
+						}
+						warmStartStore(path, fresh);
+					}
+				}
+				catch (const ErrorPolicyViolation&)
+				{
+					// raise_on policy fired off the Python call boundary; treat as a failed revalidation
+				}
+			});
+			{
+				std::lock_guard<std::mutex> lock(warmRevalidateMutex);
+				std::thread& slot = warmRevalidations()[rawHeadset];
+				if (slot.joinable())
+					slot.join(); // an earlier revalidation of this headset, finished or nearly so
+				slot = std::move(revalidate);
+			}
+			return cached;
+		},
+		py::arg("headset"), py::arg("path"),
+		R"(Like `Headset_getStartupInfo`, but served from an on-disk cache on a warm start
+
+On the first run (or with no readable cache file) this behaves like
+`Headset_getStartupInfo`: the three queries block, and on full success the
+snapshot is written to `path`, keyed by headset serial. On subsequent runs the
+most recently validated device's record is returned immediately from the file
+— removing the handshake round-trips from the first-frame critical path — and
+a background thread revalidates against the service, updating both the
+in-process cache and the file, so a later `Headset_getStartupInfo` call (and
+the next run) sees fresh data. The file holds one record per serial, replaced
+on each successful revalidation.
+
+A record served from disk can be stale (e.g. after a runtime upgrade or a
+headset swap); treat it as provisional until the revalidation lands. The cache
+file is best effort: write failures are silent and a corrupt file is simply
+ignored.
+
+\param path Where to persist the cache, e.g. somewhere under the user's application data directory
+\return The `StartupInfo` record; check its three error fields individually
+\see Headset_getStartupInfo
+)");
+
+	m.def(
+		"Headset_registerCapabilities", [](Headset& headset, Fove_ClientCapabilities caps, const bool force) {
+			if (!force && capabilitiesAlreadyRegistered(headset, caps))
+				return Fove_ErrorCode::None; // all requested capabilities already active, skip the IPC round-trip
+			const Fove_ErrorCode err = FOVE_PERF(fove_Headset_registerCapabilities(headset, caps));
+			if (err == Fove_ErrorCode::None)
+				noteCapabilitiesRegistered(headset, caps);
+			return err;
+		},
+		py::arg("headset"), py::arg("caps"), py::arg("force") = false,
 		R"(Registers a client capability, enabling the required hardware as needed
 
 Usually you provide the required capabilities at the creation of the headset
 But you can add and remove capabilities anytime while the object is alive.
+The registered set is cached locally: when every requested capability is already
+active, the call returns immediately without contacting the service.
 \param caps A set of capabilities to register. Registering an existing capability is a no-op
+\param force Set to `True` to contact the service even if the local cache says all capabilities are active
 \return #Fove_ErrorCode_None if the capability has been properly registered
         #Fove_ErrorCode_Connect_NotConnected if not connected to the service
         #Fove_ErrorCode_License_FeatureAccessDenied if your license doesn't offer access to this capability
@@ -2271,7 +10152,7 @@ But you can add and remove capabilities anytime while the object is alive.
 	
 	m.def(
 		"Headset_registerPassiveCapabilities", [](Headset& headset, Fove_ClientCapabilities caps) {
-			return fove_Headset_registerPassiveCapabilities(headset, caps);
+			return FOVE_PERF(fove_Headset_registerPassiveCapabilities(headset, caps));
 		},
 		R"(Registers passive capabilities for this client
 
@@ -2297,14 +10178,24 @@ But you can add and remove capabilities anytime while the object is alive.
 )");
 
 	m.def(
-		"Headset_unregisterCapabilities", [](Headset& headset, Fove_ClientCapabilities caps) {
-			return fove_Headset_unregisterCapabilities(headset, caps);
-		},
+		"Headset_unregisterCapabilities", [](Headset& headset, Fove_ClientCapabilities caps, const bool force) {
+			if (!force && capabilitiesAlreadyUnregistered(headset, caps))
+				return Fove_ErrorCode::None; // none of the requested capabilities are active, skip the IPC round-trip
+			const Fove_ErrorCode err = FOVE_PERF(fove_Headset_unregisterCapabilities(headset, caps));
+			if (err == Fove_ErrorCode::None)
+				noteCapabilitiesUnregistered(headset, caps);
+			return err;
+		},
+		py::arg("headset"), py::arg("caps"), py::arg("force") = false,
 		R"(Unregisters passive capabilities previously registered by this client
 	Removes passive capabilities previously added by `fove_registerPassiveCapabilities`.
 
 	It has no effect on active capabilities registered with `fove_registerCapabilities` or `fove_createHeadset`.
 
+	The registered set is cached locally: when none of the requested capabilities
+	are known to be active, the call returns immediately without contacting the
+	service (pass `force=True` to bypass the cache).
+
 	\param caps A set of capabilities to unregister. Unregistering an not-existing capability is a no-op
 	\return #Fove_ErrorCode_None if the capability has been properly unregistered\n
 	        #Fove_ErrorCode_API_InvalidArgument if the headset object is invalid\n
@@ -2315,17 +10206,18 @@ But you can add and remove capabilities anytime while the object is alive.
 
 	m.def(
 		"Headset_unregisterPassiveCapabilities", [](Headset& headset, Fove_ClientCapabilities caps) {
-			return fove_Headset_unregisterPassiveCapabilities(headset, caps);
+			return FOVE_PERF(fove_Headset_unregisterPassiveCapabilities(headset, caps));
 		},
 		R"(Unregisters a client capability previously registered
 \param caps A set of capabilities to unregister. Unregistering an not-existing capability is a no-op
 \return #Fove_ErrorCode_None if the capability has been properly unregistered
 )");
 
-	m.def(
-		"Headset_waitForProcessedEyeFrame", [](Headset& headset) {
-			return fove_Headset_waitForProcessedEyeFrame(headset);
-		},
+	// Routed through the timed wrapper (keeping the usual perf record name) so
+	// wait-deadline overruns feed the always-on frame_health accounting
+	defFastcall(
+		m, "Headset_waitForProcessedEyeFrame", fastcallHeadset,
+		reinterpret_cast<void*>(&waitForProcessedEyeFrameTimed), "fove_Headset_waitForProcessedEyeFrame",
 		R"(Waits for next eye camera frame to be processed
 
 Allows you to sync your eye tracking loop to the actual eye-camera loop.
@@ -2333,17 +10225,61 @@ On each loop, you would first call this blocking function to wait for the next e
 then update the local cache of eye tracking data using the fetch functions,
 and finally get the desired eye tracking data using the getters.
 
+The GIL is released while waiting, so other Python threads keep running during the wait.
+
+The wait duration additionally feeds the `frame_health` accounting, so deadline
+overruns are counted without any further instrumentation.
+
 Eye tracking should be enabled by registering the `Fove_ClientCapabilities_EyeTracking` before calling this function.
 
 \return #Fove_ErrorCode_None if the call succeeded
 	    #Fove_ErrorCode_Connect_NotConnected if not connected to the service
 	    #Fove_ErrorCode_API_NotRegistered if the required capability has not been registered prior to this call
+\see frame_health
+)");
+
+	m.def(
+		"Headset_waitForProcessedEyeFrameTimeout", [](Headset& headset, const uint64_t timeoutUs) {
+			return waitForProcessedEyeFrameBounded(headset, timeoutUs);
+		},
+		py::arg("headset"), py::arg("timeout_us"),
+		py::call_guard<py::gil_scoped_release>(),
+		R"(Bounded variant of `Headset_waitForProcessedEyeFrame`
+
+Waits for the next processed eye frame, but for at most `timeout_us`
+microseconds: when the service stalls, the call returns
+#Fove_ErrorCode_API_Timeout instead of blocking the loop indefinitely, so
+housekeeping (watchdog kicks, UI, shutdown checks) runs at a guaranteed
+cadence. The first call starts a persistent native waiter thread for the
+headset which runs the real service wait in a loop; this call merely waits on
+its frame counter with a deadline, and the GIL is released throughout. Waits
+feed the `frame_health` accounting exactly like the unbounded variant.
+
+A timeout does not consume the frame: if one arrives right after, the next
+call returns immediately.
+
+\param timeout_us The longest time to wait, in microseconds
+\return #Fove_ErrorCode_None if a frame was processed within the timeout
+	    #Fove_ErrorCode_API_Timeout if not
+	    Otherwise, the error of the underlying wait (e.g. #Fove_ErrorCode_Connect_NotConnected)
+\see Headset_waitForProcessedEyeFrame, frame_health
 )");
 
 	m.def(
 		"Headset_fetchEyeTrackingData", [](Headset& headset, Fove_FrameTimestamp* out) {
-			return fove_Headset_fetchEyeTrackingData(headset, out);
+			const Fove_ErrorCode err = FOVE_PERF(fove_Headset_fetchEyeTrackingData(headset, out));
+			if (err == Fove_ErrorCode::None && out)
+			{
+				clockSync().observe(out->timestamp); // feed the clock-domain estimator
+				recordGazeAge(out->timestamp);
+				frameHealthObserveId(out->id);
+				pushGazeSample(headset, out->timestamp); // keep the getGazeAt history current
+				gazeEventEngine().feed(headset, out->timestamp);
+				gazeFilter().feed(headset, out->timestamp);
+			}
+			return err;
 		},
+		py::call_guard<py::gil_scoped_release>(),
 		R"(Fetch the latest eye tracking data from the runtime service
 
 This function updates a local cache of eye tracking data, which other getters will fetch from.
@@ -2396,8 +10332,9 @@ Eye tracking should be enabled by registering the `Fove_ClientCapabilities_EyeTr
 
 	m.def(
 		"Headset_fetchEyesImage", [](Headset& headset, Fove_FrameTimestamp* out) {
-			return fove_Headset_fetchEyesImage(headset, out);
+			return FOVE_PERF(fove_Headset_fetchEyesImage(headset, out));
 		},
+		py::call_guard<py::gil_scoped_release>(),
 		R"(Fetch the latest eyes camera image from the runtime service
 
 This function updates a local cache of eyes image, that can be retrieved through `fove_Headset_getEyesImage`.
@@ -2420,11 +10357,96 @@ Eyes image capability should be enabled by registering `Fove_ClientCapabilities_
 \see    fove_Headset_getEyesImage
 \see    fove_Headset_fetchEyeTrackingData
 \see    fove_Headset_waitForProcessedEyeFrame
+)");
+
+	m.def(
+		"Headset_fetchFrame", [](Headset& headset, const bool fetchImage, Fove_FrameTimestamp* outDataTimestamp, Fove_FrameTimestamp* outImageTimestamp) {
+			const Fove_ErrorCode dataErr = FOVE_PERF(fove_Headset_fetchEyeTrackingData(headset, outDataTimestamp));
+			const Fove_ErrorCode imageErr = fetchImage
+												? FOVE_PERF(fove_Headset_fetchEyesImage(headset, outImageTimestamp))
+												: Fove_ErrorCode::None;
+			return py::make_tuple(dataErr, imageErr);
+		},
+		py::arg("headset"), py::arg("fetch_image"), py::arg("outDataTimestamp"), py::arg("outImageTimestamp"),
+		R"(Fetches the latest eye tracking data and, optionally, the eyes image in one call
+
+Combines `fove_Headset_fetchEyeTrackingData` and `fove_Headset_fetchEyesImage` into a single
+binding crossing: both caches are updated back to back, and both frame timestamps are written
+out together so the caller can verify in one place whether the gaze data and the image come
+from the same frame.
+
+The relevant capabilities (`Fove_ClientCapabilities_EyeTracking`, and
+`Fove_ClientCapabilities_EyesImage` when fetching the image) should be registered beforehand.
+
+\param fetch_image Whether to also fetch the eyes image
+\param outDataTimestamp A pointer to write the frame timestamp of the fetched eye tracking data. If null, the timestamp is not written.
+\param outImageTimestamp A pointer to write the frame timestamp of the fetched image; untouched when `fetch_image` is False. If null, the timestamp is not written.
+\return A tuple `(dataError, imageError)` with the error codes of the two fetches
+        (`imageError` is #Fove_ErrorCode_None when `fetch_image` is False); each fetch
+        reports the same error codes as its standalone counterpart
+\see    fove_Headset_fetchEyeTrackingData
+\see    fove_Headset_fetchEyesImage
+)");
+
+	m.def(
+		"Headset_getGazeAt", [](Headset& headset, const uint64_t timestampUs) -> py::tuple {
+			// Snapshot the bracketing samples under the lock, interpolate outside it
+			GazeSample s0 = {}, s1 = {};
+			bool found = false;
+			{
+				std::lock_guard<std::mutex> lock(gazeHistoryMutex);
+				const auto it = gazeHistories.find(headset);
+				if (it != gazeHistories.end() && it->second.count >= 2)
+				{
+					const GazeHistory& history = it->second;
+					const size_t oldest = history.count < gazeHistoryCapacity ? 0 : history.next;
+					for (size_t i = 0; i + 1 < history.count; ++i)
+					{
+						const GazeSample& a = history.samples[(oldest + i) % gazeHistoryCapacity];
+						const GazeSample& b = history.samples[(oldest + i + 1) % gazeHistoryCapacity];
+						if (a.timestampUs <= timestampUs && timestampUs <= b.timestampUs)
+						{
+							s0 = a;
+							s1 = b;
+							found = true;
+							break;
+						}
+					}
+				}
+			}
+			if (!found)
+				return py::make_tuple(Fove_ErrorCode::Data_NoUpdate, py::none());
+			const GazeSample sample = interpolateGazeSamples(s0, s1, timestampUs);
+			py::dict result;
+			result["timestamp"] = sample.timestampUs;
+			result["gazeVectorLeft"] = sample.gazeLeft;
+			result["gazeVectorRight"] = sample.gazeRight;
+			result["combinedRay"] = sample.combinedRay;
+			result["combinedDepth"] = sample.combinedDepth;
+			result["pupilRadiusLeft"] = sample.pupilLeft;
+			result["pupilRadiusRight"] = sample.pupilRight;
+			return py::make_tuple(Fove_ErrorCode::None, result);
+		},
+		py::arg("headset"), py::arg("timestamp_us"),
+		R"(Returns the gaze interpolated at an arbitrary timestamp from the native history
+
+Every successful `Headset_fetchEyeTrackingData` appends the frame's gaze channels
+to a short per-headset ring (about half a second); this interpolates between the
+two samples bracketing the requested time — spherical interpolation for the gaze
+directions, linear for the scalars — so event-locked analysis needs no
+Python-side frame buffer.
+
+\param timestamp_us The timestamp to sample at, in the `FrameTimestamp` domain
+\return The tuple `(err, sample)`: on #Fove_ErrorCode_None, `sample` is a dict with
+        `timestamp`, `gazeVectorLeft`/`gazeVectorRight` (`Vec3`), `combinedRay` (`Ray`),
+        `combinedDepth`, `pupilRadiusLeft`/`pupilRadiusRight`;
+        #Fove_ErrorCode_Data_NoUpdate (with `None`) if the timestamp is outside the buffered span
+\see Headset_fetchEyeTrackingData
 )");
 
 	m.def(
 		"Headset_getEyeTrackingDataTimestamp", [](Headset& headset, Fove_FrameTimestamp* out) {
-			return fove_Headset_getEyeTrackingDataTimestamp(headset, out);
+			return FOVE_PERF(fove_Headset_getEyeTrackingDataTimestamp(headset, out));
 		},
 		R"(Writes out the eye frame timestamp of the cached eye tracking data
 
@@ -2441,7 +10463,7 @@ Basically returns the timestamp returned by the last call to `fove_Headset_fetch
 
 	m.def(
 		"Headset_getEyesImageTimestamp", [](Headset& headset, Fove_FrameTimestamp* out) {
-			return fove_Headset_getEyesImageTimestamp(headset, out);
+			return FOVE_PERF(fove_Headset_getEyesImageTimestamp(headset, out));
 		},
 		R"(Writes out the eye frame timestamp of the cached eyes image
 
@@ -2456,10 +10478,8 @@ Basically returns the timestamp returned by the last call to `fove_Headset_fetch
 	    #Fove_ErrorCode_API_NullInPointer if outTimestamp is null
 )");
 
-	m.def(
-		"Headset_getGazeVector", [](Headset& headset, Fove_Eye eye, Fove_Vec3& out) {
-			return fove_Headset_getGazeVector(headset, eye, &out);
-		},
+	FOVE_DEF_FASTCALL(
+		m, "Headset_getGazeVector", fastcallHeadsetEyeOut<Fove_Vec3>, fove_Headset_getGazeVector,
 		R"(Writes out the gaze vector of an individual eye
 
 `Fove_ClientCapabilities_EyeTracking` should be registered to use this function.
@@ -2475,10 +10495,8 @@ Basically returns the timestamp returned by the last call to `fove_Headset_fetch
 		#Fove_ErrorCode_API_NullInPointer if both outVector is `nullptr`
 )");
 
-	m.def(
-		"Headset_getGazeVectorRaw", [](Headset& headset, Fove_Eye eye, Fove_Vec3& out) {
-			return fove_Headset_getGazeVectorRaw(headset, eye, &out);
-		},
+	FOVE_DEF_FASTCALL(
+		m, "Headset_getGazeVectorRaw", fastcallHeadsetEyeOut<Fove_Vec3>, fove_Headset_getGazeVectorRaw,
 		R"(Writes out the raw gaze vector of an individual eye
 
 Returns the eye gaze vector without any final smoothing or compensatory processing.
@@ -2498,9 +10516,30 @@ Some processing inherent to the eye tracker logic that can't avoided still happe
 )");
 
 	m.def(
-		"Headset_getGazeScreenPosition", [](Headset& headset, Fove_Eye eye, Fove_Vec2& out) {
-			return fove_Headset_getGazeScreenPosition(headset, eye, &out);
+		"Headset_getGazeVectorFiltered", [](Headset& headset, Fove_Eye eye, Fove_Vec3& out) {
+			return gazeFilter().get(headset, eye, out);
 		},
+		R"(Writes out the custom-filtered gaze vector of an individual eye
+
+Returns the raw gaze vector passed through the filter stage configured with
+`set_gaze_filter`. The filter runs at fetch time inside
+`Headset_fetchEyeTrackingData`, so this is a plain read; its state restarts
+automatically after tracking loss.
+
+`Fove_ClientCapabilities_EyeTracking` should be registered to use this function.
+
+\param eye Specify which eye to get the value for
+\param outVector A pointer to the filtered gaze vector to write to
+\return #Fove_ErrorCode_None if the call succeeded
+        #Fove_ErrorCode_API_NotRegistered if no filter is configured (kind `"none"`)
+        #Fove_ErrorCode_Data_NoUpdate if no frame has passed through the filter yet
+        #Fove_ErrorCode_Data_LowAccuracy if the underlying raw data is of low accuracy
+        Otherwise, the error the raw gaze channel reported at the last fetch
+\see set_gaze_filter
+)");
+
+	FOVE_DEF_FASTCALL(
+		m, "Headset_getGazeScreenPosition", fastcallHeadsetEyeOut<Fove_Vec2>, fove_Headset_getGazeScreenPosition,
 		R"(Writes out the user's 2D gaze position on the screens seen through the HMD's lenses
 
 The use of lenses and distortion correction creates a screen in front of each eye.
@@ -2526,10 +10565,8 @@ Top-Right: (1, 1)
 		#Fove_ErrorCode_API_NullInPointer if both outPos is `nullptr`
 )");
 
-	m.def(
-		"Headset_getGazeScreenPositionCombined", [](Headset& headset, Fove_Vec2& out) {
-			return fove_Headset_getGazeScreenPositionCombined(headset, &out);
-		},
+	FOVE_DEF_FASTCALL(
+		m, "Headset_getGazeScreenPositionCombined", fastcallHeadsetOut<Fove_Vec2>, fove_Headset_getGazeScreenPositionCombined,
 		R"(Writes out the user's 2D gaze position on a virtual screen in front of the user.
 
 This is a 2D equivalent of `fove_Headset_getCombinedGazeRay`, and is perhaps the simplest gaze estimation function.
@@ -2558,10 +10595,8 @@ Top-Right: (1, 1)
 		#Fove_ErrorCode_API_NullInPointer if both outPos is `nullptr`
 )");
 
-	m.def(
-		"Headset_getCombinedGazeRay", [](Headset& headset, Fove_Ray& out) {
-			return fove_Headset_getCombinedGazeRay(headset, &out);
-		},
+	FOVE_DEF_FASTCALL(
+		m, "Headset_getCombinedGazeRay", fastcallHeadsetOut<Fove_Ray>, fove_Headset_getCombinedGazeRay,
 		R"(Writes out eyes gaze ray resulting from the two eye gazes combined together
 
 `Fove_ClientCapabilities_EyeTracking` should be registered to use this function.
@@ -2578,10 +10613,8 @@ To get individual eye rays use `fove_Headset_getGazeVectors` instead
 		#Fove_ErrorCode_API_NullInPointer if `outRay` is `nullptr`
 )");
 
-	m.def(
-		"Headset_getCombinedGazeDepth", [](Headset& headset, Obj<float>& out) {
-			return fove_Headset_getCombinedGazeDepth(headset, out);
-		},
+	FOVE_DEF_FASTCALL(
+		m, "Headset_getCombinedGazeDepth", fastcallHeadsetOut<Obj<float>>, fove_Headset_getCombinedGazeDepth,
 		R"(Writes out eyes gaze depth resulting from the two eye gazes combined together
 
 `Fove_ClientCapabilities_GazeDepth` should be registered to use this function.
@@ -2597,9 +10630,59 @@ To get individual eye rays use `fove_Headset_getGazeVectors` instead
 )");
 
 	m.def(
-		"Headset_isUserShiftingAttention", [](Headset& headset, Obj<bool>& out) {
-			return fove_Headset_isUserShiftingAttention(headset, out);
-		},
+		"Headset_getEyeTrackingSnapshot", [](Headset& headset, Python_EyeTrackingSnapshot& out) {
+			const Fove_ErrorCode fetchErr = fove_Headset_fetchEyeTrackingData(headset, &out.timestamp);
+			out.errGazeVectorLeft = fove_Headset_getGazeVector(headset, Fove_Eye::Left, &out.gazeVectorLeft);
+			out.errGazeVectorRight = fove_Headset_getGazeVector(headset, Fove_Eye::Right, &out.gazeVectorRight);
+			out.errGazeVectorRawLeft = fove_Headset_getGazeVectorRaw(headset, Fove_Eye::Left, &out.gazeVectorRawLeft);
+			out.errGazeVectorRawRight = fove_Headset_getGazeVectorRaw(headset, Fove_Eye::Right, &out.gazeVectorRawRight);
+			out.errPupilRadiusLeft = fove_Headset_getPupilRadius(headset, Fove_Eye::Left, &out.pupilRadiusLeft);
+			out.errPupilRadiusRight = fove_Headset_getPupilRadius(headset, Fove_Eye::Right, &out.pupilRadiusRight);
+			out.errIrisRadiusLeft = fove_Headset_getIrisRadius(headset, Fove_Eye::Left, &out.irisRadiusLeft);
+			out.errIrisRadiusRight = fove_Headset_getIrisRadius(headset, Fove_Eye::Right, &out.irisRadiusRight);
+			out.errEyeStateLeft = fove_Headset_getEyeState(headset, Fove_Eye::Left, &out.eyeStateLeft);
+			out.errEyeStateRight = fove_Headset_getEyeState(headset, Fove_Eye::Right, &out.eyeStateRight);
+			out.errEyeBlinkingLeft = fove_Headset_isEyeBlinking(headset, Fove_Eye::Left, &out.eyeBlinkingLeft);
+			out.errEyeBlinkingRight = fove_Headset_isEyeBlinking(headset, Fove_Eye::Right, &out.eyeBlinkingRight);
+			out.errCombinedRay = fove_Headset_getCombinedGazeRay(headset, &out.combinedRay);
+			out.errCombinedDepth = fove_Headset_getCombinedGazeDepth(headset, &out.combinedDepth);
+			fillGazeKinematics(out, out.errGazeVectorRawLeft == Fove_ErrorCode::None,
+							   out.errGazeVectorRawRight == Fove_ErrorCode::None,
+							   out.errEyeBlinkingLeft == Fove_ErrorCode::None && out.eyeBlinkingLeft,
+							   out.errEyeBlinkingRight == Fove_ErrorCode::None && out.eyeBlinkingRight,
+							   out.timestamp.timestamp);
+			return fetchErr;
+		},
+		R"(Fetches the latest eye tracking data and writes out all per-frame eye data in one call
+
+This is a batched convenience over `fove_Headset_fetchEyeTrackingData` followed by the individual
+per-frame getters (gaze vectors, raw gaze vectors, pupil and iris radii, eye states, blink states,
+combined gaze ray and depth). All values come from the same frame, and only one binding call is paid
+per frame instead of one per getter.
+
+The snapshot additionally carries the derived per-eye gaze kinematics channels
+(`gazeVelocityLeft`/`gazeVelocityRight` in degrees/second and
+`gazeAccelerationLeft`/`gazeAccelerationRight` in degrees/second^2), computed natively by
+differentiating consecutive raw gaze directions; they read NaN until enough valid history
+exists (see `gaze_kinematics_config`).
+
+Note that this updates the local eye tracking data cache, like an explicit fetch call would.
+
+The capabilities corresponding to the channels you intend to consume should be registered beforehand;
+channels whose capability is missing simply report #Fove_ErrorCode_API_NotRegistered in their `err*` field.
+
+\param outSnapshot The snapshot record to fill
+\return The error code of the data fetch:\n
+        #Fove_ErrorCode_None if the call succeeded\n
+        #Fove_ErrorCode_Data_NoUpdate if not connected to the service or if the service hasn't written any data out yet\n
+        #Fove_ErrorCode_API_NotRegistered if no relevant capability has been registered prior to this call\n
+        Per-channel error codes are written into the `err*` fields of the snapshot.
+\see    fove_Headset_fetchEyeTrackingData
+\see    fove_Headset_waitForProcessedEyeFrame
+)");
+
+	FOVE_DEF_FASTCALL(
+		m, "Headset_isUserShiftingAttention", fastcallHeadsetOut<Obj<bool>>, fove_Headset_isUserShiftingAttention,
 		R"(Writes out whether the user is shifting its attention between objects or looking at something specific (fixation or pursuit).
 
 This can be used to ignore eye data during large eye motions when the user is not looking at anything specific.
@@ -2616,10 +10699,8 @@ This can be used to ignore eye data during large eye motions when the user is no
 		#Fove_ErrorCode_API_NullInPointer if `outIsShiftingAttention` is `nullptr`
 )");
 
-	m.def(
-		"Headset_getEyeState", [](Headset& headset, Fove_Eye eye, Obj<Fove_EyeState>& out) {
-			return fove_Headset_getEyeState(headset, eye, out);
-		},
+	FOVE_DEF_FASTCALL(
+		m, "Headset_getEyeState", fastcallHeadsetEyeOut<Obj<Fove_EyeState>>, fove_Headset_getEyeState,
 		R"(Writes out the state of an individual eye
 
 `Fove_ClientCapabilities_EyeTracking` should be registered to use this function.
@@ -2635,10 +10716,8 @@ This can be used to ignore eye data during large eye motions when the user is no
 		#Fove_ErrorCode_API_NullInPointer if `outState` is `nullptr`
 )");
 
-	m.def(
-		"Headset_isEyeBlinking", [](Headset& headset, Fove_Eye eye, Obj<bool>& out) {
-			return fove_Headset_isEyeBlinking(headset, eye, out);
-		},
+	FOVE_DEF_FASTCALL(
+		m, "Headset_isEyeBlinking", fastcallHeadsetEyeOut<Obj<bool>>, fove_Headset_isEyeBlinking,
 		R"( Writes out whether the user is currently performing a blink for the given eye
 
 `Fove_ClientCapabilities_EyeBlink` should be registered to use this function.
@@ -2654,10 +10733,8 @@ This can be used to ignore eye data during large eye motions when the user is no
 		#Fove_ErrorCode_API_NullInPointer if `out` is `nullptr`
 )");
 
-	m.def(
-		"Headset_getEyeBlinkCount", [](Headset& headset, Fove_Eye eye, Obj<int>& out) {
-			return fove_Headset_getEyeBlinkCount(headset, eye, out);
-		},
+	FOVE_DEF_FASTCALL(
+		m, "Headset_getEyeBlinkCount", fastcallHeadsetEyeOut<Obj<int>>, fove_Headset_getEyeBlinkCount,
 		R"( Writes out the number of blink performed for the given eye since the eye tracking service started
 
 To count the number blinks performed during a given period of time call this function at the
@@ -2678,7 +10755,9 @@ beginning and at the end of the period and make the subtraction of the two value
 
 	m.def(
 		"Headset_isEyeTrackingEnabled", [](Headset& headset, Obj<bool>& outEyeTrackingEnabled) {
-			return fove_Headset_isEyeTrackingEnabled(headset, outEyeTrackingEnabled);
+			return cachedStatusQuery("isEyeTrackingEnabled", headset, outEyeTrackingEnabled, [&] {
+				return FOVE_PERF(fove_Headset_isEyeTrackingEnabled(headset, outEyeTrackingEnabled));
+			});
 		},
 		R"(Writes out whether the eye tracking hardware has started
 
@@ -2691,7 +10770,9 @@ beginning and at the end of the period and make the subtraction of the two value
 
 	m.def(
 		"Headset_isEyeTrackingCalibrated", [](Headset& headset, Obj<bool>& outEyeTrackingCalibrated) {
-			return fove_Headset_isEyeTrackingCalibrated(headset, outEyeTrackingCalibrated);
+			return cachedStatusQuery("isEyeTrackingCalibrated", headset, outEyeTrackingCalibrated, [&] {
+				return FOVE_PERF(fove_Headset_isEyeTrackingCalibrated(headset, outEyeTrackingCalibrated));
+			});
 		},
 		R"(Writes out whether eye tracking has been calibrated
 
@@ -2707,7 +10788,7 @@ beginning and at the end of the period and make the subtraction of the two value
 
 	m.def(
 		"Headset_isEyeTrackingCalibrating", [](Headset& headset, Obj<bool>& outEyeTrackingCalibrating) {
-			return fove_Headset_isEyeTrackingCalibrating(headset, outEyeTrackingCalibrating);
+			return FOVE_PERF(fove_Headset_isEyeTrackingCalibrating(headset, outEyeTrackingCalibrating));
 		},
 		R"(Writes out whether eye tracking is in the process of performing a calibration
 
@@ -2723,7 +10804,9 @@ beginning and at the end of the period and make the subtraction of the two value
 
 	m.def(
 		"Headset_isEyeTrackingCalibratedForGlasses", [](Headset& headset, Obj<bool>& out) {
-			return fove_Headset_isEyeTrackingCalibratedForGlasses(headset, out);
+			return cachedStatusQuery("isEyeTrackingCalibratedForGlasses", headset, out, [&] {
+				return FOVE_PERF(fove_Headset_isEyeTrackingCalibratedForGlasses(headset, out));
+			});
 		},
 		R"(Writes out whether the eye tracking system is currently calibrated for glasses.
 
@@ -2743,7 +10826,7 @@ This function returns 'Data_Uncalibrated' if the eye tracking system has not bee
 
 	m.def(
 		"Headset_isHmdAdjustmentGuiVisible", [](Headset& headset, Obj<bool>& outVisible) {
-			return fove_Headset_isHmdAdjustmentGuiVisible(headset, outVisible);
+			return FOVE_PERF(fove_Headset_isHmdAdjustmentGuiVisible(headset, outVisible));
 		},
 		R"(Writes out whether or not the GUI that asks the user to adjust their headset is being displayed
 
@@ -2759,7 +10842,7 @@ This function returns 'Data_Uncalibrated' if the eye tracking system has not bee
 
 	m.def(
 		"Headset_hasHmdAdjustmentGuiTimeout", [](Headset& headset, Obj<bool>& out) {
-			return fove_Headset_hasHmdAdjustmentGuiTimeout(headset, out);
+			return FOVE_PERF(fove_Headset_hasHmdAdjustmentGuiTimeout(headset, out));
 		},
 		R"(Writes out whether or not the GUI that asks the user to adjust their headset was hidden by timeout
 
@@ -2773,10 +10856,8 @@ This function returns 'Data_Uncalibrated' if the eye tracking system has not bee
 		#Fove_ErrorCode_API_NullInPointer if `outTimeout` is `nullptr`
 )");
 
-	m.def(
-		"Headset_isEyeTrackingReady", [](Headset& headset, Obj<bool>& outEyeTrackingReady) {
-			return fove_Headset_isEyeTrackingReady(headset, outEyeTrackingReady);
-		},
+	FOVE_DEF_FASTCALL(
+		m, "Headset_isEyeTrackingReady", fastcallHeadsetOut<Obj<bool>>, fove_Headset_isEyeTrackingReady,
 		R"(Writes out whether eye tracking is actively tracking an eye - or eyes
 
 `Fove_ClientCapabilities_EyeTracking` should be registered to use this function.
@@ -2789,10 +10870,8 @@ This function returns 'Data_Uncalibrated' if the eye tracking system has not bee
 		#Fove_ErrorCode_API_NullInPointer if `outEyeTrackingReady` is `nullptr`
 )");
 
-	m.def(
-		"Headset_isUserPresent", [](Headset& headset, Obj<bool>& out) {
-			return fove_Headset_isUserPresent(headset, out);
-		},
+	FOVE_DEF_FASTCALL(
+		m, "Headset_isUserPresent", fastcallHeadsetOut<Obj<bool>>, fove_Headset_isUserPresent,
 		R"(Writes out whether the user is wearing the headset or not
 
 When user is not present Eye tracking values shouldn't be used, as invalid.
@@ -2811,7 +10890,7 @@ When user is not present Eye tracking values shouldn't be used, as invalid.
 
 	m.def(
 		"Headset_getEyesImage", [](Headset& headset, Fove_BitmapImage& outImage) {
-			return fove_Headset_getEyesImage(headset, &outImage);
+			return FOVE_PERF(fove_Headset_getEyesImage(headset, &outImage));
 		},
 		R"(Returns the eyes camera image
 
@@ -2831,9 +10910,38 @@ The image data buffer is invalidated upon the next call to this function.
 )");
 
 	m.def(
-		"Headset_getUserIPD", [](Headset& headset, Obj<float>& out) {
-			return fove_Headset_getUserIPD(headset, out);
-		},
+		"Headset_getEyesImageArray", [](py::object headsetObj) {
+			Headset& headset = headsetObj.cast<Headset&>();
+			Fove_BitmapImage image = {};
+			const Fove_ErrorCode err = fove_Headset_getEyesImage(headset, &image);
+			if (err != Fove_ErrorCode::None)
+				return py::make_tuple(err, image.timestamp, py::none());
+			// Alias the SDK's cached image buffer directly; the headset object is used
+			// as the array base so the headset cannot be destroyed under the view.
+			py::array array{py::dtype::of<unsigned char>(),
+							{static_cast<py::ssize_t>(image.image.length)},
+							{static_cast<py::ssize_t>(1)},
+							image.image.data,
+							headsetObj};
+			return py::make_tuple(err, image.timestamp, array);
+		},
+		R"(Returns the eyes camera image as a numpy array without copying
+
+A zero-copy variant of `Headset_getEyesImage`: the returned array of bytes (the raw BMP data,
+header included) aliases the SDK's cached image buffer instead of copying it.
+
+The aliased buffer is overwritten by the next image fetch, so consume or copy the array
+before fetching again; a view held across fetches observes the newer frame's data.
+
+`Fove_ClientCapabilities_EyesImage` should be registered to use this function.
+
+\return A tuple `(error, timestamp, array)` where `array` is None unless `error` is #Fove_ErrorCode_None.
+        The error codes are the same as for `Headset_getEyesImage`.
+\see    Headset_getEyesImage
+)");
+
+	FOVE_DEF_FASTCALL(
+		m, "Headset_getUserIPD", fastcallHeadsetOut<Obj<float>>, fove_Headset_getUserIPD,
 		R"(Returns the user IPD (Inter Pupillary Distance), in meters
 
 `Fove_ClientCapabilities_UserIPD` should be registered to use this function.
@@ -2848,10 +10956,8 @@ The image data buffer is invalidated upon the next call to this function.
 		#Fove_ErrorCode_API_NullInPointer if `outIPD` is `nullptr`
 )");
 
-	m.def(
-		"Headset_getUserIOD", [](Headset& headset, Obj<float>& out) {
-			return fove_Headset_getUserIOD(headset, out);
-		},
+	FOVE_DEF_FASTCALL(
+		m, "Headset_getUserIOD", fastcallHeadsetOut<Obj<float>>, fove_Headset_getUserIOD,
 		R"(Returns the user IOD (Inter Occular Distance), in meters
 
 `Fove_ClientCapabilities_UserIOD` should be registered to use this function.
@@ -2866,10 +10972,8 @@ The image data buffer is invalidated upon the next call to this function.
 		#Fove_ErrorCode_API_NullInPointer if `outIPD` is `nullptr`
 )");
 
-	m.def(
-		"Headset_getPupilRadius", [](Headset& headset, Fove_Eye eye, Obj<float>& out) {
-			return fove_Headset_getPupilRadius(headset, eye, out);
-		},
+	FOVE_DEF_FASTCALL(
+		m, "Headset_getPupilRadius", fastcallHeadsetEyeOut<Obj<float>>, fove_Headset_getPupilRadius,
 		R"(Returns the user pupils radius, in meters
 
 `Fove_ClientCapabilities_PupilRadius` should be registered to use this function.
@@ -2885,10 +10989,8 @@ The image data buffer is invalidated upon the next call to this function.
 		#Fove_ErrorCode_API_NullInPointer if both `outRadius` is `nullptr`
 )");
 
-	m.def(
-		"Headset_getIrisRadius", [](Headset& headset, Fove_Eye eye, Obj<float>& out) {
-			return fove_Headset_getIrisRadius(headset, eye, out);
-		},
+	FOVE_DEF_FASTCALL(
+		m, "Headset_getIrisRadius", fastcallHeadsetEyeOut<Obj<float>>, fove_Headset_getIrisRadius,
 		R"(Returns the user iris radius, in meters
 
 `Fove_ClientCapabilities_IrisRadius` should be registered to use this function.
@@ -2904,10 +11006,8 @@ The image data buffer is invalidated upon the next call to this function.
 		#Fove_ErrorCode_API_NullInPointer if both `outRadius` is `nullptr`
 )");
 
-	m.def(
-		"Headset_getEyeballRadius", [](Headset& headset, Fove_Eye eye, Obj<float>& out) {
-			return fove_Headset_getEyeballRadius(headset, eye, out);
-		},
+	FOVE_DEF_FASTCALL(
+		m, "Headset_getEyeballRadius", fastcallHeadsetEyeOut<Obj<float>>, fove_Headset_getEyeballRadius,
 		R"(Returns the user eyeballs radius, in meters
 
 `Fove_ClientCapabilities_EyeballRadius` should be registered to use this function.
@@ -2923,10 +11023,8 @@ The image data buffer is invalidated upon the next call to this function.
 		#Fove_ErrorCode_API_NullInPointer if both `outRadius` is `nullptr`
 )");
 
-	m.def(
-		"Headset_getEyeTorsion", [](Headset& headset, Fove_Eye eye, Obj<float>& out) {
-			return fove_Headset_getEyeTorsion(headset, eye, out);
-		},
+	FOVE_DEF_FASTCALL(
+		m, "Headset_getEyeTorsion", fastcallHeadsetEyeOut<Obj<float>>, fove_Headset_getEyeTorsion,
 		R"(Returns the user eye torsion, in degrees
 
 `Fove_ClientCapabilities_EyeTorsion` should be registered to use this function.
@@ -2945,7 +11043,7 @@ The image data buffer is invalidated upon the next call to this function.
 
 	m.def(
 		"Headset_getEyeShape", [](Headset& headset, Fove_Eye eye, Python_EyeShape& out) {
-			return fove_Headset_getEyeShape(headset, eye, out);
+			return FOVE_PERF(fove_Headset_getEyeShape(headset, eye, out));
 		},
 		R"(Returns the outline shape of the specified user eye in the Eyes camera image.
 
@@ -2965,7 +11063,7 @@ The image data buffer is invalidated upon the next call to this function.
 
 	m.def(
 		"Headset_getPupilShape", [](Headset& headset, Fove_Eye eye, Fove_PupilShape& out) {
-			return fove_Headset_getPupilShape(headset, eye, &out);
+			return FOVE_PERF(fove_Headset_getPupilShape(headset, eye, &out));
 		},
 		R"(Returns the pupil ellipse of the specified user eye in the Eyes camera image.
 
@@ -2982,9 +11080,10 @@ The image data buffer is invalidated upon the next call to this function.
         #Fove_ErrorCode_License_FeatureAccessDenied if the current license is not sufficient for this feature
 )");
 
+#if FOVE_HAS_FEATURE(FOVE_FEATURE_CALIBRATION_GUI)
 	m.def(
 		"Headset_startHmdAdjustmentProcess", [](Headset& headset, bool lazy) {
-			return fove_Headset_startHmdAdjustmentProcess(headset, lazy);
+			return FOVE_PERF(fove_Headset_startHmdAdjustmentProcess(headset, lazy));
 		},
 		R"(Start the HMD adjustment process. Doing this will display the HMD adjustment GUI.
 
@@ -2998,7 +11097,7 @@ The image data buffer is invalidated upon the next call to this function.
 
 	m.def(
 		"Headset_tickHmdAdjustmentProcess", [](Headset& headset, float deltaTime, bool isVisible, Fove_HmdAdjustmentData& data) {
-			return fove_Headset_tickHmdAdjustmentProcess(headset, deltaTime, isVisible, &data);
+			return FOVE_PERF(fove_Headset_tickHmdAdjustmentProcess(headset, deltaTime, isVisible, &data));
 		},
 		R"(Tick the current HMD adjustment process and retrieve data information to render the current HMD positioning state
 
@@ -3027,8 +11126,9 @@ before the HMD adjustment processes is marked as completed by the `IsHmdAdjustme
 
 	m.def(
 		"Headset_startEyeTrackingCalibration", [](Headset& headset, const Fove_CalibrationOptions& options) {
-			return fove_Headset_startEyeTrackingCalibration(headset, &options);
+			return FOVE_PERF(fove_Headset_startEyeTrackingCalibration(headset, &options));
 		},
+		py::call_guard<py::gil_scoped_release>(),
 		R"(Starts eye tracking calibration
 
 `Fove_ClientCapabilities_EyeTracking` should be registered to use this function.
@@ -3039,11 +11139,13 @@ before the HMD adjustment processes is marked as completed by the `IsHmdAdjustme
 	    #Fove_ErrorCode_Connect_NotConnected if not connected to the service
 	    #Fove_ErrorCode_License_FeatureAccessDenied if any of the enabled options require a license beyond what is active on this machine
 )");
+#endif // FOVE_FEATURE_CALIBRATION_GUI
 
 	m.def(
 		"Headset_stopEyeTrackingCalibration", [](Headset& headset) {
-			return fove_Headset_stopEyeTrackingCalibration(headset);
+			return FOVE_PERF(fove_Headset_stopEyeTrackingCalibration(headset));
 		},
+		py::call_guard<py::gil_scoped_release>(),
 		R"(Stops eye tracking calibration if it's running, does nothing if it's not running.
 
 `Fove_ClientCapabilities_EyeTracking` should be registered to use this function.
@@ -3055,7 +11157,7 @@ before the HMD adjustment processes is marked as completed by the `IsHmdAdjustme
 
 	m.def(
 		"Headset_getEyeTrackingCalibrationState", [](Headset& headset, Obj<Fove_CalibrationState>& state) {
-			return fove_Headset_getEyeTrackingCalibrationState(headset, state);
+			return FOVE_PERF(fove_Headset_getEyeTrackingCalibrationState(headset, state));
 		},
 		R"(Get the state of the currently running calibration process.
 
@@ -3069,17 +11171,18 @@ before the HMD adjustment processes is marked as completed by the `IsHmdAdjustme
 		#Fove_ErrorCode_API_NullInPointer if `outCalibrationState` is `nullptr`
 )");
 
+#if FOVE_HAS_FEATURE(FOVE_FEATURE_CALIBRATION_GUI)
 	m.def(
 		"Headset_getEyeTrackingCalibrationStateDetails", [](Headset& headset, CalibrationData& data) {
 			auto callback = [](const Fove_CalibrationData* nativeData, void* userData) {
-				auto* data = reinterpret_cast<CalibrationData*>(userData);
-				*data = CalibrationData::FromNative(nativeData);
+				reinterpret_cast<CalibrationData*>(userData)->assignFromNative(nativeData);
 			};
-			return fove_Headset_getEyeTrackingCalibrationStateDetails(headset, callback, &data);
+			return FOVE_PERF(fove_Headset_getEyeTrackingCalibrationStateDetails(headset, callback, &data));
 		},
 		R"(Get the detailed information about the state of the currently running calibration process.
 
-\param outCalibrationData The calibration current detailed state information
+\param outCalibrationData The calibration current detailed state information; updated in place,
+so the same object can be passed on every call without allocating
 
 When the calibration process is not running, this returns the final state of the previously run calibration process.
 Value is undefined if no calibration process has begun since the service was started.
@@ -3096,18 +11199,23 @@ Note that it is perfectly fine not to call this function, in which case the Fove
 	m.def(
 		"Headset_tickEyeTrackingCalibration", [](Headset& headset, float deltaTime, bool isVisible, CalibrationData& data) {
 			auto callback = [](const Fove_CalibrationData* nativeData, void* userData) {
-				auto* data = reinterpret_cast<CalibrationData*>(userData);
-				*data = CalibrationData::FromNative(nativeData);
+				reinterpret_cast<CalibrationData*>(userData)->assignFromNative(nativeData);
 			};
-			return fove_Headset_tickEyeTrackingCalibration(headset, deltaTime, isVisible, callback, &data);
+			const Fove_ErrorCode err = FOVE_PERF(fove_Headset_tickEyeTrackingCalibration(headset, deltaTime, isVisible, callback, &data));
+			if (err == Fove_ErrorCode::None)
+				calibrationTargetLerp().observe(data.targetL, data.targetR); // feed calibration_targets_at
+			return err;
 		},
+		py::call_guard<py::gil_scoped_release>(),
 		R"(Tick the current calibration process and retrieve data information to render the current calibration state.
 
 \param deltaTime The time elapsed since the last rendered frame
 \param isVisible Indicate to the calibration system that something is being drawn to the screen.
 This allows the calibration renderer to take as much time as it wants to display success/failure messages
 and animate away before the calibration processes is marked as completed by the `IsEyeTrackingCalibrating` function.
-\param outCalibrationData The calibration current state information
+\param outCalibrationData The calibration current state information; updated in place, so the
+same object can be passed every tick without allocating (the `stateInfo` string only touches
+the heap when the message actually changes)
 
 This function is how the client declares to the calibration system that is available to render calibration.
 The calibration system determines which of the available renderers has the highest priority,
@@ -3126,9 +11234,38 @@ Note that it is perfectly fine not to call this function, in which case the Fove
         #Fove_ErrorCode_Calibration_OtherRendererPrioritized if another process has currently the priority for rendering calibration process
 )");
 
+	m.def(
+		"calibration_targets_at", [](const uint64_t nowUs) -> py::object {
+			Fove_CalibrationTarget left = {}, right = {};
+			if (!calibrationTargetLerp().at(nowUs != 0 ? nowUs : ClockSync::hostNowUs(), left, right))
+				return py::none();
+			return py::make_tuple(left, right);
+		},
+		py::arg("now_us") = 0,
+		R"(Returns the calibration targets interpolated between the last two ticks
+
+`Headset_tickEyeTrackingCalibration` records its targets against the host
+monotonic clock; this call serves positions (and recommended sizes) linearly
+interpolated between the last two recorded ticks. A 120 Hz renderer can thus
+tick the service at a fraction of the display rate and still draw smooth
+target motion every frame, instead of paying the full tick cost per frame.
+
+Interpolated motion lags one tick interval behind the service. A gap of more
+than half a second between ticks resets the history, so resuming calibration
+does not sweep the target across the screen.
+
+\param now_us The host monotonic time to interpolate at, in microseconds
+       (0, the default, uses the current time)
+\return A `(left, right)` tuple of `CalibrationTarget`, or `None` if no tick
+        was recorded yet
+\see Headset_tickEyeTrackingCalibration
+)");
+#endif // FOVE_FEATURE_CALIBRATION_GUI
+
+#if FOVE_HAS_FEATURE(FOVE_FEATURE_GAZABLE_OBJECTS)
 	m.def(
 		"Headset_getGazedObjectId", [](Headset& headset, Obj<int>& id) {
-			return fove_Headset_getGazedObjectId(headset, id);
+			return FOVE_PERF(fove_Headset_getGazedObjectId(headset, id));
 		},
 		R"(Get the id of the object gazed by the user.
 
@@ -3151,7 +11288,7 @@ To use this function, you need to register the `Fove_ClientCapabilities_GazedObj
 
 	m.def(
 		"Headset_registerGazableObject", [](Headset& headset, const Fove_GazableObject& gazableObj) {
-			return fove_Headset_registerGazableObject(headset, &gazableObj);
+			return FOVE_PERF(fove_Headset_registerGazableObject(headset, &gazableObj));
 		},
 		R"(Registers an object in the 3D world
 
@@ -3171,11 +11308,185 @@ Connection to the service is not required for object registration, thus you can
 \see                fove_Headset_updateGazableObject
 \see                fove_Headset_removeGazableObject
 \see                Fove_GazeConvergenceData
+)");
+
+	m.def(
+		"Headset_registerGazableObjects", [](Headset& headset, const std::vector<Fove_GazableObject>& objects) {
+			size_t registered = 0;
+			Fove_ErrorCode err = Fove_ErrorCode::None;
+			for (const Fove_GazableObject& object : objects)
+			{
+				err = fove_Headset_registerGazableObject(headset, &object);
+				if (err != Fove_ErrorCode::None)
+					break;
+				++registered;
+			}
+			return py::make_tuple(err, registered);
+		},
+		R"(Registers a batch of objects in the 3D world in a single call
+
+Equivalent to calling `Headset_registerGazableObject` once per object, but the loop runs
+in the binding layer so that only one Python call is paid for the whole scene.
+
+Registration stops at the first failing object.
+
+\param objects      The descriptions of the objects to register. Data is copied and no reference is kept to this memory after return.
+\return             A tuple `(error, count)` where `count` is the number of successfully registered objects
+                    and `error` is #Fove_ErrorCode_None if all of them were, or the error of the first failing object:\n
+                    #Fove_ErrorCode_API_InvalidArgument if an object is invalid in any way (such as an invalid object id)\n
+                    #Fove_ErrorCode_Object_AlreadyRegistered if an object with same id is already registered
+\see                fove_Headset_registerGazableObject
+\see                fove_Headset_removeGazableObject
+)");
+
+	m.def(
+		"create_collider_mesh", [](const FloatBatch& vertices, const py::object indices) -> int {
+			const py::ssize_t vertexCount = batchLength(vertices, 3, "vertices");
+			auto mesh = std::make_shared<SharedColliderMesh>();
+			mesh->vertices.assign(vertices.data(), vertices.data() + vertexCount * 3);
+			if (!indices.is_none())
+			{
+				const auto indexArray = indices.cast<py::array_t<uint32_t, py::array::c_style | py::array::forcecast>>();
+				if (indexArray.ndim() != 1 || indexArray.shape(0) % 3 != 0)
+					throw std::runtime_error("indices must be a one-dimensional array with a multiple of 3 entries");
+				mesh->indices.assign(indexArray.data(), indexArray.data() + indexArray.shape(0));
+			}
+			else if (vertexCount % 3 != 0)
+				throw std::runtime_error("Without indices, the vertex count must be a multiple of 3 (a plain triangle list)");
+
+			std::lock_guard<std::mutex> lock(sharedMeshMutex);
+			const int handle = nextSharedMeshHandle++;
+			sharedMeshes.emplace(handle, std::move(mesh));
+			return handle;
+		},
+		py::arg("vertices"), py::arg("indices") = py::none(),
+		R"(Uploads a collider mesh once and returns a handle for instancing it
+
+The mesh data is copied into native storage a single time; any number of
+gazable objects can then reference it by handle (see
+`Headset_registerGazableObjectInstances` and `collider_mesh_from_handle`)
+instead of each registration carrying its own copy of the geometry.
+
+\param vertices A float array of shape [N, 3] with the mesh vertex positions
+\param indices An optional one-dimensional uint32 array of 3*T triangle indices; without it the vertices are taken as a plain triangle list
+\return The mesh handle, to be released with `release_collider_mesh`
+)");
+
+	m.def(
+		"release_collider_mesh", [](const int handle) {
+			std::lock_guard<std::mutex> lock(sharedMeshMutex);
+			return sharedMeshes.erase(handle) > 0;
+		},
+		py::arg("handle"),
+		R"(Releases a mesh uploaded with `create_collider_mesh`
+
+Registrations already made from the handle are unaffected (the runtime copied
+the data), but `ColliderMesh` objects obtained via `collider_mesh_from_handle`
+must no longer be used.
+
+\param handle The handle to release
+\return Whether the handle was valid
+)");
+
+	m.def(
+		"collider_mesh_from_handle", [](const int handle) {
+			return colliderMeshOf(*sharedMeshByHandle(handle));
+		},
+		py::arg("handle"),
+		R"(Returns a `ColliderMesh` referencing a mesh uploaded with `create_collider_mesh`
+
+The returned mesh aliases the shared native storage, so it can be placed in any
+number of `GazableObject` colliders without duplicating the geometry. Keep the
+handle alive (do not call `release_collider_mesh`) while the mesh is in use.
+
+\param handle The handle returned by `create_collider_mesh`
+\return A `ColliderMesh` aliasing the shared storage
+)");
+
+	m.def(
+		"Headset_registerGazableObjectInstances", [](Headset& headset, const int mesh, const py::array_t<int32_t, py::array::c_style | py::array::forcecast>& ids, const FloatBatch& poses, const Fove_ObjectGroup group) {
+			static_assert(sizeof(Fove_ObjectPose) == 13 * sizeof(float), "Fove_ObjectPose layout changed; update the instanced registration binding");
+			if (ids.ndim() != 1)
+				throw std::runtime_error("ids must be a one-dimensional array");
+			const py::ssize_t n = ids.shape(0);
+			if (batchLength(poses, 13, "poses") != n)
+				throw std::runtime_error("ids and poses must have the same length");
+
+			const std::shared_ptr<SharedColliderMesh> shared = sharedMeshByHandle(mesh);
+			Fove_ObjectCollider collider = {};
+			collider.shapeType = Fove_ColliderType::Mesh;
+			collider.shapeDefinition.mesh = colliderMeshOf(*shared);
+
+			Fove_GazableObject object = {};
+			object.group = group;
+			object.colliderCount = 1;
+			object.colliders = &collider;
+
+			const int32_t* const pIds = ids.data();
+			const float* const pPoses = poses.data();
+			size_t registered = 0;
+			Fove_ErrorCode err = Fove_ErrorCode::None;
+			for (py::ssize_t i = 0; i < n; ++i)
+			{
+				object.id = pIds[i];
+				std::memcpy(&object.pose, pPoses + i * 13, sizeof object.pose);
+				err = fove_Headset_registerGazableObject(headset, &object);
+				if (err != Fove_ErrorCode::None)
+					break;
+				++registered;
+			}
+			return py::make_tuple(err, registered);
+		},
+		py::arg("headset"), py::arg("mesh"), py::arg("ids"), py::arg("poses"), py::arg("group") = Fove_ObjectGroup::Group0,
+		R"(Registers many instances of one shared collider mesh in a single call
+
+The instanced counterpart of `Headset_registerGazableObjects`: every instance
+references the mesh uploaded once with `create_collider_mesh` and differs only
+in id and pose, so registering a scene full of identical props sends no
+per-instance copy of the geometry through Python.
+
+Registration stops at the first failing object.
+
+\param mesh The handle returned by `create_collider_mesh`
+\param ids An array of shape [N] with the ids to register
+\param poses An array of shape [N, 13] of float32 laid out like #Fove_ObjectPose:
+                    scale (x, y, z), rotation (x, y, z, w), position (x, y, z), velocity (x, y, z)
+\param group The gazable object group of all the instances
+\return             A tuple `(error, count)` where `count` is the number of successfully registered objects
+                    and `error` is #Fove_ErrorCode_None if all of them were, or the error of the first failing object
+\see                fove_Headset_registerGazableObject
+)");
+
+	m.def(
+		"Headset_removeGazableObjects", [](Headset& headset, const std::vector<int>& ids) {
+			size_t removed = 0;
+			Fove_ErrorCode err = Fove_ErrorCode::None;
+			for (const int id : ids)
+			{
+				err = fove_Headset_removeGazableObject(headset, id);
+				if (err != Fove_ErrorCode::None)
+					break;
+				++removed;
+			}
+			return py::make_tuple(err, removed);
+		},
+		R"(Removes a batch of previously registered 3D objects from the scene in a single call
+
+Equivalent to calling `Headset_removeGazableObject` once per id, but the loop runs in the binding layer.
+
+Removal stops at the first failing object.
+
+\param objectIds    Ids of the objects passed to the register calls
+\return             A tuple `(error, count)` where `count` is the number of successfully removed objects
+                    and `error` is #Fove_ErrorCode_None if all of them were, or the error of the first failing object:\n
+                    #Fove_ErrorCode_API_InvalidArgument if an object was not already registered
+\see                fove_Headset_registerGazableObjects
+\see                fove_Headset_removeGazableObject
 )");
 
 	m.def(
 		"Headset_updateGazableObject", [](Headset& headset, const int id, const Fove_ObjectPose& pose) {
-			return fove_Headset_updateGazableObject(headset, id, &pose);
+			return FOVE_PERF(fove_Headset_updateGazableObject(headset, id, &pose));
 		},
 		R"(Update a previously registered 3D object pose.
 
@@ -3186,11 +11497,52 @@ Connection to the service is not required for object registration, thus you can
                     #Fove_ErrorCode_API_InvalidArgument if the object was not already registered
 \see                fove_Headset_registerCameraObject
 \see                fove_Headset_removeGazableObject
+)");
+
+	m.def(
+		"Headset_updateGazableObjects", [](Headset& headset, const py::array_t<int32_t, py::array::c_style | py::array::forcecast>& ids, const FloatBatch& poses) {
+			static_assert(sizeof(Fove_ObjectPose) == 13 * sizeof(float), "Fove_ObjectPose layout changed; update the batch pose update binding");
+			if (ids.ndim() != 1)
+				throw std::runtime_error("ids must be a one-dimensional array");
+			const py::ssize_t n = ids.shape(0);
+			if (batchLength(poses, 13, "poses") != n)
+				throw std::runtime_error("ids and poses must have the same length");
+			const int32_t* const pIds = ids.data();
+			const float* const pPoses = poses.data();
+			size_t updated = 0;
+			Fove_ErrorCode err = Fove_ErrorCode::None;
+			for (py::ssize_t i = 0; i < n; ++i)
+			{
+				Fove_ObjectPose pose;
+				std::memcpy(&pose, pPoses + i * 13, sizeof pose);
+				err = fove_Headset_updateGazableObject(headset, pIds[i], &pose);
+				if (err != Fove_ErrorCode::None)
+					break;
+				++updated;
+			}
+			return py::make_tuple(err, updated);
+		},
+		py::arg("headset"), py::arg("ids"), py::arg("poses"),
+		R"(Updates the poses of a batch of previously registered 3D objects in a single call
+
+The per-frame counterpart of `Headset_registerGazableObjects`: updating all the moving
+objects of a scene costs one binding call instead of one per object.
+
+Updating stops at the first failing object.
+
+\param ids          An array of shape [N] with the ids of the objects to update
+\param poses        An array of shape [N, 13] of float32 laid out like #Fove_ObjectPose:
+                    scale (x, y, z), rotation (x, y, z, w), position (x, y, z), velocity (x, y, z)
+\return             A tuple `(error, count)` where `count` is the number of successfully updated objects
+                    and `error` is #Fove_ErrorCode_None if all of them were, or the error of the first failing object:\n
+                    #Fove_ErrorCode_API_InvalidArgument if an object was not already registered
+\see                fove_Headset_updateGazableObject
+\see                fove_Headset_registerGazableObjects
 )");
 
 	m.def(
 		"Headset_removeGazableObject", [](Headset& headset, const int id) {
-			return fove_Headset_removeGazableObject(headset, id);
+			return FOVE_PERF(fove_Headset_removeGazableObject(headset, id));
 		},
 		R"(Removes a previously registered 3D object from the scene.
 
@@ -3205,7 +11557,7 @@ Because of the asynchronous nature of the FOVE system, this object may still be
 
 	m.def(
 		"Headset_registerCameraObject", [](Headset& headset, const Fove_CameraObject& cameraObj) {
-			return fove_Headset_registerCameraObject(headset, &cameraObj);
+			return FOVE_PERF(fove_Headset_registerCameraObject(headset, &cameraObj));
 		},
 		R"(Registers an camera in the 3D world
 
@@ -3231,7 +11583,7 @@ Connection to the service is not required for object registration, thus you can
 
 	m.def(
 		"Headset_updateCameraObject", [](Headset& headset, const int id, const Fove_ObjectPose& pose) {
-			return fove_Headset_updateCameraObject(headset, id, &pose);
+			return FOVE_PERF(fove_Headset_updateCameraObject(headset, id, &pose));
 		},
 		R"(Update the pose of a registered camera
 
@@ -3245,7 +11597,7 @@ Connection to the service is not required for object registration, thus you can
 
 	m.def(
 		"Headset_removeCameraObject", [](Headset& headset, const int id) {
-			return fove_Headset_removeCameraObject(headset, id);
+			return FOVE_PERF(fove_Headset_removeCameraObject(headset, id));
 		},
 		R"(Removes a previously registered camera from the scene.
 
@@ -3255,10 +11607,11 @@ Connection to the service is not required for object registration, thus you can
 \see                fove_Headset_registerCameraObject
 \see                fove_Headset_updateCameraObject
 )");
+#endif // FOVE_FEATURE_GAZABLE_OBJECTS
 
 	m.def(
 		"Headset_tareOrientationSensor", [](Headset& headset) {
-			return fove_Headset_tareOrientationSensor(headset);
+			return FOVE_PERF(fove_Headset_tareOrientationSensor(headset));
 		},
 		R"(Tares the orientation of the headset
 
@@ -3272,7 +11625,7 @@ should be registered to use this function.
 
 	m.def(
 		"Headset_isPositionReady", [](Headset& headset, Obj<bool>& outPositionReady) {
-			return fove_Headset_isPositionReady(headset, outPositionReady);
+			return FOVE_PERF(fove_Headset_isPositionReady(headset, outPositionReady));
 		},
 		R"( Writes out whether position tracking hardware has started and returns whether it was successful
 
@@ -3288,7 +11641,7 @@ should be registered to use this function.
 
 	m.def(
 		"Headset_tarePositionSensors", [](Headset& headset) {
-			return fove_Headset_tarePositionSensors(headset);
+			return FOVE_PERF(fove_Headset_tarePositionSensors(headset));
 		},
 		R"(Tares the position of the headset
 
@@ -3301,8 +11654,12 @@ should be registered to use this function.
 
 	m.def(
 		"Headset_fetchPoseData", [](Headset& headset, Fove_FrameTimestamp* out) {
-			return fove_Headset_fetchPoseData(headset, out);
+			const Fove_ErrorCode err = FOVE_PERF(fove_Headset_fetchPoseData(headset, out));
+			if (err == Fove_ErrorCode::None && out)
+				clockSync().observe(out->timestamp); // feed the clock-domain estimator
+			return err;
 		},
+		py::call_guard<py::gil_scoped_release>(),
 		R"(Fetch the latest pose data, and cache it locally
 
 This function caches the headset pose for later retrieval by `fove_Headset_getPose`.
@@ -3326,8 +11683,9 @@ throughout all your update loop code.
 
 	m.def(
 		"Headset_fetchPositionImage", [](Headset& headset, Fove_FrameTimestamp* out) {
-			return fove_Headset_fetchPositionImage(headset, out);
+			return FOVE_PERF(fove_Headset_fetchPositionImage(headset, out));
 		},
+		py::call_guard<py::gil_scoped_release>(),
 		R"(Fetch the latest position camera image, and cache it locally
 
 This function caches the position camera image for later retrieval by `fove_Headset_getPositionImage`.
@@ -3348,7 +11706,7 @@ loop if needed to ensure consistent data throughout the update loop code.
 
 	m.def(
 		"Headset_getPoseDataTimestamp", [](Headset& headset, Fove_FrameTimestamp* out) {
-			return fove_Headset_getPoseDataTimestamp(headset, out);
+			return FOVE_PERF(fove_Headset_getPoseDataTimestamp(headset, out));
 		},
 		R"(Writes out the frame timestamp of the cached pose data
 
@@ -3363,7 +11721,7 @@ Basically returns the timestamp returned by the last call to `fove_Headset_fetch
 
 	m.def(
 		"Headset_getPositionImageTimestamp", [](Headset& headset, Fove_FrameTimestamp* out) {
-			return fove_Headset_getPositionImageTimestamp(headset, out);
+			return FOVE_PERF(fove_Headset_getPositionImageTimestamp(headset, out));
 		},
 		R"(Writes out the frame timestamp of the cached position image
 
@@ -3376,10 +11734,8 @@ Basically returns the timestamp returned by the last call to `fove_Headset_fetch
 	    #Fove_ErrorCode_API_NullInPointer if outTimestamp is null
 )");
 
-	m.def(
-		"Headset_getPose", [](Headset& headset, Fove_Pose& outPose) {
-			return fove_Headset_getPose(headset, &outPose);
-		},
+	FOVE_DEF_FASTCALL(
+		m, "Headset_getPose", fastcallHeadsetOut<Fove_Pose>, fove_Headset_getPose,
 		R"(Writes out the pose of the head-mounted display
 
 \param outPose  A pointer to the variable to be written
@@ -3394,7 +11750,7 @@ Basically returns the timestamp returned by the last call to `fove_Headset_fetch
 
 	m.def(
 		"Headset_getPositionImage", [](Headset& headset, Fove_BitmapImage& outImage) {
-			return fove_Headset_getPositionImage(headset, &outImage);
+			return FOVE_PERF(fove_Headset_getPositionImage(headset, &outImage));
 		},
 		R"(Returns the position camera image
 
@@ -3413,9 +11769,57 @@ The image data buffer is invalidated upon the next call to this function.
 		#Fove_ErrorCode_API_NullInPointer if `outImage` is `nullptr`
 )");
 
+	m.def(
+		"Headset_getPositionImageArray", [](py::object headsetObj, const uint64_t sinceTimestamp) {
+			Headset& headset = headsetObj.cast<Headset&>();
+			if (sinceTimestamp != 0)
+			{
+				// The timestamp query is much cheaper than materializing the
+				// image; skip delivery when the cached image has not advanced
+				Fove_FrameTimestamp timestamp = {};
+				if (fove_Headset_getPositionImageTimestamp(headset, &timestamp) == Fove_ErrorCode::None && timestamp.timestamp <= sinceTimestamp)
+					return py::make_tuple(Fove_ErrorCode::None, timestamp.timestamp, py::none());
+			}
+			Fove_BitmapImage image = {};
+			const Fove_ErrorCode err = fove_Headset_getPositionImage(headset, &image);
+			if (err != Fove_ErrorCode::None)
+				return py::make_tuple(err, image.timestamp, py::none());
+			// Alias the SDK's cached image buffer directly; the headset object is used
+			// as the array base so the headset cannot be destroyed under the view.
+			py::array array{py::dtype::of<unsigned char>(),
+							{static_cast<py::ssize_t>(image.image.length)},
+							{static_cast<py::ssize_t>(1)},
+							image.image.data,
+							headsetObj};
+			return py::make_tuple(err, image.timestamp, array);
+		},
+		py::arg("headset"), py::arg("since_timestamp") = 0,
+		R"(Returns the position camera image as a numpy array without copying
+
+A zero-copy variant of `Headset_getPositionImage`: the returned array of bytes (the raw
+BMP data, header included) aliases the SDK's cached image buffer instead of copying it.
+It feeds `decode_bitmap` and `ImageStream.publish` the same way the eyes image does.
+
+The position image has no wait/sync equivalent, so pollers pass the timestamp of the
+image they already delivered as `since_timestamp`: when the cached image has not advanced
+past it, the call answers with the cheap timestamp query alone and returns no array.
+
+The aliased buffer is overwritten by the next image fetch, so consume or copy the array
+before fetching again; a view held across fetches observes the newer frame's data.
+
+`Fove_ClientCapabilities_PositionImage` should be registered to use this function.
+
+\param headset The headset to read the cached position image from
+\param since_timestamp Timestamp of the last delivered image; `0` always delivers
+\return A tuple `(error, timestamp, array)` where `array` is None unless `error` is
+        #Fove_ErrorCode_None and the image is newer than `since_timestamp`.
+        The error codes are the same as for `Headset_getPositionImage`.
+\see    Headset_getPositionImage, Headset_getEyesImageArray
+)");
+
 	m.def(
 		"Headset_getProjectionMatricesLH", [](Headset& headset, const float zNear, const float zFar, Python_Matrix44& outLeftMat, Python_Matrix44& outRightMat) {
-			return fove_Headset_getProjectionMatricesLH(headset, zNear, zFar, outLeftMat, outRightMat);
+			return FOVE_PERF(fove_Headset_getProjectionMatricesLH(headset, zNear, zFar, outLeftMat, outRightMat));
 		},
 		R"(Writes out the values of passed-in left-handed 4x4 projection matrices
 
@@ -3434,7 +11838,7 @@ both to `nullptr` is considered invalid and will return `Fove_ErrorCode::API_Nul
 
 	m.def(
 		"Headset_getProjectionMatricesRH", [](Headset& headset, const float zNear, const float zFar, Python_Matrix44& outLeftMat, Python_Matrix44& outRightMat) {
-			return fove_Headset_getProjectionMatricesRH(headset, zNear, zFar, outLeftMat, outRightMat);
+			return FOVE_PERF(fove_Headset_getProjectionMatricesRH(headset, zNear, zFar, outLeftMat, outRightMat));
 		},
 		R"(Writes out the values of passed-in right-handed 4x4 projection matrices
 
@@ -3451,9 +11855,43 @@ both to `nullptr` is considered invalid and will return `Fove_ErrorCode::API_Nul
 		#Fove_ErrorCode_API_NullInPointer if both `outLeftMat` and `outRightMat` are `nullptr`
 )");
 
+	m.def(
+		"Headset_getProjectionMatrices", [](Headset& headset, const float zNear, const float zFar, py::array_t<float, py::array::c_style> out, const bool leftHanded) {
+			// Writes both eye matrices straight into the caller's [2, 4, 4] array,
+			// skipping the per-frame Matrix44 wrapper objects and their buffer
+			// exports that a render loop would otherwise construct every frame
+			if (out.ndim() != 3 || out.shape(0) != 2 || out.shape(1) != 4 || out.shape(2) != 4)
+				throw std::runtime_error("out must be a C-contiguous float32 array of shape [2, 4, 4]");
+			if (!out.writeable())
+				throw std::runtime_error("out must be writeable");
+			Fove_Matrix44* const mats = static_cast<Fove_Matrix44*>(out.request().ptr);
+			return FOVE_PERF(leftHanded
+								 ? fove_Headset_getProjectionMatricesLH(headset, zNear, zFar, &mats[0], &mats[1])
+								 : fove_Headset_getProjectionMatricesRH(headset, zNear, zFar, &mats[0], &mats[1]));
+		},
+		// noconvert: a silently converted (copied) out array would receive the
+		// result instead of the caller's
+		py::arg("headset"), py::arg("zNear"), py::arg("zFar"), py::arg("out").noconvert(), py::arg("left_handed") = true,
+		R"(Writes both 4x4 projection matrices directly into a caller-provided numpy array
+
+Allocation-free variant of `Headset_getProjectionMatricesLH`/`RH` for render loops:
+the left eye matrix is written to `out[0]` and the right eye matrix to `out[1]`,
+row-major, with no intermediate `Matrix44` objects constructed.
+
+\param zNear       The near plane in float, Range: from 0 to zFar
+\param zFar        The far plane in float, Range: from zNear to infinity
+\param out         A writeable C-contiguous float32 array of shape [2, 4, 4] to receive both matrices
+\param left_handed Whether to compute left-handed (default) or right-handed matrices
+\return #Fove_ErrorCode_None if the call succeeded
+        #Fove_ErrorCode_Connect_NotConnected if not connected to the service
+        #Fove_ErrorCode_Data_NoUpdate if no valid data has been returned by the service yet
+\see Headset_getProjectionMatricesLH
+\see Headset_getProjectionMatricesRH
+)");
+
 	m.def(
 		"Headset_getRawProjectionValues", [](Headset& headset, Fove_ProjectionParams& outLeft, Fove_ProjectionParams& outRight) {
-			return fove_Headset_getRawProjectionValues(headset, &outLeft, &outRight);
+			return FOVE_PERF(fove_Headset_getRawProjectionValues(headset, &outLeft, &outRight));
 		},
 		R"(Writes out values for the view frustum of the specified eye at 1 unit away.
 
@@ -3469,9 +11907,83 @@ other struct, however setting both to `nullptr` is considered and error and the
 		#Fove_ErrorCode_API_NullInPointer if both `outLeft` and `outRight` are `nullptr`
 )");
 
+	m.def(
+		"Headset_getFoveationRegions", [](Headset& headset, const float fovDegrees, const int width, const int height, py::array_t<float, py::array::c_style> out) {
+			if (out.ndim() != 2 || out.shape(0) != 2 || out.shape(1) != 4)
+				throw std::runtime_error("out must be a C-contiguous float32 array of shape [2, 4]");
+			if (!out.writeable())
+				throw std::runtime_error("out must be writeable");
+			if (fovDegrees <= 0 || fovDegrees >= 180 || width <= 0 || height <= 0)
+				throw std::runtime_error("fov_degrees must be in (0, 180) and width/height positive");
+
+			Fove_ProjectionParams projections[2];
+			const Fove_ErrorCode errProjection = FOVE_PERF(fove_Headset_getRawProjectionValues(headset, &projections[0], &projections[1]));
+
+			float* const rects = static_cast<float*>(out.request().ptr);
+			Fove_ErrorCode errs[2] = {errProjection, errProjection};
+			for (int i = 0; i < 2; ++i)
+			{
+				const Fove_Eye eye = i == 0 ? Fove_Eye::Left : Fove_Eye::Right;
+				Fove_Vec2 gaze = {};
+				if (errs[i] == Fove_ErrorCode::None)
+					errs[i] = FOVE_PERF(fove_Headset_getGazeScreenPosition(headset, eye, &gaze));
+				if (errs[i] != Fove_ErrorCode::None && errs[i] != Fove_ErrorCode::Data_LowAccuracy && errs[i] != Fove_ErrorCode::Data_Unreliable)
+				{
+					// No usable gaze: degrade to the full viewport so the renderer stays correct
+					rects[i * 4 + 0] = 0;
+					rects[i * 4 + 1] = 0;
+					rects[i * 4 + 2] = static_cast<float>(width);
+					rects[i * 4 + 3] = static_cast<float>(height);
+					continue;
+				}
+
+				// Gaze in the frustum's tangent plane at depth 1 (screen [-1, 1] spans
+				// left..right and bottom..top)
+				const Fove_ProjectionParams& p = projections[i];
+				const float tx = p.left + (gaze.x + 1) * 0.5f * (p.right - p.left);
+				const float ty = p.bottom + (gaze.y + 1) * 0.5f * (p.top - p.bottom);
+
+				// Half-extent of a cone of half-angle fov/2 around the gaze direction,
+				// projected onto the tangent plane; the (1 + t^2) factor is d(tan)/d(angle)
+				// at the gaze point, first-order exact and slightly conservative off-axis
+				const float halfTan = std::tan(fovDegrees * 0.5f * 3.14159265358979323846f / 180);
+				const float dx = halfTan * (1 + tx * tx);
+				const float dy = halfTan * (1 + ty * ty);
+
+				// To pixels; y runs downward from the top scanline
+				const auto clamp01 = [](const float v) { return v < 0 ? 0.0f : v > 1 ? 1.0f : v; };
+				rects[i * 4 + 0] = clamp01((tx - dx - p.left) / (p.right - p.left)) * width;
+				rects[i * 4 + 1] = clamp01((p.top - (ty + dy)) / (p.top - p.bottom)) * height;
+				rects[i * 4 + 2] = clamp01((tx + dx - p.left) / (p.right - p.left)) * width;
+				rects[i * 4 + 3] = clamp01((p.top - (ty - dy)) / (p.top - p.bottom)) * height;
+			}
+			return py::make_tuple(errs[0], errs[1]);
+		},
+		py::arg("headset"), py::arg("fov_degrees"), py::arg("width"), py::arg("height"), py::arg("out").noconvert(),
+		R"(Computes the per-eye foveation rectangles from the current gaze and projection state
+
+Writes one pixel-space ROI per eye into the caller-provided array — row 0 the
+left eye, row 1 the right, each as `(x0, y0, x1, y1)` with y growing downward —
+covering a cone of the given full angle around the current gaze direction,
+clamped to the viewport. Everything is computed natively in one crossing, so a
+gaze-contingent renderer has no Python math between the gaze fetch and its GPU
+commands. An eye whose gaze is unavailable gets the full viewport, keeping the
+renderer correct during tracking loss.
+
+`Fove_ClientCapabilities_EyeTracking` should be registered to use this function.
+
+\param fov_degrees The full opening angle of the high-resolution cone, in degrees
+\param width The render target width of one eye, in pixels
+\param height The render target height of one eye, in pixels
+\param out A writeable C-contiguous float32 array of shape [2, 4]
+\return The tuple `(errLeft, errRight)` of per-eye error codes
+\see Headset_getGazeScreenPosition
+\see Headset_getRawProjectionValues
+)");
+
 	m.def(
 		"Headset_getEyeToHeadMatrices", [](Headset& headset, Python_Matrix44& outLeft, Python_Matrix44& outRight) {
-			return fove_Headset_getEyeToHeadMatrices(headset, outLeft, outRight);
+			return FOVE_PERF(fove_Headset_getEyeToHeadMatrices(headset, outLeft, outRight));
 		},
 		R"(Writes out the matrices to convert from eye- to head-space coordinates
 
@@ -3486,7 +11998,7 @@ This is simply a translation matrix that returns +/- IOD/2
 
 	m.def(
 		"Headset_getRenderIOD", [](Headset& headset, Obj<float>& outIOD) {
-			return fove_Headset_getRenderIOD(headset, outIOD);
+			return FOVE_PERF(fove_Headset_getRenderIOD(headset, outIOD));
 		},
 		R"(Interocular distance, returned in meters
 
@@ -3504,7 +12016,10 @@ We recommend calling this each frame when doing stereoscopic rendering.
 
 	m.def(
 		"Headset_createProfile", [](Headset& headset, const std::string& profileName) {
-			return fove_Headset_createProfile(headset, profileName.c_str());
+			const Fove_ErrorCode err = FOVE_PERF(fove_Headset_createProfile(headset, profileName.c_str()));
+			if (err == Fove_ErrorCode::None)
+				profileCaches()[headset.val].listValid = false;
+			return err;
 		},
 		R"(Creates a new profile
 
@@ -3528,7 +12043,14 @@ This function creates a new profile, but does not add any data or switch to it.
 
 	m.def(
 		"Headset_renameProfile", [](Headset& headset, const std::string& oldName, const std::string& newName) {
-			return fove_Headset_renameProfile(headset, oldName.c_str(), newName.c_str());
+			const Fove_ErrorCode err = FOVE_PERF(fove_Headset_renameProfile(headset, oldName.c_str(), newName.c_str()));
+			if (err == Fove_ErrorCode::None)
+			{
+				ProfileCache& cache = profileCaches()[headset.val];
+				cache.listValid = false;
+				cache.currentValid = false; // the current profile may have been the one renamed
+			}
+			return err;
 		},
 		R"(Renames an existing profile
 
@@ -3550,7 +12072,14 @@ This function renames an existing profile. This works on the current profile as
 
 	m.def(
 		"Headset_deleteProfile", [](Headset& headset, const std::string& profileName) {
-			return fove_Headset_deleteProfile(headset, profileName.c_str());
+			const Fove_ErrorCode err = FOVE_PERF(fove_Headset_deleteProfile(headset, profileName.c_str()));
+			if (err == Fove_ErrorCode::None)
+			{
+				ProfileCache& cache = profileCaches()[headset.val];
+				cache.listValid = false;
+				cache.currentValid = false; // deleting the current profile unsets it
+			}
+			return err;
 		},
 		R"(Deletes an existing profile
 
@@ -3572,18 +12101,39 @@ In such a case, it is undefined whether any existing profile data loaded into me
 \see fove_Headset_queryProfileDataPath)");
 
 	m.def(
-		"Headset_listProfiles", [](Headset& headset, Fove_ErrorCode& err) -> std::vector<std::string> {
+		"Headset_listProfiles", [](Headset& headset, Fove_ErrorCode& err) -> py::tuple {
+			ProfileCache& cache = profileCaches()[headset.val];
+			if (cache.listValid)
+			{
+				err = Fove_ErrorCode::None;
+				return cache.list;
+			}
 			std::vector<std::string> ret;
 			auto callback = [](const char* val, void* data) {
 				auto vectorPtr = reinterpret_cast<std::vector<std::string>*>(data);
 				vectorPtr->push_back(val);
 			};
 			err = fove_Headset_listProfiles(headset, callback, &ret);
-			return ret;
+			py::tuple names(ret.size());
+			for (size_t i = 0; i < ret.size(); ++i)
+				names[i] = py::str(ret[i]);
+			if (err == Fove_ErrorCode::None)
+			{
+				// Cache the tuple itself, so unchanged polls return the same object
+				cache.list = names;
+				cache.listValid = true;
+			}
+			return names;
 		},
 		R"(Lists all existing profiles
 
-\param outProfileNames The list of existing profile names
+The result is cached per headset and invalidated by the profile mutators in
+this module, so repeat polls between profile changes return the identical
+tuple without touching the service. Out-of-process profile changes are not
+seen until `profile_cache_invalidate` is called (or the connection
+supervisor observes a reconnect).
+
+\param outProfileNames A tuple of existing profile names
 \return #Fove_ErrorCode_None if the profile names were successfully listed
 	    #Fove_ErrorCode_Connect_NotConnected if not connected to the service
 	    #Fove_ErrorCode_API_NullInPointer if callback is null
@@ -3596,7 +12146,10 @@ In such a case, it is undefined whether any existing profile data loaded into me
 
 	m.def(
 		"Headset_setCurrentProfile", [](Headset& headset, const std::string& profileName) {
-			return fove_Headset_setCurrentProfile(headset, profileName.c_str());
+			const Fove_ErrorCode err = FOVE_PERF(fove_Headset_setCurrentProfile(headset, profileName.c_str()));
+			if (err == Fove_ErrorCode::None)
+				profileCaches()[headset.val].currentValid = false;
+			return err;
 		},
 		R"(Sets the current profile
 
@@ -3620,14 +12173,29 @@ Please note that no-ops are OK but you should check for #Fove_ErrorCode_Profile_
 
 	m.def(
 		"Headset_queryCurrentProfile", [](Headset& headset, Obj<std::string>& profileName) {
+			ProfileCache& cache = profileCaches()[headset.val];
+			if (cache.currentValid)
+			{
+				profileName.val = cache.current;
+				return Fove_ErrorCode::None;
+			}
 			auto callback = [](const char* val, void* data) {
 				auto valuePtr = reinterpret_cast<std::string*>(data);
 				*valuePtr = val;
 			};
-			return fove_Headset_queryCurrentProfile(headset, callback, &profileName.val);
+			const Fove_ErrorCode err = FOVE_PERF(fove_Headset_queryCurrentProfile(headset, callback, &profileName.val));
+			if (err == Fove_ErrorCode::None)
+			{
+				cache.current = profileName.val;
+				cache.currentValid = true;
+			}
+			return err;
 		},
 		R"(Gets the current profile
 
+The answer is cached per headset and invalidated by the profile mutators in
+this module; see `Headset_listProfiles` for the caching rules.
+
 \param profileName The name of the current profile
 \return #Fove_ErrorCode_None if the profile name was successfully retrieved
 	    #Fove_ErrorCode_Connect_NotConnected if not connected to the service
@@ -3645,7 +12213,7 @@ Please note that no-ops are OK but you should check for #Fove_ErrorCode_Profile_
 				auto valuePtr = reinterpret_cast<std::string*>(data);
 				*valuePtr = val;
 			};
-			return fove_Headset_queryProfileDataPath(headset, profileName.c_str(), callback, &dataPath.val);
+			return FOVE_PERF(fove_Headset_queryProfileDataPath(headset, profileName.c_str(), callback, &dataPath.val));
 		},
 		R"(Gets the data folder for a given profile
 
@@ -3674,22 +12242,87 @@ They will need to test for profile name changes and deletions manually in that c
 
 	m.def(
 		"Headset_hasAccessToFeature", [](Headset& headset, const std::string& featureName, Obj<bool>& hasAccess) {
-			return fove_Headset_hasAccessToFeature(headset, featureName.c_str(), &hasAccess.val);
+			StatusCache& cache = statusCache();
+			{
+				std::lock_guard<std::mutex> lock(cache.mutex);
+				const auto entry = cache.featureAccess.find({headset.val, featureName});
+				if (entry != cache.featureAccess.end())
+				{
+					hasAccess.val = entry->second;
+					++cache.hits;
+					return Fove_ErrorCode::None;
+				}
+			}
+			const Fove_ErrorCode err = FOVE_PERF(fove_Headset_hasAccessToFeature(headset, featureName.c_str(), &hasAccess.val));
+			std::lock_guard<std::mutex> lock(cache.mutex);
+			++cache.misses;
+			if (err == Fove_ErrorCode::None)
+				cache.featureAccess.emplace(std::make_pair(headset.val, featureName), hasAccess.val);
+			return err;
 		},
 		R"(Returns whether the Headset has access to the given feature.
 
 If the provided feature name doesn't exist, then `false` and `#Fove_ErrorCode_None` are returned.
 
+Successful answers are cached natively per headset and feature name, so repeat
+queries are a hash lookup with no IPC; the cache is invalidated on license
+activation or deactivation and when the connection supervisor re-establishes a
+lost connection.
+
 \param featureName A null-terminated UTF-8 string with the name of the feature to query
 \param hasAccess Output variable set to true if the headset can access the given feature
 \return #Fove_ErrorCode_None if the call succeeded
 	    #Fove_ErrorCode_API_NullInPointer if inFeatureName is null
 	    #Fove_ErrorCode_API_NullOutPointersOnly if outHasAccess is null
+\see status_cache_invalidate
+)");
+
+	m.def(
+		"profile_cache_invalidate", []() { profileCacheInvalidate(); },
+		R"(Drops the cached profile list and current-profile answers
+
+The next `Headset_listProfiles` / `Headset_queryCurrentProfile` of each
+headset goes back to the service. Needed only when another process may have
+changed the profile set; this module's own mutators invalidate automatically.
+)");
+
+	m.def(
+		"status_cache_invalidate", []() { statusCacheInvalidate(); },
+		R"(Drops every cached feature-access and status-query answer
+
+The next query of each kind goes back to the service. Invalidation also happens
+automatically on license activation/deactivation and when the connection
+supervisor re-establishes a lost connection.
+)");
+
+	m.def(
+		"set_status_cache_ttl", [](const uint64_t ttlMs) {
+			StatusCache& cache = statusCache();
+			std::lock_guard<std::mutex> lock(cache.mutex);
+			cache.ttlUs = ttlMs * 1000;
+			cache.status.clear(); // existing expiries were computed with the old TTL
+		},
+		py::arg("ttl_ms"),
+		R"(Sets how long isEyeTrackingEnabled-class status answers are served from cache
+
+Feature-access answers are unaffected (they live until invalidated). A TTL of 0
+disables status-query caching.
+
+\param ttl_ms Cache lifetime of a status answer, in milliseconds (default 500)
 )");
 
+	m.def(
+		"status_cache_stats", []() {
+			StatusCache& cache = statusCache();
+			std::lock_guard<std::mutex> lock(cache.mutex);
+			return py::make_tuple(cache.featureAccess.size(), cache.status.size(), cache.hits, cache.misses);
+		},
+		"Returns `(feature_entries, status_entries, hits, misses)` of the status cache");
+
 	m.def(
 		"Headset_activateLicense", [](Headset& headset, const std::string& licenseKey) {
-			return fove_Headset_activateLicense(headset, licenseKey.c_str());
+			statusCacheInvalidate(); // feature access may change with the license set
+			return FOVE_PERF(fove_Headset_activateLicense(headset, licenseKey.c_str()));
 		},
 		R"(Returns whether the license is activated successfully
 
@@ -3700,7 +12333,8 @@ If the provided feature name doesn't exist, then `false` and `#Fove_ErrorCode_No
 
 	m.def(
 		"Headset_deactivateLicense", [](Headset& headset, const std::string& licenseData) {
-			return fove_Headset_deactivateLicense(headset, licenseData.c_str());
+			statusCacheInvalidate(); // feature access may change with the license set
+			return FOVE_PERF(fove_Headset_deactivateLicense(headset, licenseData.c_str()));
 		},
 		R"(Returns whether the license is deactivated successfully
 
@@ -3709,10 +12343,11 @@ If the provided feature name doesn't exist, then `false` and `#Fove_ErrorCode_No
 		#Fove_ErrorCode_UnknownError if the deactivation failed
 )");
 
+#if FOVE_HAS_FEATURE(FOVE_FEATURE_COMPOSITOR)
 	// Compositor
 	m.def(
 		"Headset_createCompositor", [](Headset& headset, Compositor& outCompositor) {
-			return fove_Headset_createCompositor(headset, outCompositor);
+			return FOVE_PERF_DIRECT(fove_Headset_createCompositor(headset, outCompositor));
 		},
 		R"(Returns a compositor interface from the given headset
 
@@ -3723,7 +12358,8 @@ It is ok for the compositor to outlive the headset passed in.
 
 	m.def(
 		"Compositor_destroy", [](Compositor& compositor) {
-			return fove_Compositor_destroy(compositor);
+			forgetRenderPose(compositor);
+			return FOVE_PERF_DIRECT(fove_Compositor_destroy(compositor));
 		},
 		R"(Frees resources used by the compositor object, including memory and sockets
 
@@ -3732,7 +12368,7 @@ Upon return, this compositor pointer should no longer be used.
 
 	m.def(
 		"Compositor_createLayer", [](Compositor& compositor, const Fove_CompositorLayerCreateInfo& layerInfo, Fove_CompositorLayer& outLayer) {
-			return fove_Compositor_createLayer(compositor, &layerInfo, &outLayer);
+			return FOVE_PERF(fove_Compositor_createLayer(compositor, &layerInfo, &outLayer));
 		},
 		R"(Create a layer for this client.
 
@@ -3752,7 +12388,7 @@ This is a feature we would like to add in the future.
 
 	m.def(
 		"Compositor_submit", [](Compositor& compositor, const Fove_CompositorLayerSubmitInfo& submitInfo, const std::size_t layerCount) {
-			return fove_Compositor_submit(compositor, &submitInfo, layerCount);
+			return pacingTimedSubmit([&] { return FOVE_PERF(fove_Compositor_submit(compositor, &submitInfo, layerCount)); });
 		},
 		R"(Submit a frame to the compositor
 
@@ -3763,8 +12399,15 @@ This function takes the feed from your game engine to the compositor for output.
 
 	m.def(
 		"Compositor_waitForRenderPose", [](Compositor& compositor, Fove_Pose& outPose) {
-			return fove_Compositor_waitForRenderPose(compositor, &outPose);
+			const Fove_ErrorCode err = FOVE_PERF(fove_Compositor_waitForRenderPose(compositor, &outPose));
+			if (err == Fove_ErrorCode::None)
+			{
+				noteRenderPose(compositor, outPose); // keep the prediction cache current
+				pacingNoteWaitReturn(outPose);
+			}
+			return err;
 		},
+		py::call_guard<py::gil_scoped_release>(),
 		R"(Wait for the next pose to use for rendering purposes
 
 All compositor clients should use this function as the sole means of limiting their frame rate.
@@ -3785,30 +12428,196 @@ In general, a client's main loop should look like:
 \see fove_Compositor_getLastRenderPose
 	})");
 
+	m.def(
+		"Compositor_beginFrame", [](Compositor& compositor, Headset& headset, Fove_Pose& outPose, const float zNear, const float zFar, py::array_t<float, py::array::c_style> projections, const bool leftHanded, py::object layer, py::object outResolution) {
+			// One crossing per frame: the render-pose wait and the projection
+			// fetch run back to back with the GIL released once, and the layer
+			// resolution (static per layer) is copied out locally
+			if (projections.ndim() != 3 || projections.shape(0) != 2 || projections.shape(1) != 4 || projections.shape(2) != 4)
+				throw std::runtime_error("projections must be a C-contiguous float32 array of shape [2, 4, 4]");
+			if (!projections.writeable())
+				throw std::runtime_error("projections must be writeable");
+			Fove_Matrix44* const mats = static_cast<Fove_Matrix44*>(projections.request().ptr);
+			if (!outResolution.is_none())
+			{
+				if (layer.is_none())
+					throw std::runtime_error("resolution requires the layer it is read from");
+				outResolution.cast<Fove_Vec2i&>() = layer.cast<const Fove_CompositorLayer&>().idealResolutionPerEye;
+			}
+			Fove_ErrorCode err;
+			{
+				py::gil_scoped_release release;
+				err = FOVE_PERF(fove_Compositor_waitForRenderPose(compositor, &outPose));
+				if (err == Fove_ErrorCode::None)
+				{
+					noteRenderPose(compositor, outPose); // keep the prediction cache current
+					pacingNoteWaitReturn(outPose);
+					err = FOVE_PERF(leftHanded
+										? fove_Headset_getProjectionMatricesLH(headset, zNear, zFar, &mats[0], &mats[1])
+										: fove_Headset_getProjectionMatricesRH(headset, zNear, zFar, &mats[0], &mats[1]));
+				}
+			}
+			return err;
+		},
+		// noconvert: a silently converted (copied) projections array would
+		// receive the result instead of the caller's
+		py::arg("compositor"), py::arg("headset"), py::arg("pose"), py::arg("zNear"), py::arg("zFar"), py::arg("projections").noconvert(), py::arg("left_handed") = true, py::arg("layer") = py::none(), py::arg("resolution") = py::none(),
+		R"(Waits for the next render pose and gathers the per-frame render inputs in one call
+
+Bundles the fixed start-of-frame sequence — `Compositor_waitForRenderPose`,
+`Headset_getProjectionMatrices` into a persistent caller array, and optionally
+the layer's `idealResolutionPerEye` — into a single binding crossing with the
+GIL released for the whole native stretch, so a render loop pays the
+per-call overhead once per frame instead of three times.
+
+\param compositor  The compositor to wait on
+\param headset     The headset the projection matrices are read from
+\param pose        The `Pose` object the render pose is written to
+\param zNear       The near plane in float, Range: from 0 to zFar
+\param zFar        The far plane in float, Range: from zNear to infinity
+\param projections A writeable C-contiguous float32 array of shape [2, 4, 4] receiving both eye matrices, row-major
+\param left_handed Whether to compute left-handed (default) or right-handed matrices
+\param layer       The `CompositorLayer` whose ideal resolution to copy out, if `resolution` is given
+\param resolution  A `Vec2i` that receives `layer.idealResolutionPerEye`, or `None`
+\return #Fove_ErrorCode_None if the wait and the projection fetch both succeeded\n
+        Otherwise, the first error encountered (the matrices are untouched if the wait failed)
+\see Compositor_waitForRenderPose
+\see Headset_getProjectionMatrices
+)");
+
 	m.def(
 		"Compositor_getLastRenderPose", [](Compositor& compositor, Fove_Pose& outPose) {
-			return fove_Compositor_getLastRenderPose(compositor, &outPose);
+			const Fove_ErrorCode err = FOVE_PERF(fove_Compositor_getLastRenderPose(compositor, &outPose));
+			if (err == Fove_ErrorCode::None)
+				noteRenderPose(compositor, outPose); // keep the prediction cache current
+			return err;
 		},
 		R"(Get the last cached pose for rendering purposes)");
 
+	m.def(
+		"Compositor_getPredictedPoseAt", [](Compositor& compositor, const uint64_t displayTimeUs, Fove_Pose& outPose) {
+			Fove_Pose cached;
+			{
+				std::lock_guard<std::mutex> lock(renderPoseMutex);
+				const auto it = lastRenderPoses.find(compositor);
+				if (it == lastRenderPoses.end())
+					return Fove_ErrorCode::Data_NoUpdate;
+				cached = it->second;
+			}
+			outPose = predictPoseAt(cached, displayTimeUs);
+			return Fove_ErrorCode::None;
+		},
+		R"(Extrapolates the most recent render pose to the given display time
+
+Predicts from the velocity/acceleration and angular velocity/acceleration fields
+of the pose last returned by `Compositor_waitForRenderPose` (or
+`Compositor_getLastRenderPose`), entirely locally — no IPC — so a late-latching
+renderer can re-predict right before encode, any number of times per frame.
+The extrapolation span is clamped to 50 ms either way.
+
+\param displayTimeUs The display time to predict for, in the `FrameTimestamp` domain
+\param outPose       The pose object the prediction is written to
+\return #Fove_ErrorCode_None if a prediction was written\n
+        #Fove_ErrorCode_Data_NoUpdate if no render pose has been received yet
+\see Compositor_waitForRenderPose
+)");
+
+	m.def(
+		"compositor_pacing_stats", []() {
+			const auto histogram = [](const PerfRecord& record) {
+				py::dict entry;
+				const uint64_t count = record.count.load();
+				entry["count"] = count;
+				entry["mean_ns"] = count > 0 ? record.totalNs.load() / count : 0;
+				entry["max_ns"] = record.maxNs.load();
+				entry["p50_ns"] = record.quantileNs(0.50);
+				entry["p95_ns"] = record.quantileNs(0.95);
+				entry["p99_ns"] = record.quantileNs(0.99);
+				return entry;
+			};
+			CompositorPacing& pacing = compositorPacing();
+			py::dict stats;
+			stats["waits"] = pacing.waits.load();
+			stats["submits"] = pacing.submits.load();
+			stats["missed_composes"] = pacing.missedComposes.load();
+			stats["wait_to_submit_ns"] = histogram(pacing.waitToSubmit);
+			stats["submit_ns"] = histogram(pacing.submitDuration);
+			return stats;
+		},
+		R"(Returns frame pacing telemetry of the compositor submit path
+
+Always on; the cost is two clock reads around each submit. The histograms
+are log2-bucketed like `perf_stats`.
+
+\return A dict with `waits`, `submits`, `missed_composes` (render-pose ids
+        skipped between consecutive waits: frames the compositor composed
+        without a submission from this client, i.e. reprojected stutter
+        frames) and two histogram dicts, `wait_to_submit_ns` (the frame
+        budget the renderer used between the wait returning and the submit
+        call) and `submit_ns` (the duration of the submit call itself), each
+        with `count`, `mean_ns`, `max_ns`, `p50_ns`, `p95_ns`, `p99_ns`
+\see compositor_pacing_reset, perf_stats
+)");
+
+	m.def(
+		"compositor_pacing_reset", []() {
+			CompositorPacing& pacing = compositorPacing();
+			std::lock_guard<std::mutex> lock(pacing.mutex);
+			pacing.waitToSubmit.reset();
+			pacing.submitDuration.reset();
+			pacing.waits.store(0);
+			pacing.submits.store(0);
+			pacing.missedComposes.store(0);
+			pacing.hasLastPose = false;
+			pacing.hasWaitReturn = false;
+		},
+		"Resets the compositor pacing counters and histograms");
+
 	m.def(
 		"Compositor_isReady", [](Compositor& compositor, Obj<bool>& outIsReady) {
-			return fove_Compositor_isReady(compositor, outIsReady);
+			return FOVE_PERF(fove_Compositor_isReady(compositor, outIsReady));
 		},
 		R"(Returns true if we are connected to a running compositor and ready to submit frames for compositing)");
 
+	m.def(
+		"Compositor_waitUntilReady", [](Compositor& compositor, const uint64_t timeoutUs) {
+			Fove_ErrorCode err;
+			{
+				py::gil_scoped_release release;
+				err = compositorWaitUntilReady(compositor, timeoutUs);
+			}
+			return applyErrorPolicy(err);
+		},
+		py::arg("compositor"), py::arg("timeout_us") = 0,
+		R"(Blocks until the compositor is ready to accept frames
+
+Replaces the startup sleep-poll loop around `Compositor_isReady`: the readiness
+poll runs natively at millisecond granularity with the GIL released, so other
+Python threads keep running and readiness is observed without the quantization
+of an event-loop sleep. For asyncio clients, `CompositorWaiter` provides the
+awaitable equivalent.
+
+\param compositor The compositor to wait on
+\param timeout_us Give up after this long; 0 waits indefinitely
+\return #Fove_ErrorCode_None once the compositor is ready\n
+        #Fove_ErrorCode_API_Timeout if the timeout lapsed first\n
+        Otherwise, the error reported by the readiness query
+\see Compositor_isReady
+)");
+
 	m.def(
 		"Compositor_queryAdapterId", [](Compositor& compositor, Fove_AdapterId& outAdapterId) {
-			return fove_Compositor_queryAdapterId(compositor, &outAdapterId);
+			return FOVE_PERF(fove_Compositor_queryAdapterId(compositor, &outAdapterId));
 		},
 		R"(Returns the ID of the GPU currently attached to the headset.
 
 For systems with multiple GPUs, submitted textures to the compositor must from the same GPU that the compositor is using
 )");
+#endif // FOVE_FEATURE_COMPOSITOR
 
 	m.def(
 		"Config_getValue_bool", [](const char* key, Obj<bool>& outValue) {
-			return fove_Config_getValue_bool(key, &outValue.val);
+			return FOVE_PERF(fove_Config_getValue_bool(key, &outValue.val));
 		},
 		R"(Get the value of the provided key from the FOVE config
 
@@ -3821,7 +12630,7 @@ For systems with multiple GPUs, submitted textures to the compositor must from t
 
 	m.def(
 		"Config_getValue_int", [](const char* key, Obj<int>& outValue) {
-			return fove_Config_getValue_int(key, &outValue.val);
+			return FOVE_PERF(fove_Config_getValue_int(key, &outValue.val));
 		},
 		R"(Get the value of the provided key from the FOVE config
 
@@ -3834,7 +12643,7 @@ For systems with multiple GPUs, submitted textures to the compositor must from t
 
 	m.def(
 		"Config_getValue_float", [](const char* key, Obj<float>& outValue) {
-			return fove_Config_getValue_float(key, &outValue.val);
+			return FOVE_PERF(fove_Config_getValue_float(key, &outValue.val));
 		},
 		R"(Get the value of the provided key from the FOVE config
 
@@ -3851,7 +12660,7 @@ For systems with multiple GPUs, submitted textures to the compositor must from t
 				auto valuePtr = reinterpret_cast<std::string*>(data);
 				*valuePtr = val;
 			};
-			return fove_Config_getValue_string(key, callback, &outValue.val);
+			return FOVE_PERF(fove_Config_getValue_string(key, callback, &outValue.val));
 		},
 		R"(Get the value of the provided key from the FOVE config
 
@@ -3925,6 +12734,274 @@ For systems with multiple GPUs, submitted textures to the compositor must from t
 	\return #Fove_ErrorCode_None if the value was successfully reset
 	        #Fove_ErrorCode_API_NullInPointer if key is null
 	        #Fove_ErrorCode_Config_DoesntExist if the provided key doesn't exist)");
+
+	// Tuple-returning variants of the hottest per-frame getters.
+	// The out-parameter forms above require the caller to construct a fresh
+	// holder object (capi.Vec3(), capi.Float(), ...) per call; these return the
+	// `(error, value)` pair directly so the per-call holder allocation disappears
+	// from the hot loop. Scalars come back as plain Python floats/bools/enums.
+	// The error codes are the same as for the corresponding out-parameter form.
+
+	m.def(
+		"Headset_getGazeVectorTuple", [](Headset& headset, Fove_Eye eye) {
+			Fove_Vec3 out = {};
+			const Fove_ErrorCode err = FOVE_PERF(fove_Headset_getGazeVector(headset, eye, &out));
+			return py::make_tuple(err, out);
+		},
+		"Tuple-returning variant of `Headset_getGazeVector`: returns `(error, Vec3)`");
+
+	m.def(
+		"Headset_getGazeVectorRawTuple", [](Headset& headset, Fove_Eye eye) {
+			Fove_Vec3 out = {};
+			const Fove_ErrorCode err = FOVE_PERF(fove_Headset_getGazeVectorRaw(headset, eye, &out));
+			return py::make_tuple(err, out);
+		},
+		"Tuple-returning variant of `Headset_getGazeVectorRaw`: returns `(error, Vec3)`");
+
+	m.def(
+		"Headset_getGazeScreenPositionTuple", [](Headset& headset, Fove_Eye eye) {
+			Fove_Vec2 out = {};
+			const Fove_ErrorCode err = FOVE_PERF(fove_Headset_getGazeScreenPosition(headset, eye, &out));
+			return py::make_tuple(err, out);
+		},
+		"Tuple-returning variant of `Headset_getGazeScreenPosition`: returns `(error, Vec2)`");
+
+	m.def(
+		"Headset_getGazeScreenPositionCombinedTuple", [](Headset& headset) {
+			Fove_Vec2 out = {};
+			const Fove_ErrorCode err = FOVE_PERF(fove_Headset_getGazeScreenPositionCombined(headset, &out));
+			return py::make_tuple(err, out);
+		},
+		"Tuple-returning variant of `Headset_getGazeScreenPositionCombined`: returns `(error, Vec2)`");
+
+	m.def(
+		"Headset_getCombinedGazeRayTuple", [](Headset& headset) {
+			Fove_Ray out = {};
+			const Fove_ErrorCode err = FOVE_PERF(fove_Headset_getCombinedGazeRay(headset, &out));
+			return py::make_tuple(err, out);
+		},
+		"Tuple-returning variant of `Headset_getCombinedGazeRay`: returns `(error, Ray)`");
+
+	m.def(
+		"Headset_getCombinedGazeDepthTuple", [](Headset& headset) {
+			float out = 0;
+			const Fove_ErrorCode err = FOVE_PERF(fove_Headset_getCombinedGazeDepth(headset, &out));
+			return py::make_tuple(err, out);
+		},
+		"Tuple-returning variant of `Headset_getCombinedGazeDepth`: returns `(error, float)`");
+
+	m.def(
+		"Headset_getPupilRadiusTuple", [](Headset& headset, Fove_Eye eye) {
+			float out = 0;
+			const Fove_ErrorCode err = FOVE_PERF(fove_Headset_getPupilRadius(headset, eye, &out));
+			return py::make_tuple(err, out);
+		},
+		"Tuple-returning variant of `Headset_getPupilRadius`: returns `(error, float)`");
+
+	m.def(
+		"Headset_getIrisRadiusTuple", [](Headset& headset, Fove_Eye eye) {
+			float out = 0;
+			const Fove_ErrorCode err = FOVE_PERF(fove_Headset_getIrisRadius(headset, eye, &out));
+			return py::make_tuple(err, out);
+		},
+		"Tuple-returning variant of `Headset_getIrisRadius`: returns `(error, float)`");
+
+	m.def(
+		"Headset_getEyeballRadiusTuple", [](Headset& headset, Fove_Eye eye) {
+			float out = 0;
+			const Fove_ErrorCode err = FOVE_PERF(fove_Headset_getEyeballRadius(headset, eye, &out));
+			return py::make_tuple(err, out);
+		},
+		"Tuple-returning variant of `Headset_getEyeballRadius`: returns `(error, float)`");
+
+	m.def(
+		"Headset_getEyeTorsionTuple", [](Headset& headset, Fove_Eye eye) {
+			float out = 0;
+			const Fove_ErrorCode err = FOVE_PERF(fove_Headset_getEyeTorsion(headset, eye, &out));
+			return py::make_tuple(err, out);
+		},
+		"Tuple-returning variant of `Headset_getEyeTorsion`: returns `(error, float)`");
+
+	m.def(
+		"Headset_getEyeStateTuple", [](Headset& headset, Fove_Eye eye) {
+			Fove_EyeState out = Fove_EyeState::NotDetected;
+			const Fove_ErrorCode err = FOVE_PERF(fove_Headset_getEyeState(headset, eye, &out));
+			return py::make_tuple(err, out);
+		},
+		"Tuple-returning variant of `Headset_getEyeState`: returns `(error, EyeState)`");
+
+	m.def(
+		"Headset_isEyeBlinkingTuple", [](Headset& headset, Fove_Eye eye) {
+			bool out = false;
+			const Fove_ErrorCode err = FOVE_PERF(fove_Headset_isEyeBlinking(headset, eye, &out));
+			return py::make_tuple(err, out);
+		},
+		"Tuple-returning variant of `Headset_isEyeBlinking`: returns `(error, bool)`");
+
+	// Both-eyes variants of the per-eye getters: one binding call retrieves the
+	// left and right values together as a flat `(errLeft, left, errRight, right)`
+	// tuple, halving the crossings of loops that always query both eyes.
+	// (This SDK version has no native both-eyes C calls, so each variant performs
+	// the two cache reads back to back inside the one crossing.)
+
+	m.def(
+		"Headset_getGazeVectors", [](Headset& headset) {
+			Fove_Vec3 left = {}, right = {};
+			const Fove_ErrorCode errLeft = FOVE_PERF(fove_Headset_getGazeVector(headset, Fove_Eye::Left, &left));
+			const Fove_ErrorCode errRight = FOVE_PERF(fove_Headset_getGazeVector(headset, Fove_Eye::Right, &right));
+			return py::make_tuple(errLeft, left, errRight, right);
+		},
+		"Both-eyes variant of `Headset_getGazeVector`: returns `(errLeft, Vec3, errRight, Vec3)`");
+
+	m.def(
+		"Headset_getGazeVectorsRaw", [](Headset& headset) {
+			Fove_Vec3 left = {}, right = {};
+			const Fove_ErrorCode errLeft = FOVE_PERF(fove_Headset_getGazeVectorRaw(headset, Fove_Eye::Left, &left));
+			const Fove_ErrorCode errRight = FOVE_PERF(fove_Headset_getGazeVectorRaw(headset, Fove_Eye::Right, &right));
+			return py::make_tuple(errLeft, left, errRight, right);
+		},
+		"Both-eyes variant of `Headset_getGazeVectorRaw`: returns `(errLeft, Vec3, errRight, Vec3)`");
+
+	m.def(
+		"Headset_getGazeScreenPositions", [](Headset& headset) {
+			Fove_Vec2 left = {}, right = {};
+			const Fove_ErrorCode errLeft = FOVE_PERF(fove_Headset_getGazeScreenPosition(headset, Fove_Eye::Left, &left));
+			const Fove_ErrorCode errRight = FOVE_PERF(fove_Headset_getGazeScreenPosition(headset, Fove_Eye::Right, &right));
+			return py::make_tuple(errLeft, left, errRight, right);
+		},
+		"Both-eyes variant of `Headset_getGazeScreenPosition`: returns `(errLeft, Vec2, errRight, Vec2)`");
+
+	m.def(
+		"Headset_getPupilRadii", [](Headset& headset) {
+			float left = 0, right = 0;
+			const Fove_ErrorCode errLeft = FOVE_PERF(fove_Headset_getPupilRadius(headset, Fove_Eye::Left, &left));
+			const Fove_ErrorCode errRight = FOVE_PERF(fove_Headset_getPupilRadius(headset, Fove_Eye::Right, &right));
+			return py::make_tuple(errLeft, left, errRight, right);
+		},
+		"Both-eyes variant of `Headset_getPupilRadius`: returns `(errLeft, float, errRight, float)`");
+
+	m.def(
+		"Headset_getIrisRadii", [](Headset& headset) {
+			float left = 0, right = 0;
+			const Fove_ErrorCode errLeft = FOVE_PERF(fove_Headset_getIrisRadius(headset, Fove_Eye::Left, &left));
+			const Fove_ErrorCode errRight = FOVE_PERF(fove_Headset_getIrisRadius(headset, Fove_Eye::Right, &right));
+			return py::make_tuple(errLeft, left, errRight, right);
+		},
+		"Both-eyes variant of `Headset_getIrisRadius`: returns `(errLeft, float, errRight, float)`");
+
+	m.def(
+		"Headset_getEyeballRadii", [](Headset& headset) {
+			float left = 0, right = 0;
+			const Fove_ErrorCode errLeft = FOVE_PERF(fove_Headset_getEyeballRadius(headset, Fove_Eye::Left, &left));
+			const Fove_ErrorCode errRight = FOVE_PERF(fove_Headset_getEyeballRadius(headset, Fove_Eye::Right, &right));
+			return py::make_tuple(errLeft, left, errRight, right);
+		},
+		"Both-eyes variant of `Headset_getEyeballRadius`: returns `(errLeft, float, errRight, float)`");
+
+	m.def(
+		"Headset_getEyeTorsions", [](Headset& headset) {
+			float left = 0, right = 0;
+			const Fove_ErrorCode errLeft = FOVE_PERF(fove_Headset_getEyeTorsion(headset, Fove_Eye::Left, &left));
+			const Fove_ErrorCode errRight = FOVE_PERF(fove_Headset_getEyeTorsion(headset, Fove_Eye::Right, &right));
+			return py::make_tuple(errLeft, left, errRight, right);
+		},
+		"Both-eyes variant of `Headset_getEyeTorsion`: returns `(errLeft, float, errRight, float)`");
+
+	m.def(
+		"Headset_getEyeStates", [](Headset& headset) {
+			Fove_EyeState left = Fove_EyeState::NotDetected, right = Fove_EyeState::NotDetected;
+			const Fove_ErrorCode errLeft = FOVE_PERF(fove_Headset_getEyeState(headset, Fove_Eye::Left, &left));
+			const Fove_ErrorCode errRight = FOVE_PERF(fove_Headset_getEyeState(headset, Fove_Eye::Right, &right));
+			return py::make_tuple(errLeft, left, errRight, right);
+		},
+		"Both-eyes variant of `Headset_getEyeState`: returns `(errLeft, EyeState, errRight, EyeState)`");
+
+	m.def(
+		"Headset_areEyesBlinking", [](Headset& headset) {
+			bool left = false, right = false;
+			const Fove_ErrorCode errLeft = FOVE_PERF(fove_Headset_isEyeBlinking(headset, Fove_Eye::Left, &left));
+			const Fove_ErrorCode errRight = FOVE_PERF(fove_Headset_isEyeBlinking(headset, Fove_Eye::Right, &right));
+			return py::make_tuple(errLeft, left, errRight, right);
+		},
+		"Both-eyes variant of `Headset_isEyeBlinking`: returns `(errLeft, bool, errRight, bool)`");
+
+	m.def(
+		"Headset_getEyeBlinkCounts", [](Headset& headset) {
+			int left = 0, right = 0;
+			const Fove_ErrorCode errLeft = FOVE_PERF(fove_Headset_getEyeBlinkCount(headset, Fove_Eye::Left, &left));
+			const Fove_ErrorCode errRight = FOVE_PERF(fove_Headset_getEyeBlinkCount(headset, Fove_Eye::Right, &right));
+			return py::make_tuple(errLeft, left, errRight, right);
+		},
+		"Both-eyes variant of `Headset_getEyeBlinkCount`: returns `(errLeft, int, errRight, int)`");
+
+	m.def(
+		"Headset_getEyeShapes", [](Headset& headset) {
+			Obj<Fove_EyeShape> left = {}, right = {};
+			const Fove_ErrorCode errLeft = FOVE_PERF(fove_Headset_getEyeShape(headset, Fove_Eye::Left, left));
+			const Fove_ErrorCode errRight = FOVE_PERF(fove_Headset_getEyeShape(headset, Fove_Eye::Right, right));
+			return py::make_tuple(errLeft, left, errRight, right);
+		},
+		"Both-eyes variant of `Headset_getEyeShape`: returns `(errLeft, EyeShape, errRight, EyeShape)`");
+
+	m.def(
+		"Headset_getPupilShapes", [](Headset& headset) {
+			Fove_PupilShape left = {}, right = {};
+			const Fove_ErrorCode errLeft = FOVE_PERF(fove_Headset_getPupilShape(headset, Fove_Eye::Left, &left));
+			const Fove_ErrorCode errRight = FOVE_PERF(fove_Headset_getPupilShape(headset, Fove_Eye::Right, &right));
+			return py::make_tuple(errLeft, left, errRight, right);
+		},
+		"Both-eyes variant of `Headset_getPupilShape`: returns `(errLeft, PupilShape, errRight, PupilShape)`");
+
+	// Direct-write overloads of the two above for per-frame feature extraction:
+	// both eyes are fetched in one crossing and written straight into a caller
+	// array, with no temporary shape objects or Python-side marshalling
+	m.def(
+		"Headset_getEyeShapes", [](Headset& headset, py::array_t<float, py::array::c_style> out) {
+			if (out.ndim() != 3 || out.shape(0) != 2 || out.shape(1) != 12 || out.shape(2) != 2)
+				throw std::runtime_error("out must be a C-contiguous float32 array of shape [2, 12, 2]");
+			if (!out.writeable())
+				throw std::runtime_error("out must be writeable");
+			// Fove_EyeShape is exactly 12 Vec2 outline points, the [12, 2] buffer layout
+			static_assert(sizeof(Fove_EyeShape) == sizeof(float) * 12 * 2, "EyeShape layout changed");
+			Fove_EyeShape* const shapes = static_cast<Fove_EyeShape*>(out.request().ptr);
+			const Fove_ErrorCode errLeft = FOVE_PERF(fove_Headset_getEyeShape(headset, Fove_Eye::Left, &shapes[0]));
+			const Fove_ErrorCode errRight = FOVE_PERF(fove_Headset_getEyeShape(headset, Fove_Eye::Right, &shapes[1]));
+			return py::make_tuple(errLeft, errRight);
+		},
+		py::arg("headset"), py::arg("out").noconvert(),
+		R"(Writes both eyes' shapes directly into a caller-provided numpy array
+
+The left eye outline is written to `out[0]` and the right eye outline to `out[1]`,
+each as 12 (x, y) points, with no intermediate `EyeShape` objects constructed.
+
+\param out A writeable C-contiguous float32 array of shape [2, 12, 2]
+\return The tuple `(errLeft, errRight)` of per-eye error codes
+\see Headset_getEyeShape
+)");
+
+	m.def(
+		"Headset_getPupilShapes", [](Headset& headset, py::array_t<float, py::array::c_style> out) {
+			if (out.ndim() != 2 || out.shape(0) != 2 || out.shape(1) != 5)
+				throw std::runtime_error("out must be a C-contiguous float32 array of shape [2, 5]");
+			if (!out.writeable())
+				throw std::runtime_error("out must be writeable");
+			// Fove_PupilShape is 5 packed floats: center x/y, size x/y, angle
+			static_assert(sizeof(Fove_PupilShape) == sizeof(float) * 5, "PupilShape layout changed");
+			Fove_PupilShape* const shapes = static_cast<Fove_PupilShape*>(out.request().ptr);
+			const Fove_ErrorCode errLeft = FOVE_PERF(fove_Headset_getPupilShape(headset, Fove_Eye::Left, &shapes[0]));
+			const Fove_ErrorCode errRight = FOVE_PERF(fove_Headset_getPupilShape(headset, Fove_Eye::Right, &shapes[1]));
+			return py::make_tuple(errLeft, errRight);
+		},
+		py::arg("headset"), py::arg("out").noconvert(),
+		R"(Writes both eyes' pupil ellipses directly into a caller-provided numpy array
+
+Each row holds one eye as `(center.x, center.y, size.x, size.y, angle)`, left eye
+in `out[0]` and right eye in `out[1]`.
+
+\param out A writeable C-contiguous float32 array of shape [2, 5]
+\return The tuple `(errLeft, errRight)` of per-eye error codes
+\see Headset_getPupilShape
+)");
 }
 
 } // namespace FovePython
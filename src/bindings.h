@@ -2,6 +2,29 @@
 
 #include <pybind11/pybind11.h>
 
+// Optional registration groups, so embedded deployments that never touch them
+// (headless kiosks rendering nothing and calibrating nothing) can compile them
+// out entirely: smaller binary, fewer types registered on import, and no
+// attack surface for code paths the deployment cannot exercise.
+//
+// The default build binds everything. Configure with
+// -DFOVE_PYTHON_SLIM_BINDINGS=ON (which defines FOVE_SLIM_BINDINGS) for the
+// eye-data-only module, or define FOVE_BINDINGS_FEATURES directly to an
+// or-combination of the bits below to pick groups individually.
+#define FOVE_FEATURE_COMPOSITOR 0x1      // compositor session, layer submission, the submit fast path
+#define FOVE_FEATURE_CALIBRATION_GUI 0x2 // client-side calibration/HMD-adjustment rendering (start/tick/targets)
+#define FOVE_FEATURE_GAZABLE_OBJECTS 0x4 // collider scene registration and the local gaze raycast
+
+#ifndef FOVE_BINDINGS_FEATURES
+#ifdef FOVE_SLIM_BINDINGS
+#define FOVE_BINDINGS_FEATURES 0
+#else
+#define FOVE_BINDINGS_FEATURES (FOVE_FEATURE_COMPOSITOR | FOVE_FEATURE_CALIBRATION_GUI | FOVE_FEATURE_GAZABLE_OBJECTS)
+#endif
+#endif
+
+#define FOVE_HAS_FEATURE(feature) ((FOVE_BINDINGS_FEATURES & (feature)) != 0)
+
 namespace FovePython
 {
 namespace py = pybind11;
@@ -73,6 +96,39 @@ void defstruct_CalibrationData(py::module&);
 void defstruct_CalibrationOptions(py::module&);
 void defstruct_HmdAdjustmentData(py::module&);
 
+void defstruct_Dtypes(py::module&);
+void defstruct_EyeTrackingSnapshot(py::module&);
+void defstruct_StartupInfo(py::module&);
+void defstruct_FramePump(py::module&);
+void defstruct_FrameAligner(py::module&);
+void defstruct_HeadsetGroup(py::module&);
+void defstruct_Recorder(py::module&);
+void defstruct_ReplayHeadset(py::module&);
+void defstruct_FrameWaiter(py::module&);
+void defstruct_CompositorWaiter(py::module&);
+void defstruct_PoseBuffer(py::module&);
+void defstruct_PosePump(py::module&);
+void defstruct_ConnectionSupervisor(py::module&);
+void defstruct_GazeCastScene(py::module&);
+void defstruct_ImageStream(py::module&);
+void defstruct_SnapshotBus(py::module&);
+void defstruct_SubmitContext(py::module&);
+void defstruct_Scratch(py::module&);
+void defstruct_Heatmap(py::module&);
+void defstruct_Scanpath(py::module&);
+void defstruct_ArrowBatch(py::module&);
+void defstruct_Relay(py::module&);
+
 void bind_CAPIs(py::module&);
+void bind_BatchMath(py::module&);
+void bind_BitmapDecode(py::module&);
+void bind_Perf(py::module&);
+void bind_ErrorPolicy(py::module&);
+void bind_Log(py::module&);
+void bind_ClockSync(py::module&);
+void bind_GazeEvents(py::module&);
+void bind_GazeFilter(py::module&);
+void bind_PupilStats(py::module&);
+void bind_ColumnExport(py::module&);
 
 } // namespace FovePython
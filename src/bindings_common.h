@@ -0,0 +1,808 @@
+#pragma once
+
+// Shared internal preamble of the binding translation units: how FoveAPI.h is
+// pulled in (the C API compiled as C++), the Obj<T> out-parameter wrapper, and
+// the per-call latency instrumentation every fove_* call site goes through.
+// Include this first, before any other header that may include FoveAPI.h.
+//
+// Note:
+// - The C API provides a canonical API to which other language bindings are made
+// - The C++ API is a bit special in that (currently) it is not really a binding to the C API
+//   but defined by sharing codes with the C API
+// - Here, we bind to the C API compiled as C++ codes; this in particular means:
+//   - C++ APIs are not defined
+//   - `FoveAPI.h` is pulled in with `FOVE_DEFINE_CXX_API` set to false (0)
+//   - Structs exclusively uses containment than inheritance;
+//     but they are compiled as C++, so that we can use member pointers
+//   - Enums are C++ enum class (for symmetry and better type safety);
+//     but this comes at a cost of we having have to duplicate some functions
+//     that operates on some enums (`operator|` for ClientCapabilities etc.)
+//   - Maybe systematically expose a fraction of CXX_API to python bindings using
+//     FOVE_PYTHON_BINDINGS cpp flag?
+//
+// Note2: On initialization of objects
+// - As a matter of principle, we prefer to have objects initialized properly
+//   as soon as they get constructed.  This is certainly so when objects in concern
+//   have sensible defaults; even if not (e.g. `Fove_Versions`) we prefer them
+//   (as a matter of taste) to be initialized to arbitrary but predictable values,
+//   with possible exceptions that doing so may incur significant performance penalties.
+// - So, it would nice if we could initialize structs in `FoveAPI.h`
+//   with their non-static data member initializers (NSDMI) as in the C++ API.
+// - In C++11, however, we cannot aggregate initialize (Struct x = {...}) objects
+//   with NSDMIs. (In C++14, we can.)
+// - We do not want to force our clients to use C++14. (We do force C++11, or later)
+// - So when we use NSDMI, `pybind11` ctors like
+//   ```
+//   py::class_<C>(..)
+//     .def(py::init<Arg>(py::arg("arg0") = ..))
+//   ```
+//   chokes (should choke) when we compile in a strict C++11 mode.
+// - There is `py::class_<C>(..).def(py::init([](Arg arg0, ..) { .. }))`, but it does not appear
+//   to provide a handle for controlling keyword argument names as of yet.
+// - There are two choices at this point:
+//   (1) give up NSDMI on the C++ layer and (repeat and) inject default values from this file to `FoveAPI.h`
+//   (2) use NSDMI and provide `py::init<>()` and `py::init([](Args..) {..})`
+//   And both have pros and cons.
+// - Bottom line: Choose (1) for now.
+//   (Would be more python user friendly, in case we ever ended up opening up `fove.capi` to users)
+// - [Remark: for those that do not have sensible defaults (e.g. `Fove_Versions`, `Fove_Matrix44`)
+//    we do not really care and just provide a default constructor.]
+#define FOVE_DEFINE_CXX_API 0
+#define FOVE_CXX_NAMESPACE SHOULD_CAUSE_SYNTAX_ERROR_WHEN_USED !
+#define FOVE_EXTERN_C extern "C"
+#define FOVE_ENUM(enumName) enum class Fove_##enumName
+#define FOVE_ENUM_VAL(enumName, valueName) valueName
+#define FOVE_ENUM_END(enumName) ;
+#define FOVE_STRUCT(structName) struct Fove_##structName
+// We do not set default values upon constructions although we are in a C++ mode;
+// see the comments above for a rationale.
+// #define FOVE_STRUCT_VAL(memberName, defaultVal) memberName = defaultVal
+#define FOVE_STRUCT_VAL(memberName, defaultVal) memberName;
+#define FOVE_STRUCT_END(structName) ;
+#define FOVE_STRUCT_END_NO_CXX_ALIAS(structName) ;
+#include <FoveAPI.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+// For binding-internal structs with py::object members: pybind11 types carry
+// hidden visibility, so a default-visibility struct holding one draws a GCC
+// -Wattributes warning ("declared with greater visibility than the type of
+// its field"). These structs never cross the module boundary, so give them
+// hidden visibility too, the same way pybind11 marks its own namespace.
+#if defined(__GNUC__)
+#define FOVE_BINDINGS_HIDDEN __attribute__((visibility("hidden")))
+#else
+#define FOVE_BINDINGS_HIDDEN
+#endif
+
+// FoveAPI.h uses these names to define opaque types.
+// We do not really need define these, but pybind11 requires them to be defined.
+// clang-format off
+struct Fove_Headset_{};
+struct Fove_Compositor_{};
+// clang-format on
+
+namespace FovePython
+{
+namespace py = pybind11;
+
+// pybind11 does not support like C arrays and C double pointers, so we wrap
+// structs that contains those in an Obj.
+// Also, primitive types such as bool, int, .. are immutable, so we wrap them
+// as well.
+template <typename T>
+struct Obj
+{
+	T val;
+	operator T&() { return val; }
+	operator T*() { return &val; }
+};
+
+// clang-format off
+template <typename T>
+bool operator==(const Obj<T>& a, const Obj<T>& b) { return a.val == b.val; }
+template <typename T>
+bool operator!=(const Obj<T>& a, const Obj<T>& b) { return !(a.val == b.val); }
+// clang-format on
+
+using Headset = Obj<Fove_Headset*>;
+using Compositor = Obj<Fove_Compositor*>;
+using Python_Matrix44 = Obj<Fove_Matrix44>;
+using Python_EyeShape = Obj<Fove_EyeShape>;
+
+// pybind11 does not support C arrays, so we translate Fove_Versions
+// to Python_Versions in Headset_querySoftwareVersions().
+struct Python_Versions
+{
+	int clientMajor = -1;
+	int clientMinor = -1;
+	int clientBuild = -1;
+	int clientProtocol = -1;
+	std::string clientHash;
+	int runtimeMajor = -1;
+	int runtimeMinor = -1;
+	int runtimeBuild = -1;
+	std::string runtimeHash;
+	int firmware = -1;
+	int maxFirmware = -1;
+	int minFirmware = -1;
+	bool tooOldHeadsetConnected = false;
+};
+
+// pybind11 does not support C arrays, so we translate Fove_LicenseInfo to Python_LicenseInfo
+struct Python_LicenseInfo
+{
+	std::string uuid;
+	int expirationYear = 0;
+	int expirationMonth = 0;
+	int expirationDay = 0;
+	std::string licenseType;
+	std::string licensee;
+};
+
+// pybind11 does not support C arrays, so we translate Fove_HeadsetHardwareInfo
+// to Python_HeadsetHardwareInfo in Headset_queryHardwareInfo().
+struct Python_HeadsetHardwareInfo
+{
+	std::string serialNumber;
+	std::string manufacturer;
+	std::string modelName;
+};
+
+struct CalibrationData
+{
+	Fove_CalibrationMethod method;
+	Fove_CalibrationState state;
+	std::string stateInfo;
+	Fove_CalibrationTarget targetL;
+	Fove_CalibrationTarget targetR;
+
+	static CalibrationData FromNative(const Fove_CalibrationData* nativeData)
+	{
+		return {
+			nativeData->method,
+			nativeData->state,
+			nativeData->stateInfo ? nativeData->stateInfo : "",
+			nativeData->targetL,
+			nativeData->targetR,
+		};
+	}
+
+	// In-place variant for the per-tick callbacks, which run 120 times a second
+	// during calibration: scalar fields are overwritten and stateInfo keeps its
+	// existing heap storage, only reallocating when the runtime actually sends
+	// a longer message than any seen before
+	void assignFromNative(const Fove_CalibrationData* nativeData)
+	{
+		method = nativeData->method;
+		state = nativeData->state;
+		targetL = nativeData->targetL;
+		targetR = nativeData->targetR;
+		const char* const info = nativeData->stateInfo ? nativeData->stateInfo : "";
+		if (stateInfo != info) // the common case: the message is unchanged, so not even a copy
+			stateInfo = info;
+	}
+};
+
+// copied from FoveAPI.h
+inline constexpr Fove_ClientCapabilities operator|(Fove_ClientCapabilities a, Fove_ClientCapabilities b) { return static_cast<Fove_ClientCapabilities>(static_cast<int>(a) | static_cast<int>(b)); }
+inline constexpr Fove_ClientCapabilities operator&(Fove_ClientCapabilities a, Fove_ClientCapabilities b) { return static_cast<Fove_ClientCapabilities>(static_cast<int>(a) & static_cast<int>(b)); }
+inline constexpr Fove_ClientCapabilities operator~(Fove_ClientCapabilities a) { return static_cast<Fove_ClientCapabilities>(~static_cast<int>(a)); }
+inline constexpr Fove_ObjectGroup operator|(Fove_ObjectGroup a, Fove_ObjectGroup b) { return static_cast<Fove_ObjectGroup>(static_cast<int>(a) | static_cast<int>(b)); }
+inline constexpr Fove_ObjectGroup operator&(Fove_ObjectGroup a, Fove_ObjectGroup b) { return static_cast<Fove_ObjectGroup>(static_cast<int>(a) & static_cast<int>(b)); }
+inline constexpr Fove_ObjectGroup operator~(Fove_ObjectGroup a) { return static_cast<Fove_ObjectGroup>(~static_cast<int>(a)); }
+
+// Lightweight per-function latency histograms over the fove_* calls the bindings
+// make. Disabled by default, in which case the only per-call cost is one relaxed
+// atomic load; enabled, each call adds two clock reads and a few relaxed atomic
+// increments into log2-spaced nanosecond buckets.
+constexpr int perfBucketCount = 32;
+
+struct PerfRecord
+{
+	std::string name;
+	std::atomic<uint64_t> count{0};
+	std::atomic<uint64_t> totalNs{0};
+	std::atomic<uint64_t> maxNs{0};
+	std::atomic<uint64_t> buckets[perfBucketCount] = {};
+
+	void add(const uint64_t ns)
+	{
+		count.fetch_add(1, std::memory_order_relaxed);
+		totalNs.fetch_add(ns, std::memory_order_relaxed);
+		uint64_t prevMax = maxNs.load(std::memory_order_relaxed);
+		while (ns > prevMax && !maxNs.compare_exchange_weak(prevMax, ns, std::memory_order_relaxed))
+		{
+		}
+		int bucket = 0;
+		while (bucket < perfBucketCount - 1 && (uint64_t(1) << (bucket + 1)) <= ns)
+			++bucket;
+		buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void reset()
+	{
+		count.store(0);
+		totalNs.store(0);
+		maxNs.store(0);
+		for (auto& bucket : buckets)
+			bucket.store(0);
+	}
+
+	// Upper bound of the bucket holding the given quantile of observed latencies
+	uint64_t quantileNs(const double q) const
+	{
+		const uint64_t total = count.load();
+		const uint64_t rank = static_cast<uint64_t>(q * total);
+		uint64_t seen = 0;
+		for (int bucket = 0; bucket < perfBucketCount; ++bucket)
+		{
+			seen += buckets[bucket].load();
+			if (seen > rank)
+				return uint64_t(1) << (bucket + 1);
+		}
+		return 0;
+	}
+};
+
+inline std::atomic<bool> perfEnabled{false};
+
+struct PerfRegistry
+{
+	std::mutex mutex;
+	std::vector<std::unique_ptr<PerfRecord>> records;
+
+	// Called once per call site via a local static; the stringified call
+	// expression is keyed by the function name (everything before the '(')
+	PerfRecord& lookup(const char* callText)
+	{
+		const char* const paren = std::strchr(callText, '(');
+		const std::string name{callText, paren ? static_cast<size_t>(paren - callText) : std::strlen(callText)};
+		std::lock_guard<std::mutex> lock(mutex);
+		for (auto& record : records)
+			if (record->name == name)
+				return *record;
+		records.emplace_back(new PerfRecord);
+		records.back()->name = name;
+		return *records.back();
+	}
+};
+
+inline PerfRegistry& perfRegistry()
+{
+	static PerfRegistry registry;
+	return registry;
+}
+
+template <typename F>
+auto perfMeasure(PerfRecord& record, F&& f) -> decltype(f())
+{
+	if (!perfEnabled.load(std::memory_order_relaxed))
+		return f();
+	const auto begin = std::chrono::steady_clock::now();
+	auto result = f();
+	const auto end = std::chrono::steady_clock::now();
+	record.add(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()));
+	return result;
+}
+
+////////////////////////////////////////////////////////////////
+// Error policy
+
+// Process-wide policy for the Fove_ErrorCode every binding returns, configured
+// via set_error_policy. The raise_on set turns selected codes into Python
+// exceptions natively at the call site (checked inside FOVE_PERF, so the
+// default empty set costs one relaxed atomic load per call); the acceptable
+// set backs the native error_is_acceptable query, replacing the chained
+// Python-level enum comparisons in headset.py's Result.
+struct ErrorPolicy
+{
+	std::mutex mutex;
+	std::vector<Fove_ErrorCode> acceptable{Fove_ErrorCode::None, Fove_ErrorCode::Data_LowAccuracy, Fove_ErrorCode::Data_Unreliable};
+	std::vector<Fove_ErrorCode> raiseOn;
+	std::atomic<bool> raiseActive{false}; // mirrors !raiseOn.empty() for the lock-free hot path
+};
+
+inline ErrorPolicy& errorPolicy()
+{
+	static ErrorPolicy policy;
+	return policy;
+}
+
+// Thrown for codes in the raise_on set. Deliberately not a Python exception:
+// the throw site may not hold the GIL (call_guard bindings, the fastcall
+// trampolines), so the translation to capi.ErrorCodeError happens at the
+// binding boundary. The exception type object is published here so the
+// fastcall trampolines can translate without going through pybind11.
+struct ErrorPolicyViolation
+{
+	Fove_ErrorCode code;
+};
+
+inline PyObject* errorPolicyExceptionType = nullptr; // set by bind_ErrorPolicy
+
+inline Fove_ErrorCode applyErrorPolicy(const Fove_ErrorCode err)
+{
+	ErrorPolicy& policy = errorPolicy();
+	if (err != Fove_ErrorCode::None && policy.raiseActive.load(std::memory_order_relaxed))
+	{
+		std::lock_guard<std::mutex> lock(policy.mutex);
+		for (const Fove_ErrorCode code : policy.raiseOn)
+			if (code == err)
+				throw ErrorPolicyViolation{err};
+	}
+	return err;
+}
+
+////////////////////////////////////////////////////////////////
+// Connection supervision
+
+// Process-wide connection state, driven by the ConnectionSupervisor in
+// bindings.cpp. While a supervisor runs and a call has returned
+// Connect_NotConnected, `down` is set: subsequent calls short-circuit to the
+// cached error without attempting IPC, and the supervisor thread re-probes the
+// service with exponential backoff until it answers. Unsupervised, the whole
+// machinery costs one relaxed load per call.
+struct ConnectionState
+{
+	std::atomic<bool> supervised{false}; // a supervisor thread is running
+	std::atomic<bool> down{false};       // short-circuit calls while set
+};
+
+inline ConnectionState& connectionState()
+{
+	static ConnectionState state;
+	return state;
+}
+
+inline bool connectionDown()
+{
+	return connectionState().down.load(std::memory_order_relaxed);
+}
+
+// Central detection point: every instrumented call reports its error here
+inline void noteConnectionError(const Fove_ErrorCode err)
+{
+	if (err == Fove_ErrorCode::Connect_NotConnected)
+	{
+		ConnectionState& state = connectionState();
+		if (state.supervised.load(std::memory_order_relaxed))
+			state.down.store(true, std::memory_order_relaxed);
+	}
+}
+
+// Wraps a fove_* call site with the per-function latency instrumentation
+// and the configured error policy, bypassing the connection short-circuit:
+// lifecycle calls (createHeadset, Headset_destroy, ...) must reach the
+// runtime even while the supervisor holds the connection down
+#define FOVE_PERF_DIRECT(call)                                              \
+	([&]() -> decltype(call) {                                              \
+		static PerfRecord& perfRecord = perfRegistry().lookup(#call);       \
+		const Fove_ErrorCode fovePerfErr =                                  \
+			perfMeasure(perfRecord, [&] { return (call); });                \
+		noteConnectionError(fovePerfErr);                                   \
+		return applyErrorPolicy(fovePerfErr);                               \
+	}())
+
+// The regular call-site wrapper: additionally answers Connect_NotConnected
+// from the cached connection state without any IPC while the supervisor is
+// re-establishing the connection
+#define FOVE_PERF(call)                                                     \
+	([&]() -> decltype(call) {                                              \
+		if (connectionDown())                                               \
+			return applyErrorPolicy(Fove_ErrorCode::Connect_NotConnected);  \
+		return FOVE_PERF_DIRECT(call);                                      \
+	}())
+
+////////////////////////////////////////////////////////////////
+// Scratch arena
+
+// Thread-local bump arena for binding-layer temporaries that die before the
+// call returns (packet staging buffers, decode scratch, ...). Allocation is a
+// pointer bump; nothing is freed individually. The client declares its frame
+// boundary with capi.frame_mark(), which resets the calling thread's arena in
+// O(1), so after the first frame has sized the block the steady state runs
+// without malloc/free pairs. Overflow past the block falls back to heap
+// allocations that are reclaimed (and the block regrown) at the next mark.
+//
+// POD only: the arena never runs destructors.
+struct ScratchArena
+{
+	std::unique_ptr<char[]> block;
+	size_t capacity = 0;
+	size_t used = 0;
+	std::vector<std::unique_ptr<char[]>> overflow; // freed at the next frame mark
+	size_t overflowBytes = 0;
+	uint64_t frames = 0;
+	uint64_t heapFallbacks = 0; // cumulative, across all frames
+};
+
+inline ScratchArena& scratchArena()
+{
+	static thread_local ScratchArena arena;
+	return arena;
+}
+
+inline void* scratchAlloc(const size_t bytes)
+{
+	ScratchArena& arena = scratchArena();
+	const size_t aligned = (bytes + 15) / 16 * 16;
+	if (arena.used + aligned <= arena.capacity)
+	{
+		void* const ptr = arena.block.get() + arena.used;
+		arena.used += aligned;
+		return ptr;
+	}
+	arena.overflow.emplace_back(new char[aligned]);
+	arena.overflowBytes += aligned;
+	++arena.heapFallbacks;
+	return arena.overflow.back().get();
+}
+
+template <typename T>
+inline T* scratchAllocOf(const size_t count)
+{
+	static_assert(alignof(T) <= 16, "scratch allocations are 16-byte aligned");
+	return static_cast<T*>(scratchAlloc(count * sizeof(T)));
+}
+
+inline void scratchFrameMark()
+{
+	ScratchArena& arena = scratchArena();
+	const size_t footprint = arena.used + arena.overflowBytes;
+	if (footprint > arena.capacity)
+	{
+		// Grow to the largest frame seen (plus headroom) so the next frames fit
+		arena.capacity = footprint + footprint / 2;
+		arena.block.reset(new char[arena.capacity]);
+	}
+	arena.used = 0;
+	arena.overflow.clear();
+	arena.overflowBytes = 0;
+	++arena.frames;
+}
+
+////////////////////////////////////////////////////////////////
+// Image buffer pool
+
+// Fixed pool of recycled output buffers for the per-frame image paths
+// (decode_bitmap results, ImageStreamReader copies), configured via
+// configure_image_pool. At 120 Hz a fresh numpy allocation per frame
+// fragments the heap and stalls in the allocator; pooled buffers are handed
+// to Python wrapped in an array whose capsule base returns the buffer to
+// the free list when the last view dies, so the steady-state image pipeline
+// allocates nothing. A buffer cannot be recycled while any Python view of
+// it is alive, so no generation check is needed on the views themselves.
+//
+// Each slot keeps its payload capacity in a 64-byte header in front of the
+// payload (which also cacheline-aligns the payload for the vectorized
+// kernels); a buffer released after a reconfiguration that changed the
+// capacity is freed instead of re-entering the pool.
+constexpr size_t imagePoolHeaderSize = 64;
+
+struct ImagePool
+{
+	std::mutex mutex;
+	std::vector<unsigned char*> freeBuffers; // base pointers, header included
+	size_t capacity = 0;                     // payload bytes per buffer
+	size_t count = 0;                        // configured number of buffers
+};
+
+inline ImagePool& imagePool()
+{
+	// Leaked deliberately: capsule destructors can still run during
+	// interpreter shutdown, after function-local statics are gone
+	static ImagePool& pool = *new ImagePool;
+	return pool;
+}
+
+// Returns a pooled payload pointer of at least `bytes` capacity, or nullptr
+// when the pool is unconfigured, exhausted, or too small (the caller then
+// allocates normally)
+inline unsigned char* imagePoolAcquire(const size_t bytes)
+{
+	ImagePool& pool = imagePool();
+	std::lock_guard<std::mutex> lock(pool.mutex);
+	if (pool.freeBuffers.empty() || pool.capacity < bytes)
+		return nullptr;
+	unsigned char* const base = pool.freeBuffers.back();
+	pool.freeBuffers.pop_back();
+	return base + imagePoolHeaderSize;
+}
+
+inline void imagePoolRelease(unsigned char* const payload)
+{
+	unsigned char* const base = payload - imagePoolHeaderSize;
+	size_t capacity;
+	std::memcpy(&capacity, base, sizeof capacity);
+	ImagePool& pool = imagePool();
+	std::unique_lock<std::mutex> lock(pool.mutex);
+	if (capacity == pool.capacity && pool.freeBuffers.size() < pool.count)
+		pool.freeBuffers.push_back(base);
+	else
+	{
+		lock.unlock();
+		delete[] base;
+	}
+}
+
+// Wraps a pooled payload in a uint8 array of the given shape; the capsule
+// base recycles the buffer once Python drops the last reference
+inline py::array_t<uint8_t, py::array::c_style> imagePoolArray(unsigned char* const payload, const std::vector<py::ssize_t>& shape)
+{
+	const py::capsule base(payload, [](void* p) { imagePoolRelease(static_cast<unsigned char*>(p)); });
+	return py::array_t<uint8_t, py::array::c_style>(shape, payload, base);
+}
+
+// The layout the batch APIs take their float input through: contiguous
+// row-major float32, converting on entry if needed
+using FloatBatch = py::array_t<float, py::array::c_style | py::array::forcecast>;
+
+// Checks that `arr` is of shape [N, width] and returns N; -1 requests any N
+inline py::ssize_t batchLength(const FloatBatch& arr, py::ssize_t width, const char* name)
+{
+	if (arr.ndim() != 2 || arr.shape(1) != width)
+		throw std::runtime_error(std::string(name) + " must be an array of shape [N, " + std::to_string(width) + "]");
+	return arr.shape(0);
+}
+
+// Defined in bindings_diag.cpp: routes a binding-layer record into the
+// asynchronous log sink configured via log_config
+void logDiagnostic(Fove_LogLevel level, const char* text);
+
+////////////////////////////////////////////////////////////////
+// Worker thread scheduling
+
+// Placement controls for the binding-owned worker threads (pump, recorder,
+// waiter, ...), configured from Python via thread_config. On rigs where a
+// renderer owns specific cores, letting capture threads float onto them costs
+// dropped frames; the registry below lets a deployment pin each subsystem to
+// a CPU set, raise it to SCHED_FIFO where permitted, or park it below the
+// renderer with a nice value. Each worker applies its subsystem's entry as
+// its thread starts, so configure a subsystem before starting it.
+struct ThreadSched
+{
+	std::string name;      // thread name; empty uses "fove-<subsystem>"
+	uint64_t affinity = 0; // CPU bitmask (bit N = CPU N); 0 keeps the inherited mask
+	int priority = 0;      // with fifo: SCHED_FIFO priority 1-99; otherwise a nice value
+	bool fifo = false;
+};
+
+struct ThreadSchedRegistry
+{
+	std::mutex mutex;
+	std::map<std::string, ThreadSched> subsystems;
+};
+
+inline ThreadSchedRegistry& threadSchedRegistry()
+{
+	// Leaked deliberately: worker threads can outlive static destruction
+	static ThreadSchedRegistry& registry = *new ThreadSchedRegistry;
+	return registry;
+}
+
+// Applies the configuration for `subsystem` to the calling thread; every
+// worker calls this first thing. The thread is always named (worth it alone
+// for profiler traces); affinity and scheduling are best effort — notably,
+// SCHED_FIFO without rtprio rights fails with EPERM and is ignored rather
+// than failing the subsystem.
+inline void applyThreadSched(const char* const subsystem)
+{
+	ThreadSched config;
+	{
+		ThreadSchedRegistry& registry = threadSchedRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		const auto found = registry.subsystems.find(subsystem);
+		if (found != registry.subsystems.end())
+			config = found->second;
+	}
+	const std::string name = config.name.empty() ? std::string("fove-") + subsystem : config.name;
+#ifdef _WIN32
+	SetThreadDescription(GetCurrentThread(), std::wstring(name.begin(), name.end()).c_str());
+	if (config.affinity != 0)
+		SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(config.affinity));
+	if (config.fifo)
+		SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL);
+	else if (config.priority != 0)
+		SetThreadPriority(GetCurrentThread(), config.priority < 0 ? THREAD_PRIORITY_ABOVE_NORMAL : THREAD_PRIORITY_BELOW_NORMAL);
+#else
+	pthread_setname_np(pthread_self(), name.substr(0, 15).c_str()); // kernel limit: 15 chars + NUL
+	if (config.affinity != 0)
+	{
+		cpu_set_t cpus;
+		CPU_ZERO(&cpus);
+		for (unsigned cpu = 0; cpu < 64; ++cpu)
+			if (config.affinity & (uint64_t(1) << cpu))
+				CPU_SET(cpu, &cpus);
+		pthread_setaffinity_np(pthread_self(), sizeof cpus, &cpus);
+	}
+	if (config.fifo)
+	{
+		sched_param param = {};
+		param.sched_priority = config.priority < 1 ? 1 : (config.priority > 99 ? 99 : config.priority);
+		pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+	}
+#ifdef __linux__
+	else if (config.priority != 0)
+		setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), config.priority); // per-thread nice
+#endif
+#endif
+}
+
+////////////////////////////////////////////////////////////////
+// Worker thread registry
+
+// Live accounting of the binding-owned worker threads, surfaced through
+// thread_stats(): which subsystems are running and how much CPU each thread
+// burns, so an idle-cost regression (a poll loop degenerating into a spin)
+// shows up in a dashboard instead of a battery drain report.
+struct ThreadStatsEntry
+{
+	std::string subsystem;
+#ifndef _WIN32
+	clockid_t cpuClock; // per-thread CPU clock, valid while the thread lives
+#endif
+	std::chrono::steady_clock::time_point started;
+};
+
+struct ThreadStatsRegistry
+{
+	std::mutex mutex;
+	uint64_t nextId = 1;
+	std::map<uint64_t, ThreadStatsEntry> entries;
+};
+
+inline ThreadStatsRegistry& threadStatsRegistry()
+{
+	// Leaked deliberately: worker threads can outlive static destruction
+	static ThreadStatsRegistry& registry = *new ThreadStatsRegistry;
+	return registry;
+}
+
+// Declared at the top of every worker thread function: applies the
+// subsystem's scheduling configuration and keeps the thread visible in
+// thread_stats() for its lifetime (the entry is removed before the thread
+// function returns, so a registered CPU clock is always queryable).
+class WorkerScope
+{
+public:
+	explicit WorkerScope(const char* const subsystem)
+	{
+		applyThreadSched(subsystem);
+		ThreadStatsEntry entry;
+		entry.subsystem = subsystem;
+		entry.started = std::chrono::steady_clock::now();
+#ifndef _WIN32
+		if (pthread_getcpuclockid(pthread_self(), &entry.cpuClock) != 0)
+			entry.cpuClock = CLOCK_THREAD_CPUTIME_ID;
+#endif
+		ThreadStatsRegistry& registry = threadStatsRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		id_ = registry.nextId++;
+		registry.entries.emplace(id_, std::move(entry));
+	}
+
+	~WorkerScope()
+	{
+		ThreadStatsRegistry& registry = threadStatsRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		registry.entries.erase(id_);
+	}
+
+	WorkerScope(const WorkerScope&) = delete;
+	WorkerScope& operator=(const WorkerScope&) = delete;
+
+private:
+	uint64_t id_ = 0;
+};
+
+////////////////////////////////////////////////////////////////
+// Hot-path IntEnum bindings
+
+// ErrorCode, Eye and EyeState are bound as Python IntEnum rather than
+// py::enum_: headset.py compares an error code against None_ on every call,
+// and a py::enum_ comparison dispatches through a bound __eq__ (argument
+// tuple, overload resolution) where IntEnum members compare through int's
+// native rich compare. The registry below holds the created type and a
+// value-to-member cache per enum so the casters return interned members
+// without a Python-level constructor call; it is filled once during module
+// init (defenum_*) and read-only afterwards, so lookups need no lock even
+// under free-threaded CPython.
+enum class IntEnumId : size_t
+{
+	ErrorCode,
+	Eye,
+	EyeState,
+	Count_,
+};
+
+struct FOVE_BINDINGS_HIDDEN IntEnumRegistry
+{
+	py::object type;                                   // the IntEnum subclass
+	std::unordered_map<long long, py::object> members; // value -> interned member
+};
+
+// Defined in bindings_structs.cpp, filled by the defenum_* registrations
+IntEnumRegistry& intEnumRegistry(IntEnumId id);
+
+// Returns the cached member for `value`, or a plain int for values the enum
+// does not name (so a newer runtime's codes round-trip instead of throwing)
+inline py::object intEnumMember(const IntEnumId id, const long long value)
+{
+	const IntEnumRegistry& registry = intEnumRegistry(id);
+	const auto found = registry.members.find(value);
+	if (found != registry.members.end())
+		return found->second;
+	return py::int_(value);
+}
+
+} // namespace FovePython
+
+// The type casters that replace pybind11's enum machinery for the hot enums:
+// loading accepts any Python int (IntEnum members included, since IntEnum is
+// an int subclass), casting returns the cached member. These must be visible
+// to every translation unit that binds a function touching these types, which
+// is why they live here rather than next to the registrations.
+namespace pybind11
+{
+namespace detail
+{
+
+#define FOVE_INT_ENUM_CASTER(CppType, PyName, Id)                                            \
+	template <>                                                                              \
+	struct type_caster<CppType>                                                              \
+	{                                                                                        \
+		PYBIND11_TYPE_CASTER(CppType, const_name(PyName));                                   \
+		bool load(handle src, bool)                                                          \
+		{                                                                                    \
+			if (!src || !PyLong_Check(src.ptr()))                                            \
+				return false;                                                                \
+			const long long raw = PyLong_AsLongLong(src.ptr());                              \
+			if (raw == -1 && PyErr_Occurred())                                               \
+			{                                                                                \
+				PyErr_Clear();                                                               \
+				return false;                                                                \
+			}                                                                                \
+			value = static_cast<CppType>(raw);                                               \
+			return true;                                                                     \
+		}                                                                                    \
+		static handle cast(const CppType src, return_value_policy, handle)                   \
+		{                                                                                    \
+			return FovePython::intEnumMember(FovePython::IntEnumId::Id,                      \
+											 static_cast<long long>(src))                    \
+				.release();                                                                  \
+		}                                                                                    \
+	};
+
+FOVE_INT_ENUM_CASTER(Fove_ErrorCode, "ErrorCode", ErrorCode)
+FOVE_INT_ENUM_CASTER(Fove_Eye, "Eye", Eye)
+FOVE_INT_ENUM_CASTER(Fove_EyeState, "EyeState", EyeState)
+
+#undef FOVE_INT_ENUM_CASTER
+
+} // namespace detail
+} // namespace pybind11
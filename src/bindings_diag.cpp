@@ -0,0 +1,548 @@
+// Diagnostics bindings: the perf_* latency statistics (whose collection side
+// lives in bindings_common.h so every TU can instrument its fove_* calls)
+// and the asynchronous log sink.
+#include "bindings_common.h"
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <thread>
+#include <unordered_set>
+
+#include <pybind11/stl.h>
+
+#include "bindings.h"
+
+namespace FovePython
+{
+
+void bind_Perf(py::module& m)
+{
+	m.def(
+		"perf_enable", [](const bool enabled) { perfEnabled.store(enabled); },
+		py::arg("enabled") = true,
+		R"(Enables or disables per-call latency instrumentation of the fove_* calls
+
+Disabled (the default), the instrumentation costs a single branch per call.
+
+\param enabled Whether latency histograms should be collected from now on
+\see perf_stats
+)");
+
+	m.def(
+		"perf_stats", []() {
+			py::dict stats;
+			PerfRegistry& registry = perfRegistry();
+			std::lock_guard<std::mutex> lock(registry.mutex);
+			for (const auto& record : registry.records)
+			{
+				const uint64_t count = record->count.load();
+				if (count == 0)
+					continue;
+				py::dict entry;
+				entry["count"] = count;
+				entry["total_ns"] = record->totalNs.load();
+				entry["mean_ns"] = record->totalNs.load() / count;
+				entry["max_ns"] = record->maxNs.load();
+				entry["p50_ns"] = record->quantileNs(0.50);
+				entry["p95_ns"] = record->quantileNs(0.95);
+				entry["p99_ns"] = record->quantileNs(0.99);
+				stats[py::str(record->name)] = entry;
+			}
+			return stats;
+		},
+		R"(Returns the per-function latency statistics collected so far
+
+\return A dict mapping each instrumented fove_* function to a dict with
+        `count`, `total_ns`, `mean_ns`, `max_ns` and histogram-derived
+        `p50_ns`/`p95_ns`/`p99_ns` (upper bounds of log2 buckets)
+\see perf_enable
+\see perf_reset
+)");
+
+	m.def(
+		"perf_reset", []() {
+			PerfRegistry& registry = perfRegistry();
+			std::lock_guard<std::mutex> lock(registry.mutex);
+			for (auto& record : registry.records)
+				record->reset();
+		},
+		"Resets all collected latency statistics to zero");
+
+	m.def(
+		"frame_mark", []() { scratchFrameMark(); },
+		R"(Declares a frame boundary, resetting the calling thread's scratch arena
+
+Binding-layer temporaries (relay packet staging, decode scratch, ...) bump
+allocate from a thread-local arena; calling this once per frame recycles it in
+O(1), so after the first frame has sized the arena the steady state runs those
+paths without malloc/free pairs. Safe to never call: the arena then simply
+grows to the high-water mark of the whole session.
+)");
+
+	m.def(
+		"scratch_stats", []() {
+			const ScratchArena& arena = scratchArena();
+			return py::make_tuple(arena.capacity, arena.used + arena.overflowBytes, arena.frames, arena.heapFallbacks);
+		},
+		R"(Returns `(capacity, used, frames, heap_fallbacks)` of this thread's scratch arena
+
+`heap_fallbacks` counts allocations that overflowed the arena block since the
+thread started; a steadily climbing value means `frame_mark` is not being
+called (or a frame outgrew the block and it will regrow at the next mark).
+)");
+
+	m.def(
+		"object_census", []() {
+			// Walks pybind11's live-instance registry rather than keeping
+			// per-type counters: exact on demand, and zero cost on every
+			// construction/destruction in between
+			std::map<std::string, uint64_t> counts;
+			std::unordered_set<const void*> seen;
+			const auto tally = [&](const py::detail::instance_map& instances) {
+				for (const auto& item : instances)
+				{
+					if (!seen.insert(item.second).second)
+						continue; // multi-base instances register once per base pointer
+					const char* const typeName = Py_TYPE(reinterpret_cast<PyObject*>(item.second))->tp_name;
+					const char* const dot = std::strrchr(typeName, '.');
+					counts[dot ? dot + 1 : typeName] += 1;
+				}
+			};
+			py::detail::internals& internals = py::detail::get_internals();
+#ifdef Py_GIL_DISABLED
+			for (size_t i = 0; i <= internals.instance_shards_mask; ++i)
+			{
+				auto& shard = internals.instance_shards[i];
+				std::unique_lock<py::detail::pymutex> lock(shard.mutex);
+				tally(shard.registered_instances);
+			}
+#else
+			tally(internals.registered_instances);
+#endif
+			py::dict result;
+			for (const auto& entry : counts)
+				result[py::str(entry.first)] = entry.second;
+			return result;
+		},
+		R"(Returns a census of every live bound object, as a dict of type name to count
+
+Counts the instances of the binding's registered types currently alive in this
+process (wrapper objects like `Headset`/`EyeStateObj`, pumps, recorders,
+calibration structs, ...), taken from the binding layer's own instance
+registry. Nothing is maintained per construction, so the census costs nothing
+until queried; sampling it periodically on a long-running deployment shows
+which type's population grows when memory does.
+
+\return A dict mapping each bound type name with live instances to its count
+)");
+	m.def(
+		"thread_config", [](const std::string& subsystem, const uint64_t affinity, const int priority, const bool fifo, const std::string& name) {
+			if (subsystem.empty())
+				throw std::runtime_error("thread_config: subsystem must not be empty");
+			if (fifo && (priority < 1 || priority > 99))
+				throw std::runtime_error("thread_config: fifo priority must be in [1, 99]");
+			ThreadSchedRegistry& registry = threadSchedRegistry();
+			std::lock_guard<std::mutex> lock(registry.mutex);
+			registry.subsystems[subsystem] = ThreadSched{name, affinity, priority, fifo};
+		},
+		py::arg("subsystem"), py::arg("affinity") = 0, py::arg("priority") = 0, py::arg("fifo") = false, py::arg("name") = "",
+		R"(Configures scheduling for a subsystem's worker threads
+
+The binding-owned worker threads otherwise inherit the process defaults and
+compete with the application's renderer for cores. Known subsystems: `pump`,
+`recorder`, `waiter`, `aligner`, `group`, `pose`, `compositor`, `supervisor`,
+`log`, `metrics`. The configuration is applied when a subsystem's thread
+starts, so call this before starting (or restart) the subsystem. Affinity and
+scheduling are applied best effort: requesting `fifo` without real-time
+privileges is ignored rather than raised, since the deployment still works,
+just unplaced. The thread is always named (`name`, or `fove-<subsystem>`),
+which alone makes profiler traces legible.
+
+\param subsystem Which worker threads to configure (see the list above)
+\param affinity  CPU bitmask to pin the threads to (bit N = CPU N); 0 keeps the inherited mask
+\param priority  With `fifo`, the SCHED_FIFO priority (1-99); otherwise a nice
+       value (negative runs the threads above the default priority)
+\param fifo      Request the real-time FIFO scheduling class (where permitted)
+\param name      Thread name override; empty uses `fove-<subsystem>`
+)");
+
+	m.def(
+		"thread_stats", []() {
+			py::list stats;
+			ThreadStatsRegistry& registry = threadStatsRegistry();
+			const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+			std::lock_guard<std::mutex> lock(registry.mutex);
+			for (const auto& item : registry.entries)
+			{
+				const ThreadStatsEntry& entry = item.second;
+				py::dict line;
+				line["subsystem"] = entry.subsystem;
+				const uint64_t uptimeNs = static_cast<uint64_t>(
+					std::chrono::duration_cast<std::chrono::nanoseconds>(now - entry.started).count());
+				line["uptime_ns"] = uptimeNs;
+#ifndef _WIN32
+				timespec cpu = {};
+				if (clock_gettime(entry.cpuClock, &cpu) == 0)
+				{
+					const uint64_t cpuNs = static_cast<uint64_t>(cpu.tv_sec) * 1000000000u + static_cast<uint64_t>(cpu.tv_nsec);
+					line["cpu_ns"] = cpuNs;
+					line["utilization"] = uptimeNs > 0 ? static_cast<double>(cpuNs) / static_cast<double>(uptimeNs) : 0.0;
+				}
+#endif
+				stats.append(std::move(line));
+			}
+			return stats;
+		},
+		R"(Returns per-thread CPU accounting of the live binding-owned workers
+
+One entry per running worker thread with `subsystem`, `uptime_ns` and (on
+POSIX) `cpu_ns` plus `utilization` (CPU seconds per wall second: an idle poll
+loop should sit near 0, a spinning one near 1). The workers block in the
+native frame wait where one exists; the polling threads use deadline-
+estimating sleeps with a short spin-finish window, and a regression of that
+strategy shows up here before it shows up on a battery gauge.
+
+\see thread_config
+)");
+
+}
+
+////////////////////////////////////////////////////////////////
+// Async logging
+
+namespace
+{
+
+// A bounded multi-producer ring of fixed-size log records, drained by a
+// background flusher thread. Producers pay nothing when the level is below
+// the threshold (one relaxed atomic load, checked before any formatting),
+// and otherwise one fetch_add plus a bounded copy into the claimed slot —
+// never a lock, an allocation, or an I/O call. When the ring is full,
+// records are dropped and counted rather than blocking the producer.
+struct LogRecord
+{
+	std::atomic<uint32_t> seq{0}; // even = free, odd = being written, written = slot generation marker
+	uint32_t level;
+	uint64_t timestampUs;
+	char text[232];
+};
+
+constexpr size_t logRingSize = 1024; // power of two
+
+class LogSink
+{
+public:
+	// The producer-side fast path; safe to call from any thread, without the GIL
+	void write(const Fove_LogLevel level, const char* const text)
+	{
+		if (static_cast<int>(level) < threshold_.load(std::memory_order_relaxed))
+			return;
+		const uint64_t ticket = head_.fetch_add(1, std::memory_order_relaxed);
+		if (ticket - tail_.load(std::memory_order_acquire) >= logRingSize)
+		{
+			dropped_.fetch_add(1, std::memory_order_relaxed);
+			head_.fetch_sub(1, std::memory_order_relaxed); // give the ticket back
+			return;
+		}
+		LogRecord& rec = ring_[ticket % logRingSize];
+		rec.level = static_cast<uint32_t>(level);
+		rec.timestampUs = static_cast<uint64_t>(
+			std::chrono::duration_cast<std::chrono::microseconds>(
+				std::chrono::steady_clock::now().time_since_epoch())
+				.count());
+		std::strncpy(rec.text, text, sizeof rec.text - 1);
+		rec.text[sizeof rec.text - 1] = '\0';
+		// Publish: the flusher only consumes slots whose generation matches
+		rec.seq.store(static_cast<uint32_t>(ticket / logRingSize) * 2 + 1, std::memory_order_release);
+	}
+
+	// Reconfigures the sink; empty path closes the file, None callback detaches it.
+	// Called with the GIL held; drainMutex_ is always taken with the GIL released
+	// (matching the flusher's drainMutex_-then-GIL order) to avoid a deadlock.
+	void configure(const Fove_LogLevel level, const std::string& path, py::object callback)
+	{
+		std::lock_guard<std::mutex> lock(configMutex_);
+		threshold_.store(static_cast<int>(level), std::memory_order_relaxed);
+		{
+			py::gil_scoped_release release;
+			drainMutex_.lock();
+		}
+		std::lock_guard<std::mutex> drainLock(drainMutex_, std::adopt_lock);
+		if (file_)
+			std::fclose(file_);
+		file_ = nullptr;
+		if (!path.empty())
+		{
+			file_ = std::fopen(path.c_str(), "ab");
+			if (!file_)
+				throw std::runtime_error("log_config: cannot open " + path + " for appending");
+		}
+		callback_ = std::move(callback);
+		if (!flusher_.joinable())
+		{
+			running_.store(true);
+			flusher_ = std::thread([this] { runFlusher(); });
+		}
+	}
+
+	// Called with the GIL released (see log_flush)
+	void flush()
+	{
+		std::lock_guard<std::mutex> lock(drainMutex_);
+		drain();
+	}
+
+	// Called with the GIL held, from the module teardown capsule
+	void shutdown()
+	{
+		running_.store(false);
+		{
+			py::gil_scoped_release release;
+			if (flusher_.joinable())
+				flusher_.join();
+			drainMutex_.lock();
+		}
+		std::lock_guard<std::mutex> lock(drainMutex_, std::adopt_lock);
+		drain();
+		if (file_)
+		{
+			std::fclose(file_);
+			file_ = nullptr;
+		}
+		callback_ = py::object();
+	}
+
+	uint64_t droppedCount() const { return dropped_.load(); }
+
+private:
+	void runFlusher()
+	{
+		const WorkerScope worker("log");
+		while (running_.load(std::memory_order_relaxed))
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			std::lock_guard<std::mutex> lock(drainMutex_);
+			drain();
+		}
+	}
+
+	// Consumes all published records; single consumer by construction (drainMutex_)
+	void drain()
+	{
+		for (;;)
+		{
+			const uint64_t ticket = tail_.load(std::memory_order_relaxed);
+			if (ticket >= head_.load(std::memory_order_acquire))
+				return;
+			LogRecord& rec = ring_[ticket % logRingSize];
+			const uint32_t want = static_cast<uint32_t>(ticket / logRingSize) * 2 + 1;
+			if (rec.seq.load(std::memory_order_acquire) != want)
+				return; // producer claimed but has not published yet
+			emit(rec);
+			tail_.store(ticket + 1, std::memory_order_release);
+		}
+	}
+
+	void emit(const LogRecord& rec)
+	{
+		static const char* const levelNames[] = {"DEBUG", "WARNING", "ERROR"};
+		const char* const levelName = rec.level < 3 ? levelNames[rec.level] : "?";
+		if (file_)
+		{
+			std::fprintf(file_, "[%llu.%06llu] [%s] %s\n",
+						 static_cast<unsigned long long>(rec.timestampUs / 1000000),
+						 static_cast<unsigned long long>(rec.timestampUs % 1000000),
+						 levelName, rec.text);
+			std::fflush(file_);
+		}
+		if (callback_ && !callback_.is_none() && Py_IsInitialized())
+		{
+			py::gil_scoped_acquire gil;
+			try
+			{
+				callback_(static_cast<Fove_LogLevel>(rec.level), std::string(rec.text));
+			}
+			catch (const py::error_already_set&)
+			{
+				// A throwing drain callback must not kill the flusher thread
+			}
+		}
+	}
+
+	LogRecord ring_[logRingSize];
+	std::atomic<uint64_t> head_{0};
+	std::atomic<uint64_t> tail_{0};
+	std::atomic<int> threshold_{static_cast<int>(Fove_LogLevel::Error) + 1}; // off by default
+	std::atomic<uint64_t> dropped_{0};
+	std::atomic<bool> running_{false};
+	std::thread flusher_;
+	std::mutex configMutex_;
+	std::mutex drainMutex_; // serializes drain() with reconfiguration
+	std::FILE* file_ = nullptr;
+	py::object callback_;
+};
+
+LogSink& logSink()
+{
+	static LogSink* const sink = new LogSink; // leaked deliberately; threads stop via the module teardown capsule
+	return *sink;
+}
+
+} // namespace
+
+void bind_ErrorPolicy(py::module& m)
+{
+	// The exception raised for codes in the raise_on set; its single argument is
+	// the offending ErrorCode value
+	if (errorPolicyExceptionType == nullptr)
+	{
+		errorPolicyExceptionType = PyErr_NewExceptionWithDoc(
+			"fove.capi.ErrorCodeError",
+			"Raised when a binding returns an ErrorCode in the configured raise_on set; args[0] is the code",
+			PyExc_RuntimeError, nullptr);
+		py::register_exception_translator([](std::exception_ptr p) {
+			try
+			{
+				if (p)
+					std::rethrow_exception(p);
+			}
+			catch (const ErrorPolicyViolation& e)
+			{
+				PyErr_SetObject(errorPolicyExceptionType, py::cast(e.code).ptr());
+			}
+		});
+	}
+	m.attr("ErrorCodeError") = py::reinterpret_borrow<py::object>(errorPolicyExceptionType);
+
+	m.def(
+		"set_error_policy", [](const py::object& acceptable, const py::object& raiseOn) {
+			std::vector<Fove_ErrorCode> acceptableCodes, raiseCodes;
+			if (!acceptable.is_none())
+				for (const py::handle code : py::iterable(acceptable))
+					acceptableCodes.push_back(code.cast<Fove_ErrorCode>());
+			if (!raiseOn.is_none())
+				for (const py::handle code : py::iterable(raiseOn))
+					raiseCodes.push_back(code.cast<Fove_ErrorCode>());
+
+			ErrorPolicy& policy = errorPolicy();
+			std::lock_guard<std::mutex> lock(policy.mutex);
+			if (!acceptable.is_none())
+				policy.acceptable = std::move(acceptableCodes);
+			if (!raiseOn.is_none())
+			{
+				policy.raiseOn = std::move(raiseCodes);
+				policy.raiseActive.store(!policy.raiseOn.empty(), std::memory_order_relaxed);
+			}
+		},
+		py::arg("acceptable") = py::none(), py::arg("raise_on") = py::none(),
+		R"(Configures the process-wide error policy applied natively to every binding's ErrorCode
+
+Codes in `raise_on` no longer reach Python as return values: the binding raises
+`ErrorCodeError` (with the code as `args[0]`) from the call site, so only
+genuinely exceptional codes construct exceptions and the per-call status
+branching disappears from the hot loop. Codes in `acceptable` define what the
+native `error_is_acceptable` query (and through it `Result.isAcceptable` in the
+high-level wrapper) treats as usable data.
+
+Passing None for either set leaves it unchanged. The defaults are
+`acceptable={None_, Data_LowAccuracy, Data_Unreliable}` and `raise_on={}`,
+which matches the historical behavior exactly.
+
+\param acceptable An iterable of ErrorCode values to treat as usable, or None
+\param raise_on An iterable of ErrorCode values to turn into ErrorCodeError, or None
+\see get_error_policy
+\see error_is_acceptable
+)");
+
+	m.def(
+		"get_error_policy", []() {
+			ErrorPolicy& policy = errorPolicy();
+			std::lock_guard<std::mutex> lock(policy.mutex);
+			return py::make_tuple(py::cast(policy.acceptable), py::cast(policy.raiseOn));
+		},
+		R"(Returns the current error policy as the tuple `(acceptable, raise_on)`
+
+\return Two lists of ErrorCode values
+\see set_error_policy
+)");
+
+	m.def(
+		"error_is_acceptable", [](const Fove_ErrorCode err) {
+			ErrorPolicy& policy = errorPolicy();
+			if (err == Fove_ErrorCode::None)
+				return true; // success needs no policy lookup
+			std::lock_guard<std::mutex> lock(policy.mutex);
+			for (const Fove_ErrorCode code : policy.acceptable)
+				if (code == err)
+					return true;
+			return false;
+		},
+		py::arg("error"),
+		R"(Returns whether the given ErrorCode is in the policy's acceptable set
+
+One native call, replacing the chained enum comparisons Result.isAcceptable
+used to do per API call.
+
+\param error The ErrorCode to test
+\see set_error_policy
+)");
+}
+
+
+void bind_Log(py::module& m)
+{
+	m.def(
+		"log_config", [](const Fove_LogLevel level, const std::string& path, py::object callback) {
+			logSink().configure(level, path, std::move(callback));
+		},
+		py::arg_v("level", Fove_LogLevel::Warning, "LogLevel.Warning"),
+		py::arg("path") = std::string(),
+		py::arg("callback") = py::none(),
+		R"(Configures the asynchronous diagnostic log sink
+
+Binding-layer log records are written into a bounded lock-free ring and drained
+by a background thread, so producers never block on I/O: below-threshold records
+cost one atomic load, above-threshold ones a bounded copy into the ring. When
+the ring is full, records are dropped (see `log_dropped`) rather than blocking.
+
+\param level    The minimum level to record; records below it are filtered before any formatting
+\param path     A file to append drained records to, or the empty string for none
+\param callback An optional `f(level, text)` drain callback, called from the flusher thread with the GIL held
+\see log_write
+\see log_flush
+)");
+
+	m.def(
+		"log_write", [](const Fove_LogLevel level, const std::string& text) { logSink().write(level, text.c_str()); },
+		py::arg("level"), py::arg("text"),
+		R"(Writes a record to the asynchronous log sink
+
+\param level The severity of the record
+\param text  The record text; truncated to the fixed record size
+\see log_config
+)");
+
+	m.def(
+		"log_flush", [] { logSink().flush(); },
+		py::call_guard<py::gil_scoped_release>(),
+		"Synchronously drains all published records to the configured file/callback");
+
+	m.def(
+		"log_dropped", [] { return logSink().droppedCount(); },
+		"Number of records dropped because the ring was full");
+
+	// Stops the flusher thread when the module is torn down, so a drain callback
+	// is never invoked into a dying interpreter
+	m.add_object("_log_teardown", py::capsule(&logSink(), [](void* sink) {
+					 static_cast<LogSink*>(sink)->shutdown();
+				 }));
+}
+
+void logDiagnostic(const Fove_LogLevel level, const char* const text)
+{
+	logSink().write(level, text);
+}
+
+} // namespace FovePython
@@ -0,0 +1,684 @@
+// Batch math and BMP decoding: the multi-versioned compute kernels and their
+// module-level bindings, in their own TU so the per-ISA clone builds do not
+// lengthen rebuilds of bindings.cpp.
+#include "bindings_common.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include <pybind11/numpy.h>
+
+#include "bindings.h"
+
+using namespace std;
+
+namespace FovePython
+{
+
+////////////////////////////////////////////////////////////////
+// Batch math
+
+// Runtime ISA dispatch for the vectorizable kernels below (batch math and the
+// BMP row swizzle): each annotated function is compiled once per listed
+// target and resolved through a glibc ifunc on first call, so one build runs
+// the best auto-vectorized code the machine supports, from SSE4-only
+// industrial PCs up to AVX-512 workstations. The sources stay intrinsics-free.
+// Elsewhere (Windows, macOS, AArch64 — where NEON is the baseline anyway) the
+// attribute collapses to the single default clone. The kernels need external
+// linkage: GCC's LTO localizes anonymous-namespace functions and silently
+// drops the non-default clones in the process.
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__ELF__)
+#define FOVE_MULTIARCH __attribute__((target_clones("default", "sse4.2", "avx2", "avx512f")))
+#else
+#define FOVE_MULTIARCH
+#endif
+
+FOVE_MULTIARCH void quatRotateVec3Kernel(const float* const q, const py::ssize_t nq,
+										 const float* const v, const py::ssize_t nv, float* const r)
+{
+	for (py::ssize_t i = 0; i < nv; ++i)
+	{
+		const float* const qi = q + (nq == 1 ? 0 : i * 4);
+		const float* const vi = v + i * 3;
+		// v' = v + w*t + q.xyz x t, with t = 2 * (q.xyz x v)
+		const float tx = 2 * (qi[1] * vi[2] - qi[2] * vi[1]);
+		const float ty = 2 * (qi[2] * vi[0] - qi[0] * vi[2]);
+		const float tz = 2 * (qi[0] * vi[1] - qi[1] * vi[0]);
+		r[i * 3 + 0] = vi[0] + qi[3] * tx + qi[1] * tz - qi[2] * ty;
+		r[i * 3 + 1] = vi[1] + qi[3] * ty + qi[2] * tx - qi[0] * tz;
+		r[i * 3 + 2] = vi[2] + qi[3] * tz + qi[0] * ty - qi[1] * tx;
+	}
+}
+
+FOVE_MULTIARCH void quatNormalizeKernel(const float* const q, const py::ssize_t n, float* const r)
+{
+	for (py::ssize_t i = 0; i < n; ++i)
+	{
+		const float* const qi = q + i * 4;
+		const float norm2 = qi[0] * qi[0] + qi[1] * qi[1] + qi[2] * qi[2] + qi[3] * qi[3];
+		const float a = 1.0f / std::sqrt(norm2);
+		r[i * 4 + 0] = a * qi[0];
+		r[i * 4 + 1] = a * qi[1];
+		r[i * 4 + 2] = a * qi[2];
+		r[i * 4 + 3] = a * qi[3];
+	}
+}
+
+FOVE_MULTIARCH void vec3NormalizeKernel(const float* const v, const py::ssize_t n, float* const r)
+{
+	for (py::ssize_t i = 0; i < n; ++i)
+	{
+		const float* const vi = v + i * 3;
+		const float norm2 = vi[0] * vi[0] + vi[1] * vi[1] + vi[2] * vi[2];
+		const float a = norm2 > 0 ? 1.0f / std::sqrt(norm2) : 0.0f;
+		r[i * 3 + 0] = a * vi[0];
+		r[i * 3 + 1] = a * vi[1];
+		r[i * 3 + 2] = a * vi[2];
+	}
+}
+
+FOVE_MULTIARCH void quatSlerpKernel(const float* const pa, const float* const pb, const float t,
+									const py::ssize_t n, float* const r)
+{
+	for (py::ssize_t i = 0; i < n; ++i)
+	{
+		const float* const qa = pa + i * 4;
+		const float* const qb = pb + i * 4;
+		float dot = qa[0] * qb[0] + qa[1] * qb[1] + qa[2] * qb[2] + qa[3] * qb[3];
+		// take the shorter arc
+		const float sign = dot < 0 ? -1.0f : 1.0f;
+		dot = std::fabs(dot) < 1.0f ? std::fabs(dot) : 1.0f;
+		float wa, wb;
+		if (dot > 0.9995f)
+		{
+			// nearly parallel: fall back to a lerp (renormalized below)
+			wa = 1.0f - t;
+			wb = t;
+		}
+		else
+		{
+			const float theta = std::acos(dot);
+			const float s = std::sin(theta);
+			wa = std::sin((1.0f - t) * theta) / s;
+			wb = std::sin(t * theta) / s;
+		}
+		wb *= sign;
+		float q[4];
+		float norm2 = 0;
+		for (int c = 0; c < 4; ++c)
+		{
+			q[c] = wa * qa[c] + wb * qb[c];
+			norm2 += q[c] * q[c];
+		}
+		const float inv = 1.0f / std::sqrt(norm2);
+		for (int c = 0; c < 4; ++c)
+			r[i * 4 + c] = inv * q[c];
+	}
+}
+
+FOVE_MULTIARCH void transformPointsKernel(const float* const m16, const float* const p,
+										  const py::ssize_t n, float* const r)
+{
+	for (py::ssize_t i = 0; i < n; ++i)
+	{
+		const float* const pi = p + i * 3;
+		const float x = m16[0] * pi[0] + m16[1] * pi[1] + m16[2] * pi[2] + m16[3];
+		const float y = m16[4] * pi[0] + m16[5] * pi[1] + m16[6] * pi[2] + m16[7];
+		const float z = m16[8] * pi[0] + m16[9] * pi[1] + m16[10] * pi[2] + m16[11];
+		const float w = m16[12] * pi[0] + m16[13] * pi[1] + m16[14] * pi[2] + m16[15];
+		// Affine matrices produce w = 1 and the divide is a no-op; projective
+		// ones get the homogeneous divide (w = 0 passes through undivided)
+		const float inv = w != 0.0f ? 1.0f / w : 1.0f;
+		r[i * 3 + 0] = inv * x;
+		r[i * 3 + 1] = inv * y;
+		r[i * 3 + 2] = inv * z;
+	}
+}
+
+FOVE_MULTIARCH void transformRaysKernel(const float* const m16, const float* const rays,
+										const py::ssize_t n, float* const r)
+{
+	for (py::ssize_t i = 0; i < n; ++i)
+	{
+		const float* const o = rays + i * 6;
+		const float* const d = o + 3;
+		// origin with w = 1, direction with w = 0 (rotation/scale only)
+		r[i * 6 + 0] = m16[0] * o[0] + m16[1] * o[1] + m16[2] * o[2] + m16[3];
+		r[i * 6 + 1] = m16[4] * o[0] + m16[5] * o[1] + m16[6] * o[2] + m16[7];
+		r[i * 6 + 2] = m16[8] * o[0] + m16[9] * o[1] + m16[10] * o[2] + m16[11];
+		r[i * 6 + 3] = m16[0] * d[0] + m16[1] * d[1] + m16[2] * d[2];
+		r[i * 6 + 4] = m16[4] * d[0] + m16[5] * d[1] + m16[6] * d[2];
+		r[i * 6 + 5] = m16[8] * d[0] + m16[9] * d[1] + m16[10] * d[2];
+	}
+}
+
+FOVE_MULTIARCH void vergenceKernel(const float* const l, const float* const r, const float iod,
+								   const py::ssize_t n, float* const angles, float* const distances)
+{
+	for (py::ssize_t i = 0; i < n; ++i)
+	{
+		const float* const li = l + i * 3;
+		const float* const ri = r + i * 3;
+		const float ln2 = li[0] * li[0] + li[1] * li[1] + li[2] * li[2];
+		const float rn2 = ri[0] * ri[0] + ri[1] * ri[1] + ri[2] * ri[2];
+		if (ln2 <= 0 || rn2 <= 0)
+		{
+			// Degenerate sample (e.g. a blink frame with a zeroed vector)
+			angles[i] = std::numeric_limits<float>::quiet_NaN();
+			distances[i] = std::numeric_limits<float>::quiet_NaN();
+			continue;
+		}
+		float dot = (li[0] * ri[0] + li[1] * ri[1] + li[2] * ri[2]) / std::sqrt(ln2 * rn2);
+		dot = dot > 1.0f ? 1.0f : (dot < -1.0f ? -1.0f : dot);
+		const float angle = std::acos(dot);
+		angles[i] = angle;
+		// Symmetric-convergence model: the gaze rays cross at (iod / 2) / tan(angle / 2);
+		// parallel or diverging gaze converges at infinity
+		const float t = std::tan(angle * 0.5f);
+		distances[i] = t > 0 ? (iod * 0.5f) / t : std::numeric_limits<float>::infinity();
+	}
+}
+
+namespace
+{
+
+// Extracts the 16 row-major floats of a `Matrix44` or any [4, 4] array-like
+void readMatrix44(const py::object& mat, float* const m16)
+{
+	if (py::isinstance<Fove_Matrix44>(mat))
+	{
+		memcpy(m16, &mat.cast<const Fove_Matrix44&>().mat[0][0], 16 * sizeof(float));
+		return;
+	}
+	const FloatBatch arr = mat.cast<FloatBatch>();
+	if (arr.ndim() != 2 || arr.shape(0) != 4 || arr.shape(1) != 4)
+		throw std::runtime_error("mat must be a Matrix44 or an array of shape [4, 4]");
+	memcpy(m16, arr.data(), 16 * sizeof(float));
+}
+
+// Returns `out` validated against [n, width], or a fresh array when it is None
+py::array_t<float> batchOutput(py::object out, const py::ssize_t n, const py::ssize_t width, const char* const name)
+{
+	if (out.is_none())
+		return py::array_t<float>{{n, width}};
+	py::array_t<float, py::array::c_style> result = out.cast<py::array_t<float, py::array::c_style>>();
+	if (result.ndim() != 2 || result.shape(0) != n || result.shape(1) != width)
+		throw std::runtime_error(std::string(name) + " must be a float32 array of shape [N, " + std::to_string(width) + "] matching the input length");
+	if (!result.writeable())
+		throw std::runtime_error(std::string(name) + " must be writeable");
+	return result;
+}
+
+} // namespace
+
+void bind_BatchMath(py::module& m)
+{
+	// Batch counterparts of the scalar Quaternion/Vec3 operations above, looping
+	// over contiguous float32 arrays in C++ so that session-sized data does not
+	// have to go through one Python object per sample. The layouts match the
+	// buffer protocol exports already asserted by assert_layout().
+	m.def(
+		"quat_rotate_vec3", [](const FloatBatch& quats, const FloatBatch& vecs) {
+			const py::ssize_t nq = batchLength(quats, 4, "quats");
+			const py::ssize_t nv = batchLength(vecs, 3, "vecs");
+			if (nq != nv && nq != 1)
+				throw std::runtime_error("quats must have the same length as vecs, or length 1 to broadcast");
+			py::array_t<float> out{{nv, static_cast<py::ssize_t>(3)}};
+			const float* const q = quats.data();
+			const float* const v = vecs.data();
+			float* const r = static_cast<float*>(out.request().ptr);
+			{
+				py::gil_scoped_release release;
+				quatRotateVec3Kernel(q, nq, v, nv, r);
+			}
+			return out;
+		},
+		py::arg("quats"), py::arg("vecs"),
+		R"(Rotates a batch of vectors by a batch of quaternions
+
+\param quats An array of shape [N, 4] of (x, y, z, w) quaternions, or [1, 4] to rotate all vectors by the same quaternion
+\param vecs An array of shape [N, 3] of vectors
+\return An array of shape [N, 3] with the rotated vectors
+)");
+
+	m.def(
+		"quat_normalize", [](const FloatBatch& quats) {
+			const py::ssize_t n = batchLength(quats, 4, "quats");
+			py::array_t<float> out{{n, static_cast<py::ssize_t>(4)}};
+			const float* const q = quats.data();
+			float* const r = static_cast<float*>(out.request().ptr);
+			{
+				py::gil_scoped_release release;
+				quatNormalizeKernel(q, n, r);
+			}
+			return out;
+		},
+		py::arg("quats"),
+		R"(Normalizes a batch of quaternions to unit norm
+
+\param quats An array of shape [N, 4] of (x, y, z, w) quaternions
+\return An array of shape [N, 4] with the normalized quaternions
+)");
+
+	m.def(
+		"vec3_normalize", [](const FloatBatch& vecs) {
+			const py::ssize_t n = batchLength(vecs, 3, "vecs");
+			py::array_t<float> out{{n, static_cast<py::ssize_t>(3)}};
+			const float* const v = vecs.data();
+			float* const r = static_cast<float*>(out.request().ptr);
+			{
+				py::gil_scoped_release release;
+				vec3NormalizeKernel(v, n, r);
+			}
+			return out;
+		},
+		py::arg("vecs"),
+		R"(Normalizes a batch of vectors to unit norm
+
+Zero vectors are left as zero instead of producing NaNs.
+
+\param vecs An array of shape [N, 3] of vectors
+\return An array of shape [N, 3] with the normalized vectors
+)");
+
+	m.def(
+		"quat_slerp", [](const FloatBatch& a, const FloatBatch& b, const float t) {
+			const py::ssize_t n = batchLength(a, 4, "a");
+			if (batchLength(b, 4, "b") != n)
+				throw std::runtime_error("a and b must have the same length");
+			py::array_t<float> out{{n, static_cast<py::ssize_t>(4)}};
+			const float* const pa = a.data();
+			const float* const pb = b.data();
+			float* const r = static_cast<float*>(out.request().ptr);
+			{
+				py::gil_scoped_release release;
+				quatSlerpKernel(pa, pb, t, n, r);
+			}
+			return out;
+		},
+		py::arg("a"), py::arg("b"), py::arg("t"),
+		R"(Spherically interpolates between two batches of quaternions
+
+Interpolation always takes the shorter arc, and the result is normalized.
+
+\param a An array of shape [N, 4] of (x, y, z, w) quaternions at t = 0
+\param b An array of shape [N, 4] of (x, y, z, w) quaternions at t = 1
+\param t The interpolation parameter, in [0, 1]
+\return An array of shape [N, 4] with the interpolated quaternions
+)");
+
+	m.def(
+		"transform_points", [](const py::object& mat, const FloatBatch& points, py::object out) {
+			float m16[16];
+			readMatrix44(mat, m16);
+			const py::ssize_t n = batchLength(points, 3, "points");
+			py::array_t<float> result = batchOutput(std::move(out), n, 3, "out");
+			const float* const p = points.data();
+			float* const r = static_cast<float*>(result.request().ptr);
+			{
+				py::gil_scoped_release release;
+				transformPointsKernel(m16, p, n, r);
+			}
+			return result;
+		},
+		py::arg("mat"), py::arg("points"), py::arg("out") = py::none(),
+		R"(Transforms a batch of points by a 4x4 matrix
+
+Each point is multiplied with an implicit w of 1; projective matrices get the
+homogeneous divide, so affine world transforms and projection matrices both
+work. Composes with the recorder's structured arrays, e.g.
+`transform_points(mat, np.stack([rec["position"]["x"], ...], axis=1))`.
+
+\param mat A `Matrix44` (row-major, as returned by `Headset_getProjectionMatricesLH`) or any [4, 4] array
+\param points An array of shape [N, 3] of points
+\param out An optional writeable float32 array of shape [N, 3] to receive the result, avoiding the allocation
+\return An array of shape [N, 3] with the transformed points (the same object as `out` when one was given)
+\see transform_rays
+)");
+
+	m.def(
+		"transform_rays", [](const py::object& mat, const FloatBatch& rays, py::object out) {
+			float m16[16];
+			readMatrix44(mat, m16);
+			const py::ssize_t n = batchLength(rays, 6, "rays");
+			py::array_t<float> result = batchOutput(std::move(out), n, 6, "out");
+			const float* const p = rays.data();
+			float* const r = static_cast<float*>(result.request().ptr);
+			{
+				py::gil_scoped_release release;
+				transformRaysKernel(m16, p, n, r);
+			}
+			return result;
+		},
+		py::arg("mat"), py::arg("rays"), py::arg("out") = py::none(),
+		R"(Transforms a batch of rays by a 4x4 matrix
+
+Origins transform as points (w = 1), directions as vectors (w = 0, so they
+rotate and scale but never translate). Directions are not renormalized; the
+[N, 6] layout matches `GazeCastScene.cast`.
+
+\param mat A `Matrix44` or any [4, 4] array, row-major
+\param rays An array of shape [N, 6]: origin xyz followed by direction xyz per row
+\param out An optional writeable float32 array of shape [N, 6] to receive the result, avoiding the allocation
+\return An array of shape [N, 6] with the transformed rays (the same object as `out` when one was given)
+\see transform_points
+)");
+
+	m.def(
+		"compute_vergence", [](const FloatBatch& gazeL, const FloatBatch& gazeR, const float iod) {
+			const py::ssize_t n = batchLength(gazeL, 3, "gaze_l");
+			if (batchLength(gazeR, 3, "gaze_r") != n)
+				throw std::runtime_error("gaze_l and gaze_r must have the same length");
+			if (iod <= 0)
+				throw std::runtime_error("iod must be positive");
+			py::array_t<float> angles{n};
+			py::array_t<float> distances{n};
+			const float* const l = gazeL.data();
+			const float* const r = gazeR.data();
+			float* const a = static_cast<float*>(angles.request().ptr);
+			float* const d = static_cast<float*>(distances.request().ptr);
+			{
+				py::gil_scoped_release release;
+				vergenceKernel(l, r, iod, n, a, d);
+			}
+			return py::make_tuple(std::move(angles), std::move(distances));
+		},
+		py::arg("gaze_l"), py::arg("gaze_r"), py::arg("iod"),
+		R"(Computes vergence angle and convergence distance for a batch of gaze pairs
+
+The vergence angle is the angle between the two gaze vectors (radians); the
+convergence distance assumes symmetric convergence of eyes `iod` apart, so it
+comes out in the same units as `iod` and matches the single-sample semantics
+of `Headset_getCombinedGazeDepth`. Parallel or diverging gaze yields an
+infinite distance; samples with a zeroed vector (e.g. blink frames) yield NaN
+for both outputs.
+
+\param gaze_l An array of shape [N, 3] of left-eye gaze vectors (need not be normalized)
+\param gaze_r An array of shape [N, 3] of right-eye gaze vectors
+\param iod The interocular distance, as from `Headset_getUserIOD`
+\return A tuple `(angles, distances)` of float32 arrays of length N
+\see Headset_getCombinedGazeDepth
+)");
+}
+
+////////////////////////////////////////////////////////////////
+// BMP decoding
+
+namespace
+{
+
+// Reads a little-endian integer from unaligned BMP header bytes
+template <typename T>
+T readLE(const unsigned char* const p)
+{
+	T value;
+	memcpy(&value, p, sizeof(T));
+	return value;
+}
+
+} // namespace
+
+// Row flip + channel swizzle, multi-versioned like the batch math kernels
+// (external linkage for the same LTO reason; see FOVE_MULTIARCH)
+FOVE_MULTIARCH void bmpSwizzleKernel(const unsigned char* const pixels, unsigned char* const dst,
+									 const py::ssize_t width, const py::ssize_t height, const py::ssize_t channels,
+									 const size_t rowStride, const size_t dstStride, const bool bottomUp)
+{
+	for (py::ssize_t row = 0; row < height; ++row)
+	{
+		const unsigned char* const src = pixels + (bottomUp ? height - 1 - row : row) * rowStride;
+		unsigned char* const d = dst + row * dstStride;
+		switch (channels)
+		{
+		case 1:
+			memcpy(d, src, dstStride);
+			break;
+		case 3:
+			for (py::ssize_t x = 0; x < width; ++x)
+			{ // BGR -> RGB
+				d[3 * x + 0] = src[3 * x + 2];
+				d[3 * x + 1] = src[3 * x + 1];
+				d[3 * x + 2] = src[3 * x + 0];
+			}
+			break;
+		case 4:
+			for (py::ssize_t x = 0; x < width; ++x)
+			{ // BGRA -> RGBA
+				d[4 * x + 0] = src[4 * x + 2];
+				d[4 * x + 1] = src[4 * x + 1];
+				d[4 * x + 2] = src[4 * x + 0];
+				d[4 * x + 3] = src[4 * x + 3];
+			}
+			break;
+		}
+	}
+}
+
+// ROI crop + integer downsample fused into the same flip/swizzle pass, for
+// consumers (e.g. pupil-crop inference models) that need a small window of
+// the camera frame: only the sampled pixels are ever touched. Downsampling
+// is point sampling (every step-th pixel), keeping the pass single-read
+// single-write. Coordinates are in decoded (top-down) image space.
+FOVE_MULTIARCH void bmpSwizzleRoiKernel(const unsigned char* const pixels, unsigned char* const dst,
+										const py::ssize_t channels, const size_t rowStride, const size_t dstStride,
+										const bool bottomUp, const py::ssize_t srcHeight,
+										const py::ssize_t roiX, const py::ssize_t roiY,
+										const py::ssize_t outWidth, const py::ssize_t outHeight, const py::ssize_t step)
+{
+	for (py::ssize_t row = 0; row < outHeight; ++row)
+	{
+		const py::ssize_t srcRow = roiY + row * step;
+		const unsigned char* const src = pixels + (bottomUp ? srcHeight - 1 - srcRow : srcRow) * rowStride + roiX * channels;
+		unsigned char* const d = dst + row * dstStride;
+		switch (channels)
+		{
+		case 1:
+			if (step == 1)
+				memcpy(d, src, static_cast<size_t>(outWidth));
+			else
+				for (py::ssize_t x = 0; x < outWidth; ++x)
+					d[x] = src[x * step];
+			break;
+		case 3:
+			for (py::ssize_t x = 0; x < outWidth; ++x)
+			{ // BGR -> RGB
+				d[3 * x + 0] = src[3 * x * step + 2];
+				d[3 * x + 1] = src[3 * x * step + 1];
+				d[3 * x + 2] = src[3 * x * step + 0];
+			}
+			break;
+		case 4:
+			for (py::ssize_t x = 0; x < outWidth; ++x)
+			{ // BGRA -> RGBA
+				d[4 * x + 0] = src[4 * x * step + 2];
+				d[4 * x + 1] = src[4 * x * step + 1];
+				d[4 * x + 2] = src[4 * x * step + 0];
+				d[4 * x + 3] = src[4 * x * step + 3];
+			}
+			break;
+		}
+	}
+}
+
+void bind_BitmapDecode(py::module& m)
+{
+	// Decodes the raw BMP blob of a BitmapImage straight into a numpy array,
+	// replacing the per-frame PIL round-trip. The row flip (BMPs are bottom-up
+	// unless the height is negative) and BGR(A)->RGB(A) swizzle are fused into
+	// one pass of simple per-row loops that the compiler auto-vectorizes per
+	// target ISA (see FOVE_MULTIARCH above); the bindings use no explicit SIMD
+	// intrinsics, in keeping with the batch math helpers.
+	m.def(
+		"decode_bitmap", [](const Fove_BitmapImage& image, py::object out, py::object roi, const int downsample) -> py::array {
+			const unsigned char* const data = static_cast<const unsigned char*>(image.image.data);
+			const size_t length = image.image.length;
+			if (!data || length < 54) // BITMAPFILEHEADER (14) + BITMAPINFOHEADER (40)
+				throw std::runtime_error("Image does not contain a complete BMP header");
+			if (data[0] != 'B' || data[1] != 'M')
+				throw std::runtime_error("Image is not a BMP (missing 'BM' signature)");
+
+			const uint32_t pixelOffset = readLE<uint32_t>(data + 10);
+			const uint32_t infoSize = readLE<uint32_t>(data + 14);
+			const int32_t width = readLE<int32_t>(data + 18);
+			const int32_t rawHeight = readLE<int32_t>(data + 22);
+			const uint16_t bitCount = readLE<uint16_t>(data + 28);
+			const uint32_t compression = readLE<uint32_t>(data + 30);
+
+			if (infoSize < 40)
+				throw std::runtime_error("Unsupported BMP header version");
+			if (compression != 0 && compression != 3) // BI_RGB / BI_BITFIELDS
+				throw std::runtime_error("Compressed BMPs are not supported");
+			if (width <= 0 || rawHeight == 0)
+				throw std::runtime_error("BMP has invalid dimensions");
+			if (bitCount != 8 && bitCount != 24 && bitCount != 32)
+				throw std::runtime_error("Only 8, 24 and 32 bits per pixel BMPs are supported");
+
+			const bool bottomUp = rawHeight > 0; // negative height means top-down rows
+			const py::ssize_t height = bottomUp ? rawHeight : -rawHeight;
+			const py::ssize_t channels = bitCount / 8;
+			const size_t rowStride = (static_cast<size_t>(width) * channels + 3) / 4 * 4; // rows are padded to 4 bytes
+			if (pixelOffset + rowStride * height > length)
+				throw std::runtime_error("BMP pixel data is truncated");
+
+			// ROI crop and integer downsample, applied during the decode pass so
+			// only the requested pixels are ever read. The ROI is given in the
+			// decoded (top-down) image: x, y is the top-left corner.
+			if (downsample < 1)
+				throw std::runtime_error("downsample must be a positive integer");
+			py::ssize_t roiX = 0, roiY = 0, roiW = width, roiH = height;
+			if (!roi.is_none())
+			{
+				const py::tuple rect = roi.cast<py::tuple>();
+				if (rect.size() != 4)
+					throw std::runtime_error("roi must be a tuple of (x, y, width, height)");
+				roiX = rect[0].cast<py::ssize_t>();
+				roiY = rect[1].cast<py::ssize_t>();
+				roiW = rect[2].cast<py::ssize_t>();
+				roiH = rect[3].cast<py::ssize_t>();
+				if (roiX < 0 || roiY < 0 || roiW <= 0 || roiH <= 0 || roiX + roiW > width || roiY + roiH > height)
+					throw std::runtime_error("roi lies outside the image");
+			}
+			const py::ssize_t outWidth = (roiW + downsample - 1) / downsample;
+			const py::ssize_t outHeight = (roiH + downsample - 1) / downsample;
+
+			// Reuse the caller's output array when one is provided; otherwise
+			// draw from the recycled buffer pool, falling back to a fresh
+			// allocation when the pool is unconfigured or exhausted
+			py::array_t<uint8_t, py::array::c_style> result;
+			if (out.is_none())
+			{
+				const std::vector<py::ssize_t> shape = channels == 1
+					? std::vector<py::ssize_t>{outHeight, outWidth}
+					: std::vector<py::ssize_t>{outHeight, outWidth, channels};
+				if (unsigned char* const pooled = imagePoolAcquire(static_cast<size_t>(outHeight) * outWidth * channels))
+					result = imagePoolArray(pooled, shape);
+				else
+					result = py::array_t<uint8_t, py::array::c_style>(shape);
+			}
+			else
+			{
+				result = out.cast<py::array_t<uint8_t, py::array::c_style>>();
+				const py::ssize_t expectedDims = channels == 1 ? 2 : 3;
+				if (result.ndim() != expectedDims || result.shape(0) != outHeight || result.shape(1) != outWidth
+					|| (channels != 1 && result.shape(2) != channels))
+					throw std::runtime_error("Output array has the wrong shape for this image");
+			}
+
+			const unsigned char* const pixels = data + pixelOffset;
+			unsigned char* const dst = static_cast<unsigned char*>(result.request().ptr);
+			const size_t dstStride = static_cast<size_t>(outWidth) * channels;
+			{
+				py::gil_scoped_release release;
+				if (roi.is_none() && downsample == 1)
+					bmpSwizzleKernel(pixels, dst, width, height, channels, rowStride, dstStride, bottomUp);
+				else
+					bmpSwizzleRoiKernel(pixels, dst, channels, rowStride, dstStride, bottomUp, height,
+										roiX, roiY, outWidth, outHeight, downsample);
+			}
+			return result;
+		},
+		py::arg("image"), py::arg("out") = py::none(), py::arg("roi") = py::none(), py::arg("downsample") = 1,
+		R"(Decodes the BMP data of a `BitmapImage` into a numpy array
+
+Handles the images returned by `Headset_getEyesImage` and
+`Headset_getPositionImage`: 8-bit grayscale decodes to an array of shape
+`[H, W]`, 24/32-bit to `[H, W, 3]` / `[H, W, 4]` with the channels swizzled
+from BMP BGR(A) order to RGB(A). Bottom-up bitmaps are flipped to row-major
+top-down order.
+
+A crop rectangle and an integer downsample factor can be applied during the
+decode itself, e.g. `decode_bitmap(img, roi=(x, y, w, h), downsample=2)`:
+only the sampled pixels are read and written, so extracting a small pupil
+window costs a fraction of a full-frame decode. The ROI is given in decoded
+(top-down) coordinates; downsampling keeps every `downsample`-th pixel
+(point sampling, no filtering) and the result shape is the ROI size divided
+by the factor, rounded up.
+
+\param image The `BitmapImage` whose BMP blob to decode
+\param out An optional preallocated uint8 output array of the exact result shape, to avoid the per-frame allocation
+\param roi An optional `(x, y, width, height)` crop rectangle in decoded image coordinates
+\param downsample Keep every n-th pixel in both directions (default 1, no downsampling)
+\return The decoded uint8 array (the same object as `out` when one was given)
+)");
+
+	m.def(
+		"configure_image_pool", [](const size_t count, const py::tuple shape) {
+			size_t bytes = 1;
+			for (const py::handle dim : shape)
+			{
+				const py::ssize_t n = dim.cast<py::ssize_t>();
+				if (n <= 0)
+					throw std::runtime_error("Pool buffer dimensions must be positive");
+				bytes *= static_cast<size_t>(n);
+			}
+			if (shape.size() == 0)
+				throw std::runtime_error("Pool buffer shape must have at least one dimension");
+
+			ImagePool& pool = imagePool();
+			std::lock_guard<std::mutex> lock(pool.mutex);
+			for (unsigned char* const base : pool.freeBuffers)
+				delete[] base;
+			pool.freeBuffers.clear();
+			pool.count = count;
+			pool.capacity = count == 0 ? 0 : bytes;
+			for (size_t i = 0; i < count; ++i)
+			{
+				unsigned char* const base = new unsigned char[imagePoolHeaderSize + bytes];
+				std::memcpy(base, &bytes, sizeof bytes);
+				pool.freeBuffers.push_back(base);
+			}
+		},
+		py::arg("count"), py::arg("shape"),
+		R"(Preallocates a fixed pool of recycled image output buffers
+
+Once configured, `decode_bitmap` (without an explicit `out`) and
+`ImageStreamReader.latest(copy=True)` draw their output arrays from this pool
+instead of allocating per frame; each buffer returns to the pool when Python
+drops its last reference to the array, so the steady-state image pipeline
+performs zero allocations. Requests larger than the configured shape, or made
+while all buffers are handed out, silently fall back to normal allocation.
+
+Reconfiguring frees the pooled buffers and builds a new pool; arrays still
+alive in Python keep their old buffers, which are freed when released.
+`configure_image_pool(0, shape)` disables pooling.
+
+\param count The number of buffers to preallocate
+\param shape The shape (e.g. `(height, width, channels)`) sizing each buffer; any decode result with at most that many bytes fits
+)");
+
+	m.def(
+		"image_pool_stats", []() {
+			ImagePool& pool = imagePool();
+			std::lock_guard<std::mutex> lock(pool.mutex);
+			return py::make_tuple(pool.freeBuffers.size(), pool.count, pool.capacity);
+		},
+		R"(Returns `(free, count, capacity_bytes)` of the image buffer pool
+
+`count - free` buffers are currently held by live Python arrays. Useful for
+verifying that a pipeline really is recycling rather than leaking references.
+)");
+}
+
+} // namespace FovePython
@@ -0,0 +1,1986 @@
+// Registration of the plain FoveAPI.h structs and enums: pure type bindings
+// with no state and no fove_* calls, split out of bindings.cpp so that a
+// docstring edit here does not recompile the headset machinery and vice versa.
+#include "bindings_common.h"
+
+#include <cstring>
+#include <sstream>
+
+#include <pybind11/stl.h>
+
+#include "bindings.h"
+
+using namespace std;
+
+namespace FovePython
+{
+
+////////////////////////////////////////////////////////////////
+// structures
+
+namespace
+{
+
+std::ostream& operator<<(std::ostream& out, const Fove_Versions& v)
+{
+	out << "<Versions:"
+		<< " client: " << v.clientMajor << '.' << v.clientMinor << '.' << v.clientBuild
+		<< ", runtime: " << v.runtimeMajor << '.' << v.runtimeMinor << '.' << v.runtimeBuild
+		<< ", protocol: " << v.clientProtocol
+		<< ", min_firmware: " << v.minFirmware
+		<< ", max_firmware: " << v.maxFirmware
+		<< ", too_old_headset: " << v.tooOldHeadsetConnected
+		<< ">";
+	return out;
+};
+std::ostream& operator<<(std::ostream& out, const Fove_Quaternion& self)
+{
+	out << "<Quaternion: " << self.x << ", " << self.y << ", " << self.z << ", " << self.w << ">";
+	return out;
+}
+std::ostream& operator<<(std::ostream& out, const Fove_Vec3& self)
+{
+	out << "<Vec3: " << self.x << ", " << self.y << ", " << self.z << ">";
+	return out;
+}
+std::ostream& operator<<(std::ostream& out, const Fove_Vec2& self)
+{
+	out << "<Vec2: " << self.x << ", " << self.y << ">";
+	return out;
+}
+std::ostream& operator<<(std::ostream& out, const Fove_Vec2i& self)
+{
+	out << "<Vec2i: " << self.x << ", " << self.y << ">";
+	return out;
+}
+std::ostream& operator<<(std::ostream& out, const Fove_Ray& self)
+{
+	out << "<Ray: " << self.origin << ", " << self.direction << ">";
+	return out;
+}
+std::ostream& operator<<(std::ostream& out, const Fove_FrameTimestamp& self)
+{
+	out << "<FrameTimestamp: "
+		<< "id: " << self.id
+		<< ", timestamp: " << self.timestamp
+		<< ">";
+	return out;
+}
+std::ostream& operator<<(std::ostream& out, const Fove_Pose& self)
+{
+	out << "<Pose: "
+		<< "id: " << self.id
+		<< ", timestamp: " << self.timestamp
+		<< ", orientation: " << self.orientation
+		<< ", angularVelocity: " << self.angularVelocity
+		<< ", angularAcceleration: " << self.angularAcceleration
+		<< ", position: " << self.position
+		<< ", standingPosition: " << self.standingPosition
+		<< ", velocity: " << self.velocity
+		<< ", acceleration: " << self.acceleration
+		<< ">";
+	return out;
+}
+std::ostream& operator<<(std::ostream& out, const Fove_ProjectionParams& self)
+{
+	out << "<ProjectionParams: "
+		<< "left: " << self.left
+		<< ", right: " << self.right
+		<< ", top: " << self.top
+		<< ", bottom: " << self.bottom
+		<< ">";
+	return out;
+}
+std::ostream& operator<<(std::ostream& out, const Fove_BoundingBox& self)
+{
+	out << "<BoundingBox: "
+		<< "center: " << self.center
+		<< ", extend: " << self.extend
+		<< ">";
+	return out;
+}
+std::ostream& operator<<(std::ostream& out, const Fove_ObjectPose& self)
+{
+	out << "<ObjectPose: "
+		<< "scale: " << self.scale
+		<< ", rotation: " << self.rotation
+		<< ", position: " << self.position
+		<< ", velocity: " << self.velocity
+		<< ">";
+	return out;
+}
+std::ostream& operator<<(std::ostream& out, const Fove_ColliderCube& self)
+{
+	out << "<ColliderCube: " << self.size << ">";
+	return out;
+}
+std::ostream& operator<<(std::ostream& out, const Fove_ColliderSphere& self)
+{
+	out << "<ColliderSphere: " << self.radius << ">";
+	return out;
+}
+std::ostream& operator<<(std::ostream& out, const Fove_ColliderMesh& self)
+{
+	out << "<ColliderMesh: "
+		<< "VextexCount: " << self.vertexCount
+		<< ", TriangleCount: " << self.triangleCount
+		<< ", BoundingBox: " << self.boundingBox
+		<< ">";
+	return out;
+}
+std::ostream& operator<<(std::ostream& out, const Fove_GazableObject& self)
+{
+	out << "<GazableObject: "
+		<< "Id: " << self.id
+		<< ", Pose: " << self.pose
+		<< ", Group: " << std::hex << static_cast<unsigned>(self.group)
+		<< ", ColliderCount: " << self.colliderCount
+		<< ">";
+	return out;
+}
+std::ostream& operator<<(std::ostream& out, const Fove_CameraObject& self)
+{
+	out << "<GazableObject: "
+		<< "Id: " << self.id
+		<< ", Pose: " << self.pose
+		<< ", GroupMask: " << std::hex << static_cast<unsigned>(self.groupMask)
+		<< ">";
+	return out;
+}
+std::ostream& operator<<(std::ostream& out, const Fove_ObjectCollider& self)
+{
+	out << "<ObjectCollider: "
+		<< "Center: " << self.center;
+		// << ", ShapeType: " << Fove::stringForEnum(self.shapeType);
+	switch (self.shapeType)
+	{
+		case Fove_ColliderType::Cube:
+			out << ", size: " << self.shapeDefinition.cube.size;
+			break;
+		case Fove_ColliderType::Sphere:
+			out << ", radius: " << self.shapeDefinition.sphere.radius;
+			break;
+		case Fove_ColliderType::Mesh:
+			out << ", VertexCount: " << self.shapeDefinition.mesh.vertexCount;
+			out << ", TriangleCount: " << self.shapeDefinition.mesh.triangleCount;
+			out << ", BoundingBox: " << self.shapeDefinition.mesh.boundingBox;
+			break;
+	}
+	out << ">";
+
+	return out;
+}
+
+template <typename T>
+std::string repr(const T& self)
+{
+	std::ostringstream ss;
+	ss << self;
+	return ss.str();
+}
+
+// pybind11 uses __repr__ for generating type signature, and this is done at the declaration time.
+// So to make things work, one has to forward declare classes as in
+// ```
+// auto pyFoo = py::class_<Foo>(m, "Foo");
+// auto pyBar = py::class_<Bar>(m, "Bar");
+//
+// pyFoo.def(py::init<const Bar&>());
+// pyBar.def(py::init<const Foo&>());
+//
+// ```
+// and define __repr__ to generate a string that python understands.
+// Alternatively, we could use `py::arg_v(..)` construct (for now we go this route).
+// refs:
+// - https://pybind11.readthedocs.io/en/latest/advanced/misc.html#avoiding-cpp-types-in-docstrings
+// - https://pybind11.readthedocs.io/en/latest/advanced/functions.html#default-arguments-revisited
+//
+// template <>
+// std::string repr<Fove_Vec3>(const Fove_Vec3& self)
+// {
+// 	std::ostringstream ss;
+// 	ss << "fove.capi.Vec3(0,0,0)";
+// 	return ss.str();
+// }
+
+} // namespace
+
+// XXX docstring annotation on `py::enum_` `.values` will be supported by pybind11 v2.3.0 on,
+// (which is not released as of now).
+void defenum_ClientCapabilities(py::module& m)
+{
+	py::enum_<Fove_ClientCapabilities>(m, "ClientCapabilities",
+									   R"(List of capabilities usable by clients
+
+Most features require registering for the relevant capability.
+If a client queries data related to a capability it has not registered API_NotRegistered will be returned.
+After a new capability registration the Data_NoUpdate error may be returned for a few frames while
+the service is bootstrapping the new capability.
+
+This enum is designed to be used as a flag set, so items may be binary logic operators like |.
+
+The FOVE runtime will keep any given set of hardware/software running so long as one client is registering a capability.
+
+The registration of a capability does not necessarily mean that the capability is running.
+For example, if no position tracking camera is attached, no position tracking will occur regardless of how many clients registered for it.
+
+- `None_`:  No capabilities requested
+- `OrientationTracking`:  Enables headset orientation tracking
+- `PositionTracking`:  Enables headset position tracking
+- `PositionImage`:  Enables Position camera image transfer from the runtime service to the client
+- `EyeTracking`:  Enables headset eye tracking
+- `GazeDepth`:  Enables gaze depth computation
+- `UserPresence`:  Enables user presence detection
+- `UserAttentionShift`:  Enables user attention shift computation
+- `UserIOD`:  Enables the calculation of the user IOD
+- `UserIPD`:  Enables the calculation of the user IPD
+- `EyeTorsion`:  Enables the calculation of the user eye torsion
+- `EyeShape`:  Enables the detection of the eyes shape
+- `EyesImage`:  Enables Eye camera image transfer from the runtime service to the client
+- `EyeballRadius`:  Enables the calculation of the user eyeball radius
+- `IrisRadius`:  Enables the calculation of the user iris radius
+- `PupilRadius`:  Enables the calculation of the user pupil radius
+- `GazedObjectDetection`:  Enables gazed object detection based on registered gazable objects
+- `DirectScreenAccess`:  Give you direct access to the HMD screen and disable the Fove compositor
+- `PupilShape`:  Enables the detection of the pupil shape
+- `EyeBlink`:  Enables eye blink detection and counting
+)")
+		// XXX symbol None is reserved in python
+		.value("None_", Fove_ClientCapabilities::None)
+		.value("OrientationTracking", Fove_ClientCapabilities::OrientationTracking)
+		.value("PositionTracking", Fove_ClientCapabilities::PositionTracking)
+		.value("PositionImage", Fove_ClientCapabilities::PositionImage)
+		.value("EyeTracking", Fove_ClientCapabilities::EyeTracking)
+		.value("GazeDepth", Fove_ClientCapabilities::GazeDepth)
+		.value("UserPresence", Fove_ClientCapabilities::UserPresence)
+		.value("UserAttentionShift", Fove_ClientCapabilities::UserAttentionShift)
+		.value("UserIOD", Fove_ClientCapabilities::UserIOD)
+		.value("UserIPD", Fove_ClientCapabilities::UserIPD)
+		.value("EyeTorsion", Fove_ClientCapabilities::EyeTorsion)
+		.value("EyeShape", Fove_ClientCapabilities::EyeShape)
+		.value("EyesImage", Fove_ClientCapabilities::EyesImage)
+		.value("EyeballRadius", Fove_ClientCapabilities::EyeballRadius)
+		.value("IrisRadius", Fove_ClientCapabilities::IrisRadius)
+		.value("PupilRadius", Fove_ClientCapabilities::PupilRadius)
+		.value("GazedObjectDetection", Fove_ClientCapabilities::GazedObjectDetection)
+		.value("DirectScreenAccess", Fove_ClientCapabilities::DirectScreenAccess)
+		.value("PupilShape", Fove_ClientCapabilities::PupilShape)
+		.value("EyeBlink", Fove_ClientCapabilities::EyeBlink)
+		.def("__eq__", [](const Fove_ClientCapabilities cap1, const Fove_ClientCapabilities cap2) -> bool {
+			return cap1 == cap2;
+		},
+			 py::is_operator(), "Returns True if two capabilities `cap1` and `cap2` are the same.")
+		.def("__bool__", [](const Fove_ClientCapabilities cap) -> bool {
+			return cap != Fove_ClientCapabilities::None;
+		},
+			 py::is_operator(), "Returns True if a capability `cap`is not Empty")
+		.def("__and__", [](const Fove_ClientCapabilities cap1, const Fove_ClientCapabilities cap2) {
+			return cap1 & cap2;
+		},
+			 py::is_operator(), "Returns the intersection of two capabilities `cap1` and `cap2`.")
+		.def("__or__", [](const Fove_ClientCapabilities cap1, const Fove_ClientCapabilities cap2) {
+			return cap1 | cap2;
+		},
+			 py::is_operator(), "Returns the union of two capabilities `cap1` and `cap2`.")
+		.def("__add__", [](const Fove_ClientCapabilities cap1, const Fove_ClientCapabilities cap2) {
+			return cap1 | cap2;
+		},
+			 py::is_operator(), "Returns the union of two capabilities `cap1` and `cap2`.")
+		.def("__sub__", [](const Fove_ClientCapabilities cap1, const Fove_ClientCapabilities cap2) {
+			return cap1 & ~cap2;
+		},
+			 py::is_operator(), "Returns the capability `cap2` but with `cap1` removed.")
+		.def("__contains__", [](const Fove_ClientCapabilities cap1, const Fove_ClientCapabilities cap2) -> bool {
+			return (cap1 & cap2) == cap2; // cap1 contains cap2, note the order
+		},
+			 py::is_operator(), "Returns `True` if `cap2 in cap1`.");
+}
+
+IntEnumRegistry& intEnumRegistry(const IntEnumId id)
+{
+	// Leaked deliberately: cached members must stay valid for casters that can
+	// still run during interpreter shutdown, after static destructors
+	static IntEnumRegistry* const registries = new IntEnumRegistry[size_t(IntEnumId::Count_)];
+	return registries[size_t(id)];
+}
+
+namespace
+{
+
+// Creates a Python IntEnum subclass named `name` in module `m` (via the enum
+// module's functional API) and fills the member cache the type casters in
+// bindings_common.h read from. Member order follows the initializer list.
+void makeIntEnum(py::module& m, const IntEnumId id, const char* const name, const char* const doc,
+				 const std::initializer_list<std::pair<const char*, long long>> values)
+{
+	py::dict members;
+	for (const std::pair<const char*, long long>& entry : values)
+		members[py::str(entry.first)] = py::int_(entry.second);
+	py::object type = py::module_::import("enum").attr("IntEnum")(name, members);
+	type.attr("__doc__") = doc;
+	type.attr("__module__") = m.attr("__name__");
+	m.attr(name) = type;
+
+	IntEnumRegistry& registry = intEnumRegistry(id);
+	registry.type = type;
+	for (const std::pair<const char*, long long>& entry : values)
+		registry.members.emplace(entry.second, type(py::int_(entry.second)));
+}
+
+} // namespace
+
+void defenum_ErrorCode(py::module& m)
+{
+	// Bound as IntEnum, not py::enum_: error codes are compared on every call
+	// in headset.py, and IntEnum members compare as native ints (see the
+	// casters in bindings_common.h)
+	makeIntEnum(m, IntEnumId::ErrorCode, "ErrorCode", R"(The error codes that the Fove system may return
+- `None`:  Indicates that no error occurred
+
+// Connection Errors
+- `Connect_NotConnected`:  The client lost the connection with the Fove service
+- `Connect_RuntimeVersionTooOld`:  The FOVE runtime version is too old for this client
+- `Connect_ClientVersionTooOld`:  The client version is too old for the installed runtime
+
+// API usage errors
+- `API_InvalidArgument`:  An argument passed to an API function was invalid for a reason other than one of the below reasons
+- `API_NotRegistered`:  Data was queried without first registering for that data
+- `API_NullInPointer`:  An input argument passed to an API function was invalid for a reason other than the below reasons
+- `API_InvalidEnumValue`:  An enum argument passed to an API function was invalid
+- `API_NullOutPointersOnly`:  All output arguments were null on a function that requires at least one output (all getters that have no side effects)
+- `API_OverlappingOutPointers`:  Two (or more) output parameters passed to an API function overlap in memory. Each output parameter should be a unique, separate object
+- `API_MissingArgument`:  The service was expecting extra arguments that the client didn't provide
+- `API_Timeout`:  A call to an API could not be completed within a timeout
+
+// Data Errors
+- `Data_Unreadable`:  The data couldn't be read properly from the shared memory and may be corrupted
+- `Data_NoUpdate`:  The data has not been updated by the system yet and is invalid
+- `Data_Uncalibrated`:  The data is invalid because the feature in question is not calibrated
+- `Data_Unreliable`:  The data is unreliable because the eye tracking has been lost
+- `Data_LowAccuracy`:  The accuracy of the data is low
+
+// Hardware Errors
+- `Hardware_Disconnected`:  The hardware has been physically disconnected
+- `Hardware_WrongFirmwareVersion`:  A wrong version of hardware firmware has been detected
+
+// Code and placeholders
+- `Code_NotImplementedYet`:  The function hasn't been implemented yet
+- `Code_FunctionDeprecated`:  The function has been deprecated
+
+// Position Tracking
+- `Position_ObjectNotTracked`:  The object is inactive or currently not tracked
+
+// Compositor
+- `Compositor_NotSwapped`:  This comes from submitting without calling WaitForRenderPose after a complete submit
+- `Compositor_UnableToCreateDeviceAndContext`:  Compositor was unable to initialize its backend component
+- `Compositor_UnableToUseTexture`:  Compositor was unable to use the given texture (likely due to mismatched client and data types or an incompatible format)
+- `Compositor_DeviceMismatch`:  Compositor was unable to match its device to the texture's, either because of multiple GPUs or a failure to get the device from the texture
+- `Compositor_DisconnectedFromRuntime`:  Compositor was running and is no longer responding
+- `Compositor_ErrorCreatingTexturesOnDevice`:  Failed to create shared textures for compositor
+- `Compositor_NoEyeSpecifiedForSubmit`:  The supplied Fove_Eye for submit is invalid (i.e. is Both or Neither)
+
+// Generic
+- `UnknownError`:  Errors that are unknown or couldn't be classified. If possible, info will be logged about the nature of the issue
+
+// Objects
+- `Object_AlreadyRegistered`:  The scene object that you attempted to register was already present in the object registry
+
+// Render
+- `Render_OtherRendererPrioritized`:  Another renderer registered to render the process have a higher priority than current client
+
+// License
+- `License_FeatureAccessDenied`:  You don't have the license rights to use the corresponding feature
+
+// Profiles
+- `Profile_DoesntExist`:  The profile doesn't exist
+- `Profile_NotAvailable`:  The profile already exists when it shouldn't, or is otherwise taken or not available
+- `Profile_InvalidName`:  The profile name is not a valid name
+
+// Config
+- `Config_DoesntExist`:  The provided key doesn't exist in the config
+- `Config_TypeMismatch`:  The value type of the key doesn't match
+
+// System Errors, errors that originate from the OS level API (files, sockets, etc)
+- `System_UnknownError`: Any system error not otherwise specified
+- `System_PathNotFound`: Unix: ENOENT, Windows: ERROR_PATH_NOT_FOUND or ERROR_FILE_NOT_FOUND
+- `System_AccessDenied`: Unix: EACCES, Windows: ERROR_ACCESS_DENIED
+)",
+				{
+										{"None_", static_cast<long long>(Fove_ErrorCode::None)}, // = 0
+					// Connection errors
+					{"Connect_NotConnected", static_cast<long long>(Fove_ErrorCode::Connect_NotConnected)},
+					{"Connect_RuntimeVersionTooOld", static_cast<long long>(Fove_ErrorCode::Connect_RuntimeVersionTooOld)},
+					{"Connect_ClientVersionTooOld", static_cast<long long>(Fove_ErrorCode::Connect_ClientVersionTooOld)},
+
+					// API usage errors
+					{"API_InvalidArgument", static_cast<long long>(Fove_ErrorCode::API_InvalidArgument)},
+					{"API_NotRegistered", static_cast<long long>(Fove_ErrorCode::API_NotRegistered)},
+					{"API_NullInPointer", static_cast<long long>(Fove_ErrorCode::API_NullInPointer)},
+					{"API_InvalidEnumValue", static_cast<long long>(Fove_ErrorCode::API_InvalidEnumValue)},
+					{"API_NullOutPointersOnly", static_cast<long long>(Fove_ErrorCode::API_NullOutPointersOnly)},
+					{"API_OverlappingOutPointers", static_cast<long long>(Fove_ErrorCode::API_OverlappingOutPointers)},
+					{"API_MissingArgument", static_cast<long long>(Fove_ErrorCode::API_MissingArgument)},
+					{"API_Timeout", static_cast<long long>(Fove_ErrorCode::API_Timeout)},
+					{"API_AlreadyInTheDesiredState", static_cast<long long>(Fove_ErrorCode::API_AlreadyInTheDesiredState)},
+
+					// Data errors
+					{"Data_Unreadable", static_cast<long long>(Fove_ErrorCode::Data_Unreadable)},
+					{"Data_NoUpdate", static_cast<long long>(Fove_ErrorCode::Data_NoUpdate)},
+					{"Data_Uncalibrated", static_cast<long long>(Fove_ErrorCode::Data_Uncalibrated)},
+					{"Data_Unreliable", static_cast<long long>(Fove_ErrorCode::Data_Unreliable)},
+					{"Data_LowAccuracy", static_cast<long long>(Fove_ErrorCode::Data_LowAccuracy)},
+
+					// Hardware Errors
+					{"Hardware_Disconnected", static_cast<long long>(Fove_ErrorCode::Hardware_Disconnected)},
+					{"Hardware_WrongFirmwareVersion", static_cast<long long>(Fove_ErrorCode::Hardware_WrongFirmwareVersion)},
+
+					// Code and placeholders
+					{"Code_NotImplementedYet", static_cast<long long>(Fove_ErrorCode::Code_NotImplementedYet)},
+					{"Code_FunctionDeprecated", static_cast<long long>(Fove_ErrorCode::Code_FunctionDeprecated)},
+
+					// Position Tracking
+					{"Position_ObjectNotTracked", static_cast<long long>(Fove_ErrorCode::Position_ObjectNotTracked)},
+
+					// Compositor
+					{"Compositor_NotSwapped", static_cast<long long>(Fove_ErrorCode::Compositor_NotSwapped)},
+					{"Compositor_UnableToCreateDeviceAndContext", static_cast<long long>(Fove_ErrorCode::Compositor_UnableToCreateDeviceAndContext)},
+					{"Compositor_UnableToUseTexture", static_cast<long long>(Fove_ErrorCode::Compositor_UnableToUseTexture)},
+					{"Compositor_DeviceMismatch", static_cast<long long>(Fove_ErrorCode::Compositor_DeviceMismatch)},
+					{"Compositor_DisconnectedFromRuntime", static_cast<long long>(Fove_ErrorCode::Compositor_DisconnectedFromRuntime)},
+					{"Compositor_ErrorCreatingTexturesOnDevice", static_cast<long long>(Fove_ErrorCode::Compositor_ErrorCreatingTexturesOnDevice)},
+					{"Compositor_NoEyeSpecifiedForSubmit", static_cast<long long>(Fove_ErrorCode::Compositor_NoEyeSpecifiedForSubmit)},
+
+					// Generic
+					{"UnknownError", static_cast<long long>(Fove_ErrorCode::UnknownError)}, // = 9000
+
+					// Objects
+					{"Object_AlreadyRegistered", static_cast<long long>(Fove_ErrorCode::Object_AlreadyRegistered)},
+
+					// Render
+					{"Render_OtherRendererPrioritized", static_cast<long long>(Fove_ErrorCode::Render_OtherRendererPrioritized)},
+
+					// License
+					{"License_FeatureAccessDenied", static_cast<long long>(Fove_ErrorCode::License_FeatureAccessDenied)},
+
+					// Profiles
+					{"Profile_DoesntExist", static_cast<long long>(Fove_ErrorCode::Profile_DoesntExist)},
+					{"Profile_NotAvailable", static_cast<long long>(Fove_ErrorCode::Profile_NotAvailable)},
+					{"Profile_InvalidName", static_cast<long long>(Fove_ErrorCode::Profile_InvalidName)},
+
+					// Config
+					{"Config_DoesntExist", static_cast<long long>(Fove_ErrorCode::Config_DoesntExist)},
+					{"Config_TypeMismatch", static_cast<long long>(Fove_ErrorCode::Config_TypeMismatch)},
+
+					// System Errors, errors that originate from the OS level API (files, sockets, etc)
+					{"System_UnknownError", static_cast<long long>(Fove_ErrorCode::System_UnknownError)},
+					{"System_PathNotFound", static_cast<long long>(Fove_ErrorCode::System_PathNotFound)},
+					{"System_AccessDenied", static_cast<long long>(Fove_ErrorCode::System_AccessDenied)},
+				});
+}
+
+void defenum_CompositorLayerType(py::module& m)
+{
+	py::enum_<Fove_CompositorLayerType>(m, "CompositorLayerType", R"(Compositor layer type, which defines the order that clients are composited
+
+- Base: The first and main application layer
+- Overlay: Layer over the base
+- Diagnostic: Layer over Overlay)")
+		.value("Base", Fove_CompositorLayerType::Base)
+		.value("Overlay", Fove_CompositorLayerType::Overlay)
+		.value("Diagnostic", Fove_CompositorLayerType::Diagnostic);
+}
+
+void defenum_ObjectGroup(py::module& m)
+{
+	py::enum_<Fove_ObjectGroup>(m, "ObjectGroup", R"(The groups of objects of the scene)")
+		.value("Group0", Fove_ObjectGroup::Group0)
+		.value("Group1", Fove_ObjectGroup::Group1)
+		.value("Group2", Fove_ObjectGroup::Group2)
+		.value("Group3", Fove_ObjectGroup::Group3)
+		.value("Group4", Fove_ObjectGroup::Group4)
+		.value("Group5", Fove_ObjectGroup::Group5)
+		.value("Group6", Fove_ObjectGroup::Group6)
+		.value("Group7", Fove_ObjectGroup::Group7)
+		.value("Group8", Fove_ObjectGroup::Group8)
+		.value("Group9", Fove_ObjectGroup::Group9)
+		.value("Group10", Fove_ObjectGroup::Group10)
+		.value("Group11", Fove_ObjectGroup::Group11)
+		.value("Group12", Fove_ObjectGroup::Group12)
+		.value("Group13", Fove_ObjectGroup::Group13)
+		.value("Group14", Fove_ObjectGroup::Group14)
+		.value("Group15", Fove_ObjectGroup::Group15)
+		.value("Group16", Fove_ObjectGroup::Group16)
+		.value("Group17", Fove_ObjectGroup::Group17)
+		.value("Group18", Fove_ObjectGroup::Group18)
+		.value("Group19", Fove_ObjectGroup::Group19)
+		.value("Group20", Fove_ObjectGroup::Group20)
+		.value("Group21", Fove_ObjectGroup::Group21)
+		.value("Group22", Fove_ObjectGroup::Group22)
+		.value("Group23", Fove_ObjectGroup::Group23)
+		.value("Group24", Fove_ObjectGroup::Group24)
+		.value("Group25", Fove_ObjectGroup::Group25)
+		.value("Group26", Fove_ObjectGroup::Group26)
+		.value("Group27", Fove_ObjectGroup::Group27)
+		.value("Group28", Fove_ObjectGroup::Group28)
+		.value("Group29", Fove_ObjectGroup::Group29)
+		.value("Group30", Fove_ObjectGroup::Group30)
+		.value("Group31", Fove_ObjectGroup::Group31)
+		.def(
+			"__add__", [](const Fove_ObjectGroup grp1, const Fove_ObjectGroup grp2) {
+				return grp1 | grp2;
+			},
+			py::is_operator(), "Returns the union of two groups `grp1` and `grp2`.")
+		.def("__sub__", [](const Fove_ObjectGroup grp1, const Fove_ObjectGroup grp2) {
+			return grp1 & ~grp2;
+		},
+			 py::is_operator(), "Returns the group `grp2` but with `grp1` removed.")
+		.def("__contains__", [](const Fove_ObjectGroup grp1, const Fove_ObjectGroup grp2) -> bool {
+			return (grp1 & grp2) == grp2;
+		},
+			 py::is_operator(), "Returns `True` if `grp2 in grp1`.");
+}
+
+void defstruct_Versions(py::module& m)
+{
+	py::class_<Python_Versions>(m, "Versions",
+								R"(Struct to list various version info about the FOVE software
+
+Contains the version for the software (both runtime and client versions).
+A negative value in any int field represents unknown.)")
+		.def(py::init<int, int, int, int, string, int, int, int, string, int, int, int, bool>(),
+			 py::arg("clientMajor") = -1,
+			 py::arg("clientMinor") = -1,
+			 py::arg("clientBuild") = -1,
+			 py::arg("clientProtocol") = -1,
+			 py::arg("clientHash") = "",
+			 py::arg("runtimeMajor") = -1,
+			 py::arg("runtimeMinor") = -1,
+			 py::arg("runtimeBuild") = -1,
+			 py::arg("runtimeHash") = "",
+			 py::arg("firmware") = -1,
+			 py::arg("maxFirmware") = -1,
+			 py::arg("minFirmware") = -1,
+			 py::arg("tooOldHeadsetConnected") = false)
+		.def_readwrite("clientMajor", &Python_Versions::clientMajor) // initialized to -1 in c++
+		.def_readwrite("clientMinor", &Python_Versions::clientMinor)
+		.def_readwrite("clientBuild", &Python_Versions::clientBuild)
+		.def_readwrite("clientProtocol", &Python_Versions::clientProtocol)
+		.def_readwrite("clientHash", &Python_Versions::clientHash)
+		.def_readwrite("runtimeMajor", &Python_Versions::runtimeMajor)
+		.def_readwrite("runtimeMinor", &Python_Versions::runtimeMinor)
+		.def_readwrite("runtimeBuild", &Python_Versions::runtimeBuild)
+		.def_readwrite("runtimeHash", &Python_Versions::runtimeHash)
+		.def_readwrite("firmware", &Python_Versions::firmware)
+		.def_readwrite("maxFirmware", &Python_Versions::maxFirmware)
+		.def_readwrite("minFirmware", &Python_Versions::minFirmware)
+		.def_readwrite("tooOldHeadsetConnected", &Python_Versions::tooOldHeadsetConnected) // initialized to false in c++
+		.def("__repr__", repr<Fove_Versions>, "Returns a string representation of versions");
+}
+
+void defstruct_LicenseInfo(py::module& m)
+{
+	py::class_<Python_LicenseInfo>(m, "LicenseInfo",
+								   R"(Struct with details about a FOVE license)")
+		.def(py::init<>())
+		.def_readwrite("uuid", &Python_LicenseInfo::uuid, "128-bit uuid of this license, in binary form")
+		.def_readwrite("expirationYear", &Python_LicenseInfo::expirationYear, "Expiration, year (eg. 2028), 0 if there is no expiration")
+		.def_readwrite("expirationMonth", &Python_LicenseInfo::expirationMonth, "Expiration month (1 - 12), 0 if there is no expiration")
+		.def_readwrite("expirationDay", &Python_LicenseInfo::expirationDay, "Expiration day (1 - 31), 0 if there is no expiration")
+		.def_readwrite("licenseType", &Python_LicenseInfo::licenseType, "Null-termianted type of license, such as \"Professional\"")
+		.def_readwrite("licensee", &Python_LicenseInfo::licensee, "Null-terminated name of the person or organization that this license is for, truncated as needed");
+}
+
+void defstruct_HeadsetHardwareInfo(py::module& m)
+{
+	py::class_<Python_HeadsetHardwareInfo>(m, "HeadsetHardwareInfo",
+										   R"(Struct Contains hardware information for the headset
+
+Contains the serial number, manufacturer and model name for the headset.
+Values of the member fields originates from their UTF-8 string representations
+defined by headset manufacturers, and passed to us (FoveClient) by FoveService
+server through an IPC message.
+The server may be sending very long strings, but the FoveClient library will
+be truncating them in an unspecified manner to 0-terminated strings of length
+at most 256.)")
+		.def(py::init<>())
+		.def_readwrite("serialNumber", &Python_HeadsetHardwareInfo::serialNumber, "Serial number, as a null-terminated UTF8 string")
+		.def_readwrite("manufacturer", &Python_HeadsetHardwareInfo::manufacturer, "Manufacturer info, as a null-terminated UTF8 string")
+		.def_readwrite("modelName", &Python_HeadsetHardwareInfo::modelName, "Model name, as a null-terminated UTF8 string");
+}
+
+// XXX maybe move to upstream
+template <typename Struct, typename ElemType, std::size_t Size>
+constexpr void assert_layout()
+{
+	static_assert(std::is_standard_layout<Struct>::value,
+				  "Struct not in a standard layout where one was expected.");
+	static_assert(sizeof(Struct) == Size * sizeof(ElemType),
+				  "Struct not an array of single elem type where one was expected.");
+}
+
+// define buffer_protocol for a C array type with element type Elem
+template <typename Elem, std::size_t Size,
+		  typename = typename std::enable_if<std::is_arithmetic<Elem>::value, Elem>::type>
+auto define_1D_buffer_protocol(Elem (&data)[Size])
+{
+	return py::buffer_info{
+		reinterpret_cast<void*>(&data[0]),
+		sizeof(Elem),
+		py::format_descriptor<Elem>::format(),
+		1,             // ndims
+		{Size},        // dims
+		{sizeof(Elem)} // strides
+	};
+}
+
+namespace
+{
+bool operator==(const Fove_Quaternion& self, const Fove_Quaternion& other)
+{
+	return self.x == other.x && self.y == other.y && self.z == other.z && self.w == other.w;
+}
+bool operator==(const Fove_Vec3& self, const Fove_Vec3& other)
+{
+	return self.x == other.x && self.y == other.y && self.z == other.z;
+}
+bool operator==(const Fove_Vec2& self, const Fove_Vec2& other)
+{
+	return self.x == other.x && self.y == other.y;
+}
+bool operator==(const Fove_Vec2i& self, const Fove_Vec2i& other)
+{
+	return self.x == other.x && self.y == other.y;
+}
+bool operator==(const Fove_Ray& self, const Fove_Ray& other)
+{
+	return self.origin == other.origin && self.direction == other.direction;
+}
+bool operator==(const Fove_FrameTimestamp& self, const Fove_FrameTimestamp& other)
+{
+	return self.id == other.id && self.timestamp == other.timestamp;
+}
+bool operator==(const Fove_TextureBounds& self, const Fove_TextureBounds& other)
+{
+	return self.left == other.left && self.top == other.top && self.right == other.right && self.bottom == other.bottom;
+}
+bool operator==(const Fove_BoundingBox& self, const Fove_BoundingBox& other)
+{
+	return self.center == other.center && self.extend == other.extend;
+}
+bool operator==(const Fove_ObjectPose& self, const Fove_ObjectPose& other)
+{
+	return self.scale == other.scale && self.rotation == other.rotation && self.position == other.position && self.velocity == other.velocity;
+}
+bool operator==(const Fove_CalibrationTarget& self, const Fove_CalibrationTarget& other)
+{
+	return self.position == other.position && self.recommendedSize == other.recommendedSize;
+}
+
+// This is a very annoying consequence of our choice of not initializing things
+// on the C++ level: Chains of initializations of contained structures
+// have to be done manually as containments are on the C++ level than on
+// the python level. To ameliorate clutter to some extent, we provide these
+// helper functions for structs that may be contained in others..
+Fove_Quaternion default_Quaternion()
+{
+	return Fove_Quaternion{0.0f, 0.0f, 0.0f, 1.0f};
+}
+Fove_Vec3 default_Vec3()
+{
+	return Fove_Vec3{0.0f, 0.0f, 0.0f};
+}
+Fove_Vec2 default_Vec2()
+{
+	return Fove_Vec2{0.0f, 0.0f};
+}
+Fove_Vec2i default_Vec2i()
+{
+	return Fove_Vec2i{0, 0};
+}
+Fove_Pose default_Pose()
+{
+	return Fove_Pose{0, 0, default_Quaternion(), default_Vec3(), default_Vec3(), default_Vec3(),
+					 default_Vec3(), default_Vec3(), default_Vec3()};
+}
+Fove_TextureBounds default_TextureBounds()
+{
+	return Fove_TextureBounds{0.0f, 0.0f, 0.0f, 0.0f};
+}
+Fove_CompositorLayerEyeSubmitInfo default_CompositorLayerEyeSubmitInfo()
+{
+	return Fove_CompositorLayerEyeSubmitInfo{nullptr, default_TextureBounds()};
+}
+Fove_Buffer default_Buffer()
+{
+	return Fove_Buffer{nullptr, 0};
+}
+
+Fove_ObjectPose default_ObjectPose()
+{
+	return Fove_ObjectPose{
+		Fove_Vec3{1, 1, 1},
+		default_Quaternion(),
+		default_Vec3(),
+		default_Vec3()};
+}
+
+Fove_CalibrationTarget default_CalibrationTarget()
+{
+	return Fove_CalibrationTarget{{0, 0, 0}, 0};
+}
+
+} // namespace
+
+void defstruct_Quaternion(py::module& m)
+{
+	assert_layout<Fove_Quaternion, float, 4>();
+
+	py::class_<Fove_Quaternion>(m, "Quaternion", py::buffer_protocol(),
+								R"(Struct representation on a quaternion
+
+A quaternion represents an orientation in 3D space)")
+		.def(py::init<float, float, float, float>(),
+			 py::arg("x") = 0.0f,
+			 py::arg("y") = 0.0f,
+			 py::arg("z") = 0.0f,
+			 py::arg("w") = 1.0f)
+		.def_readwrite("x", &Fove_Quaternion::x) // 0.0
+		.def_readwrite("y", &Fove_Quaternion::y) // 0.0
+		.def_readwrite("z", &Fove_Quaternion::z) // 0.0
+		.def_readwrite("w", &Fove_Quaternion::w) // 1.0
+		.def_buffer([](Fove_Quaternion& obj) {
+			using Arr4 = float(&)[4];
+			return define_1D_buffer_protocol(reinterpret_cast<Arr4>(obj));
+		})
+		.def(
+			"__eq__", [](const Fove_Quaternion& self, const Fove_Quaternion& other) {
+				return self == other;
+			},
+			py::is_operator(), "Returns `True` if two quaternions are the same. Quaternions that differ by an overall factor are considered different.")
+		.def("__ne__", [](const Fove_Quaternion& self, const Fove_Quaternion& other) {
+			return !(self == other);
+		},
+			 py::is_operator(), "Returns `True` if two quaternions are not the same. See `__eq__()`.")
+		// XXX these operations are duplicating functionalities in FoveMath.h
+		.def("__mul__", [](const Fove_Quaternion& self, const Fove_Quaternion& other) {
+			const auto& q1 = self;
+			const auto& q2 = other;
+			return Fove_Quaternion{q1.w * q2.x + q1.x * q2.w + q1.y * q2.z - q1.z * q2.y,
+								   q1.w * q2.y + q1.y * q2.w + q1.z * q2.x - q1.x * q2.z,
+								   q1.w * q2.z + q1.z * q2.w + q1.x * q2.y - q1.y * q2.x,
+								   q1.w * q2.w - q1.x * q2.x - q1.y * q2.y - q1.z * q2.z};
+		},
+			 py::is_operator(), "Returns the product of two quaternions.")
+		.def("__mul__", [](const Fove_Quaternion& self, const float other) {
+			const auto& q = self;
+			const auto a = other;
+			return Fove_Quaternion{a * q.x, a * q.y, a * q.z, a * q.w};
+		},
+			 py::is_operator(), "Returns the quaternion rescaled by a scalar.")
+		.def("__rmul__", [](const Fove_Quaternion& self, const float other) {
+			const auto& q = self;
+			const auto a = other;
+			return Fove_Quaternion{a * q.x, a * q.y, a * q.z, a * q.w};
+		},
+			 py::is_operator(), "Returns the quaternion rescaled by a scalar.")
+		// In-place variants: mutate the struct and return the same Python object,
+		// so accumulation loops allocate no temporaries
+		.def("__imul__", [](py::object selfObj, const Fove_Quaternion& other) {
+			auto& q1 = selfObj.cast<Fove_Quaternion&>();
+			const auto& q2 = other;
+			q1 = Fove_Quaternion{q1.w * q2.x + q1.x * q2.w + q1.y * q2.z - q1.z * q2.y,
+								q1.w * q2.y + q1.y * q2.w + q1.z * q2.x - q1.x * q2.z,
+								q1.w * q2.z + q1.z * q2.w + q1.x * q2.y - q1.y * q2.x,
+								q1.w * q2.w - q1.x * q2.x - q1.y * q2.y - q1.z * q2.z};
+			return selfObj;
+		},
+			 py::is_operator(), "Multiplies by another quaternion in place and returns `self`.")
+		.def("__imul__", [](py::object selfObj, const float a) {
+			auto& q = selfObj.cast<Fove_Quaternion&>();
+			q.x *= a;
+			q.y *= a;
+			q.z *= a;
+			q.w *= a;
+			return selfObj;
+		},
+			 py::is_operator(), "Rescales the quaternion by a scalar in place and returns `self`.")
+		.def("__neg__", [](const Fove_Quaternion& self) {
+			const auto& q = self;
+			return Fove_Quaternion{-q.x, -q.y, -q.z, -q.w};
+		},
+			 py::is_operator(), "Returns the quaternion whose components are all negated.")
+		.def("normalise", [](const Fove_Quaternion& self) {
+			const auto& q = self;
+			const auto norm2 = self.x * self.x + self.y * self.y + self.z * self.z + self.w * self.w;
+			const auto a = 1.0f / std::sqrt(norm2);
+			return Fove_Quaternion{a * q.x, a * q.y, a * q.z, a * q.w};
+		},
+			 "Returns the quaternion of a unit norm by appropriately rescaling the given quaternion.")
+		.def("normalise_", [](py::object selfObj) {
+			auto& q = selfObj.cast<Fove_Quaternion&>();
+			const auto norm2 = q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w;
+			const auto a = 1.0f / std::sqrt(norm2);
+			q.x *= a;
+			q.y *= a;
+			q.z *= a;
+			q.w *= a;
+			return selfObj;
+		},
+			 "Rescales the quaternion to unit norm in place and returns `self`; the allocation-free variant of `normalise()`.")
+		.def("conjugate", [](const Fove_Quaternion& self) {
+			const auto& q = self;
+			return Fove_Quaternion{-q.x, -q.y, -q.z, q.w};
+		},
+			 "Returns the conjugated quaternion.")
+		// XXX this diverges from FoveMath.h that we normalize the inverse of original norm; probably we should not support non-normalized quaternions altogether
+		.def("invert", [](const Fove_Quaternion& self) {
+			const auto& q = self;
+			const auto norm2 = self.x * self.x + self.y * self.y + self.z * self.z + self.w * self.w;
+			const auto a = 1.0f / norm2;
+			return Fove_Quaternion{-a * q.x, -a * q.y, -a * q.z, a * q.w};
+		},
+			 "Returns the inverse of the given quaternion.")
+		.def("__repr__", repr<Fove_Quaternion>, "Returns a string representation of the quaternion.");
+}
+
+void defstruct_Vec3(py::module& m)
+{
+	assert_layout<Fove_Vec3, float, 3>();
+
+	py::class_<Fove_Vec3>(m, "Vec3", py::buffer_protocol(),
+						  R"(Struct to represent a 3D-vector
+
+A vector that represents an position in 3D space.)")
+		.def(py::init<float, float, float>(),
+			 py::arg("x") = 0.0f,
+			 py::arg("y") = 0.0f,
+			 py::arg("z") = 0.0f)
+		.def_readwrite("x", &Fove_Vec3::x) // 0.0
+		.def_readwrite("y", &Fove_Vec3::y) // 0.0
+		.def_readwrite("z", &Fove_Vec3::z) // 0.0
+		.def_buffer([](Fove_Vec3& obj) {
+			using Arr3 = float(&)[3];
+			return define_1D_buffer_protocol(reinterpret_cast<Arr3>(obj));
+		})
+		.def(
+			"__eq__", [](const Fove_Vec3& self, const Fove_Vec3& other) {
+				return self == other;
+			},
+			py::is_operator(), "Returns `True` if the two vectors are the same.")
+		.def("__ne__", [](Fove_Vec3& self, Fove_Vec3& other) {
+			return !(self == other);
+		},
+			 py::is_operator(), "Returns `True` if the two vectors are not the same.")
+		.def("__add__", [](Fove_Vec3& self, Fove_Vec3& other) {
+			return Fove_Vec3{self.x + other.x, self.y + other.y, self.z + other.z};
+		},
+			 py::is_operator(), "Returns the sum of two vectors.")
+		.def("__sub__", [](Fove_Vec3& self, Fove_Vec3& other) {
+			return Fove_Vec3{self.x - other.x, self.y - other.y, self.z - other.z};
+		},
+			 py::is_operator(), "Returns the difference of two vectors.")
+		.def("__mul__", [](Fove_Vec3& self, const float a) {
+			return Fove_Vec3{a * self.x, a * self.y, a * self.z};
+		},
+			 py::is_operator(), "Returns the vector rescaled by a scalar factor.")
+		.def("__rmul__", [](const float& a, Fove_Vec3& self) {
+			return Fove_Vec3{a * self.x, a * self.y, a * self.z};
+		},
+			 py::is_operator(), "Returns the vector rescaled by a scalar factor.")
+		// In-place variants: mutate the vector and return the same Python object,
+		// so e.g. a gaze-centroid accumulation loop allocates no temporaries
+		.def("__iadd__", [](py::object selfObj, const Fove_Vec3& other) {
+			auto& self = selfObj.cast<Fove_Vec3&>();
+			self.x += other.x;
+			self.y += other.y;
+			self.z += other.z;
+			return selfObj;
+		},
+			 py::is_operator(), "Adds the other vector in place and returns `self`.")
+		.def("__isub__", [](py::object selfObj, const Fove_Vec3& other) {
+			auto& self = selfObj.cast<Fove_Vec3&>();
+			self.x -= other.x;
+			self.y -= other.y;
+			self.z -= other.z;
+			return selfObj;
+		},
+			 py::is_operator(), "Subtracts the other vector in place and returns `self`.")
+		.def("__imul__", [](py::object selfObj, const float a) {
+			auto& self = selfObj.cast<Fove_Vec3&>();
+			self.x *= a;
+			self.y *= a;
+			self.z *= a;
+			return selfObj;
+		},
+			 py::is_operator(), "Rescales the vector by a scalar factor in place and returns `self`.")
+		.def("normalise_", [](py::object selfObj) {
+			auto& self = selfObj.cast<Fove_Vec3&>();
+			const auto norm2 = self.x * self.x + self.y * self.y + self.z * self.z;
+			if (norm2 > 0) // the zero vector stays zero, matching the batch kernel
+			{
+				const auto a = 1.0f / std::sqrt(norm2);
+				self.x *= a;
+				self.y *= a;
+				self.z *= a;
+			}
+			return selfObj;
+		},
+			 "Rescales the vector to unit length in place and returns `self`; the zero vector is left unchanged.")
+		.def("rotate_by_", [](py::object selfObj, const Fove_Quaternion& q) {
+			auto& self = selfObj.cast<Fove_Vec3&>();
+			// v' = v + 2 * t x (q.w * v + q.xyz x v) with t = q.xyz, for unit q
+			const float tx = q.y * self.z - q.z * self.y;
+			const float ty = q.z * self.x - q.x * self.z;
+			const float tz = q.x * self.y - q.y * self.x;
+			const float cx = q.w * self.x + tx;
+			const float cy = q.w * self.y + ty;
+			const float cz = q.w * self.z + tz;
+			self.x += 2 * (q.y * cz - q.z * cy);
+			self.y += 2 * (q.z * cx - q.x * cz);
+			self.z += 2 * (q.x * cy - q.y * cx);
+			return selfObj;
+		},
+			 py::arg("q"), "Rotates the vector by the given unit quaternion in place and returns `self`.")
+		.def("__repr__", repr<Fove_Vec3>, "Returns a string representation of the vector.");
+}
+
+void defstruct_Vec2(py::module& m)
+{
+	assert_layout<Fove_Vec2, float, 2>();
+
+	py::class_<Fove_Vec2>(m, "Vec2", py::buffer_protocol(),
+						  R"(Struct to represent a 2D-vector
+
+A vector that represents a position or orientation in 2D space, such as screen or image coordinates.)")
+		.def(py::init<float, float>(),
+			 py::arg("x") = 0.0,
+			 py::arg("y") = 0.0)
+		.def_readwrite("x", &Fove_Vec2::x) // 0.0
+		.def_readwrite("y", &Fove_Vec2::y) // 0.0
+		.def_buffer([](Fove_Vec2& obj) {
+			using Arr2 = float(&)[2];
+			return define_1D_buffer_protocol(reinterpret_cast<Arr2>(obj));
+		})
+		.def(
+			"__eq__", [](const Fove_Vec2& self, const Fove_Vec2& other) {
+				return self == other;
+			},
+			py::is_operator(), "Returns `True` if the two vectors are the same.")
+		.def("__ne__", [](Fove_Vec2& self, Fove_Vec2& other) {
+			return !(self == other);
+		},
+			 py::is_operator(), "Returns `True` if the two vectors are not the same.")
+		.def("__add__", [](Fove_Vec2& self, Fove_Vec2& other) {
+			return Fove_Vec2{self.x + other.x, self.y + other.y};
+		},
+			 py::is_operator(), "Returns the sum of two vectors.")
+		.def("__sub__", [](Fove_Vec2& self, Fove_Vec2& other) {
+			return Fove_Vec2{self.x - other.x, self.y - other.y};
+		},
+			 py::is_operator(), "Returns the difference of two vectors.")
+		.def("__mul__", [](Fove_Vec2& self, const float a) {
+			return Fove_Vec2{a * self.x, a * self.y};
+		},
+			 py::is_operator(), "Returns the vector rescaled by a scalar factor.")
+		.def("__rmul__", [](const float& a, Fove_Vec2& self) {
+			return Fove_Vec2{a * self.x, a * self.y};
+		},
+			 py::is_operator(), "Returns the vector rescaled by a scalar factor.")
+		// In-place variants, same contract as on Vec3
+		.def("__iadd__", [](py::object selfObj, const Fove_Vec2& other) {
+			auto& self = selfObj.cast<Fove_Vec2&>();
+			self.x += other.x;
+			self.y += other.y;
+			return selfObj;
+		},
+			 py::is_operator(), "Adds the other vector in place and returns `self`.")
+		.def("__isub__", [](py::object selfObj, const Fove_Vec2& other) {
+			auto& self = selfObj.cast<Fove_Vec2&>();
+			self.x -= other.x;
+			self.y -= other.y;
+			return selfObj;
+		},
+			 py::is_operator(), "Subtracts the other vector in place and returns `self`.")
+		.def("__imul__", [](py::object selfObj, const float a) {
+			auto& self = selfObj.cast<Fove_Vec2&>();
+			self.x *= a;
+			self.y *= a;
+			return selfObj;
+		},
+			 py::is_operator(), "Rescales the vector by a scalar factor in place and returns `self`.")
+		.def("normalise_", [](py::object selfObj) {
+			auto& self = selfObj.cast<Fove_Vec2&>();
+			const auto norm2 = self.x * self.x + self.y * self.y;
+			if (norm2 > 0) // the zero vector stays zero, matching the batch kernel
+			{
+				const auto a = 1.0f / std::sqrt(norm2);
+				self.x *= a;
+				self.y *= a;
+			}
+			return selfObj;
+		},
+			 "Rescales the vector to unit length in place and returns `self`; the zero vector is left unchanged.")
+		.def("__repr__", repr<Fove_Vec2>, "Returns the string representation of the vector");
+}
+
+void defstruct_Vec2i(py::module& m)
+{
+	assert_layout<Fove_Vec2i, int, 2>();
+
+	py::class_<Fove_Vec2i>(m, "Vec2i", py::buffer_protocol(),
+						   R"(Struct to represent a 2D integral vector)")
+		.def(py::init<int, int>(),
+			 py::arg("x") = 0,
+			 py::arg("y") = 0)
+		.def_readwrite("x", &Fove_Vec2i::x)
+		.def_readwrite("y", &Fove_Vec2i::y)
+		.def_buffer([](Fove_Vec2i& obj) {
+			using Arr2i = int(&)[2];
+			return define_1D_buffer_protocol(reinterpret_cast<Arr2i>(obj));
+		})
+		.def(
+			"__eq__", [](const Fove_Vec2i& self, const Fove_Vec2i& other) {
+				return self == other;
+			},
+			py::is_operator(), "Returns `True` if the two vectors are the same.")
+		.def("__ne__", [](Fove_Vec2i& self, Fove_Vec2i& other) {
+			return !(self == other);
+		},
+			 py::is_operator(), "Returns `True` if the two vectors are the same.")
+		.def("__add__", [](Fove_Vec2i& self, Fove_Vec2i& other) {
+			return Fove_Vec2i{self.x + other.x, self.y + other.y};
+		},
+			 py::is_operator(), "Returns the sum of two vectors.")
+		.def("__sub__", [](Fove_Vec2i& self, Fove_Vec2i& other) {
+			return Fove_Vec2i{self.x - other.x, self.y - other.y};
+		},
+			 py::is_operator(), "Returns the difference of two vectors.")
+		// XXX deliberately not supporting rescaling for integral vectors
+		// .def("__mul__", [](Fove_Vec2i& self, const int a) {
+		// 	return Fove_Vec2i{a * self.x, a * self.y};
+		// },
+		// 	 py::is_operator())
+		// .def("__rmul__", [](const int& a, Fove_Vec2i& self) {
+		// 	return Fove_Vec2i{a * self.x, a * self.y};
+		// },
+		// 	 py::is_operator())
+		//
+		// In-place variants, same contract as on Vec3 (no rescaling, as above)
+		.def("__iadd__", [](py::object selfObj, const Fove_Vec2i& other) {
+			auto& self = selfObj.cast<Fove_Vec2i&>();
+			self.x += other.x;
+			self.y += other.y;
+			return selfObj;
+		},
+			 py::is_operator(), "Adds the other vector in place and returns `self`.")
+		.def("__isub__", [](py::object selfObj, const Fove_Vec2i& other) {
+			auto& self = selfObj.cast<Fove_Vec2i&>();
+			self.x -= other.x;
+			self.y -= other.y;
+			return selfObj;
+		},
+			 py::is_operator(), "Subtracts the other vector in place and returns `self`.")
+		.def("__repr__", repr<Fove_Vec2i>, "Returns a string representation of the vector.");
+}
+
+// TODO this should be mapped to a python type whose fields are numpy. how to do that automatically?
+void defstruct_Ray(py::module& m)
+{
+	py::class_<Fove_Ray>(m, "Ray",
+						 R"(Struct to represent a Ray
+
+Stores the start point and direction of a Ray)")
+		.def(py::init<Fove_Vec3, Fove_Vec3>(),
+			 py::arg_v("origin", Fove_Vec3{0, 0, 0}, "Vec3(0, 0, 0)"),
+			 py::arg_v("direction", Fove_Vec3{0, 0, 1}, "Vec3(0, 0, 1)"))
+		.def_readwrite("origin", &Fove_Ray::origin, "The start point of the Ray")     // Fove_Vec3 {0,0,0}
+		.def_readwrite("direction", &Fove_Ray::direction, "The direction of the Ray") // Fove_Vec3 {0,0,1}
+		.def(
+			"__eq__", [](const Fove_Ray& self, const Fove_Ray& other) {
+				return self == other;
+			},
+			py::is_operator(), "Returns `True` if the two rays are the same.")
+		.def("__ne__", [](Fove_Ray& self, Fove_Ray& other) {
+			return !(self == other);
+		},
+			 py::is_operator(), "Returns `True` if the two rays are not the same.")
+		.def("__repr__", repr<Fove_Ray>, "Returns a string representation of the ray.");
+}
+
+void defstruct_FrameTimestamp(py::module& m)
+{
+	py::class_<Fove_FrameTimestamp>(m, "FrameTimestamp",
+									R"(A frame timestamp information.
+
+It is returned by every update function so that you can know which frame the new data correspond to)")
+		.def(py::init<uint64_t, uint64_t>(),
+			 py::arg("id") = 0,
+			 py::arg("timestamp") = 0)
+		.def_readwrite("id", &Fove_FrameTimestamp::id, "Incremental frame counter")
+		.def_readwrite("timestamp", &Fove_FrameTimestamp::timestamp, "The time at which the data was captured, in microseconds since an unspecified epoch")
+		.def(
+			"__eq__", [](const Fove_FrameTimestamp& self, const Fove_FrameTimestamp& other) {
+				return self == other;
+			},
+			py::is_operator(), "Returns `True` if the two frame timestamps are the same.")
+		.def("__ne__", [](Fove_FrameTimestamp& self, Fove_FrameTimestamp& other) {
+			return !(self == other);
+		},
+			 py::is_operator(), "Returns `True` if the two frame timestamps are not the same.")
+		.def("__repr__", repr<Fove_FrameTimestamp>, "Returns a string representation of the frame timestamps.");
+}
+
+// XXX we do not define __eq__ just yet, as the desired semantics is not so clear: should id and timestamp participate in equalities?
+void defstruct_Pose(py::module& m)
+{
+	py::class_<Fove_Pose>(m, "Pose",
+						  R"(Struct to represent a combination of position and orientation of Fove Headset
+
+This structure is a combination of the Fove headset position and orientation in 3D space, collectively known as the "pose".
+In the future this may also contain acceleration information for the headset, and may also be used for controllers.)")
+		.def(py::init<uint64_t, uint64_t, Fove_Quaternion,
+					  Fove_Vec3, Fove_Vec3, Fove_Vec3, Fove_Vec3, Fove_Vec3, Fove_Vec3>(),
+			 py::arg("id") = 0,
+			 py::arg("timestamp") = 0,
+			 py::arg_v("orientation", default_Quaternion(), "Quaternion()"),
+			 py::arg_v("angularVelocity", default_Vec3(), "Vec3()"),
+			 py::arg_v("angularAcceleration", default_Vec3(), "Vec3()"),
+			 py::arg_v("position", default_Vec3(), "Vec3()"),
+			 py::arg_v("standingPosition", default_Vec3(), "Vec3()"),
+			 py::arg_v("velocity", default_Vec3(), "Vec3()"),
+			 py::arg_v("acceleration", default_Vec3(), "Vec3()"))
+		.def_readwrite("id", &Fove_Pose::id,
+					   "Incremental counter which tells if the coord captured is a fresh value at a given frame") // uint64_t 0
+		.def_readwrite("timestamp", &Fove_Pose::timestamp,
+					   "The time at which the pose was captured, in microseconds since an unspecified epoch") // uint64_t 0
+		.def_readwrite("orientation", &Fove_Pose::orientation,
+					   "The Quaternion which represents the orientation of the head") // Fove_Quaternion {}
+		.def_readwrite("angularVelocity", &Fove_Pose::angularVelocity,
+					   "The angular velocity of the head") // Fove_Vec3 {}
+		.def_readwrite("angularAcceleration", &Fove_Pose::angularAcceleration,
+					   "The angular acceleration of the head") // Fove_Vec3 {}
+		.def_readwrite("position", &Fove_Pose::position,
+					   "The position of headset in 3D space. Tares to (0, 0, 0). Use for sitting applications") // Fove_Vec3 {}
+		.def_readwrite("standingPosition", &Fove_Pose::standingPosition,
+					   "The position of headset including offset for camera location. Will not tare to zero. Use for standing applications") // Fove_Vec3 {}
+		.def_readwrite("velocity", &Fove_Pose::velocity,
+					   "The velocity of headset in 3D space") // Fove_Vec3 {}
+		.def_readwrite("acceleration", &Fove_Pose::acceleration,
+					   "The acceleration of headset in 3D space") // Fove_Vec3 {}
+		.def("__repr__", repr<Fove_Pose>, "Returns a string representation of the pose.");
+}
+
+void defenum_LogLevel(py::module& m)
+{
+	py::enum_<Fove_LogLevel>(m, "LogLevel", "Severity level of log messages")
+		.value("Debug", Fove_LogLevel::Debug)     // = 0,
+		.value("Warning", Fove_LogLevel::Warning) // = 1,
+		.value("Error", Fove_LogLevel::Error)     // = 2,
+		;
+}
+
+void defenum_Eye(py::module& m)
+{
+	// IntEnum for the same reason as ErrorCode: passed on every per-eye getter
+	makeIntEnum(m, IntEnumId::Eye, "Eye", R"(Enum specifying the left or right eye
+- Left: Left eye
+- Right: Right eye
+)",
+				{
+					{"Left", static_cast<long long>(Fove_Eye::Left)},
+					{"Right", static_cast<long long>(Fove_Eye::Right)},
+				});
+}
+
+void defenum_EyeState(py::module& m)
+{
+	// IntEnum for the same reason as ErrorCode: returned on the per-frame path
+	makeIntEnum(m, IntEnumId::EyeState, "EyeState", R"(Enum specifying the state of an eye
+
+- `NotDetected`: The eye is missing or the tracking was lost
+- `Opened`: The eye is present and opened
+- `Closed`: The eye is present and closed
+)",
+				{
+					{"NotDetected", static_cast<long long>(Fove_EyeState::NotDetected)},
+					{"Opened", static_cast<long long>(Fove_EyeState::Opened)},
+					{"Closed", static_cast<long long>(Fove_EyeState::Closed)},
+				});
+}
+
+// define buffer_protocol for a C double array type with element type Elem
+template <typename Elem, std::size_t Rows, std::size_t Cols,
+		  typename = typename std::enable_if<std::is_arithmetic<Elem>::value, Elem>::type>
+auto define_2D_buffer_protocol(Elem (&data)[Rows][Cols])
+{
+	return py::buffer_info{
+		reinterpret_cast<void*>(&data[0][0]),
+		sizeof(Elem),
+		py::format_descriptor<Elem>::format(),
+		2,                                  // ndims
+		{Rows, Cols},                       // dims
+		{sizeof(Elem) * Cols, sizeof(Elem)} // strides
+	};
+}
+
+void defstruct_Matrix44(py::module& m)
+{
+	py::class_<Python_Matrix44>(m, "Matrix44", py::buffer_protocol(),
+								R"(Struct to hold a rectangular array
+
+This struct implements buffer_protocol, and thus can be converted
+to a numpy array:
+m = fove.capi.Matrix44()
+a = numpy.array(m, copy=False)
+)")
+		.def(py::init<>())
+		.def_buffer([](Python_Matrix44& obj) {
+			return define_2D_buffer_protocol(obj.val.mat);
+		});
+}
+
+void defstruct_ProjectionParams(py::module& m)
+{
+	py::class_<Fove_ProjectionParams>(m, "ProjectionParams",
+									  R"(Struct holding information about projection frustum planes
+
+Values are given for a depth of 1 so that it's easy to multiply them by your near clipping plan, for example, to get the correct values for your use.)")
+		.def(py::init<float, float, float, float>(),
+			 py::arg("left") = -1.0f,
+			 py::arg("right") = 1.0f,
+			 py::arg("top") = 1.0f,
+			 py::arg("bottom") = -1.0f)
+		.def_readwrite("left", &Fove_ProjectionParams::left, "Left side (low-X)")     // float -1
+		.def_readwrite("right", &Fove_ProjectionParams::right, "Right side (high-X)") // float +1
+		.def_readwrite("top", &Fove_ProjectionParams::top, "Top (high-Y)")            // float +1
+		.def_readwrite("bottom", &Fove_ProjectionParams::bottom, "Bottom (low-Y)")    // float -1
+		.def("__repr__", repr<Fove_ProjectionParams>, "Returns a string representation of the projection params.");
+}
+
+#if FOVE_HAS_FEATURE(FOVE_FEATURE_GAZABLE_OBJECTS)
+void defstruct_BoundingBox(py::module& m)
+{
+	py::class_<Fove_BoundingBox>(m, "BoundingBox",
+								 R"(A bounding box)")
+		.def(py::init<Fove_Vec3, Fove_Vec3>(),
+			 py::arg_v("center", default_Vec3(), "Vec3()"),
+			 py::arg_v("extend", default_Vec3(), "Vec3()"))
+		.def_readwrite("center", &Fove_BoundingBox::center, "The position of the center of the bounding box")
+		.def_readwrite("extend", &Fove_BoundingBox::extend, "The extend of the bounding box (e.g. half of its size)")
+		.def("__repr__", repr<Fove_BoundingBox>, "Returns a string representation of the bounding box.")
+		.def(
+			"__eq__", [](const Fove_BoundingBox& self, const Fove_BoundingBox& other) {
+				return self == other;
+			},
+			py::is_operator(), "Returns `True` if the two bounding box are the same.")
+		.def("__ne__", [](Fove_BoundingBox& self, Fove_BoundingBox& other) {
+			return !(self == other);
+		},
+			 py::is_operator(), "Returns `True` if the two bounding box are not the same.");
+}
+
+void defstruct_ObjectPose(py::module& m)
+{
+	py::class_<Fove_ObjectPose>(m, "ObjectPose",
+								R"(Represents the pose of an object of the scene
+
+Pose transformations are applied in the following order on the object: scale, rotation, translation)")
+		.def(py::init<Fove_Vec3, Fove_Quaternion, Fove_Vec3, Fove_Vec3>(),
+			 py::arg_v("scale", Fove_Vec3{1, 1, 1}, "Vec3(1,1,1)"),
+			 py::arg_v("rotation", default_Quaternion(), "Quaternion()"),
+			 py::arg_v("position", default_Vec3(), "Vec3()"),
+			 py::arg_v("velocity", default_Vec3(), "Vec3()"))
+		.def_readwrite("scale", &Fove_ObjectPose::scale, "The scale of the object in world space")
+		.def_readwrite("rotation", &Fove_ObjectPose::rotation, "The rotation of the object in world space")
+		.def_readwrite("position", &Fove_ObjectPose::position, "The position of the object in world space")
+		.def_readwrite("velocity", &Fove_ObjectPose::velocity, "Velocity of the object in world space")
+		.def("__repr__", repr<Fove_ObjectPose>, "Returns a string representation of the object pose.")
+		.def(
+			"__eq__", [](const Fove_ObjectPose& self, const Fove_ObjectPose& other) {
+				return self == other;
+			},
+			py::is_operator(), "Returns `True` if the two poses are the same.")
+		.def("__ne__", [](Fove_ObjectPose& self, Fove_ObjectPose& other) {
+			return !(self == other);
+		},
+			 py::is_operator(), "Returns `True` if the two poses are not the same.");
+	;
+}
+
+void defenum_ColliderType(py::module& m)
+{
+	py::enum_<Fove_ColliderType>(m, "ColliderType", R"(Specify the different collider shape types
+
+- `Cube`: A cube shape
+- `Sphere`: A sphere shape
+- `Mesh`: A shape defined by a mesh
+)")
+		.value("Cube", Fove_ColliderType::Cube)
+		.value("Sphere", Fove_ColliderType::Sphere)
+		.value("Mesh", Fove_ColliderType::Mesh);
+}
+
+void defstruct_ColliderCube(py::module& m)
+{
+	py::class_<Fove_ColliderCube>(m, "ColliderCube",
+								  R"(Define a cube collider shape)")
+		.def(py::init<Fove_Vec3>(),
+			 py::arg_v("size", Fove_Vec3{1, 1, 1}, "Vec3(1,1,1)"))
+		.def_readwrite("size", &Fove_ColliderCube::size, "The size of the cube")
+		.def("__repr__", repr<Fove_ColliderCube>, "Returns a string representation of the cube collider.");
+}
+
+void defstruct_ColliderSphere(py::module& m)
+{
+	py::class_<Fove_ColliderSphere>(m, "ColliderSphere",
+									R"(Define a sphere collider shape)")
+		.def(py::init<float>(),
+			 py::arg("radius") = 0.5f)
+		.def_readwrite("radius", &Fove_ColliderSphere::radius, "The radius of the sphere")
+		.def("__repr__", repr<Fove_ColliderSphere>, "Returns a string representation of the sphere collider.");
+}
+
+struct FOVE_BINDINGS_HIDDEN VertexBuffer
+{
+	float* vertices;
+	unsigned int vertexCount;
+	// Keeps the Python buffer the vertices alias alive; null when the data is
+	// borrowed from elsewhere (e.g. read back from a ColliderMesh)
+	py::object owner;
+};
+
+void defstruct_VertexBuffer(py::module& m)
+{
+	py::class_<VertexBuffer>(m, "VertexBuffer", py::buffer_protocol(),
+							 R"(Contains the vertices defining a mesh
+
+The vertex data is aliased from the given buffer, not copied; the source object is
+kept alive by this wrapper, but mutating or resizing it while a mesh uses it is undefined.)")
+		.def(py::init([](py::buffer b) {
+			/* Request a buffer descriptor from Python */
+			py::buffer_info info = b.request();
+
+			/* Some sanity checks ... */
+			if (info.format != py::format_descriptor<float>::format())
+				throw std::runtime_error("Incompatible format: expected a float array! received:" + info.format);
+
+			if (info.ndim != 2)
+				throw std::runtime_error("Incompatible buffer dimension!");
+
+			if (info.shape[1] != 3)
+				throw std::runtime_error("Vertex should be composed of 3 components (x,y,z)!");
+
+			if (info.strides[0] != 3 * sizeof(float))
+				throw std::runtime_error("Row stride should be 3 floats");
+
+			if (info.strides[1] != sizeof(float))
+				throw std::runtime_error("Col stride should be 1 float");
+
+			// The buffer is aliased, not copied; keep the source object alive with us
+			return VertexBuffer{static_cast<float*>(info.ptr), static_cast<unsigned int>(info.shape[0] * 3), py::reinterpret_borrow<py::object>(b)};
+		}));
+}
+
+struct FOVE_BINDINGS_HIDDEN IndexBuffer
+{
+	unsigned int* indices;
+	unsigned int triangleCount;
+	// Keeps the Python buffer the indices alias alive (see VertexBuffer::owner)
+	py::object owner;
+};
+
+void defstruct_IndexBuffer(py::module& m)
+{
+	py::class_<IndexBuffer>(m, "IndexBuffer", py::buffer_protocol(),
+							R"(Contains the triangle indices defining a mesh
+
+The index data is aliased from the given buffer, not copied; the source object is
+kept alive by this wrapper, but mutating or resizing it while a mesh uses it is undefined.)")
+		.def(py::init([](py::buffer b) {
+			/* Request a buffer descriptor from Python */
+			py::buffer_info info = b.request();
+
+			if (info.ndim != 1)
+				throw std::runtime_error("Incompatible buffer dimension!");
+
+			if (info.strides[0] != sizeof(unsigned int))
+				throw std::runtime_error("Row stride should be 1 unsigned int");
+
+			if (info.shape[0] % 3 != 0)
+				throw std::runtime_error("Index buffer index count should be a multiple of 3 as it represent triangles");
+
+			// The buffer is aliased, not copied; keep the source object alive with us
+			return IndexBuffer{static_cast<unsigned int*>(info.ptr), static_cast<unsigned int>(info.shape[0] / 3), py::reinterpret_borrow<py::object>(b)};
+		}));
+}
+
+void defstruct_ColliderMesh(py::module& m)
+{
+	defstruct_VertexBuffer(m);
+	defstruct_IndexBuffer(m);
+
+	py::class_<Fove_ColliderMesh>(m, "ColliderMesh",
+								  R"(Define a mesh collider shape
+
+A mesh collider can either be defined through a triangle list or through a vertex/index buffer set.
+If the index buffer pointer is null, then the vertex buffer is interpreted as a regular triangle list.
+)")
+		.def(py::init<>())
+		.def_property("vertexBuffer",
+					  [](Fove_ColliderMesh& self) -> const VertexBuffer {
+						  return VertexBuffer{self.vertices, self.vertexCount};
+					  },
+					  [](Fove_ColliderMesh& self, const VertexBuffer& value) {
+						  self.vertices = value.vertices;
+						  self.vertexCount = value.vertexCount;
+					  },
+					  R"(The vertices of the mesh.
+
+It contains the X, Y, Z positions of mesh vertices.
+Triangles are defined using "indices
+)")
+		.def_property("indexBuffer",
+					  [](Fove_ColliderMesh& self) -> const IndexBuffer {
+						  return IndexBuffer{self.indices, self.triangleCount};
+					  },
+					  [](Fove_ColliderMesh& self, const IndexBuffer& value) {
+						  self.indices = value.indices;
+						  self.triangleCount = value.triangleCount;
+					  },
+					  R"(The vertex indices defining the triangles of the mesh
+
+Triangles are listed one after the others (and not combined using a fan or strip algorithm).
+The number of elements must equal `3 x triangleCount`.
+
+Outward faces are defined to be specified counter-clockwise.
+Face-direction information is not currently used but may be in the future.
+
+If null, the vertices are interpreted as a simple triangle list.
+)")
+		.def_readwrite("boundingBox", &Fove_ColliderMesh::boundingBox, "If null the bounding box is re-calculated internally")
+		.def("__repr__", repr<Fove_ColliderMesh>, "Returns a string representation of the mesh collider.");
+}
+
+void defstruct_ObjectCollider(py::module& m)
+{
+	py::class_<Fove_ObjectCollider>(m, "ObjectCollider",
+									R"(Represents a colliding part of a gazable object
+Colliders are used to calculate intersection between gaze rays and gazable objects)")
+		.def(py::init<Fove_Vec3>(), py::arg_v("center", default_Vec3(), "Vec3()"))
+		.def_readwrite("center", &Fove_ObjectCollider::center, "The offset of the collider center collider raw shape")
+		.def_readonly("shapeType", &Fove_ObjectCollider::shapeType, "The shape type of the collider")
+		.def_property("cubeDefinition",
+					  [](Fove_ObjectCollider& self) -> const Fove_ColliderCube& {
+						  if (self.shapeType != Fove_ColliderType::Cube)
+							  throw std::runtime_error("Error the collider is not of cube type");
+
+						  return self.shapeDefinition.cube;
+					  },
+					  [](Fove_ObjectCollider& self, const Fove_ColliderCube& value) {
+						  self.shapeType = Fove_ColliderType::Cube;
+						  self.shapeDefinition.cube = value;
+					  },
+					  R"(Set the object collider as a cube collider)")
+		.def_property("sphereDefinition",
+					  [](Fove_ObjectCollider& self) -> const Fove_ColliderSphere& {
+						  if (self.shapeType != Fove_ColliderType::Sphere)
+							  throw std::runtime_error("Error the collider is not of sphere type");
+
+						  return self.shapeDefinition.sphere;
+					  },
+					  [](Fove_ObjectCollider& self, const Fove_ColliderSphere& value) {
+						  self.shapeType = Fove_ColliderType::Sphere;
+						  self.shapeDefinition.sphere = value;
+					  },
+					  R"(Set the object collider as a sphere collider)")
+		.def_property("meshDefinition",
+					  [](Fove_ObjectCollider& self) -> const Fove_ColliderMesh& {
+						  if (self.shapeType != Fove_ColliderType::Mesh)
+							  throw std::runtime_error("Error the collider is not of mesh type");
+
+						  return self.shapeDefinition.mesh;
+					  },
+					  [](Fove_ObjectCollider& self, const Fove_ColliderMesh& value) {
+						  self.shapeType = Fove_ColliderType::Mesh;
+						  self.shapeDefinition.mesh = value;
+					  },
+					  R"(Set the object collider as a mesh collider)")
+		.def("__repr__", repr<Fove_ObjectCollider>, "Returns a string representation of the object collider.");
+}
+
+struct ColliderArray
+{
+	std::vector<Fove_ObjectCollider> colliders;
+};
+
+void defstruct_ColliderArray(py::module& m)
+{
+	py::class_<ColliderArray>(m, "ColliderArray", py::buffer_protocol(),
+							  R"(Contains the triangle indices defining a mesh)")
+		.def(py::init<>())
+		.def("add", [](ColliderArray& colliderArray, const Fove_ObjectCollider& collider) {
+			colliderArray.colliders.push_back(collider);
+		});
+}
+
+void defstruct_GazableObject(py::module& m)
+{
+	defstruct_ColliderArray(m);
+
+	py::class_<Fove_GazableObject>(m, "GazableObject",
+								   R"(Represents an object in a 3D world
+The bounding shapes of this object are used for ray casts to determine what the user is looking at.
+Note that multiple bounding shape types can be used simultaneously, such as a sphere and a mesh.
+\see fove_Headset_registerGazableObject
+\see fove_Headset_updateGazableObject
+\see fove_Headset_removeGazableObject
+)")
+		.def(py::init<int, Fove_ObjectPose, Fove_ObjectGroup>(),
+			 py::arg("id") = fove_ObjectIdInvalid,
+			 py::arg_v("pose", default_ObjectPose(), "ObjectPose()"),
+			 py::arg_v("group", Fove_ObjectGroup::Group0, "ObjectGroup(0)"))
+		.def_readwrite("id", &Fove_GazableObject::id, "Unique ID of the object. User-defined objects should use positive integers.")
+		.def_readwrite("pose", &Fove_GazableObject::pose, "The initial pose of the object")
+		.def_readwrite("group", &Fove_GazableObject::group, "The gazable object group this object belongs to")
+		.def("setColliders", [](Fove_GazableObject& self, ColliderArray& value) {
+			self.colliders = value.colliders.data();
+			self.colliderCount = static_cast<unsigned>(value.colliders.size());
+		},
+			 R"(Set the colliders of the gazable object)")
+		.def("__repr__", repr<Fove_GazableObject>, "Returns a string representation of the gazable object.");
+}
+
+void defstruct_CameraObject(py::module& m)
+{
+	py::class_<Fove_CameraObject>(m, "CameraObject",
+								  R"(Represents a camera in a 3D world
+The camera view pose determine what the user is looking at and the object mask specify which objects are rendered.)")
+		.def(py::init<int, Fove_ObjectPose, Fove_ObjectGroup>(),
+			 py::arg("id") = fove_ObjectIdInvalid,
+			 py::arg_v("pose", default_ObjectPose(), "ObjectPose()"),
+			 py::arg_v("groupMask", static_cast<Fove_ObjectGroup>(0xffffffff), "ObjectGroup(0xffffffff)"))
+		.def_readwrite("id", &Fove_CameraObject::id, "Unique ID of the camera. User-defined id should use positive integers.")
+		.def_readwrite("pose", &Fove_CameraObject::pose, "The camera initial pose")
+		.def_readwrite("groupMask", &Fove_CameraObject::groupMask, "The bit mask specifying which object groups the camera renders")
+		.def("__repr__", repr<Fove_CameraObject>, "Returns a string representation of the camera object.");
+}
+#endif // FOVE_FEATURE_GAZABLE_OBJECTS
+
+#if FOVE_HAS_FEATURE(FOVE_FEATURE_COMPOSITOR)
+void defenum_GraphicsAPI(py::module& m)
+{
+	py::enum_<Fove_GraphicsAPI>(m, "GraphicsAPI",
+								R"(enum for type of Graphics API
+
+Type of Graphics API
+Note: We currently only support DirectX)
+
+- `DirectX`: , DirectX (Windows only)
+- `OpenGL`: , OpenGL (All platforms, currently in BETA)
+- `Metal`: Metal (Mac only))")
+		.value("DirectX", Fove_GraphicsAPI::DirectX) // = 0
+		.value("OpenGL", Fove_GraphicsAPI::OpenGL)   // = 1
+		.value("Metal", Fove_GraphicsAPI::Metal)     // = 2
+		;
+}
+
+void defenum_AlphaMode(py::module& m)
+{
+	py::enum_<Fove_AlphaMode>(m, "AlphaMode",
+							  R"(Enum to help interpret the alpha of texture
+
+Determines how to interpret the alpha of a compositor client texture
+
+- `Auto`: Base layers will use One, overlay layers will use Sample
+- `One`: Alpha will always be one (fully opaque)
+- `Sample`: Alpha fill be sampled from the alpha channel of the buffer)")
+		.value("Auto", Fove_AlphaMode::Auto)     // = 0
+		.value("One", Fove_AlphaMode::One)       // = 1
+		.value("Sample", Fove_AlphaMode::Sample) // = 2
+		;
+}
+
+void defstruct_CompositorLayerCreateInfo(py::module& m)
+{
+	py::class_<Fove_CompositorLayerCreateInfo>(m, "CompositorLayerCreateInfo",
+											   R"(Struct used to define the settings for a compositor client.
+
+Structure used to define the settings for a compositor client.)")
+		.def(py::init<Fove_CompositorLayerType, bool, Fove_AlphaMode, bool, bool>(),
+			 py::arg_v("type", Fove_CompositorLayerType::Base, "CompositorLayer()"),
+			 py::arg("disableTimeWarp") = false,
+			 py::arg_v("alphaMode", Fove_AlphaMode::Auto, "AlphaMode(0)"),
+			 py::arg("disableFading") = false,
+			 py::arg("disableDistortion") = false)
+		.def_readwrite("type", &Fove_CompositorLayerCreateInfo::type,
+					   "The type (layer) upon which the client will draw") // Fove_CompositorLayerType Fove_CompositorLayerType::Base
+		.def_readwrite("disableTimeWarp", &Fove_CompositorLayerCreateInfo::disableTimeWarp,
+					   "Setting to disable timewarp, e.g. if an overlay client is operating in screen space") // bool false
+		.def_readwrite("alphaMode", &Fove_CompositorLayerCreateInfo::alphaMode,
+					   "Setting about whether to use alpha sampling or not, e.g. for a base client") // Fove_AlphaMode Fove_AlphaMode::Auto
+		.def_readwrite("disableFading", &Fove_CompositorLayerCreateInfo::disableFading,
+					   "Setting to disable fading when the base layer is misbehaving, e.g. for a diagnostic client") // bool false
+		.def_readwrite("disableDistortion", &Fove_CompositorLayerCreateInfo::disableDistortion,
+					   "Setting to disable a distortion pass, e.g. for a diagnostic client, or a client intending to do its own distortion") // bool false
+		;
+}
+
+// Struct used to store information about an existing compositor layer (after it is created)
+void defstruct_CompositorLayer(py::module& m)
+{
+	py::class_<Fove_CompositorLayer>(m, "CompositorLayer",
+									 R"(Struct used to store information about an existing compositor layer (after it is created)
+
+This exists primarily for future expandability.)")
+		.def(py::init<int, Fove_Vec2i>(),
+			 py::arg("layerId") = 0,
+			 py::arg_v("idealResolutionPerEye", default_Vec2i(), "Vec2i()"))
+		.def_readwrite("layerId", &Fove_CompositorLayer::layerId,
+					   "Uniquely identifies a layer created within an IFVRCompositor object") // int 0
+		.def_readwrite("idealResolutionPerEye", &Fove_CompositorLayer::idealResolutionPerEye,
+					   R"(The optimal resolution for a submitted buffer on this layer (for a single eye).
+
+		Clients are allowed to submit buffers of other resolutions.
+		In particular, clients can use a lower resolution buffer to reduce their rendering overhead.)") // Fove_Vec2i {}
+		;
+}
+
+void defstruct_CompositorTexture(py::module& m)
+{
+	py::class_<Fove_CompositorTexture>(m, "CompositorTexture",
+									   "Base class of API-specific texture classes")
+		.def(py::init<Fove_GraphicsAPI>(),
+			 py::arg_v("graphicsAPI", Fove_GraphicsAPI::DirectX, "GraphicsAPI(0)"))
+		.def_readwrite("graphicsAPI", &Fove_CompositorTexture::graphicsAPI,
+					   R"(If this is DirectX, this object must be a Fove_DX11Texture
+If this is OpenGL, this object must be a Fove_GLTexture
+In C++ this field is initialized automatically by the subclass)" // GraphicsAPI
+		);
+}
+
+void defstruct_DX11Texture(py::module& m)
+{
+	py::class_<Fove_DX11Texture>(m, "DX11Texture", "Struct used to submit a DirectX 11 texture")
+		.def(py::init<>([]() {
+			return Fove_DX11Texture{Fove_CompositorTexture{Fove_GraphicsAPI::DirectX}, nullptr};
+		}))
+		.def_readonly("parent", &Fove_DX11Texture::parent,
+					  "Parent object") // Fove_GraphicsAPI Fove_GraphicsAPI::OpenGL
+		.def_readwrite("texture", &Fove_DX11Texture::texture,
+					   "This must point to a ID3D11Texture2D") // void* nullptr
+		;
+}
+
+void defstruct_GLTexture(py::module& m)
+{
+	py::class_<Fove_GLTexture>(m, "GLTexture",
+							   R"(Struct used to submit an OpenGL texture
+
+The GL context must be active on the thread that submits this.)")
+		.def(py::init([]() {
+			return Fove_GLTexture{Fove_CompositorTexture{Fove_GraphicsAPI::OpenGL}, 0, nullptr};
+		}))
+		.def_readonly("parent", &Fove_GLTexture::parent, "Parent object")
+		.def_readwrite("textureId", &Fove_GLTexture::textureId,
+					   "The opengl id of the texture, as returned by glGenTextures") // uint32_t 0
+		.def_readwrite("context", &Fove_GLTexture::context,
+					   "On mac, this is a CGLContextObj, otherwise this field is reserved and you must pass null") // void* nullptr
+		;
+}
+
+void defstruct_MetalTexture(py::module& m)
+{
+	py::class_<Fove_MetalTexture>(m, "MetalTexture", "Struct used to submit a texture using the Apple Metal API")
+		.def(py::init<>([]() {
+			return Fove_MetalTexture{Fove_CompositorTexture{Fove_GraphicsAPI::Metal}, nullptr};
+		}))
+		.def_readonly("parent", &Fove_MetalTexture::parent, "Parent object") // Fove_GraphicsAPI Fove_GraphicsAPI::Metal
+		.def_readwrite("texture", &Fove_MetalTexture::texture,
+					   "Pointer to an MTLTexture (which must have MTLTextureUsageShaderRead specified).") // void* nullptr
+		;
+}
+
+void defstruct_TextureBounds(py::module& m)
+{
+	py::class_<Fove_TextureBounds>(m, "TextureBounds",
+								   R"(Struct to represent coordinates in normalized space
+
+Coordinates in normalized space where 0 is left/top and 1 is bottom/right)")
+		.def(py::init<float, float, float, float>(),
+			 py::arg("left") = 0.0f,
+			 py::arg("top") = 0.0f,
+			 py::arg("right") = 0.0f,
+			 py::arg("bottom") = 0.0f)
+		.def_readwrite("left", &Fove_TextureBounds::left)     // float 0.0f
+		.def_readwrite("top", &Fove_TextureBounds::top)       // float 0.0f
+		.def_readwrite("right", &Fove_TextureBounds::right)   // float 0.0f
+		.def_readwrite("bottom", &Fove_TextureBounds::bottom) // float 0.0f
+		.def(
+			"__eq__", [](const Fove_TextureBounds& self, const Fove_TextureBounds& other) {
+				return self == other;
+			},
+			py::is_operator(), "Returns `True` if the two texture bounds are the same.")
+		.def("__ne__", [](const Fove_TextureBounds& self, const Fove_TextureBounds& other) {
+			return !(self == other);
+		},
+			 py::is_operator(), "Returns `True` if the two texture bounds are not the same.");
+}
+
+void defstruct_CompositorLayerEyeSubmitInfo(py::module& m)
+{
+	py::class_<Fove_CompositorLayerEyeSubmitInfo>(m, "CompositorLayerEyeSubmitInfo",
+												  "Struct used to conglomerate the texture settings for a single eye, when submitting a given layer")
+		.def(py::init<const Fove_CompositorTexture*, Fove_TextureBounds>(),
+			 py::arg("texInfo") = nullptr,
+			 py::arg_v("bounds", default_TextureBounds(), "TextureBounds()"))
+		.def_readwrite("texInfo", &Fove_CompositorLayerEyeSubmitInfo::texInfo, R"(Texture to submit for this eye
+This may be null as long as the other submitted eye's texture isn't (thus allowing each eye to be submitted separately))")
+		.def_readwrite("bounds", &Fove_CompositorLayerEyeSubmitInfo::bounds, "The portion of the texture that is used to represent the eye (Eg. half of it if the texture contains both eyes)");
+}
+
+void defstruct_CompositorLayerSubmitInfo(py::module& m)
+{
+	py::class_<Fove_CompositorLayerSubmitInfo>(m, "CompositorLayerSubmitInfo", "Struct used to conglomerate the texture settings when submitting a given layer")
+		.def(py::init<int, Fove_Pose, Fove_CompositorLayerEyeSubmitInfo, Fove_CompositorLayerEyeSubmitInfo>(),
+			 py::arg("layerId") = 0,
+			 py::arg_v("pose", default_Pose(), "Pose()"),
+			 py::arg_v("left", default_CompositorLayerEyeSubmitInfo(), "CompositorLayerEyeSubmitInfo()"),
+			 py::arg_v("right", default_CompositorLayerEyeSubmitInfo(), "CompositorLayerEyeSubmitInfo()"))
+		.def_readwrite("layerId", &Fove_CompositorLayerSubmitInfo::layerId, "The layer ID as fetched from Fove_CompositorLayer")
+		.def_readwrite("pose", &Fove_CompositorLayerSubmitInfo::pose, "The pose used to draw this layer, usually coming from Compositor_waitForRenderPose")
+		.def_readwrite("left", &Fove_CompositorLayerSubmitInfo::left, "Information about the left eye")
+		.def_readwrite("right", &Fove_CompositorLayerSubmitInfo::right, "Information about the left eye");
+}
+
+// Struct used to identify a GPU adapter
+// Currently only used on Windows
+void defstruct_AdapterId(py::module& m)
+{
+	py::class_<Fove_AdapterId>(m, "AdapterId", "Struct used to identify a GPU adapter (Windows only)")
+	// This is a corner case. We choose to throw if users try to construct Fove_AdapterId
+	// on non-Win platforms
+	// .def(py::init<>())
+#ifdef _WIN32
+		.def(py::init<uint32_t, int32_t>(),
+			 py::arg("lowPart") = 0u,
+			 py::arg("highPart") = 0)
+		.def_readwrite("lowPart", &Fove_AdapterId::lowPart, "On windows, this together with `highPart` forms a LUID structure")
+		.def_readwrite("highPart", &Fove_AdapterId::highPart, "On windows, this together with `lowPart` forms a LUID structure")
+#endif // _WIN32
+		;
+}
+#endif // FOVE_FEATURE_COMPOSITOR
+
+void defstruct_Buffer(py::module& m)
+{
+	py::class_<Fove_Buffer>(m, "Buffer", py::buffer_protocol(),
+							R"(A generic memory buffer
+
+No ownership or lifetime semantics are specified. Please see the comments on the functions that use this.)")
+		.def(py::init<void*, std::size_t>(),
+			 py::arg("data") = nullptr,
+			 py::arg("length") = 0)
+		.def_readwrite("data", &Fove_Buffer::data, "Pointer to the start of the memory buffer")
+		.def_readwrite("length", &Fove_Buffer::length, "Length, in bytes, of the buffer")
+		.def_buffer([](Fove_Buffer& buf) {
+			return py::buffer_info{
+				reinterpret_cast<unsigned char*>(const_cast<void*>(buf.data)), // XXX const
+				sizeof(unsigned char),
+				py::format_descriptor<unsigned char>::format(),
+				1,                      // ndims
+				{buf.length},           // dims
+				{sizeof(unsigned char)} // strides
+			};
+		});
+}
+
+void defstruct_EyeShape(py::module& m)
+{
+	py::class_<Python_EyeShape>(m, "EyeShape", py::buffer_protocol(),
+								R"(Specify the shape of an eye
+
+This struct implements buffer_protocol, and thus can be converted to a numpy array:
+m = fove.capi.EyeShape()
+a = numpy.array(m, copy=False)
+)")
+		.def(py::init<>())
+		.def_buffer([](Python_EyeShape& obj) {
+			return py::buffer_info{
+				reinterpret_cast<void*>(&obj.val.outline[0]),
+				sizeof(float),
+				py::format_descriptor<float>::format(),
+				2,                                 // ndims
+				{12, 2},                           // dims
+				{sizeof(float) * 2, sizeof(float)} // strides
+			};
+		});
+}
+
+void defstruct_PupilShape(py::module& m)
+{
+	py::class_<Fove_PupilShape>(m, "PupilShape", R"(Specity the shape of a pupil as an ellipse
+
+Coordinates are in eye-image pixels from (0,0) to (camerawidth, cameraheight), with (0,0) being the top left.)")
+		.def(py::init<Fove_Vec2, Fove_Vec2, float>(),
+			 py::arg_v("center", default_Vec2(), "Vec2()"),
+			 py::arg_v("size", default_Vec2(), "Vec2()"),
+			 py::arg("angle") = 0.0f)
+		.def_readwrite("center", &Fove_PupilShape::center, "The center of the ellipse")
+		.def_readwrite("size", &Fove_PupilShape::size, "The width and height of the ellipse")
+		.def_readwrite("angle", &Fove_PupilShape::angle, "A clockwise rotation around the center, in degrees");
+}
+
+void defstruct_BitmapImage(py::module& m)
+{
+	py::class_<Fove_BitmapImage>(m, "BitmapImage", "A 2D bitmap image")
+		.def(py::init<uint64_t, Fove_Buffer>(),
+			 py::arg("timestamp") = 0,
+			 py::arg_v("image", default_Buffer(), "Buffer()"))
+		.def_readwrite("timestamp", &Fove_BitmapImage::timestamp,
+					   "Timestamp of the image, in microseconds since an unspecified epoch") // uint64_t 0
+		.def_readwrite("image", &Fove_BitmapImage::image,
+					   R"(BMP data (including full header that contains size, format, etc)
+
+The height may be negative to specify a top-down bitmap.)") // Fove_Buffer {}
+		;
+}
+
+#if FOVE_HAS_FEATURE(FOVE_FEATURE_CALIBRATION_GUI)
+void defstruct_CalibrationTarget(py::module& m)
+{
+	py::class_<Fove_CalibrationTarget>(m, "CalibrationTarget", "Represent a calibration target of the calibration process")
+		.def(py::init<Fove_Vec3, float>(),
+			 py::arg_v("position", default_Vec3(), "Vec3()"),
+			 py::arg("scale") = 0)
+		.def_readwrite("position", &Fove_CalibrationTarget::position,
+					   "The position of the calibration target in the 3D world space")
+		.def_readwrite("recommendedSize", &Fove_CalibrationTarget::recommendedSize,
+					   R"(The recommended size for the calibration target in world space unit.
+A recommended size of 0 means that the display of the target is not recommended at the current time)")
+		.def(
+			"__eq__", [](const Fove_CalibrationTarget& self, const Fove_CalibrationTarget& other) {
+				return self == other;
+			},
+			py::is_operator(), "Returns `True` if the two targets are the same.")
+		.def("__ne__", [](Fove_CalibrationTarget& self, Fove_CalibrationTarget& other) {
+			return !(self == other);
+		},
+			 py::is_operator(), "Returns `True` if the two targets are not the same.");
+	;
+}
+#endif // FOVE_FEATURE_CALIBRATION_GUI
+
+void defenum_CalibrationState(py::module& m)
+{
+	py::enum_<Fove_CalibrationState>(m, "CalibrationState", R"(Indicates the state of a calibration process
+A calibration process always starts from the `NotStarted` state,
+	then it can go back and forth between the `WaitingForUser` & `CollectingData` states,
+	then it goes to the `ProcessingData` state and finishes with the `Successful` state.
+
+	A failure can happen any time during the process, and stops the process where it was.
+
+	From the `ProcessingData` state the calibration process do not require any rendering
+	and gameplay can be started if wanted but new calibration won't be effective before reaching the `Successful` state.)")
+		.value("NotStarted", Fove_CalibrationState::NotStarted)
+		.value("HeadsetAdjustment", Fove_CalibrationState::HeadsetAdjustment)
+		.value("WaitingForUser", Fove_CalibrationState::WaitingForUser)
+		.value("CollectingData", Fove_CalibrationState::CollectingData)
+		.value("ProcessingData", Fove_CalibrationState::ProcessingData)
+		.value("Successful_HighQuality", Fove_CalibrationState::Successful_HighQuality)
+		.value("Successful_MediumQuality", Fove_CalibrationState::Successful_MediumQuality)
+		.value("Successful_LowQuality", Fove_CalibrationState::Successful_LowQuality)
+		.value("Failed_Unknown", Fove_CalibrationState::Failed_Unknown)
+		.value("Failed_InaccurateData", Fove_CalibrationState::Failed_InaccurateData)
+		.value("Failed_NoRenderer", Fove_CalibrationState::Failed_NoRenderer)
+		.value("Failed_NoUser", Fove_CalibrationState::Failed_NoUser)
+		.value("Failed_Aborted", Fove_CalibrationState::Failed_Aborted);
+}
+
+#if FOVE_HAS_FEATURE(FOVE_FEATURE_CALIBRATION_GUI)
+void defenum_CalibrationMethod(py::module& m)
+{
+	py::enum_<Fove_CalibrationMethod>(m, "CalibrationMethod", "Indicates the calibration method to use")
+		.value("Default", Fove_CalibrationMethod::Default)
+		.value("OnePoint", Fove_CalibrationMethod::OnePoint)
+		.value("Spiral", Fove_CalibrationMethod::Spiral)
+		.value("OnePointWithNoGlassesSpiralWithGlasses", Fove_CalibrationMethod::OnePointWithNoGlassesSpiralWithGlasses)
+		.value("ZeroPoint", Fove_CalibrationMethod::ZeroPoint)
+		.value("DefaultCalibration", Fove_CalibrationMethod::DefaultCalibration);
+}
+
+void defenum_EyeByEyeCalibration(py::module& m)
+{
+	py::enum_<Fove_EyeByEyeCalibration>(m, "EyeByEyeCalibration", "Indicate whether each eye should be calibrated separately or not")
+		.value("Default", Fove_EyeByEyeCalibration::Default)
+		.value("Disabled", Fove_EyeByEyeCalibration::Disabled)
+		.value("Enabled", Fove_EyeByEyeCalibration::Enabled);
+}
+
+void defenum_EyeTorsionCalibration(py::module& m)
+{
+	py::enum_<Fove_EyeTorsionCalibration>(m, "EyeTorsionCalibration", "Indicate whether eye torsion calibration should be run or not")
+		.value("Default", Fove_EyeTorsionCalibration::Default)
+		.value("IfEnabled", Fove_EyeTorsionCalibration::IfEnabled)
+		.value("Always", Fove_EyeTorsionCalibration::Always);
+}
+
+void defstruct_CalibrationData(py::module& m)
+{
+	py::class_<CalibrationData>(m, "CalibrationData", "Provide all the calibration data needed to render the current state of the calibration process")
+		.def(py::init<Fove_CalibrationMethod, Fove_CalibrationState, std::string, Fove_CalibrationTarget, Fove_CalibrationTarget>(),
+			 py::arg_v("method", Fove_CalibrationMethod::Spiral, "CalibrationMethod(0)"),
+			 py::arg_v("state", Fove_CalibrationState::NotStarted, "CalibrationState(0)"),
+			 py::arg("stateInfo") = std::string(),
+			 py::arg_v("targetL", default_CalibrationTarget(), "CalibrationTarget()"),
+			 py::arg_v("targetR", default_CalibrationTarget(), "CalibrationTarget()"))
+		.def_readwrite("method", &CalibrationData::method, "The calibration method currently used, or Default if the method is unknown (from a future update)")
+		.def_readwrite("state", &CalibrationData::state, "The current state of the calibration")
+		.def_readwrite("stateInfo", &CalibrationData::state, "Human readable extra information about the current calibration state")
+		.def_readwrite("targetL", &CalibrationData::targetL, "The current calibration target to display for the left eye")
+		.def_readwrite("targetR", &CalibrationData::targetR, "The current calibration target to display for the right eye");
+}
+
+void defstruct_HmdAdjustmentData(py::module& m)
+{
+	py::class_<Fove_HmdAdjustmentData>(m, "HmdAdjustmentData", "Provide all the HMD positioning data needed to render the current state of the HMD adjustment process")
+		.def(py::init<Fove_Vec2, float, bool, bool, Fove_Vec2, Fove_Vec2, float, float, Fove_Vec2, Fove_Vec2>(),
+			 py::arg_v("translation", default_Vec2(), "Vec2()"),
+			 py::arg("rotation") = 0,
+			 py::arg("adjustmentNeeded") = false,
+			 py::arg("hasTimeout") = false,
+			 py::arg_v("idealPositionL", default_Vec2(), "Vec2()"),
+			 py::arg_v("idealPositionR", default_Vec2(), "Vec2()"),
+			 py::arg("idealPositionSpanL") = 0,
+			 py::arg("idealPositionSpanR") = 0,
+			 py::arg_v("estimatedPositionL", default_Vec2(), "Vec2()"),
+			 py::arg_v("estimatedPositionR", default_Vec2(), "Vec2()"))
+		.def_readwrite("translation", &Fove_HmdAdjustmentData::translation, "The HMD translation offset in eyes camera in relative units ([-1, 1])")
+		.def_readwrite("rotation", &Fove_HmdAdjustmentData::rotation, "The rotation of HMD to the eye line in radian")
+		.def_readwrite("adjustmentNeeded", &Fove_HmdAdjustmentData::adjustmentNeeded, "Indicate whether the HMD adjustment GUI should be displayed to correct user HMD alignment")
+		.def_readwrite("hasTimeout", &Fove_HmdAdjustmentData::hasTimeout, "Indicate if the adjustment process has timeout in which case the GUI should close")
+		.def_readwrite("idealPositionL", &Fove_HmdAdjustmentData::idealPositionL, "Pixel coordinate on the left camera image for the expected ideal eye position")
+		.def_readwrite("idealPositionR", &Fove_HmdAdjustmentData::idealPositionR, "Pixel coordinate on the right camera image for the expected ideal eye position")
+		.def_readwrite("idealPositionSpanL", &Fove_HmdAdjustmentData::idealPositionSpanL, "Radius of the tolerance area for the expected ideal eye position on the left camera image in pixels")
+		.def_readwrite("idealPositionSpanR", &Fove_HmdAdjustmentData::idealPositionSpanR, "Radius of the tolerance area for the expected ideal eye position on the right camera image in pixels")
+		.def_readwrite("estimatedPositionL", &Fove_HmdAdjustmentData::estimatedPositionL, "Pixel coordinate of left eye position which is independent on eye orientation")
+		.def_readwrite("estimatedPositionR", &Fove_HmdAdjustmentData::estimatedPositionR, "Pixel coordinate of right eye position which is independent on eye orientation");
+}
+
+void defstruct_CalibrationOptions(py::module& m)
+{
+	py::class_<Fove_CalibrationOptions>(m, "CalibrationOptions", "Options specifying how to run a calibration process")
+		.def(py::init<bool, bool, Fove_EyeByEyeCalibration, Fove_CalibrationMethod, Fove_EyeTorsionCalibration>(),
+			 py::arg("lazy") = false,
+			 py::arg("restart") = false,
+			 py::arg_v("eyeByEye", Fove_EyeByEyeCalibration::Default, "EyeByEyeCalibration(0)"),
+			 py::arg_v("method", Fove_CalibrationMethod::Default, "CalibrationMethod(0)"),
+			 py::arg_v("eyeTorsion", Fove_EyeTorsionCalibration::Default, "EyeTorsionCalibration(0)"))
+		.def_readwrite("lazy", &Fove_CalibrationOptions::lazy, "Do not restart the calibration process if it is already calibrated")
+		.def_readwrite("restart", &Fove_CalibrationOptions::restart, "Restart the calibration process from the beginning if it is already running")
+		.def_readwrite("eyeByEye", &Fove_CalibrationOptions::eyeByEye, "Calibrate both eyes simultaneously or separately")
+		.def_readwrite("method", &Fove_CalibrationOptions::method, "The calibration method to use")
+		.def_readwrite("eyeTorsion", &Fove_CalibrationOptions::eyeTorsion, "Whether to perform eye torsion calibration or not");
+}
+#endif // FOVE_FEATURE_CALIBRATION_GUI
+
+} // namespace FovePython
@@ -101,6 +101,10 @@ T = TypeVar("T")
 # Class containing a FOVE API call result value as well as the operation
 # error code status
 class Result(Generic[T]):
+    # Results are allocated on every wrapped API call, so keep instances small
+    # and attribute access cheap
+    __slots__ = ("_value", "_error")
+
     # Create a new Result object from a value and error code
     def __init__(self, value: T, error=capi.ErrorCode.None_) -> None:
         self._value = value
@@ -113,11 +117,11 @@ class Result(Generic[T]):
         return (self._value if self.succeeded() else self._error).__str__()
 
     def isAcceptable(self) -> bool:
-        return (
-            self.error == capi.ErrorCode.None_
-            or self.error == capi.ErrorCode.Data_LowAccuracy
-            or self.error == capi.ErrorCode.Data_Unreliable
-        )
+        # One native call against the configured error policy (see
+        # capi.set_error_policy) instead of chained Python-level enum
+        # comparisons; the default policy accepts None_, Data_LowAccuracy
+        # and Data_Unreliable as before
+        return capi.error_is_acceptable(self._error)
 
     # True if value contains valid data
     def isValid(self) -> bool:
@@ -145,6 +149,29 @@ class Result(Generic[T]):
         return self._value
 
 
+# Interned Results for the no-value error codes every getter returns while the
+# service is idle or unreachable. Such calls would otherwise allocate a fresh
+# Result of identical immutable content per call per frame; the wrappers hand
+# back these shared instances instead (their value is None, which is fine as
+# the value is meaningless whenever one of these errors is returned). Built
+# once at import.
+_IDLE_RESULTS = {
+    error: Result(None, error)
+    for error in (
+        capi.ErrorCode.Data_NoUpdate,
+        capi.ErrorCode.Connect_NotConnected,
+        capi.ErrorCode.API_NotRegistered,
+    )
+}
+
+
+# Wraps a value and error code into a Result, reusing the interned no-value
+# instances above so that idle-state polling allocates nothing
+def _result(value, error) -> Result:
+    interned = _IDLE_RESULTS.get(error)
+    return interned if interned is not None else Result(value, error)
+
+
 # Class that manages accesses to headsets
 #
 # All Headset-related API requests will be done through an instance of this class.
@@ -195,10 +222,17 @@ class Headset(object):
     # @param capabilities The desired capabilities (EyeTrackign, OrientationTracking, etc.)
     # For multiple capabilities, use arithmetic operators as in:
     # `ClientCapabilities.EyeTracking + ClientCapabilities.PositionTracking`.
+    # @param shared Whether to reuse the process-wide shared service connection.
+    # The first Headset pays the full connection handshake; further ones reuse
+    # the same underlying connection (with the union of all requested
+    # capabilities registered on it), making them effectively free. Pass False
+    # to force a private connection of its own.
     # @see Headset.__enter__
-    def __init__(self, capabilities: capi.ClientCapabilities) -> None:
+    def __init__(self, capabilities: capi.ClientCapabilities, shared: bool = True) -> None:
         # Capabilities that the user intends to use
         self._caps: capi.ClientCapabilities = capabilities
+        # Whether the underlying connection comes from the shared pool
+        self._shared: bool = shared
         # A Fove_Headset object where the address of the newly created headset
         # will be written upon success
         self._headset: capi.Fove_Headset = capi.Fove_Headset()
@@ -213,7 +247,10 @@ class Headset(object):
     # @see Headset.__exit__
     def __enter__(self) -> Headset:
         logger.debug("Creating headset: {}".format(self._caps))
-        err = capi.createHeadset(self._caps, self._headset)
+        if self._shared:
+            err = capi.acquire_shared_headset(self._caps, self._headset)
+        else:
+            err = capi.createHeadset(self._caps, self._headset)
         if err != capi.ErrorCode.None_:
             raise RuntimeError("Failed to create headset: {}".format(err))
         return self
@@ -231,7 +268,10 @@ class Headset(object):
         if _e_type is not None:
             logger.error("Headset: exception raised: {}".format(_e_val))
         if self._headset is not None:
-            capi.Headset_destroy(self._headset)
+            if self._shared:
+                capi.release_shared_headset(self._headset, self._caps)
+            else:
+                capi.Headset_destroy(self._headset)
             logger.debug("Destroyed headset")
         return True if _e_type is None else False
 
@@ -242,7 +282,7 @@ class Headset(object):
     def isHardwareConnected(self) -> Result[bool]:
         b = capi.Bool(False)
         err = capi.Headset_isHardwareConnected(self._headset, b)
-        return Result(b.val, err)
+        return _result(b.val, err)
 
     # Checks if motion tracking hardware has started
     #
@@ -250,7 +290,7 @@ class Headset(object):
     def isMotionReady(self) -> Result[bool]:
         b = capi.Bool(False)
         err = capi.Headset_isMotionReady(self._headset, b)
-        return Result(b.val, err)
+        return _result(b.val, err)
 
     # Checks whether the client can run against the installed version of the FOVE SDK.
     #
@@ -260,7 +300,7 @@ class Headset(object):
     # or an error indicating the problem otherwise
     def checkSoftwareVersions(self) -> Result[None]:
         err = capi.Headset_checkSoftwareVersions(self._headset)
-        return Result(None, err)
+        return _result(None, err)
 
     # Gets the information about the current software versions.
     #
@@ -274,7 +314,7 @@ class Headset(object):
     def querySoftwareVersions(self) -> Result[capi.Versions]:
         versions = capi.Versions()
         err = capi.Headset_querySoftwareVersions(self._headset, versions)
-        return Result(versions, err)
+        return _result(versions, err)
 
     # Returns information about any licenses currently activated
     #
@@ -290,7 +330,7 @@ class Headset(object):
     def queryLicenses(self) -> Result[List[capi.LicenseInfo]]:
         err = capi.ErrorCode.UnknownError
         list = capi.Headset_queryLicenses(self._headset, err)
-        return Result(list, err)
+        return _result(list, err)
 
     # Gets the information about the hardware information
     #
@@ -300,7 +340,7 @@ class Headset(object):
     def queryHardwareInfo(self) -> Result[capi.HeadsetHardwareInfo]:
         hardwareInfo = capi.HeadsetHardwareInfo()
         err = capi.Headset_queryHardwareInfo(self._headset, hardwareInfo)
-        return Result(hardwareInfo, err)
+        return _result(hardwareInfo, err)
 
     # Returns whether the Headset has access to the given feature
     #
@@ -312,7 +352,7 @@ class Headset(object):
     def hasAccessToFeature(self, featureName: str) -> Result[bool]:
         b = capi.Bool(False)
         err = capi.Headset_hasAccessToFeature(self._headset, featureName, b)
-        return Result(b.val, err)
+        return _result(b.val, err)
 
     # Activate by using a license key
     #
@@ -320,7 +360,7 @@ class Headset(object):
     # @return capi.ErrorCode.UnknownError if the activation failed
     def activateLicense(self, licenseKey: str) -> Result[None]:
         err = capi.Headset_activateLicense(self._headset, licenseKey)
-        return Result(None, err)
+        return _result(None, err)
 
     # Deactivate license(s)
     #
@@ -330,7 +370,7 @@ class Headset(object):
     # @return capi.ErrorCode.UnknownError if the deactivation failed
     def deactivateLicense(self, licenseData: str) -> Result[None]:
         err = capi.Headset_deactivateLicense(self._headset, licenseData)
-        return Result(None, err)
+        return _result(None, err)
 
     # Registers a client capability, enabling the required hardware as needed
     #
@@ -343,7 +383,7 @@ class Headset(object):
     # @returncapi.ErrorCode.License_FeatureAccessDenied if your license doesn't offer access to this capability
     def registerCapabilities(self, caps: capi.ClientCapabilities) -> Result[None]:
         err = capi.Headset_registerCapabilities(self._headset, caps)
-        return Result(None, err)
+        return _result(None, err)
     
     # Registers a passive client capability, enabling the required hardware as needed
     #
@@ -365,7 +405,7 @@ class Headset(object):
     # @returncapi.ErrorCode.License_FeatureAccessDenied if your license doesn't offer access to this capability
     def registerPassiveCapabilities(self, caps: capi.ClientCapabilities) -> Result[None]:
         err = capi.Headset_registerPassiveCapabilities(self._headset, caps)
-        return Result(None, err)
+        return _result(None, err)
 
     # Unregisters a client capability previously registered
     #
@@ -374,7 +414,7 @@ class Headset(object):
     # @returncapi.ErrorCode.Connect_NotConnected if not connected to the service
     def unregisterCapabilities(self, caps: capi.ClientCapabilities) -> Result[None]:
         err = capi.Headset_unregisterCapabilities(self._headset, caps)
-        return Result(None, err)
+        return _result(None, err)
 
     # Unregisters a passive client capability previously registered
     #
@@ -383,7 +423,7 @@ class Headset(object):
     # @returncapi.ErrorCode.Connect_NotConnected if not connected to the service
     def unregisterPassiveCapabilities(self, caps: capi.ClientCapabilities) -> Result[None]:
         err = capi.Headset_unregisterPassiveCapabilities(self._headset, caps)
-        return Result(None, err)
+        return _result(None, err)
 
     # Waits for next eye camera frame to be processed
     #
@@ -402,7 +442,28 @@ class Headset(object):
     # @see HeadsetfetchEyesImage
     def waitForProcessedEyeFrame(self) -> Result[None]:
         err = capi.Headset_waitForProcessedEyeFrame(self._headset)
-        return Result(None, err)
+        return _result(None, err)
+
+    # Asynchronous version of `Headset.waitForProcessedEyeFrame` for asyncio clients
+    #
+    # Returns an awaitable that resolves once the next eye camera frame has been processed,
+    # without blocking the event loop. The blocking wait happens on a single shared native
+    # worker thread, so awaiting this does not create a Python thread per call.
+    #
+    # Usage: `err = await headset.next_frame()`, where `err` is the same error code
+    # that `waitForProcessedEyeFrame` would have reported.
+    #
+    # @return An asyncio future resolving to the capi.ErrorCode of the wait
+    # @see Headset.waitForProcessedEyeFrame
+    def next_frame(self):
+        import asyncio
+
+        loop = asyncio.get_event_loop()
+        waiter = getattr(self, "_frameWaiter", None)
+        if waiter is None:
+            waiter = capi.FrameWaiter()
+            self._frameWaiter = waiter
+        return waiter.nextFrame(self._headset, loop)
 
     # Fetch the latest eye tracking related data from runtime service
     #
@@ -419,7 +480,7 @@ class Headset(object):
     def fetchEyeTrackingData(self) -> Result[capi.FrameTimestamp]:
         timestamp = capi.FrameTimestamp()
         err = capi.Headset_fetchEyeTrackingData(self._headset, timestamp)
-        return Result(timestamp, err)
+        return _result(timestamp, err)
 
     # Fetch the latest eyes camera image from the runtime service
     #
@@ -446,7 +507,7 @@ class Headset(object):
     def fetchEyesImage(self) -> Result[capi.FrameTimestamp]:
         timestamp = capi.FrameTimestamp()
         err = capi.Headset_fetchEyesImage(self._headset, timestamp)
-        return Result(timestamp, err)
+        return _result(timestamp, err)
 
     # Writes out the eye frame timestamp of the cached eyes image
     #
@@ -463,7 +524,7 @@ class Headset(object):
     def getEyeTrackingDataTimestamp(self) -> Result[capi.FrameTimestamp]:
         timestamp = capi.FrameTimestamp()
         err = capi.Headset_getEyeTrackingDataTimestamp(self._headset, timestamp)
-        return Result(timestamp, err)
+        return _result(timestamp, err)
 
     # Writes out the eye frame timestamp of the cached eyes image
     #
@@ -480,7 +541,7 @@ class Headset(object):
     def getEyesImageTimestamp(self) -> Result[capi.FrameTimestamp]:
         timestamp = capi.FrameTimestamp()
         err = capi.Headset_getEyesImageTimestamp(self._headset, timestamp)
-        return Result(timestamp, err)
+        return _result(timestamp, err)
 
     # Gets the gaze vector of an individual eye
     #
@@ -495,9 +556,8 @@ class Headset(object):
     # - capi.ErrorCode.Data_Unreliable if the returned data is too unreliable to be used
     # - capi.ErrorCode.Data_LowAccuracy if the returned data is of low accuracy
     def getGazeVector(self, eye: capi.Eye) -> Result[capi.Vec3]:
-        vec = capi.Vec3()
-        err = capi.Headset_getGazeVector(self._headset, eye, vec)
-        return Result(vec, err)
+        err, vec = capi.Headset_getGazeVectorTuple(self._headset, eye)
+        return _result(vec, err)
 
     # Gets the user's 2D gaze position on the screens seen through the HMD's lenses
     #
@@ -523,9 +583,8 @@ class Headset(object):
     # - capi.ErrorCode.Data_Unreliable if the returned data is too unreliable to be used
     # - capi.ErrorCode.Data_LowAccuracy if the returned data is of low accuracy
     def getGazeScreenPosition(self, eye: capi.Eye) -> Result[capi.Vec2]:
-        vec = capi.Vec2()
-        err = capi.Headset_getGazeScreenPosition(self._headset, eye, vec)
-        return Result(vec, err)
+        err, vec = capi.Headset_getGazeScreenPositionTuple(self._headset, eye)
+        return _result(vec, err)
 
     # Gets the user's 2D gaze position on a virtual screen in front of the user.
     #
@@ -552,9 +611,8 @@ class Headset(object):
     # - capi.ErrorCode.Data_Unreliable if the returned data is too unreliable to be used
     # - capi.ErrorCode.Data_LowAccuracy if the returned data is of low accuracy
     def getGazeScreenPositionCombined(self) -> Result[capi.Vec2]:
-        vec = capi.Vec2()
-        err = capi.Headset_getGazeScreenPositionCombined(self._headset, vec)
-        return Result(vec, err)
+        err, vec = capi.Headset_getGazeScreenPositionCombinedTuple(self._headset)
+        return _result(vec, err)
 
     # Get eyes gaze ray resulting from the two eye gazes combined together
     #
@@ -570,9 +628,8 @@ class Headset(object):
     # - capi.ErrorCode.Data_Unreliable if the returned data is too unreliable to be used
     # - capi.ErrorCode.Data_LowAccuracy if the returned data is of low accuracy
     def getCombinedGazeRay(self) -> Result[capi.Ray]:
-        ray = capi.Ray()
-        err = capi.Headset_getCombinedGazeRay(self._headset, ray)
-        return Result(ray, err)
+        err, ray = capi.Headset_getCombinedGazeRayTuple(self._headset)
+        return _result(ray, err)
 
     # Get eyes gaze depth resulting from the two eye gazes combined together
     #
@@ -586,9 +643,8 @@ class Headset(object):
     # - capi.ErrorCode.Data_Unreliable if the returned data is too unreliable to be used
     # - capi.ErrorCode.Data_LowAccuracy if the returned data is of low accuracy
     def getCombinedGazeDepth(self) -> Result[float]:
-        depth = capi.Float()
-        err = capi.Headset_getCombinedGazeDepth(self._headset, depth)
-        return Result(depth.val, err)
+        err, depth = capi.Headset_getCombinedGazeDepthTuple(self._headset)
+        return _result(depth, err)
 
     # Get whether the user is shifting its attention between objects or looking at something specific (fixation or pursuit).
     #
@@ -606,7 +662,7 @@ class Headset(object):
     def isUserShiftingAttention(self) -> Result[bool]:
         b = capi.Bool()
         err = capi.Headset_isUserShiftingAttention(self._headset, b)
-        return Result(b.val, err)
+        return _result(b.val, err)
 
     # Get the state of an individual eye
     #
@@ -621,9 +677,8 @@ class Headset(object):
     # - capi.ErrorCode.Data_Unreliable if the returned data is too unreliable to be used
     # - capi.ErrorCode.Data_LowAccuracy if the returned data is of low accuracy
     def getEyeState(self, eye: capi.Eye) -> Result[capi.EyeState]:
-        b = capi.EyeStateObj()
-        err = capi.Headset_getEyeState(self._headset, eye, b)
-        return Result(b.val, err)
+        err, state = capi.Headset_getEyeStateTuple(self._headset, eye)
+        return _result(state, err)
 
     # Checks if eye tracking hardware has started
     #
@@ -634,7 +689,7 @@ class Headset(object):
     def isEyeTrackingEnabled(self) -> Result[bool]:
         b = capi.Bool(False)
         err = capi.Headset_isEyeTrackingEnabled(self._headset, b)
-        return Result(b.val, err)
+        return _result(b.val, err)
 
     # Checks if eye tracking has been calibrated
     #
@@ -648,7 +703,7 @@ class Headset(object):
     def isEyeTrackingCalibrated(self) -> Result[bool]:
         b = capi.Bool(False)
         err = capi.Headset_isEyeTrackingCalibrated(self._headset, b)
-        return Result(b.val, err)
+        return _result(b.val, err)
 
     # Checks if eye tracking is in the process of calibration
     #
@@ -662,7 +717,7 @@ class Headset(object):
     def isEyeTrackingCalibrating(self) -> Result[bool]:
         b = capi.Bool(False)
         err = capi.Headset_isEyeTrackingCalibrating(self._headset, b)
-        return Result(b.val, err)
+        return _result(b.val, err)
 
     # Check whether the eye tracking system is currently calibrated for glasses.
     #
@@ -680,7 +735,7 @@ class Headset(object):
     def isEyeTrackingCalibratedForGlasses(self) -> Result[bool]:
         b = capi.Bool(False)
         err = capi.Headset_isEyeTrackingCalibratedForGlasses(self._headset, b)
-        return Result(b.val, err)
+        return _result(b.val, err)
 
     # Check whether or not the GUI that asks the user to adjust their headset is being displayed
     #
@@ -694,7 +749,7 @@ class Headset(object):
     def isHmdAdjustmentGuiVisible(self) -> Result[bool]:
         b = capi.Bool(False)
         err = capi.Headset_isHmdAdjustmentGuiVisible(self._headset, b)
-        return Result(b.val, err)
+        return _result(b.val, err)
 
     # Check whether the GUI that asks the user to adjust their headset was hidden by timeout
     #
@@ -708,7 +763,7 @@ class Headset(object):
     def hasHmdAdjustmentGuiTimeout(self) -> Result[bool]:
         b = capi.Bool(False)
         err = capi.Headset_hasHmdAdjustmentGuiTimeout(self._headset, b)
-        return Result(b.val, err)
+        return _result(b.val, err)
 
     # Checks if eye tracking is actively tracking an eye - or eyes.
     #
@@ -724,7 +779,7 @@ class Headset(object):
     def isEyeTrackingReady(self) -> Result[bool]:
         b = capi.Bool(False)
         err = capi.Headset_isEyeTrackingReady(self._headset, b)
-        return Result(b.val, err)
+        return _result(b.val, err)
 
     # Checks whether the user is wearing the headset or not
     #
@@ -742,7 +797,7 @@ class Headset(object):
     def isUserPresent(self) -> Result[bool]:
         b = capi.Bool(False)
         err = capi.Headset_isUserPresent(self._headset, b)
-        return Result(b.val, err)
+        return _result(b.val, err)
 
     # Returns the eyes camera image
     #
@@ -761,7 +816,7 @@ class Headset(object):
     def getEyesImage(self) -> Result[capi.BitmapImage]:
         b = capi.BitmapImage()
         err = capi.Headset_getEyesImage(self._headset, b)
-        return Result(b, err)
+        return _result(b, err)
 
     # Returns the user IPD (Inter Pupillary Distance), in meters
     #
@@ -777,7 +832,7 @@ class Headset(object):
     def getUserIPD(self) -> Result[float]:
         b = capi.Float()
         err = capi.Headset_getUserIPD(self._headset, b)
-        return Result(b.val, err)
+        return _result(b.val, err)
 
     # Returns the user IOD (Inter Occular Distance), in meters
     #
@@ -793,7 +848,7 @@ class Headset(object):
     def getUserIOD(self) -> Result[float]:
         b = capi.Float()
         err = capi.Headset_getUserIOD(self._headset, b)
-        return Result(b.val, err)
+        return _result(b.val, err)
 
     # Returns the user pupils radius, in meters
     #
@@ -808,9 +863,8 @@ class Headset(object):
     # - capi.ErrorCode.Data_Unreliable if the returned data is too unreliable to be used
     # - capi.ErrorCode.Data_LowAccuracy if the returned data is of low accuracy
     def getPupilRadius(self, eye: capi.Eye) -> Result[float]:
-        b = capi.Float()
-        err = capi.Headset_getPupilRadius(self._headset, eye, b)
-        return Result(b.val, err)
+        err, radius = capi.Headset_getPupilRadiusTuple(self._headset, eye)
+        return _result(radius, err)
 
     # Returns the user iris radius, in meters
     #
@@ -825,9 +879,8 @@ class Headset(object):
     # - capi.ErrorCode.Data_Unreliable if the returned data is too unreliable to be used
     # - capi.ErrorCode.Data_LowAccuracy if the returned data is of low accuracy
     def getIrisRadius(self, eye: capi.Eye) -> Result[float]:
-        b = capi.Float()
-        err = capi.Headset_getIrisRadius(self._headset, eye, b)
-        return Result(b.val, err)
+        err, radius = capi.Headset_getIrisRadiusTuple(self._headset, eye)
+        return _result(radius, err)
 
     # Returns the user eyeballs radius, in meters
     #
@@ -842,9 +895,8 @@ class Headset(object):
     # - capi.ErrorCode.Data_Unreliable if the returned data is too unreliable to be used
     # - capi.ErrorCode.Data_LowAccuracy if the returned data is of low accuracy
     def getEyeballRadius(self, eye: capi.Eye) -> Result[float]:
-        b = capi.Float()
-        err = capi.Headset_getEyeballRadius(self._headset, eye, b)
-        return Result(b.val, err)
+        err, radius = capi.Headset_getEyeballRadiusTuple(self._headset, eye)
+        return _result(radius, err)
 
     # Returns the user eye torsion, in degrees
     #
@@ -861,9 +913,8 @@ class Headset(object):
     # - capi.ErrorCode.API_NullInPointer if both `outAngle` is `nullptr`
     # - capi.ErrorCode.License_FeatureAccessDenied if the current license is not sufficient for this feature
     def getEyeTorsion(self, eye: capi.Eye) -> Result[float]:
-        b = capi.Float()
-        err = capi.Headset_getEyeTorsion(self._headset, eye, b)
-        return Result(b.val, err)
+        err, angle = capi.Headset_getEyeTorsionTuple(self._headset, eye)
+        return _result(angle, err)
 
     # Returns the outline shape of the specified user eye in the Eyes camera image.
     #
@@ -882,7 +933,7 @@ class Headset(object):
     def getEyeShape(self, eye: capi.Eye) -> Result[capi.EyeShape]:
         b = capi.EyeShape()
         err = capi.Headset_getEyeShape(self._headset, eye, b)
-        return Result(b, err)
+        return _result(b, err)
 
     # Returns the pupil ellipse of the specified user eye in the Eyes camera image.
     #
@@ -900,7 +951,7 @@ class Headset(object):
     def getPupilShape(self, eye: capi.Eye) -> Result[capi.PupilShape]:
         b = capi.PupilShape()
         err = capi.Headset_getPupilShape(self._headset, eye, b)
-        return Result(b, err)
+        return _result(b, err)
 
     # Starts eye tracking calibration
     #
@@ -917,7 +968,7 @@ class Headset(object):
         if not options:
             options = capi.CalibrationOptions()
         err = capi.Headset_startEyeTrackingCalibration(self._headset, options)
-        return Result(None, err)
+        return _result(None, err)
 
     # Stops eye tracking calibration if it's running, does nothing if it's not running
     #
@@ -928,7 +979,7 @@ class Headset(object):
     # @return capi.ErrorCode.Connect_NotConnected if not connected to the service
     def stopEyeTrackingCalibration(self) -> Result[None]:
         err = capi.Headset_stopEyeTrackingCalibration(self._headset)
-        return Result(None, err)
+        return _result(None, err)
 
     # Get the state of the currently running calibration process
     #
@@ -942,7 +993,7 @@ class Headset(object):
     def getEyeTrackingCalibrationState(self) -> Result[capi.CalibrationState]:
         s = capi.CalibrationStateObj()
         err = capi.Headset_getEyeTrackingCalibrationState(self._headset, s)
-        return Result(s.val, err)
+        return _result(s.val, err)
 
     # Tick the current calibration process and retrieve data information to render the current calibration state.
     #
@@ -975,7 +1026,7 @@ class Headset(object):
         err = capi.Headset_tickEyeTrackingCalibration(
             self._headset, deltaTime, isVisible, s
         )
-        return Result(s, err)
+        return _result(s, err)
 
     # Get the id of the object gazed by the user.
     #
@@ -996,7 +1047,7 @@ class Headset(object):
     def getGazedObjectId(self) -> Result[int]:
         s = capi.Int()
         err = capi.Headset_getGazedObjectId(self._headset, s)
-        return Result(s.val, err)
+        return _result(s.val, err)
 
     # Registers an object in the 3D world
     #
@@ -1017,7 +1068,7 @@ class Headset(object):
     # @see Headset.Fove_GazeConvergenceData
     def registerGazableObject(self, gazableObject: capi.GazableObject) -> Result[None]:
         err = capi.Headset_registerGazableObject(self._headset, gazableObject)
-        return Result(None, err)
+        return _result(None, err)
 
     # Update a previously registered 3D object pose.
     #
@@ -1029,7 +1080,7 @@ class Headset(object):
     # @see Headset.removeGazableObject
     def updateGazableObject(self, objectId: int, pose: capi.ObjectPose) -> Result[None]:
         err = capi.Headset_updateGazableObject(self._headset, objectId, pose)
-        return Result(None, err)
+        return _result(None, err)
 
     # Removes a previously registered 3D object from the scene.
     #
@@ -1042,7 +1093,7 @@ class Headset(object):
     # @see Headset.updateGazableObject
     def removeGazableObject(self, objectId: int) -> Result[None]:
         err = capi.Headset_removeGazableObject(self._headset, objectId)
-        return Result(None, err)
+        return _result(None, err)
 
     # Registers an camera in the 3D world
     #
@@ -1064,7 +1115,7 @@ class Headset(object):
     # @see Headset.removeCameraObject
     def registerCameraObject(self, cameraObject: capi.CameraObject) -> Result[None]:
         err = capi.Headset_registerCameraObject(self._headset, cameraObject)
-        return Result(None, err)
+        return _result(None, err)
 
     # Update the pose of a registered camera
     #
@@ -1076,7 +1127,7 @@ class Headset(object):
     # @see Headset.removeCameraObject
     def updateCameraObject(self, cameraId: int, pose: capi.ObjectPose) -> Result[None]:
         err = capi.Headset_updateCameraObject(self._headset, cameraId, pose)
-        return Result(None, err)
+        return _result(None, err)
 
     # Removes a previously registered camera from the scene.
     #
@@ -1087,7 +1138,7 @@ class Headset(object):
     # @see Headset.updateCameraObject
     def removeCameraObject(self, cameraId: int) -> Result[None]:
         err = capi.Headset_removeCameraObject(self._headset, cameraId)
-        return Result(None, err)
+        return _result(None, err)
 
     # Tares the orientation of the headset
     #
@@ -1099,7 +1150,7 @@ class Headset(object):
     # @return capi.ErrorCode.Connect_NotConnected if not connected to the service
     def tareOrientationSensor(self) -> Result[None]:
         err = capi.Headset_tareOrientationSensor(self._headset)
-        return Result(None, err)
+        return _result(None, err)
 
     # Writes out whether position tracking hardware has started and returns whether it was successful
     #
@@ -1113,7 +1164,7 @@ class Headset(object):
     def isPositionReady(self) -> Result[bool]:
         b = capi.Bool(False)
         err = capi.Headset_isPositionReady(self._headset, b)
-        return Result(b.val, err)
+        return _result(b.val, err)
 
     # Tares the position of the headset
     #
@@ -1124,7 +1175,7 @@ class Headset(object):
     # @return capi.ErrorCode.Connect_NotConnected if not connected to the service
     def tarePositionSensors(self) -> Result[None]:
         err = capi.Headset_tarePositionSensors(self._headset)
-        return Result(None, err)
+        return _result(None, err)
 
     # Fetch the latest headset pose related data from runtime service
     #
@@ -1143,7 +1194,7 @@ class Headset(object):
     def fetchPoseData(self) -> Result[capi.FrameTimestamp]:
         b = capi.FrameTimestamp()
         err = capi.Headset_fetchPoseData(self._headset, b)
-        return Result(b, err)
+        return _result(b, err)
 
     # Writes out the pose of the head-mounted display
     #
@@ -1157,7 +1208,7 @@ class Headset(object):
     def getPose(self) -> Result[capi.Pose]:
         pose = capi.Pose()
         err = capi.Headset_getPose(self._headset, pose)
-        return Result(pose, err)
+        return _result(pose, err)
 
     # Returns the position camera image
     #
@@ -1176,7 +1227,7 @@ class Headset(object):
     def getPositionImage(self) -> Result[capi.BitmapImage]:
         i = capi.BitmapImage()
         err = capi.Headset_getPositionImage(self._headset, i)
-        return Result(i, err)
+        return _result(i, err)
 
     # Gets the valoues of passed-in left-handed 4x4 projection matrices
     #
@@ -1200,7 +1251,7 @@ class Headset(object):
         err = capi.Headset_getProjectionMatricesLH(
             self._headset, zNear, zFar, lMat, rMat
         )
-        return Result((lMat, rMat), err)
+        return _result((lMat, rMat), err)
 
     # Gets the valoues of passed-in right-handed 4x4 projection matrices
     #
@@ -1224,7 +1275,7 @@ class Headset(object):
         err = capi.Headset_getProjectionMatricesRH(
             self._headset, zNear, zFar, lMat, rMat
         )
-        return Result((lMat, rMat), err)
+        return _result((lMat, rMat), err)
 
     # Gets values for the view frustum of both eyes at 1 unit away
     #
@@ -1242,7 +1293,7 @@ class Headset(object):
     ) -> Result[Tuple[capi.ProjectionParams, capi.ProjectionParams]]:
         lParams, rParams = capi.ProjectionParams(), capi.ProjectionParams()
         err = capi.Headset_getRawProjectionValues(self._headset, lParams, rParams)
-        return Result((lParams, rParams), err)
+        return _result((lParams, rParams), err)
 
     # Gets the matrices to convert from eye- to head-space coordintes.
     #
@@ -1255,7 +1306,7 @@ class Headset(object):
     def getEyeToHeadMatrices(self) -> Result[Tuple[capi.Matrix44, capi.Matrix44]]:
         lMat, rMat = capi.Matrix44(), capi.Matrix44()
         err = capi.Headset_getEyeToHeadMatrices(self._headset, lMat, rMat)
-        return Result((lMat, rMat), err)
+        return _result((lMat, rMat), err)
 
     # Gets interocular distance in meters
     #
@@ -1271,7 +1322,7 @@ class Headset(object):
     def getRenderIOD(self) -> Result[float]:
         iod = capi.Float(-1.0)
         err = capi.Headset_getRenderIOD(self._headset, iod)
-        return Result(iod.val, err)
+        return _result(iod.val, err)
 
     # Creates a new profile
     #
@@ -1293,7 +1344,7 @@ class Headset(object):
     # @see Headset.queryProfileDataPath
     def createProfile(self, profileName: str) -> Result[None]:
         err = capi.Headset_createProfile(self._headset, profileName)
-        return Result(None, err)
+        return _result(None, err)
 
     # Renames an existing profile
     #
@@ -1313,7 +1364,7 @@ class Headset(object):
     # @see Headset.queryProfileDataPath
     def renameProfile(self, oldName: str, newName: str) -> Result[None]:
         err = capi.Headset_renameProfile(self._headset, oldName, newName)
-        return Result(None, err)
+        return _result(None, err)
 
     # Lists all existing profiles
     #
@@ -1326,10 +1377,10 @@ class Headset(object):
     # @see Headset.setCurrentProfile
     # @see Headset.queryCurrentProfile
     # @see Headset.queryProfileDataPath
-    def listProfiles(self) -> Result[List[str]]:
+    def listProfiles(self) -> Result[Tuple[str, ...]]:
         err = capi.ErrorCode.UnknownError
-        list = capi.Headset_listProfiles(self._headset, err)
-        return Result(list, err)
+        names = capi.Headset_listProfiles(self._headset, err)
+        return _result(names, err)
 
     # Sets the current profile
     #
@@ -1352,7 +1403,7 @@ class Headset(object):
     # @see Headset.queryProfileDataPath
     def setCurrentProfile(self, profileName: str) -> Result[None]:
         err = capi.Headset_setCurrentProfile(self._headset, profileName)
-        return Result(None, err)
+        return _result(None, err)
 
     # Gets the current profile
     #
@@ -1370,7 +1421,7 @@ class Headset(object):
     def queryCurrentProfile(self) -> Result[str]:
         s = capi.String()
         err = capi.Headset_queryCurrentProfile(self._headset, s)
-        return Result(s.val, err)
+        return _result(s.val, err)
 
     # Gets the data folder for a given profile
     #
@@ -1399,7 +1450,7 @@ class Headset(object):
     def queryProfileDataPath(self, profileName: str) -> Result[str]:
         s = capi.String()
         err = capi.Headset_queryProfileDataPath(self._headset, profileName, s)
-        return Result(s.val, err)
+        return _result(s.val, err)
 
     # Returns a compositor interface from the given headset
     #
@@ -1595,6 +1646,45 @@ class Compositor(object):
             return None
         return b.val
 
+    # Blocks until the compositor is ready to accept frames
+    #
+    # Replaces the startup sleep-poll loop around `Compositor.isReady`: the readiness
+    # poll runs natively at millisecond granularity with the GIL released, so startup
+    # proceeds as soon as the compositor answers instead of after the next Python sleep.
+    #
+    # @param timeout_us Give up after this long, in microseconds; 0 waits indefinitely
+    # @return True once the compositor is ready, False if the timeout lapsed or the
+    # readiness query failed (the error is logged)
+    def waitUntilReady(self, timeout_us: int = 0) -> bool:
+        err = capi.Compositor_waitUntilReady(self._compositor, timeout_us)
+        if err == capi.ErrorCode.None_:
+            return True
+        if err != capi.ErrorCode.API_Timeout:
+            logger.error("compositor.waitUntilReady() failed: {}".format(err))
+        return False
+
+    # Asynchronous version of `Compositor.waitUntilReady` for asyncio clients
+    #
+    # Returns an awaitable that resolves once the compositor accepts frames, without
+    # blocking the event loop. The native readiness polls happen on a single shared
+    # worker thread, so awaiting this does not create a Python thread per call.
+    #
+    # Usage: `err = await compositor.until_ready()`, where `err` is the same error
+    # code that `waitUntilReady` reacts to (None_ on ready, API_Timeout on timeout).
+    #
+    # @param timeout_us Give up after this long, in microseconds; 0 waits indefinitely
+    # @return An asyncio future resolving to the capi.ErrorCode of the wait
+    # @see Compositor.waitUntilReady
+    def until_ready(self, timeout_us: int = 0):
+        import asyncio
+
+        loop = asyncio.get_event_loop()
+        waiter = getattr(self, "_compositorWaiter", None)
+        if waiter is None:
+            waiter = capi.CompositorWaiter()
+            self._compositorWaiter = waiter
+        return waiter.untilReady(self._compositor, loop, timeout_us)
+
     # Returns the ID of the GPU currently attached to the headset
     #
     # For systems with multiple GPUs, submitted textures to the compositor must
@@ -1641,6 +1731,19 @@ def connectToHeadset(headset: capi.Fove_Headset, caps: capi.ClientCapabilities)
     return iter < maxIter
 
 
+# The build generates specialized overrides for the hottest scalar getters
+# (src/gen_fastpaths.py, run by a POST_BUILD rule): identical signatures,
+# docstrings and Result semantics, but the scalar out-param holder is cached
+# per Headset instance instead of constructed per call. Running from a source
+# checkout without a build keeps the plain wrappers above.
+try:
+    from . import _fastpaths
+except ImportError:
+    pass
+else:
+    _fastpaths.install(Headset, _result, capi)
+
+
 if __name__ == "__main__":
     import numpy as np
 
@@ -0,0 +1,222 @@
+// Lazy-loading trampolines for the libFoveClient surface used by the bindings.
+//
+// The module no longer links the client library eagerly: every fove_* call
+// lands in one of the trampolines below, which resolves the real entry point
+// from the runtime library on first use. `import fove.capi` therefore pays no
+// dynamic-link or service-discovery cost, and machines without the SDK can
+// still use everything that does not touch a headset (recorder files, replay,
+// batch math, the relay codec, ...). The entry points are declared noexcept,
+// so a missing runtime cannot raise: calls that need it return
+// #Fove_ErrorCode_Connect_NotConnected (after one stderr note), which is what
+// callers already handle for a service that is not running.
+//
+// The library is searched by soname first, then next to this module (the
+// build copies libFoveClient.so / FoveClient.dll into the package directory).
+//
+// One FOVE_LAZY line per imported symbol, in name order; the compiler checks
+// each signature against the FoveAPI.h declaration, so a mismatch here fails
+// the build rather than corrupting a call. Regenerate the list against
+// `nm -D --undefined-only capi.so` when the bindings start using new entry
+// points.
+
+#define FOVE_DEFINE_CXX_API 0
+#define FOVE_CXX_NAMESPACE SHOULD_CAUSE_SYNTAX_ERROR_WHEN_USED !
+#define FOVE_EXTERN_C extern "C"
+#define FOVE_ENUM(enumName) enum class Fove_##enumName
+#define FOVE_ENUM_VAL(enumName, valueName) valueName
+#define FOVE_ENUM_END(enumName) ;
+#define FOVE_STRUCT(structName) struct Fove_##structName
+#define FOVE_STRUCT_VAL(memberName, defaultVal) memberName;
+#define FOVE_STRUCT_END(structName) ;
+#define FOVE_STRUCT_END_NO_CXX_ALIAS(structName) ;
+#include <FoveAPI.h>
+
+#include <cstdio>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+namespace
+{
+
+#ifdef _WIN32
+
+void* loadFoveClient()
+{
+	return reinterpret_cast<void*>(LoadLibraryA("FoveClient.dll"));
+}
+
+void* findSymbol(void* const library, const char* const name)
+{
+	return reinterpret_cast<void*>(GetProcAddress(static_cast<HMODULE>(library), name));
+}
+
+#else
+
+void* loadFoveClient()
+{
+	if (void* const handle = dlopen("libFoveClient.so", RTLD_NOW | RTLD_LOCAL))
+		return handle;
+	// Not on the default search path: try next to this module, where the
+	// build copies the runtime library
+	Dl_info info = {};
+	if (dladdr(reinterpret_cast<void*>(&loadFoveClient), &info) && info.dli_fname)
+	{
+		std::string path = info.dli_fname;
+		const size_t slash = path.rfind('/');
+		if (slash != std::string::npos)
+		{
+			path.replace(slash + 1, std::string::npos, "libFoveClient.so");
+			return dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+		}
+	}
+	return nullptr;
+}
+
+void* findSymbol(void* const library, const char* const name)
+{
+	return dlsym(library, name);
+}
+
+#endif
+
+// Loads the client library once and resolves one entry point; called from a
+// trampoline on its first invocation. Returns null (noisily, once per cause)
+// when the runtime is missing or too old, in which case the trampoline
+// reports Connect_NotConnected to its caller.
+void* resolveFoveSymbol(const char* const name)
+{
+	static void* const library = [] {
+		void* const handle = loadFoveClient();
+		if (!handle)
+			std::fprintf(stderr, "fove.capi: the FoveClient runtime library was not found; "
+								 "headset functions will report Connect_NotConnected\n");
+		return handle;
+	}();
+	if (!library)
+		return nullptr;
+	void* const symbol = findSymbol(library, name);
+	if (!symbol)
+		std::fprintf(stderr, "fove.capi: the installed FoveClient library does not provide %s "
+							 "(it is probably older than these bindings)\n",
+					 name);
+	return symbol;
+}
+
+} // namespace
+
+// Each trampoline resolves its target on first call and caches the pointer in
+// a function-local static (thread-safe per the C++11 rules)
+#define FOVE_LAZY(Ret, name, params, args) \
+	extern "C" Ret name params FOVE_NOEXCEPT \
+	{ \
+		static const auto real = reinterpret_cast<Ret(*) params>(resolveFoveSymbol(#name)); \
+		if (!real) \
+			return Fove_ErrorCode::Connect_NotConnected; \
+		return real args; \
+	}
+
+FOVE_LAZY(Fove_ErrorCode, fove_Compositor_createLayer, (Fove_Compositor* a0, const Fove_CompositorLayerCreateInfo* a1, Fove_CompositorLayer* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Compositor_destroy, (Fove_Compositor* a0), (a0))
+FOVE_LAZY(Fove_ErrorCode, fove_Compositor_getLastRenderPose, (Fove_Compositor* a0, Fove_Pose* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Compositor_isReady, (Fove_Compositor* a0, bool* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Compositor_queryAdapterId, (Fove_Compositor* a0, Fove_AdapterId* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Compositor_submit, (Fove_Compositor* a0, const Fove_CompositorLayerSubmitInfo* a1, size_t a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Compositor_waitForRenderPose, (Fove_Compositor* a0, Fove_Pose* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Config_clearValue, (const char* a0), (a0))
+FOVE_LAZY(Fove_ErrorCode, fove_Config_getValue_bool, (const char* a0, bool* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Config_getValue_float, (const char* a0, float* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Config_getValue_int, (const char* a0, int* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Config_getValue_string, (const char* a0, void(FOVE_CALLBACK* a1)(const char* value, void* callbackData), void* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Config_setValue_bool, (const char* a0, bool a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Config_setValue_float, (const char* a0, float a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Config_setValue_int, (const char* a0, int a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Config_setValue_string, (const char* a0, const char* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_activateLicense, (Fove_Headset* a0, const char* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_checkSoftwareVersions, (Fove_Headset* a0), (a0))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_createCompositor, (Fove_Headset* a0, Fove_Compositor** a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_createProfile, (Fove_Headset* a0, const char* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_deactivateLicense, (Fove_Headset* a0, const char* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_deleteProfile, (Fove_Headset* a0, const char* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_destroy, (Fove_Headset* a0), (a0))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_fetchEyeTrackingData, (Fove_Headset* a0, Fove_FrameTimestamp* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_fetchEyesImage, (Fove_Headset* a0, Fove_FrameTimestamp* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_fetchPoseData, (Fove_Headset* a0, Fove_FrameTimestamp* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_fetchPositionImage, (Fove_Headset* a0, Fove_FrameTimestamp* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getCombinedGazeDepth, (Fove_Headset* a0, float* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getCombinedGazeRay, (Fove_Headset* a0, Fove_Ray* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getEyeBlinkCount, (Fove_Headset* a0, Fove_Eye a1, int* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getEyeShape, (Fove_Headset* a0, Fove_Eye a1, Fove_EyeShape* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getEyeState, (Fove_Headset* a0, Fove_Eye a1, Fove_EyeState* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getEyeToHeadMatrices, (Fove_Headset* a0, Fove_Matrix44* a1, Fove_Matrix44* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getEyeTorsion, (Fove_Headset* a0, Fove_Eye a1, float* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getEyeTrackingCalibrationState, (Fove_Headset* a0, Fove_CalibrationState* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getEyeTrackingCalibrationStateDetails, (Fove_Headset* a0, void(FOVE_CALLBACK* a1)(const Fove_CalibrationData* detailsData, void* callbackData), void* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getEyeTrackingDataTimestamp, (Fove_Headset* a0, Fove_FrameTimestamp* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getEyeballRadius, (Fove_Headset* a0, Fove_Eye a1, float* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getEyesImage, (Fove_Headset* a0, Fove_BitmapImage* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getEyesImageTimestamp, (Fove_Headset* a0, Fove_FrameTimestamp* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getGazeScreenPosition, (Fove_Headset* a0, Fove_Eye a1, Fove_Vec2* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getGazeScreenPositionCombined, (Fove_Headset* a0, Fove_Vec2* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getGazeVector, (Fove_Headset* a0, Fove_Eye a1, Fove_Vec3* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getGazeVectorRaw, (Fove_Headset* a0, Fove_Eye a1, Fove_Vec3* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getGazedObjectId, (Fove_Headset* a0, int* const a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getIrisRadius, (Fove_Headset* a0, Fove_Eye a1, float* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getPose, (Fove_Headset* a0, Fove_Pose* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getPoseDataTimestamp, (Fove_Headset* a0, Fove_FrameTimestamp* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getPositionImage, (Fove_Headset* a0, Fove_BitmapImage* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getPositionImageTimestamp, (Fove_Headset* a0, Fove_FrameTimestamp* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getProjectionMatricesLH, (Fove_Headset* a0, float a1, float a2, Fove_Matrix44* a3, Fove_Matrix44* a4), (a0, a1, a2, a3, a4))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getProjectionMatricesRH, (Fove_Headset* a0, float a1, float a2, Fove_Matrix44* a3, Fove_Matrix44* a4), (a0, a1, a2, a3, a4))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getPupilRadius, (Fove_Headset* a0, Fove_Eye a1, float* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getPupilShape, (Fove_Headset* a0, Fove_Eye a1, Fove_PupilShape* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getRawProjectionValues, (Fove_Headset* a0, Fove_ProjectionParams* a1, Fove_ProjectionParams* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getRenderIOD, (Fove_Headset* a0, float* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getUserIOD, (Fove_Headset* a0, float* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_getUserIPD, (Fove_Headset* a0, float* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_hasAccessToFeature, (Fove_Headset* a0, const char* a1, bool* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_hasHmdAdjustmentGuiTimeout, (Fove_Headset* a0, bool* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_isEyeBlinking, (Fove_Headset* a0, Fove_Eye a1, bool* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_isEyeTrackingCalibrated, (Fove_Headset* a0, bool* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_isEyeTrackingCalibratedForGlasses, (Fove_Headset* a0, bool* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_isEyeTrackingCalibrating, (Fove_Headset* a0, bool* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_isEyeTrackingEnabled, (Fove_Headset* a0, bool* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_isEyeTrackingReady, (Fove_Headset* a0, bool* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_isHardwareConnected, (Fove_Headset* a0, bool* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_isHmdAdjustmentGuiVisible, (Fove_Headset* a0, bool* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_isMotionReady, (Fove_Headset* a0, bool* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_isPositionReady, (Fove_Headset* a0, bool* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_isUserPresent, (Fove_Headset* a0, bool* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_isUserShiftingAttention, (Fove_Headset* a0, bool* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_listProfiles, (Fove_Headset* a0, void(FOVE_CALLBACK* a1)(const char* callbackProfileName, void* callbackData), void* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_queryCurrentProfile, (Fove_Headset* a0, void(FOVE_CALLBACK* a1)(const char* callbackProfileName, void* callbackData), void* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_queryHardwareInfo, (Fove_Headset* a0, Fove_HeadsetHardwareInfo* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_queryLicenses, (Fove_Headset* a0, Fove_LicenseInfo* a1, size_t* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_queryProfileDataPath, (Fove_Headset* a0, const char* a1, void(FOVE_CALLBACK* a2)(const char* callbackProfileName, void* callbackData), void* a3), (a0, a1, a2, a3))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_querySoftwareVersions, (Fove_Headset* a0, Fove_Versions* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_registerCameraObject, (Fove_Headset* a0, const Fove_CameraObject* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_registerCapabilities, (Fove_Headset* a0, Fove_ClientCapabilities a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_registerGazableObject, (Fove_Headset* a0, const Fove_GazableObject* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_registerPassiveCapabilities, (Fove_Headset* a0, Fove_ClientCapabilities a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_removeCameraObject, (Fove_Headset* a0, int a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_removeGazableObject, (Fove_Headset* a0, int a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_renameProfile, (Fove_Headset* a0, const char* a1, const char* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_setCurrentProfile, (Fove_Headset* a0, const char* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_startEyeTrackingCalibration, (Fove_Headset* a0, const Fove_CalibrationOptions* a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_startHmdAdjustmentProcess, (Fove_Headset* a0, bool a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_stopEyeTrackingCalibration, (Fove_Headset* a0), (a0))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_tareOrientationSensor, (Fove_Headset* a0), (a0))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_tarePositionSensors, (Fove_Headset* a0), (a0))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_tickEyeTrackingCalibration, (Fove_Headset* a0, float a1, bool a2, void(FOVE_CALLBACK* a3)(const Fove_CalibrationData* calibrationData, void* callbackData), void* a4), (a0, a1, a2, a3, a4))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_tickHmdAdjustmentProcess, (Fove_Headset* a0, float a1, bool a2, Fove_HmdAdjustmentData* a3), (a0, a1, a2, a3))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_unregisterCapabilities, (Fove_Headset* a0, Fove_ClientCapabilities a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_unregisterPassiveCapabilities, (Fove_Headset* a0, Fove_ClientCapabilities a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_updateCameraObject, (Fove_Headset* a0, int a1, const Fove_ObjectPose* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_updateGazableObject, (Fove_Headset* a0, int a1, const Fove_ObjectPose* a2), (a0, a1, a2))
+FOVE_LAZY(Fove_ErrorCode, fove_Headset_waitForProcessedEyeFrame, (Fove_Headset* a0), (a0))
+FOVE_LAZY(Fove_ErrorCode, fove_createHeadset, (Fove_ClientCapabilities a0, Fove_Headset** a1), (a0, a1))
+FOVE_LAZY(Fove_ErrorCode, fove_logText, (Fove_LogLevel a0, const char* a1), (a0, a1))
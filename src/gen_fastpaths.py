@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+# Build-time generator for fove/_fastpaths.py (see the POST_BUILD rule in
+# CMakeLists.txt).
+#
+# fove/headset.py hand-writes one wrapper per capi function; for the hot
+# per-frame scalar getters the wrapper overhead is dominated by constructing a
+# fresh out-param holder (capi.Bool/Float/Int) on every call. This script
+# emits specialized overrides for those methods that cache one holder of each
+# scalar type per Headset instance, with identical signatures, docstrings and
+# Result semantics (including the interned idle-state Results of headset.py's
+# _result helper); headset.py installs them when present and keeps its plain
+# wrappers otherwise.
+#
+# Only scalar holders are eligible: their `.val` is returned by value, so a
+# reused holder can never alias the value captured in an earlier Result.
+# Struct holders (FrameTimestamp etc.) return `.val` by reference and must
+# keep constructing per call.
+#
+# The spec below is validated against the m.def declarations in bindings.cpp,
+# so a renamed or removed binding fails the build here instead of drifting
+# apart from the wrapper layer silently.
+
+import re
+import sys
+
+# (method on fove.headset.Headset, capi function, scalar holder constructor)
+SPEC = [
+    ("isHardwareConnected", "Headset_isHardwareConnected", "Bool"),
+    ("isMotionReady", "Headset_isMotionReady", "Bool"),
+    ("isUserShiftingAttention", "Headset_isUserShiftingAttention", "Bool"),
+    ("isEyeTrackingEnabled", "Headset_isEyeTrackingEnabled", "Bool"),
+    ("isEyeTrackingCalibrated", "Headset_isEyeTrackingCalibrated", "Bool"),
+    ("isEyeTrackingCalibrating", "Headset_isEyeTrackingCalibrating", "Bool"),
+    (
+        "isEyeTrackingCalibratedForGlasses",
+        "Headset_isEyeTrackingCalibratedForGlasses",
+        "Bool",
+    ),
+    ("isHmdAdjustmentGuiVisible", "Headset_isHmdAdjustmentGuiVisible", "Bool"),
+    ("hasHmdAdjustmentGuiTimeout", "Headset_hasHmdAdjustmentGuiTimeout", "Bool"),
+    ("isEyeTrackingReady", "Headset_isEyeTrackingReady", "Bool"),
+    ("isUserPresent", "Headset_isUserPresent", "Bool"),
+    ("isPositionReady", "Headset_isPositionReady", "Bool"),
+    ("getUserIPD", "Headset_getUserIPD", "Float"),
+    ("getUserIOD", "Headset_getUserIOD", "Float"),
+    ("getGazedObjectId", "Headset_getGazedObjectId", "Int"),
+]
+
+HOLDER_ATTR = {"Bool": "_fph_bool", "Float": "_fph_float", "Int": "_fph_int"}
+HOLDER_INIT = {"Bool": "Bool(False)", "Float": "Float()", "Int": "Int()"}
+
+HEADER = '''\
+# Generated by src/gen_fastpaths.py at build time -- do not edit.
+#
+# Specialized overrides for the hot scalar getters of fove.headset.Headset:
+# identical signatures and Result semantics to the hand-written wrappers, but
+# the scalar out-param holder is cached per instance instead of constructed
+# per call. Installed from the bottom of headset.py when this module exists;
+# result_fn is headset.py's _result helper, so idle-state polling returns the
+# interned Results instead of allocating one per call.
+
+
+def install(headset_cls, result_fn, capi):
+'''
+
+
+def method_source(method, capi_fn, holder):
+    # The capi function is looked up at call time, not captured as a default
+    # argument: capturing it at install time would force the lazily bound
+    # function table to materialize on import, undoing the lazy-import win.
+    attr = HOLDER_ATTR[holder]
+    return (
+        "    def {m}(self, _capi=capi, _result=result_fn):\n"
+        "        try:\n"
+        "            b = self.{a}\n"
+        "        except AttributeError:\n"
+        "            b = self.{a} = _capi.{h}({i})\n"
+        "        err = _capi.{f}(self._headset, b)\n"
+        "        return _result(b.val, err)\n"
+        "\n"
+        '    {m}.__doc__ = getattr(headset_cls.{m}, "__doc__", None)\n'
+        "    headset_cls.{m} = {m}\n"
+    ).format(
+        m=method,
+        f=capi_fn,
+        h=holder,
+        a=attr,
+        i="False" if holder == "Bool" else "",
+    )
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("usage: gen_fastpaths.py <bindings.cpp> <output.py>")
+    bindings_path, output_path = sys.argv[1], sys.argv[2]
+
+    with open(bindings_path) as f:
+        bound = set(re.findall(r'"(Headset_[A-Za-z0-9_]+)"', f.read()))
+    missing = [fn for _, fn, _ in SPEC if fn not in bound]
+    if missing:
+        sys.exit(
+            "gen_fastpaths.py: spec entries not found in {}: {}\n"
+            "(binding renamed or removed? update SPEC)".format(
+                bindings_path, ", ".join(missing)
+            )
+        )
+
+    parts = [HEADER]
+    for method, capi_fn, holder in SPEC:
+        parts.append(method_source(method, capi_fn, holder))
+        parts.append("\n")
+    with open(output_path, "w") as f:
+        f.write("".join(parts[:-1]))
+
+
+if __name__ == "__main__":
+    main()
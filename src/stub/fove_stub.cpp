@@ -0,0 +1,1140 @@
+// Loopback stub implementation of the libFoveClient surface used by the
+// bindings, for hardware-free benchmarking, load testing and development.
+//
+// Every function the bindings call is implemented against a local, fully
+// deterministic 120 Hz signal generator: gaze vectors sweep sinusoidally,
+// pupil radii breathe, blinks fire every 4 s, the head pose follows a slow
+// circle, and the eye/position images are generated 64x32 BMP gradients.
+// No IPC, no hardware, no nondeterminism.
+//
+// Selection: the module links libFoveClient.so by soname, so the stub is
+// selected per process at load time without rebuilding:
+//
+//     LD_PRELOAD=$PWD/libfove_stub.so python3 my_benchmark.py
+//
+// or link the module against the stub outright with -DFOVE_PYTHON_USE_STUB=ON.
+
+#define FOVE_DEFINE_CXX_API 0
+#define FOVE_CXX_NAMESPACE SHOULD_CAUSE_SYNTAX_ERROR_WHEN_USED !
+#define FOVE_EXTERN_C extern "C"
+#define FOVE_ENUM(enumName) enum class Fove_##enumName
+#define FOVE_ENUM_VAL(enumName, valueName) valueName
+#define FOVE_ENUM_END(enumName) ;
+#define FOVE_STRUCT(structName) struct Fove_##structName
+#define FOVE_STRUCT_VAL(memberName, defaultVal) memberName;
+#define FOVE_STRUCT_END(structName) ;
+#define FOVE_STRUCT_END_NO_CXX_ALIAS(structName) ;
+#include <FoveAPI.h>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+constexpr double pi = 3.14159265358979323846;
+constexpr uint64_t framePeriodUs = 8333; // 120 Hz
+
+// Monotonic microseconds since process start; the one clock all signals derive from
+uint64_t nowUs()
+{
+	static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+Fove_Vec3 normalized(const float x, const float y, const float z)
+{
+	const float inv = 1.0f / std::sqrt(x * x + y * y + z * z);
+	return Fove_Vec3{x * inv, y * inv, z * inv};
+}
+
+// Deterministic gaze sweep; eye: 0 = left, 1 = right, 2 = combined
+Fove_Vec3 gazeAt(const double t, const int eye)
+{
+	const double phase = eye == 1 ? 0.08 : 0.0;
+	const float x = static_cast<float>(0.35 * std::sin(2 * pi * 0.23 * t + phase));
+	const float y = static_cast<float>(0.25 * std::sin(2 * pi * 0.31 * t));
+	return normalized(x, y, 1.0f);
+}
+
+// Blink window: 150 ms every 4 s, offset per eye so they are not synchronized
+bool blinkingAt(const double t, const int eye)
+{
+	return std::fmod(t + (eye == 1 ? 0.5 : 0.0), 4.0) < 0.15;
+}
+
+int blinkCountAt(const double t, const int eye)
+{
+	return static_cast<int>((t + (eye == 1 ? 0.5 : 0.0)) / 4.0);
+}
+
+// The state behind one headset handle
+struct StubHeadset
+{
+	Fove_ClientCapabilities capabilities;
+	Fove_ClientCapabilities passiveCapabilities = static_cast<Fove_ClientCapabilities>(0);
+	uint64_t lastWaitedFrame = 0;
+	Fove_FrameTimestamp eyeFrame = {};      // set by fetchEyeTrackingData
+	Fove_FrameTimestamp poseFrame = {};     // set by fetchPoseData
+	Fove_FrameTimestamp eyesImageFrame = {};
+	Fove_FrameTimestamp positionImageFrame = {};
+	std::vector<unsigned char> eyesImage;
+	std::vector<unsigned char> positionImage;
+	std::set<int> gazableObjects;
+	std::set<int> cameraObjects;
+	std::string currentProfile = "default";
+	std::set<std::string> profiles{"default"};
+	std::mutex mutex;
+
+	explicit StubHeadset(const Fove_ClientCapabilities caps)
+	    : capabilities(caps) {}
+};
+
+struct StubCompositor
+{
+	StubHeadset* headset;
+	int nextLayerId = 0;
+
+	explicit StubCompositor(StubHeadset* const owner)
+	    : headset(owner) {}
+};
+
+StubHeadset* asStub(Fove_Headset* const handle) { return reinterpret_cast<StubHeadset*>(handle); }
+StubCompositor* asStub(Fove_Compositor* const handle) { return reinterpret_cast<StubCompositor*>(handle); }
+
+Fove_FrameTimestamp frameNow()
+{
+	const uint64_t us = nowUs();
+	return Fove_FrameTimestamp{us / framePeriodUs, us};
+}
+
+Fove_Pose poseAt(const double t)
+{
+	Fove_Pose pose = {};
+	pose.id = nowUs() / framePeriodUs;
+	pose.timestamp = nowUs();
+	const double yaw = 0.5 * std::sin(2 * pi * 0.05 * t);
+	pose.orientation = Fove_Quaternion{0, static_cast<float>(std::sin(yaw / 2)), 0, static_cast<float>(std::cos(yaw / 2))};
+	pose.position = Fove_Vec3{static_cast<float>(0.1 * std::sin(2 * pi * 0.02 * t)), 1.6f,
+							  static_cast<float>(0.1 * std::cos(2 * pi * 0.02 * t))};
+	pose.standingPosition = pose.position;
+	pose.velocity = Fove_Vec3{static_cast<float>(0.1 * 2 * pi * 0.02 * std::cos(2 * pi * 0.02 * t)), 0,
+							  static_cast<float>(-0.1 * 2 * pi * 0.02 * std::sin(2 * pi * 0.02 * t))};
+	return pose;
+}
+
+// Regenerates a 24-bit 64x32 BMP with a time-varying gradient into `out`
+void generateBmp(std::vector<unsigned char>& out, const double t)
+{
+	constexpr int width = 64;
+	constexpr int height = 32;
+	constexpr int rowStride = width * 3; // already a multiple of 4
+	constexpr uint32_t dataSize = rowStride * height;
+	constexpr uint32_t fileSize = 54 + dataSize;
+
+	out.resize(fileSize);
+	unsigned char* const p = out.data();
+	memset(p, 0, 54);
+	p[0] = 'B';
+	p[1] = 'M';
+	const uint32_t size32 = fileSize;
+	memcpy(p + 2, &size32, 4);
+	const uint32_t offset = 54;
+	memcpy(p + 10, &offset, 4);
+	const uint32_t infoSize = 40;
+	memcpy(p + 14, &infoSize, 4);
+	const int32_t w = width, h = height;
+	memcpy(p + 18, &w, 4);
+	memcpy(p + 22, &h, 4);
+	const uint16_t planes = 1, bits = 24;
+	memcpy(p + 26, &planes, 2);
+	memcpy(p + 28, &bits, 2);
+	memcpy(p + 34, &dataSize, 4);
+
+	const int shift = static_cast<int>(t * 120.0) % width;
+	for (int y = 0; y < height; ++y)
+	{
+		unsigned char* const row = p + 54 + y * rowStride;
+		for (int x = 0; x < width; ++x)
+		{
+			const unsigned char v = static_cast<unsigned char>(((x + shift) % width) * 255 / (width - 1));
+			row[3 * x + 0] = v;
+			row[3 * x + 1] = static_cast<unsigned char>(y * 255 / (height - 1));
+			row[3 * x + 2] = v;
+		}
+	}
+}
+
+// Process-wide config store backing the fove_Config_* functions
+std::mutex configMutex;
+std::map<std::string, bool> configBools;
+std::map<std::string, int> configInts;
+std::map<std::string, float> configFloats;
+std::map<std::string, std::string> configStrings;
+
+constexpr Fove_ErrorCode ok = Fove_ErrorCode::None;
+
+} // namespace
+
+// ---- Module-level functions -------------------------------------------------
+
+FOVE_EXPORT Fove_ErrorCode fove_logText(Fove_LogLevel, const char* utf8Text) FOVE_NOEXCEPT
+{
+	return utf8Text ? ok : Fove_ErrorCode::API_InvalidArgument;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_createHeadset(Fove_ClientCapabilities capabilities, Fove_Headset** outHeadset) FOVE_NOEXCEPT
+{
+	if (!outHeadset)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*outHeadset = reinterpret_cast<Fove_Headset*>(new StubHeadset(capabilities));
+	return ok;
+}
+
+// ---- Headset ----------------------------------------------------------------
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_destroy(Fove_Headset* headset) FOVE_NOEXCEPT
+{
+	delete asStub(headset);
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_isHardwareConnected(Fove_Headset*, bool* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = true;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_isMotionReady(Fove_Headset*, bool* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = true;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_checkSoftwareVersions(Fove_Headset*) FOVE_NOEXCEPT
+{
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_querySoftwareVersions(Fove_Headset*, Fove_Versions* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	memset(out, 0, sizeof(*out));
+	out->clientMajor = 1;
+	out->clientMinor = 4;
+	out->clientBuild = 0;
+	out->runtimeMajor = 1;
+	out->runtimeMinor = 4;
+	out->runtimeBuild = 0;
+	out->clientProtocol = 1;
+	strncpy(out->clientHash, "stub", sizeof(out->clientHash) - 1);
+	strncpy(out->runtimeHash, "stub", sizeof(out->runtimeHash) - 1);
+	out->firmware = 1;
+	out->maxFirmware = 1;
+	out->minFirmware = 1;
+	out->tooOldHeadsetConnected = false;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_queryLicenses(Fove_Headset*, Fove_LicenseInfo*, size_t* inOutArraySize) FOVE_NOEXCEPT
+{
+	if (!inOutArraySize)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*inOutArraySize = 0; // the stub has no licenses; every feature is accessible
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_queryHardwareInfo(Fove_Headset*, Fove_HeadsetHardwareInfo* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	memset(out, 0, sizeof(*out));
+	strncpy(out->serialNumber, "FOVE-STUB-0000", sizeof(out->serialNumber) - 1);
+	strncpy(out->manufacturer, "FOVE", sizeof(out->manufacturer) - 1);
+	strncpy(out->modelName, "Loopback Stub", sizeof(out->modelName) - 1);
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_registerCapabilities(Fove_Headset* headset, Fove_ClientCapabilities caps) FOVE_NOEXCEPT
+{
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	stub->capabilities = static_cast<Fove_ClientCapabilities>(static_cast<int>(stub->capabilities) | static_cast<int>(caps));
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_unregisterCapabilities(Fove_Headset* headset, Fove_ClientCapabilities caps) FOVE_NOEXCEPT
+{
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	stub->capabilities = static_cast<Fove_ClientCapabilities>(static_cast<int>(stub->capabilities) & ~static_cast<int>(caps));
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_registerPassiveCapabilities(Fove_Headset* headset, Fove_ClientCapabilities caps) FOVE_NOEXCEPT
+{
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	stub->passiveCapabilities = static_cast<Fove_ClientCapabilities>(static_cast<int>(stub->passiveCapabilities) | static_cast<int>(caps));
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_unregisterPassiveCapabilities(Fove_Headset* headset, Fove_ClientCapabilities caps) FOVE_NOEXCEPT
+{
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	stub->passiveCapabilities = static_cast<Fove_ClientCapabilities>(static_cast<int>(stub->passiveCapabilities) & ~static_cast<int>(caps));
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_waitForProcessedEyeFrame(Fove_Headset* headset) FOVE_NOEXCEPT
+{
+	// Blocks until the next 120 Hz tick after the last one this headset waited on,
+	// so pump loops run at the same cadence they would against the runtime
+	StubHeadset* const stub = asStub(headset);
+	uint64_t target;
+	{
+		std::lock_guard<std::mutex> lock(stub->mutex);
+		const uint64_t current = nowUs() / framePeriodUs;
+		target = current <= stub->lastWaitedFrame ? stub->lastWaitedFrame + 1 : current;
+		stub->lastWaitedFrame = target;
+	}
+	const uint64_t targetUs = target * framePeriodUs;
+	const uint64_t now = nowUs();
+	if (targetUs > now)
+		std::this_thread::sleep_for(std::chrono::microseconds(targetUs - now));
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_fetchEyeTrackingData(Fove_Headset* headset, Fove_FrameTimestamp* outTimestamp) FOVE_NOEXCEPT
+{
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	stub->eyeFrame = frameNow();
+	if (outTimestamp)
+		*outTimestamp = stub->eyeFrame;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_fetchPoseData(Fove_Headset* headset, Fove_FrameTimestamp* outTimestamp) FOVE_NOEXCEPT
+{
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	stub->poseFrame = frameNow();
+	if (outTimestamp)
+		*outTimestamp = stub->poseFrame;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_fetchEyesImage(Fove_Headset* headset, Fove_FrameTimestamp* outTimestamp) FOVE_NOEXCEPT
+{
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	stub->eyesImageFrame = frameNow();
+	generateBmp(stub->eyesImage, stub->eyesImageFrame.timestamp * 1e-6);
+	if (outTimestamp)
+		*outTimestamp = stub->eyesImageFrame;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_fetchPositionImage(Fove_Headset* headset, Fove_FrameTimestamp* outTimestamp) FOVE_NOEXCEPT
+{
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	stub->positionImageFrame = frameNow();
+	generateBmp(stub->positionImage, stub->positionImageFrame.timestamp * 1e-6);
+	if (outTimestamp)
+		*outTimestamp = stub->positionImageFrame;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getEyeTrackingDataTimestamp(Fove_Headset* headset, Fove_FrameTimestamp* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	*out = stub->eyeFrame;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getPoseDataTimestamp(Fove_Headset* headset, Fove_FrameTimestamp* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	*out = stub->poseFrame;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getEyesImageTimestamp(Fove_Headset* headset, Fove_FrameTimestamp* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	*out = stub->eyesImageFrame;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getPositionImageTimestamp(Fove_Headset* headset, Fove_FrameTimestamp* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	*out = stub->positionImageFrame;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getGazeVector(Fove_Headset*, Fove_Eye eye, Fove_Vec3* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = gazeAt(nowUs() * 1e-6, eye == Fove_Eye::Right ? 1 : 0);
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getGazeVectorRaw(Fove_Headset*, Fove_Eye eye, Fove_Vec3* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	// Same sweep plus deterministic high-frequency "sensor noise"
+	const double t = nowUs() * 1e-6;
+	Fove_Vec3 v = gazeAt(t, eye == Fove_Eye::Right ? 1 : 0);
+	v.x += static_cast<float>(0.01 * std::sin(2 * pi * 17.0 * t));
+	v.y += static_cast<float>(0.01 * std::sin(2 * pi * 19.0 * t));
+	*out = normalized(v.x, v.y, v.z);
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getGazeScreenPosition(Fove_Headset*, Fove_Eye eye, Fove_Vec2* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	const Fove_Vec3 gaze = gazeAt(nowUs() * 1e-6, eye == Fove_Eye::Right ? 1 : 0);
+	*out = Fove_Vec2{gaze.x / gaze.z, gaze.y / gaze.z};
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getGazeScreenPositionCombined(Fove_Headset*, Fove_Vec2* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	const Fove_Vec3 gaze = gazeAt(nowUs() * 1e-6, 2);
+	*out = Fove_Vec2{gaze.x / gaze.z, gaze.y / gaze.z};
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getCombinedGazeRay(Fove_Headset*, Fove_Ray* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	out->origin = Fove_Vec3{0, 0, 0};
+	out->direction = gazeAt(nowUs() * 1e-6, 2);
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getCombinedGazeDepth(Fove_Headset*, float* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = static_cast<float>(1.5 + 0.5 * std::sin(2 * pi * 0.11 * nowUs() * 1e-6));
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_isUserShiftingAttention(Fove_Headset*, bool* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = false;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getEyeState(Fove_Headset*, Fove_Eye eye, Fove_EyeState* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = blinkingAt(nowUs() * 1e-6, eye == Fove_Eye::Right ? 1 : 0) ? Fove_EyeState::Closed : Fove_EyeState::Opened;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_isEyeBlinking(Fove_Headset*, Fove_Eye eye, bool* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = blinkingAt(nowUs() * 1e-6, eye == Fove_Eye::Right ? 1 : 0);
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getEyeBlinkCount(Fove_Headset*, Fove_Eye eye, int* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = blinkCountAt(nowUs() * 1e-6, eye == Fove_Eye::Right ? 1 : 0);
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_isEyeTrackingEnabled(Fove_Headset*, bool* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = true;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_isEyeTrackingCalibrated(Fove_Headset*, bool* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = true;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_isEyeTrackingCalibrating(Fove_Headset*, bool* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = false;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_isEyeTrackingCalibratedForGlasses(Fove_Headset*, bool* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = false;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_isHmdAdjustmentGuiVisible(Fove_Headset*, bool* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = false;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_hasHmdAdjustmentGuiTimeout(Fove_Headset*, bool* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = false;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_isEyeTrackingReady(Fove_Headset*, bool* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = true;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_isUserPresent(Fove_Headset*, bool* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = true;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getEyesImage(Fove_Headset* headset, Fove_BitmapImage* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	if (stub->eyesImage.empty())
+		generateBmp(stub->eyesImage, nowUs() * 1e-6);
+	out->timestamp = stub->eyesImageFrame.timestamp;
+	out->image = Fove_Buffer{stub->eyesImage.data(), stub->eyesImage.size()};
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getPositionImage(Fove_Headset* headset, Fove_BitmapImage* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	if (stub->positionImage.empty())
+		generateBmp(stub->positionImage, nowUs() * 1e-6);
+	out->timestamp = stub->positionImageFrame.timestamp;
+	out->image = Fove_Buffer{stub->positionImage.data(), stub->positionImage.size()};
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getUserIPD(Fove_Headset*, float* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = 0.063f;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getUserIOD(Fove_Headset*, float* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = 0.063f;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getRenderIOD(Fove_Headset*, float* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = 0.063f;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getPupilRadius(Fove_Headset*, Fove_Eye, float* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = static_cast<float>(0.0025 + 0.0005 * std::sin(2 * pi * 0.1 * nowUs() * 1e-6));
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getIrisRadius(Fove_Headset*, Fove_Eye, float* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = 0.006f;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getEyeballRadius(Fove_Headset*, Fove_Eye, float* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = 0.012f;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getEyeTorsion(Fove_Headset*, Fove_Eye, float* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = static_cast<float>(0.02 * std::sin(2 * pi * 0.07 * nowUs() * 1e-6));
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getEyeShape(Fove_Headset*, Fove_Eye eye, Fove_EyeShape* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	// An ellipse of 12 points around the eye center in (synthetic) image coordinates
+	const float centerX = eye == Fove_Eye::Right ? 96.0f : 32.0f;
+	for (int i = 0; i < 12; ++i)
+	{
+		const double angle = 2 * pi * i / 12;
+		out->outline[i] = Fove_Vec2{centerX + 14.0f * static_cast<float>(std::cos(angle)),
+									16.0f + 7.0f * static_cast<float>(std::sin(angle))};
+	}
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getPupilShape(Fove_Headset*, Fove_Eye eye, Fove_PupilShape* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	out->center = Fove_Vec2{eye == Fove_Eye::Right ? 96.0f : 32.0f, 16.0f};
+	const float size = static_cast<float>(5.0 + std::sin(2 * pi * 0.1 * nowUs() * 1e-6));
+	out->size = Fove_Vec2{size, size};
+	out->angle = 0;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_startEyeTrackingCalibration(Fove_Headset*, const Fove_CalibrationOptions*) FOVE_NOEXCEPT
+{
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_stopEyeTrackingCalibration(Fove_Headset*) FOVE_NOEXCEPT
+{
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getEyeTrackingCalibrationState(Fove_Headset*, Fove_CalibrationState* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = Fove_CalibrationState::Successful_HighQuality;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_tickEyeTrackingCalibration(Fove_Headset*, float, bool, void(FOVE_CALLBACK* callback)(const Fove_CalibrationData*, void*), void* callbackData) FOVE_NOEXCEPT
+{
+	if (callback)
+	{
+		Fove_CalibrationData data = {};
+		data.state = Fove_CalibrationState::Successful_HighQuality;
+		callback(&data, callbackData);
+	}
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getEyeTrackingCalibrationStateDetails(Fove_Headset*, void(FOVE_CALLBACK* callback)(const Fove_CalibrationData*, void*), void* callbackData) FOVE_NOEXCEPT
+{
+	if (callback)
+	{
+		Fove_CalibrationData data = {};
+		data.state = Fove_CalibrationState::Successful_HighQuality;
+		callback(&data, callbackData);
+	}
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_startHmdAdjustmentProcess(Fove_Headset*, bool) FOVE_NOEXCEPT
+{
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_tickHmdAdjustmentProcess(Fove_Headset*, float, bool, Fove_HmdAdjustmentData* outData) FOVE_NOEXCEPT
+{
+	if (outData)
+		memset(outData, 0, sizeof(*outData)); // perfectly adjusted
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getGazedObjectId(Fove_Headset*, int* const out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = fove_ObjectIdInvalid; // the stub performs no scene raycasts
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_registerGazableObject(Fove_Headset* headset, const Fove_GazableObject* object) FOVE_NOEXCEPT
+{
+	if (!object)
+		return Fove_ErrorCode::API_NullInPointer;
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	stub->gazableObjects.insert(object->id);
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_updateGazableObject(Fove_Headset* headset, int objectId, const Fove_ObjectPose* pose) FOVE_NOEXCEPT
+{
+	if (!pose)
+		return Fove_ErrorCode::API_NullInPointer;
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	return stub->gazableObjects.count(objectId) ? ok : Fove_ErrorCode::API_InvalidArgument;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_removeGazableObject(Fove_Headset* headset, int objectId) FOVE_NOEXCEPT
+{
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	return stub->gazableObjects.erase(objectId) ? ok : Fove_ErrorCode::API_InvalidArgument;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_registerCameraObject(Fove_Headset* headset, const Fove_CameraObject* camera) FOVE_NOEXCEPT
+{
+	if (!camera)
+		return Fove_ErrorCode::API_NullInPointer;
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	stub->cameraObjects.insert(camera->id);
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_updateCameraObject(Fove_Headset* headset, int cameraId, const Fove_ObjectPose* pose) FOVE_NOEXCEPT
+{
+	if (!pose)
+		return Fove_ErrorCode::API_NullInPointer;
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	return stub->cameraObjects.count(cameraId) ? ok : Fove_ErrorCode::API_InvalidArgument;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_removeCameraObject(Fove_Headset* headset, int cameraId) FOVE_NOEXCEPT
+{
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	return stub->cameraObjects.erase(cameraId) ? ok : Fove_ErrorCode::API_InvalidArgument;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_tareOrientationSensor(Fove_Headset*) FOVE_NOEXCEPT
+{
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_isPositionReady(Fove_Headset*, bool* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = true;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_tarePositionSensors(Fove_Headset*) FOVE_NOEXCEPT
+{
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getPose(Fove_Headset*, Fove_Pose* out) FOVE_NOEXCEPT
+{
+	if (!out)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*out = poseAt(nowUs() * 1e-6);
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getProjectionMatricesLH(Fove_Headset*, float zNear, float zFar, Fove_Matrix44* outLeft, Fove_Matrix44* outRight) FOVE_NOEXCEPT
+{
+	if (!outLeft && !outRight)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	Fove_Matrix44 proj = {};
+	proj.mat[0][0] = 1;
+	proj.mat[1][1] = 1;
+	proj.mat[2][2] = zFar / (zFar - zNear);
+	proj.mat[2][3] = -zNear * zFar / (zFar - zNear);
+	proj.mat[3][2] = 1;
+	if (outLeft)
+		*outLeft = proj;
+	if (outRight)
+		*outRight = proj;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getProjectionMatricesRH(Fove_Headset*, float zNear, float zFar, Fove_Matrix44* outLeft, Fove_Matrix44* outRight) FOVE_NOEXCEPT
+{
+	if (!outLeft && !outRight)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	Fove_Matrix44 proj = {};
+	proj.mat[0][0] = 1;
+	proj.mat[1][1] = 1;
+	proj.mat[2][2] = zFar / (zNear - zFar);
+	proj.mat[2][3] = zNear * zFar / (zNear - zFar);
+	proj.mat[3][2] = -1;
+	if (outLeft)
+		*outLeft = proj;
+	if (outRight)
+		*outRight = proj;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getRawProjectionValues(Fove_Headset*, Fove_ProjectionParams* outLeft, Fove_ProjectionParams* outRight) FOVE_NOEXCEPT
+{
+	if (!outLeft && !outRight)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	const Fove_ProjectionParams params = {-1, 1, 1, -1};
+	if (outLeft)
+		*outLeft = params;
+	if (outRight)
+		*outRight = params;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_getEyeToHeadMatrices(Fove_Headset*, Fove_Matrix44* outLeft, Fove_Matrix44* outRight) FOVE_NOEXCEPT
+{
+	if (!outLeft && !outRight)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	constexpr float halfIod = 0.063f / 2;
+	Fove_Matrix44 mat = {};
+	mat.mat[0][0] = mat.mat[1][1] = mat.mat[2][2] = mat.mat[3][3] = 1;
+	if (outLeft)
+	{
+		*outLeft = mat;
+		outLeft->mat[0][3] = -halfIod;
+	}
+	if (outRight)
+	{
+		*outRight = mat;
+		outRight->mat[0][3] = halfIod;
+	}
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_createCompositor(Fove_Headset* headset, Fove_Compositor** outCompositor) FOVE_NOEXCEPT
+{
+	if (!outCompositor)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*outCompositor = reinterpret_cast<Fove_Compositor*>(new StubCompositor(asStub(headset)));
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_hasAccessToFeature(Fove_Headset*, const char* inFeatureName, bool* outHasAccess) FOVE_NOEXCEPT
+{
+	if (!inFeatureName)
+		return Fove_ErrorCode::API_NullInPointer;
+	if (!outHasAccess)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*outHasAccess = true; // the stub gates nothing
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_activateLicense(Fove_Headset*, const char* licenseKey) FOVE_NOEXCEPT
+{
+	return licenseKey ? ok : Fove_ErrorCode::API_NullInPointer;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_deactivateLicense(Fove_Headset*, const char* licenseData) FOVE_NOEXCEPT
+{
+	return licenseData ? ok : Fove_ErrorCode::API_NullInPointer;
+}
+
+// ---- Profiles ---------------------------------------------------------------
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_createProfile(Fove_Headset* headset, const char* newName) FOVE_NOEXCEPT
+{
+	if (!newName)
+		return Fove_ErrorCode::API_NullInPointer;
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	return stub->profiles.insert(newName).second ? ok : Fove_ErrorCode::Profile_InvalidName;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_renameProfile(Fove_Headset* headset, const char* oldName, const char* newName) FOVE_NOEXCEPT
+{
+	if (!oldName || !newName)
+		return Fove_ErrorCode::API_NullInPointer;
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	if (!stub->profiles.erase(oldName))
+		return Fove_ErrorCode::Profile_DoesntExist;
+	stub->profiles.insert(newName);
+	if (stub->currentProfile == oldName)
+		stub->currentProfile = newName;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_deleteProfile(Fove_Headset* headset, const char* profileName) FOVE_NOEXCEPT
+{
+	if (!profileName)
+		return Fove_ErrorCode::API_NullInPointer;
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	return stub->profiles.erase(profileName) ? ok : Fove_ErrorCode::Profile_DoesntExist;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_listProfiles(Fove_Headset* headset, void(FOVE_CALLBACK* callback)(const char*, void*), void* callbackData) FOVE_NOEXCEPT
+{
+	if (!callback)
+		return Fove_ErrorCode::API_NullInPointer;
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	for (const std::string& name : stub->profiles)
+		callback(name.c_str(), callbackData);
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_setCurrentProfile(Fove_Headset* headset, const char* profileName) FOVE_NOEXCEPT
+{
+	if (!profileName)
+		return Fove_ErrorCode::API_NullInPointer;
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	if (!stub->profiles.count(profileName))
+		return Fove_ErrorCode::Profile_DoesntExist;
+	stub->currentProfile = profileName;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_queryCurrentProfile(Fove_Headset* headset, void(FOVE_CALLBACK* callback)(const char*, void*), void* callbackData) FOVE_NOEXCEPT
+{
+	if (!callback)
+		return Fove_ErrorCode::API_NullInPointer;
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	callback(stub->currentProfile.c_str(), callbackData);
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Headset_queryProfileDataPath(Fove_Headset* headset, const char* profileName, void(FOVE_CALLBACK* callback)(const char*, void*), void* callbackData) FOVE_NOEXCEPT
+{
+	if (!profileName || !callback)
+		return Fove_ErrorCode::API_NullInPointer;
+	StubHeadset* const stub = asStub(headset);
+	std::lock_guard<std::mutex> lock(stub->mutex);
+	if (!stub->profiles.count(profileName))
+		return Fove_ErrorCode::Profile_DoesntExist;
+	const std::string path = std::string("/tmp/fove_stub/profiles/") + profileName;
+	callback(path.c_str(), callbackData);
+	return ok;
+}
+
+// ---- Compositor -------------------------------------------------------------
+
+FOVE_EXPORT Fove_ErrorCode fove_Compositor_destroy(Fove_Compositor* compositor) FOVE_NOEXCEPT
+{
+	delete asStub(compositor);
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Compositor_createLayer(Fove_Compositor* compositor, const Fove_CompositorLayerCreateInfo* layerInfo, Fove_CompositorLayer* outLayer) FOVE_NOEXCEPT
+{
+	if (!layerInfo)
+		return Fove_ErrorCode::API_NullInPointer;
+	if (!outLayer)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	StubCompositor* const stub = asStub(compositor);
+	memset(outLayer, 0, sizeof(*outLayer));
+	outLayer->layerId = stub->nextLayerId++;
+	outLayer->idealResolutionPerEye = Fove_Vec2i{1280, 1440};
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Compositor_submit(Fove_Compositor*, const Fove_CompositorLayerSubmitInfo* submitInfo, size_t layerCount) FOVE_NOEXCEPT
+{
+	if (!submitInfo && layerCount > 0)
+		return Fove_ErrorCode::API_NullInPointer;
+	return ok; // nothing is rendered; submission is accepted at any rate
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Compositor_waitForRenderPose(Fove_Compositor*, Fove_Pose* outPose) FOVE_NOEXCEPT
+{
+	if (!outPose)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	// Pace the render loop at the same 120 Hz as the eye frames
+	const uint64_t now = nowUs();
+	const uint64_t next = (now / framePeriodUs + 1) * framePeriodUs;
+	std::this_thread::sleep_for(std::chrono::microseconds(next - now));
+	*outPose = poseAt(nowUs() * 1e-6);
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Compositor_getLastRenderPose(Fove_Compositor*, Fove_Pose* outPose) FOVE_NOEXCEPT
+{
+	if (!outPose)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*outPose = poseAt(nowUs() * 1e-6);
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Compositor_isReady(Fove_Compositor*, bool* outIsReady) FOVE_NOEXCEPT
+{
+	if (!outIsReady)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	*outIsReady = true;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Compositor_queryAdapterId(Fove_Compositor*, Fove_AdapterId* outAdapterId) FOVE_NOEXCEPT
+{
+	if (!outAdapterId)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	memset(outAdapterId, 0, sizeof(*outAdapterId));
+	return ok;
+}
+
+// ---- Config -----------------------------------------------------------------
+
+FOVE_EXPORT Fove_ErrorCode fove_Config_getValue_bool(const char* key, bool* outValue) FOVE_NOEXCEPT
+{
+	if (!key)
+		return Fove_ErrorCode::API_NullInPointer;
+	if (!outValue)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	std::lock_guard<std::mutex> lock(configMutex);
+	const auto it = configBools.find(key);
+	if (it == configBools.end())
+		return Fove_ErrorCode::Config_DoesntExist;
+	*outValue = it->second;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Config_getValue_int(const char* key, int* outValue) FOVE_NOEXCEPT
+{
+	if (!key)
+		return Fove_ErrorCode::API_NullInPointer;
+	if (!outValue)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	std::lock_guard<std::mutex> lock(configMutex);
+	const auto it = configInts.find(key);
+	if (it == configInts.end())
+		return Fove_ErrorCode::Config_DoesntExist;
+	*outValue = it->second;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Config_getValue_float(const char* key, float* outValue) FOVE_NOEXCEPT
+{
+	if (!key)
+		return Fove_ErrorCode::API_NullInPointer;
+	if (!outValue)
+		return Fove_ErrorCode::API_NullOutPointersOnly;
+	std::lock_guard<std::mutex> lock(configMutex);
+	const auto it = configFloats.find(key);
+	if (it == configFloats.end())
+		return Fove_ErrorCode::Config_DoesntExist;
+	*outValue = it->second;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Config_getValue_string(const char* key, void(FOVE_CALLBACK* callback)(const char*, void*), void* callbackData) FOVE_NOEXCEPT
+{
+	if (!key || !callback)
+		return Fove_ErrorCode::API_NullInPointer;
+	std::lock_guard<std::mutex> lock(configMutex);
+	const auto it = configStrings.find(key);
+	if (it == configStrings.end())
+		return Fove_ErrorCode::Config_DoesntExist;
+	callback(it->second.c_str(), callbackData);
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Config_setValue_bool(const char* key, bool value) FOVE_NOEXCEPT
+{
+	if (!key)
+		return Fove_ErrorCode::API_NullInPointer;
+	std::lock_guard<std::mutex> lock(configMutex);
+	configBools[key] = value;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Config_setValue_int(const char* key, int value) FOVE_NOEXCEPT
+{
+	if (!key)
+		return Fove_ErrorCode::API_NullInPointer;
+	std::lock_guard<std::mutex> lock(configMutex);
+	configInts[key] = value;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Config_setValue_float(const char* key, float value) FOVE_NOEXCEPT
+{
+	if (!key)
+		return Fove_ErrorCode::API_NullInPointer;
+	std::lock_guard<std::mutex> lock(configMutex);
+	configFloats[key] = value;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Config_setValue_string(const char* key, const char* value) FOVE_NOEXCEPT
+{
+	if (!key || !value)
+		return Fove_ErrorCode::API_NullInPointer;
+	std::lock_guard<std::mutex> lock(configMutex);
+	configStrings[key] = value;
+	return ok;
+}
+
+FOVE_EXPORT Fove_ErrorCode fove_Config_clearValue(const char* key) FOVE_NOEXCEPT
+{
+	if (!key)
+		return Fove_ErrorCode::API_NullInPointer;
+	std::lock_guard<std::mutex> lock(configMutex);
+	const size_t erased = configBools.erase(key) + configInts.erase(key) + configFloats.erase(key) + configStrings.erase(key);
+	return erased ? ok : Fove_ErrorCode::Config_DoesntExist;
+}